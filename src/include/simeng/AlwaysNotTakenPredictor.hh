@@ -16,11 +16,17 @@ class AlwaysNotTakenPredictor : public BranchPredictor {
   /** Provide branch results to update the prediction model for the specified
    * instruction address. As this model is static, this does nothing. */
   void update(uint64_t address, bool taken, uint64_t targetAddress,
-              BranchType type) override;
+              BranchType type, const BranchPrediction& prediction) override;
 
   /** Provide flush logic for branch prediction scheme. As there's no flush
    * logic for an always taken predictor, this does nothing. */
-  void flush(uint64_t address) override;
+  void flush(uint64_t address, BranchType type,
+             const BranchPrediction& prediction) override;
+
+  /** Provide repair logic for branch prediction scheme. As this model holds
+   * no speculative state, this does nothing. */
+  void repair(uint64_t address, bool taken, uint64_t targetAddress,
+              BranchType type, const BranchPrediction& prediction) override;
 };
 
 }  // namespace simeng
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace simeng {
+
+/** A global history of branch directions, held in a circular buffer of bits.
+ * Any number of folded views of the history may be registered; each compresses
+ * the most recent `length` directions into a `width`-bit value by XOR-ing
+ * together consecutive `width`-bit chunks, and is maintained incrementally as
+ * directions are inserted. Folding is linear, so XOR-ing the folded views of
+ * two lengths yields a folded view of the directions between them.
+ *
+ * Directions may be inserted speculatively, as predictions are made, and later
+ * removed by restoring a checkpoint taken before them. Each removal reverses
+ * the update made to every folded view, so checkpoints need only record the
+ * number of directions inserted. */
+class BranchHistory {
+ public:
+  /** The number of most recent insertions which may be removed by restoring a
+   * checkpoint. */
+  static constexpr uint16_t MAX_SPECULATIVE = 1024;
+
+  /** Construct a history able to hold at least `maxLength` directions, in
+   * addition to `MAX_SPECULATIVE` speculatively inserted directions. */
+  BranchHistory(uint16_t maxLength);
+
+  /** Register a folded view of the `length` most recent directions, with a
+   * width of `width` bits. Returns an identifier for the view. */
+  uint16_t addFolded(uint16_t length, uint8_t width);
+
+  /** Retrieve the current value of the folded view `id`. */
+  uint32_t getFolded(uint16_t id) const;
+
+  /** Retrieve the direction inserted `age` insertions ago, where 0 is the most
+   * recent. */
+  bool get(uint16_t age) const;
+
+  /** Retrieve the 64 most recent directions, with the most recent in the least
+   * significant bit. */
+  uint64_t getRecent() const;
+
+  /** Insert the direction of the most recent branch, updating all folded
+   * views. */
+  void push(bool taken);
+
+  /** Retrieve a checkpoint of the current history; the number of directions
+   * inserted so far. */
+  uint64_t getCheckpoint() const;
+
+  /** Remove all directions inserted since `checkpoint` was taken. Returns false
+   * without modifying the history if no directions have been inserted since,
+   * or if too many have been to be removed. */
+  bool restore(uint64_t checkpoint);
+
+ private:
+  /** A folded view of the history. */
+  struct FoldedView {
+    /** The folded history value. */
+    uint32_t value;
+
+    /** The number of directions folded. */
+    uint16_t length;
+
+    /** The width of the folded value in bits. */
+    uint8_t width;
+  };
+
+  /** A circular buffer of directions; sized to a power of two large enough to
+   * hold the longest view plus the direction leaving it, and the directions
+   * which may be removed by restoring a checkpoint. */
+  std::vector<uint8_t> directions_;
+
+  /** The position of the most recent direction in `directions_`. */
+  size_t head_ = 0;
+
+  /** The number of directions inserted. */
+  uint64_t inserted_ = 0;
+
+  /** The 64 most recent directions, with the most recent in the least
+   * significant bit. */
+  uint64_t recent_ = 0;
+
+  /** The registered folded views. */
+  std::vector<FoldedView> folded_;
+};
+
+}  // namespace simeng
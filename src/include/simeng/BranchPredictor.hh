@@ -3,6 +3,8 @@
 #include <cstdint>
 #include <tuple>
 
+#include "simeng/ReturnAddressStack.hh"
+
 namespace simeng {
 
 /** The types of branches recognised. */
@@ -15,6 +17,14 @@ enum class BranchType {
   Unknown
 };
 
+/** Check whether a branch of type `type` with the known target `knownTarget` is
+ * indirect; that is, whether its target is read from a register, other than as
+ * a return. */
+inline bool isIndirectBranch(BranchType type, uint64_t knownTarget) {
+  return knownTarget == 0 && (type == BranchType::Unconditional ||
+                              type == BranchType::SubroutineCall);
+}
+
 /** A branch result prediction for an instruction. */
 struct BranchPrediction {
   /** Whether the branch will be taken. */
@@ -24,7 +34,30 @@ struct BranchPrediction {
    * will be ignored. */
   uint64_t target;
 
-  /** Check for equality of two branch predictions . */
+  /** Predictor-specific state recorded when the prediction was made, such as
+   * the index of the table entry used, and supplied back to the predictor when
+   * the branch is updated. */
+  uint64_t state = 0;
+
+  /** A checkpoint of the predictor's global history taken before this
+   * prediction was made, used to repair the history if the branch is
+   * mispredicted or flushed. */
+  uint64_t historyCheckpoint = 0;
+
+  /** A checkpoint of the predictor's RAS taken before this prediction was
+   * made, used to repair the RAS if the branch is mispredicted or flushed. */
+  ReturnAddressStack::Checkpoint rasCheckpoint;
+
+  /** The identifier of the indirect target prediction made for this branch, or
+   * 0 if it is not an indirect branch. */
+  uint64_t indirectState = 0;
+
+  /** A checkpoint of the indirect target predictor's path history taken before
+   * this prediction was made. */
+  uint64_t indirectCheckpoint = 0;
+
+  /** Check for equality of two branch predictions . Only the direction and
+   * target are compared. */
   bool operator==(const BranchPrediction& other) {
     if ((taken == other.taken) && (target == other.target))
       return true;
@@ -32,7 +65,8 @@ struct BranchPrediction {
       return false;
   }
 
-  /** Check for inequality of two branch predictions . */
+  /** Check for inequality of two branch predictions . Only the direction and
+   * target are compared. */
   bool operator!=(const BranchPrediction& other) {
     if ((taken != other.taken) || (target != other.target))
       return true;
@@ -52,14 +86,26 @@ class BranchPredictor {
                                    uint64_t knownTarget) = 0;
 
   /** Provide branch results to update the prediction model for the specified
-   * instruction address. */
+   * instruction address, using the state recorded in the prediction made for
+   * it. If the branch was mispredicted, any speculative state updated by the
+   * predictions made since is repaired. */
   virtual void update(uint64_t address, bool taken, uint64_t targetAddress,
-                      BranchType type) = 0;
+                      BranchType type, const BranchPrediction& prediction) = 0;
 
   /** Provides flushing behaviour for the implemented branch prediction schemes
-   * via the instruction address.
-   */
-  virtual void flush(uint64_t address) = 0;
+   * via the instruction address, branch type, and the prediction made for it.
+   * Flushed branches are supplied youngest first, so that speculative state
+   * may be repaired to that before the oldest. */
+  virtual void flush(uint64_t address, BranchType type,
+                     const BranchPrediction& prediction) = 0;
+
+  /** Repair the speculative state updated by the predictions made since the
+   * branch at `address`, which was found to be mispredicted before execution,
+   * applying its corrected outcome in their place. No tables are trained; the
+   * branch is updated once executed, with a prediction amended to the
+   * corrected outcome. */
+  virtual void repair(uint64_t address, bool taken, uint64_t targetAddress,
+                      BranchType type, const BranchPrediction& prediction) = 0;
 };
 
 }  // namespace simeng
\ No newline at end of file
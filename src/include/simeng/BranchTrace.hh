@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "simeng/BranchPredictor.hh"
+
+namespace simeng {
+
+/** A retired branch held in a branch trace. */
+struct BranchTraceRecord {
+  /** The number of instructions retired up to and including this branch. */
+  uint64_t instruction = 0;
+
+  /** The address of the branch instruction. */
+  uint64_t address = 0;
+
+  /** The type of the branch. */
+  BranchType type = BranchType::Unknown;
+
+  /** Whether the branch was taken. */
+  bool taken = false;
+
+  /** The address execution continued from after the branch. */
+  uint64_t target = 0;
+
+  /** The branch target offset known from the instruction's encoding, or 0 if
+   * not known; as supplied to `BranchPredictor::predict`. */
+  uint64_t knownTarget = 0;
+};
+
+/** The layout of a branch trace file. A file begins with the four characters
+ * "SEBT" and a 32-bit format version, followed by one fixed-size record per
+ * retired branch. Each record holds, in host byte order:
+ *
+ * - A 32-bit count of the instructions retired since the previous branch.
+ * - The 64-bit branch address.
+ * - The 64-bit address execution continued from.
+ * - The 32-bit signed known target offset.
+ * - An 8-bit field holding the branch type in the low bits, and whether the
+ *   branch was taken in the top bit. */
+namespace branchTraceFormat {
+
+/** The characters identifying a branch trace file. */
+constexpr char MAGIC[4] = {'S', 'E', 'B', 'T'};
+
+/** The format version written to new files. */
+constexpr uint32_t VERSION = 1;
+
+/** The size of the file header in bytes. */
+constexpr size_t HEADER_SIZE = sizeof(MAGIC) + sizeof(uint32_t);
+
+/** The size of a single record in bytes. */
+constexpr size_t RECORD_SIZE = 4 + 8 + 8 + 4 + 1;
+
+/** The number of records buffered between file accesses. */
+constexpr size_t BUFFERED_RECORDS = 1 << 16;
+
+}  // namespace branchTraceFormat
+
+/** Writes retired branches to a binary branch trace file, for later replay
+ * through a branch predictor. */
+class BranchTraceWriter {
+ public:
+  /** Create a branch trace file at `path`, replacing any existing file. */
+  BranchTraceWriter(const std::string& path);
+
+  /** Write any buffered records and close the file. */
+  ~BranchTraceWriter();
+
+  /** Append a retired branch to the trace. Records must be supplied in
+   * retirement order. */
+  void record(const BranchTraceRecord& record);
+
+  /** Retrieve the number of branches recorded. */
+  uint64_t getRecordCount() const;
+
+ private:
+  /** Write the buffered records to the file. */
+  void flushBuffer();
+
+  /** The trace file being written. */
+  std::ofstream file_;
+
+  /** Encoded records awaiting writing. */
+  std::vector<char> buffer_;
+
+  /** The instruction count of the previously recorded branch. */
+  uint64_t lastInstruction_ = 0;
+
+  /** The number of branches recorded. */
+  uint64_t records_ = 0;
+};
+
+/** Reads the retired branches held in a binary branch trace file. */
+class BranchTraceReader {
+ public:
+  /** Open the branch trace file at `path`, and check its header. */
+  BranchTraceReader(const std::string& path);
+
+  /** Read the next branch from the trace into `record`. Returns false once
+   * the end of the trace is reached. */
+  bool next(BranchTraceRecord& record);
+
+ private:
+  /** Refill the buffer from the file. Returns false if no data remains. */
+  bool fill();
+
+  /** The trace file being read. */
+  std::ifstream file_;
+
+  /** Encoded records read from the file. */
+  std::vector<char> buffer_;
+
+  /** The offset of the next unread record within the buffer. */
+  size_t position_ = 0;
+
+  /** The number of valid bytes held in the buffer. */
+  size_t size_ = 0;
+
+  /** The instruction count of the previously read branch. */
+  uint64_t instruction_ = 0;
+};
+
+}  // namespace simeng
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace simeng {
+
+/** A double-ended queue held in a single contiguous ring of storage. The
+ * capacity is fixed at construction and only grows, by doubling, if an element
+ * is pushed while full; in steady state no memory is allocated. */
+template <class T>
+class CircularBuffer {
+ public:
+  /** Construct a buffer able to hold at least `capacity` elements before
+   * growing. */
+  explicit CircularBuffer(size_t capacity = 1) {
+    size_t rounded = 1;
+    while (rounded < capacity) rounded <<= 1;
+    buffer_.resize(rounded);
+    mask_ = rounded - 1;
+  }
+
+  /** Get the number of elements held. */
+  size_t size() const { return size_; }
+
+  /** Query whether the buffer holds no elements. */
+  bool empty() const { return size_ == 0; }
+
+  /** Get the number of elements which may be held before growing. */
+  size_t capacity() const { return buffer_.size(); }
+
+  /** Access the element `index` places from the front of the buffer. */
+  T& operator[](size_t index) {
+    assert(index < size_ && "Attempted to access beyond the buffer's end");
+    return buffer_[(head_ + index) & mask_];
+  }
+  const T& operator[](size_t index) const {
+    assert(index < size_ && "Attempted to access beyond the buffer's end");
+    return buffer_[(head_ + index) & mask_];
+  }
+
+  /** Access the oldest element. */
+  T& front() { return (*this)[0]; }
+
+  /** Access the newest element. */
+  T& back() { return (*this)[size_ - 1]; }
+
+  /** Append an element, growing the storage if the buffer is full. */
+  void push_back(T value) {
+    if (size_ == buffer_.size()) grow();
+    buffer_[(head_ + size_) & mask_] = std::move(value);
+    size_++;
+  }
+
+  /** Remove the oldest element. */
+  void pop_front() {
+    assert(size_ > 0 && "Attempted to pop from an empty buffer");
+    buffer_[head_] = T();
+    head_ = (head_ + 1) & mask_;
+    size_--;
+  }
+
+  /** Remove the newest element. */
+  void pop_back() {
+    assert(size_ > 0 && "Attempted to pop from an empty buffer");
+    size_--;
+    buffer_[(head_ + size_) & mask_] = T();
+  }
+
+  /** Remove all elements satisfying `predicate`, preserving the order of those
+   * which remain. */
+  template <class Predicate>
+  void remove_if(Predicate predicate) {
+    size_t kept = 0;
+    for (size_t i = 0; i < size_; i++) {
+      T& element = (*this)[i];
+      if (predicate(element)) continue;
+      if (kept != i) (*this)[kept] = std::move(element);
+      kept++;
+    }
+    while (size_ > kept) pop_back();
+  }
+
+  /** Remove all elements. */
+  void clear() {
+    while (size_ > 0) pop_back();
+    head_ = 0;
+  }
+
+ private:
+  /** Double the storage capacity, moving the held elements to its start. */
+  void grow() {
+    std::vector<T> larger(buffer_.size() * 2);
+    for (size_t i = 0; i < size_; i++) {
+      larger[i] = std::move((*this)[i]);
+    }
+    buffer_ = std::move(larger);
+    mask_ = buffer_.size() - 1;
+    head_ = 0;
+  }
+
+  /** The ring of element storage; its size is always a power of two. */
+  std::vector<T> buffer_;
+
+  /** A mask mapping positions onto indices within `buffer_`. */
+  size_t mask_;
+
+  /** The index of the oldest element. */
+  size_t head_ = 0;
+
+  /** The number of elements held. */
+  size_t size_ = 0;
+};
+
+}  // namespace simeng
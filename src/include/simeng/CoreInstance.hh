@@ -3,13 +3,16 @@
 #include <string>
 
 #include "simeng/AlwaysNotTakenPredictor.hh"
+#include "simeng/BranchTrace.hh"
 #include "simeng/Core.hh"
 #include "simeng/Elf.hh"
 #include "simeng/FixedLatencyMemoryInterface.hh"
 #include "simeng/FlatMemoryInterface.hh"
 #include "simeng/GenericPredictor.hh"
 #include "simeng/ModelConfig.hh"
+#include "simeng/PerceptronPredictor.hh"
 #include "simeng/SpecialFileDirGen.hh"
+#include "simeng/TagePredictor.hh"
 #include "simeng/arch/Architecture.hh"
 #include "simeng/arch/aarch64/Architecture.hh"
 #include "simeng/arch/aarch64/Instruction.hh"
@@ -140,6 +143,9 @@ class CoreInstance {
   /** Reference to the SimEng branch predictor object. */
   std::unique_ptr<simeng::BranchPredictor> predictor_ = nullptr;
 
+  /** The branch trace retired branches are recorded to, if enabled. */
+  std::unique_ptr<simeng::BranchTraceWriter> branchTrace_ = nullptr;
+
   /** Reference to the SimEng port allocator object. */
   std::unique_ptr<simeng::pipeline::PortAllocator> portAllocator_ = nullptr;
 
@@ -14,6 +14,7 @@ const char Format64 = 2;
 
 struct ElfHeader {
   uint32_t type;
+  uint32_t flags;
   uint64_t offset;
   uint64_t virtualAddress;
   uint64_t physicalAddress;
@@ -30,6 +31,10 @@ class Elf {
   bool isValid() const;
   uint64_t getEntryPoint() const;
 
+  /** Get the loaded segments holding executable code, as (virtual address,
+   * size) pairs. */
+  std::vector<std::pair<uint64_t, uint64_t>> getExecutableRegions() const;
+
  private:
   uint64_t entryPoint_;
   std::vector<ElfHeader> headers_;
@@ -1,10 +1,11 @@
 #pragma once
 
-#include <deque>
-#include <map>
 #include <vector>
 
+#include "simeng/BranchHistory.hh"
 #include "simeng/BranchPredictor.hh"
+#include "simeng/IndirectTargetPredictor.hh"
+#include "simeng/ReturnAddressStack.hh"
 #include "yaml-cpp/yaml.h"
 
 namespace simeng {
@@ -18,6 +19,13 @@ namespace simeng {
  * 2-bit saturating counter.
  *
  * - A Return Address Stack (RAS) is also in use.
+ *
+ * - An indirect target predictor, for branches with targets read from
+ * registers.
+ *
+ * The global history and RAS are updated speculatively as predictions are made,
+ * and repaired from the checkpoints held by a prediction if it is found to be
+ * wrong or is flushed.
  */
 
 class GenericPredictor : public BranchPredictor {
@@ -35,12 +43,25 @@ class GenericPredictor : public BranchPredictor {
   /** Updates appropriate predictor model objects based on the address and
    * outcome of the branch instruction. */
   void update(uint64_t address, bool taken, uint64_t targetAddress,
-              BranchType type) override;
+              BranchType type, const BranchPrediction& prediction) override;
 
-  /** Provides RAS rewinding behaviour. */
-  void flush(uint64_t address) override;
+  /** Repairs the global history and RAS to their state before the flushed
+   * branch was predicted. */
+  void flush(uint64_t address, BranchType type,
+             const BranchPrediction& prediction) override;
+
+  /** Repairs the global history, RAS and indirect path history to their state
+   * before the mispredicted branch was predicted, then applies its corrected
+   * outcome. */
+  void repair(uint64_t address, bool taken, uint64_t targetAddress,
+              BranchType type, const BranchPrediction& prediction) override;
 
  private:
+  /** Repair the global history and RAS to their state before the branch at
+   * `address` was predicted, then apply its outcome `taken`. */
+  void repairHistory(uint64_t address, bool taken, BranchType type,
+                     const BranchPrediction& prediction);
+
   /** The bitlength of the BTB index; BTB will have 2^bits entries. */
   uint64_t btbBits_;
 
@@ -48,29 +69,21 @@ class GenericPredictor : public BranchPredictor {
    * counter and a branch target. */
   std::vector<std::pair<uint8_t, uint64_t>> btb_;
 
-  /** The previous BTB index calculated for an address. */
-  std::map<uint64_t, uint64_t> btbHistory_;
-
   /** The number of bits used to form the saturating counter in a BTB entry. */
   uint64_t satCntBits_;
 
-  /** A n-bit history of previous branch directions where n is equal to
-   * globalHistoryLength_. */
-  uint64_t globalHistory_ = 0;
-
-  /** The number of previous branch directions recorded globally. */
+  /** A mask of the number of previous branch directions used to index the
+   * BTB. */
   uint64_t globalHistoryLength_;
 
-  /** A return address stack. */
-  std::deque<uint64_t> ras_;
+  /** The global history of branch directions. */
+  BranchHistory history_;
 
-  /** RAS history with instruction address as the keys. A non-zero value
-   * represents the target prediction for a return instruction and a 0 entry for
-   * a branch-and-link instruction. */
-  std::map<uint64_t, uint64_t> rasHistory_;
+  /** A return address stack. */
+  ReturnAddressStack ras_;
 
-  /** The size of the RAS. */
-  uint64_t rasSize_;
+  /** A predictor of indirect branch targets. */
+  IndirectTargetPredictor indirect_;
 };
 
 }  // namespace simeng
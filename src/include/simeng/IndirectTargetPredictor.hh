@@ -0,0 +1,149 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "simeng/BranchHistory.hh"
+#include "simeng/BranchPredictor.hh"
+#include "yaml-cpp/yaml.h"
+
+namespace simeng {
+
+/** An ITTAGE-style indirect branch target predictor, used by the branch
+ * predictors to predict the targets of indirect jumps and calls. Targets are
+ * held in a series of partially tagged tables indexed with geometrically
+ * increasing lengths of a path history. The matching table using the longest
+ * history provides the target; where none matches, the target predicted by the
+ * owning predictor's BTB is used.
+ *
+ * The path history records the direction of each predicted branch, and for
+ * indirect branches a bit hashed from their target, so that the history
+ * distinguishes the paths taken through earlier indirect branches. It is
+ * updated speculatively as predictions are made, and repaired from the
+ * checkpoint held by a prediction if it is found to be wrong or is flushed.
+ *
+ * The predictor is disabled if configured with no tables. */
+class IndirectTargetPredictor {
+ public:
+  /** The maximum number of tagged tables supported. */
+  static constexpr uint8_t MAX_TABLES = 16;
+
+  /** The number of predictions whose state is retained for use on update. */
+  static constexpr uint16_t PREDICTION_STATE_ENTRIES = 1024;
+
+  /** Initialise the tables from the `Branch-Predictor` section of `config`,
+   * using default sizes for any options not supplied. */
+  IndirectTargetPredictor(YAML::Node config);
+
+  /** Amend `prediction`, made for the branch at `address`, with a predicted
+   * target if the branch is indirect, recording the state required to update
+   * and repair the predictor within it. The path history is then updated with
+   * the predicted outcome. */
+  void predict(uint64_t address, BranchType type, uint64_t knownTarget,
+               BranchPrediction& prediction);
+
+  /** Train the tables with the resolved target of an indirect branch, and
+   * repair the path history if the branch was mispredicted. */
+  void update(uint64_t address, bool taken, uint64_t targetAddress,
+              const BranchPrediction& prediction);
+
+  /** Repair the path history to its state before the flushed branch was
+   * predicted. */
+  void flush(const BranchPrediction& prediction);
+
+  /** Repair the path history to its state before the mispredicted branch was
+   * predicted, and apply the branch's corrected outcome. */
+  void repair(bool taken, uint64_t targetAddress,
+              const BranchPrediction& prediction);
+
+ private:
+  /** An entry within a tagged table. */
+  struct TaggedEntry {
+    /** Whether this entry has been allocated. */
+    bool valid = false;
+
+    /** The partial tag of the address and history which allocated this
+     * entry. */
+    uint16_t tag = 0;
+
+    /** The predicted target. */
+    uint64_t target = 0;
+
+    /** A saturating counter of the target's recent correct predictions; the
+     * target is replaced when it mispredicts with no confidence. */
+    uint8_t confidence = 0;
+
+    /** Whether this entry has recently provided a correct target where the
+     * alternate prediction would not have. */
+    bool useful = false;
+  };
+
+  /** The table lookups made when predicting a branch, retained for use when
+   * the branch's target is known. */
+  struct PredictionState {
+    /** The identifier of the prediction which recorded this state. */
+    uint64_t id = 0;
+
+    /** The index accessed in each tagged table. */
+    std::array<uint32_t, MAX_TABLES> indices;
+
+    /** The tag compared in each tagged table. */
+    std::array<uint16_t, MAX_TABLES> tags;
+
+    /** The tagged table providing the prediction, or -1 if none matched. */
+    int provider = -1;
+
+    /** The target predicted by the next longest matching table, or by the
+     * BTB. */
+    uint64_t alternateTarget = 0;
+
+    /** The final predicted target. */
+    uint64_t target = 0;
+  };
+
+  /** Retrieve the bit inserted into the path history for a branch; a hash of
+   * the target for indirect branches, otherwise the direction. */
+  static bool getPathBit(bool indirect, bool taken, uint64_t target);
+
+  /** The number of tagged tables. */
+  uint8_t numTables_;
+
+  /** The bitlength of each tagged table's index. */
+  uint8_t tableBits_;
+
+  /** The bitlength of the tags held in tagged table entries. */
+  uint8_t tagBits_;
+
+  /** The tagged tables, ordered by increasing history length. */
+  std::vector<std::vector<TaggedEntry>> tables_;
+
+  /** The length of path history used to index each tagged table. */
+  std::vector<uint16_t> historyLengths_;
+
+  /** The path history. */
+  BranchHistory history_;
+
+  /** The folded history views of the width of each tagged table's index. */
+  std::vector<uint16_t> indexFolds_;
+
+  /** The folded history views of the width of each tagged table's tags. */
+  std::vector<uint16_t> tagFolds_;
+
+  /** The folded history views of one bit less than the width of each tagged
+   * table's tags; combined with `tagFolds_` to form tags. */
+  std::vector<uint16_t> tagFoldsShort_;
+
+  /** The number of indirect branch updates made; used to periodically clear
+   * the useful bits of all tagged entries. */
+  uint64_t updateCount_ = 0;
+
+  /** The table lookups made by recent predictions, indexed by prediction
+   * identifier modulo `PREDICTION_STATE_ENTRIES`. */
+  std::vector<PredictionState> predictionStates_;
+
+  /** The identifier to give the next prediction. Identifiers start from 1, so
+   * that a prediction for a non-indirect branch matches no recorded state. */
+  uint64_t nextPredictionId_ = 1;
+};
+
+}  // namespace simeng
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "capstone/capstone.h"
@@ -69,8 +70,14 @@ class Instruction {
   /** Generate memory addresses this instruction wishes to access. */
   virtual span<const MemoryAccessTarget> generateAddresses() = 0;
 
-  /** Provide data from a requested memory address. */
-  virtual void supplyData(uint64_t address, const RegisterValue& data) = 0;
+  /** Provide the data read for the memory access at position `index` of the
+   * generated addresses. */
+  virtual void supplyData(size_t index, const RegisterValue& data) = 0;
+
+  /** Provide the data read for a contiguous block of memory accesses, starting
+   * at position `firstIndex` of the generated addresses. */
+  virtual void supplyDataBlock(size_t firstIndex,
+                               span<const RegisterValue> data) = 0;
 
   /** Retrieve previously generated memory addresses. */
   virtual span<const MemoryAccessTarget> getGeneratedAddresses() const = 0;
@@ -163,6 +170,12 @@ class Instruction {
   /** Get this instruction's supported set of ports. */
   virtual const std::vector<uint16_t>& getSupportedPorts() = 0;
 
+  /** Create a new instance of this instruction in the state it was in when
+   * pre-decoded, such that the same decoding may be issued repeatedly without
+   * instances interfering with each other. Must only be called on an
+   * instruction which has not yet progressed beyond pre-decode. */
+  virtual std::shared_ptr<Instruction> clone() const = 0;
+
   /** Is this a micro-operation? */
   bool isMicroOp() const;
 
@@ -178,6 +191,40 @@ class Instruction {
   /** Get arbitrary micro-operation index. */
   int getMicroOpIndex() const;
 
+  /** Is this a register-to-register move, whose single result is an exact copy
+   * of one of its source registers? */
+  bool isRegisterMove() const;
+
+  /** Retrieve the index of the source register copied by a register move. */
+  uint8_t getMoveSourceIndex() const;
+
+  /** Is this a zero idiom, whose single result is zero regardless of the values
+   * of its source registers? */
+  bool isZeroIdiom() const;
+
+  /** Mark this instruction as having been eliminated at rename, such that it
+   * completes without being executed. */
+  void setEliminated();
+
+  /** Has this instruction been eliminated at rename? */
+  bool isEliminated() const;
+
+  /** Can this instruction be fused with the following instruction `tail`,
+   * under the macro-op fusion rules enabled for the ISA? */
+  virtual bool canFuseWith(const Instruction& tail) const = 0;
+
+  /** Fuse the following instruction `tail` onto this instruction, such that it
+   * occupies no pipeline resources of its own and is executed immediately
+   * after this instruction by the same execution unit. */
+  void setFusedTail(const std::shared_ptr<Instruction>& tail);
+
+  /** Retrieve the instruction fused onto this instruction, or nullptr if there
+   * is none. */
+  const std::shared_ptr<Instruction>& getFusedTail() const;
+
+  /** Has this instruction been fused onto the preceding instruction? */
+  bool isFusedTail() const;
+
  protected:
   /** Whether an exception has been encountered. */
   bool exceptionEncountered_ = false;
@@ -252,6 +299,26 @@ class Instruction {
   /** An arbitrary index value for the micro-operation. Its use is based on the
    * implementation of specific micro-operations. */
   int microOpIndex_;
+
+  // Rename-time elimination
+  /** Is this a register-to-register move? */
+  bool isRegisterMove_ = false;
+
+  /** The index of the source register copied by a register move. */
+  uint8_t moveSourceIndex_ = 0;
+
+  /** Is this a zero idiom? */
+  bool isZeroIdiom_ = false;
+
+  /** Has this instruction been eliminated at rename? */
+  bool eliminated_ = false;
+
+  // Macro-op fusion
+  /** The instruction fused onto this instruction, if any. */
+  std::shared_ptr<Instruction> fusedTail_ = nullptr;
+
+  /** Has this instruction been fused onto the preceding instruction? */
+  bool isFusedTail_ = false;
 };
 
 }  // namespace simeng
\ No newline at end of file
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "simeng/BranchHistory.hh"
+#include "simeng/BranchPredictor.hh"
+#include "simeng/IndirectTargetPredictor.hh"
+#include "simeng/ReturnAddressStack.hh"
+#include "yaml-cpp/yaml.h"
+
+namespace simeng {
+
+/** A hashed perceptron branch predictor. Conditional branch directions are
+ * predicted from the sign of a sum of weights, one selected from each of a set
+ * of feature tables. The first table is indexed by the instruction address
+ * alone, providing a bias weight; the others by the address hashed with
+ * successively older, doubling segments of the global history, and optionally
+ * with a per-address local history. Weights are trained towards the outcome on
+ * a misprediction, or when the sum's magnitude does not exceed a threshold.
+ *
+ * All weights are held in a single contiguous table of 8-bit values, so that
+ * evaluating a prediction touches one small, densely packed structure.
+ *
+ * Branch targets are predicted by a direct-mapped Branch Target Buffer (BTB),
+ * refined for indirect branches by an indirect target predictor, and return
+ * addresses by a Return Address Stack (RAS). The global history and
+ * RAS are updated speculatively as predictions are made, and repaired from the
+ * checkpoints held by a prediction if it is found to be wrong or is flushed.
+ */
+class PerceptronPredictor : public BranchPredictor {
+ public:
+  /** The maximum number of feature tables supported. */
+  static constexpr uint8_t MAX_FEATURE_TABLES = 16;
+
+  /** The number of predictions whose state is retained for use on update. A
+   * prediction updated after this many later predictions have been made is not
+   * used for training. */
+  static constexpr uint16_t PREDICTION_STATE_ENTRIES = 1024;
+
+  /** Initialise predictor models. */
+  PerceptronPredictor(YAML::Node config);
+  ~PerceptronPredictor();
+
+  /** Generate a branch prediction for the supplied instruction address, a
+   * branch type, and a known target if not 0. Returns a branch direction and
+   * branch target address. */
+  BranchPrediction predict(uint64_t address, BranchType type,
+                           uint64_t knownTarget) override;
+
+  /** Updates appropriate predictor model objects based on the address and
+   * outcome of the branch instruction. */
+  void update(uint64_t address, bool taken, uint64_t targetAddress,
+              BranchType type, const BranchPrediction& prediction) override;
+
+  /** Repairs the global history and RAS to their state before the flushed
+   * branch was predicted. */
+  void flush(uint64_t address, BranchType type,
+             const BranchPrediction& prediction) override;
+
+  /** Repairs the global history, RAS and indirect path history to their state
+   * before the mispredicted branch was predicted, then applies its corrected
+   * outcome. */
+  void repair(uint64_t address, bool taken, uint64_t targetAddress,
+              BranchType type, const BranchPrediction& prediction) override;
+
+  /** Retrieve the number of bits of state held by the weight tables and
+   * histories, excluding the BTB and RAS. */
+  uint64_t getStorageBits() const;
+
+ private:
+  /** Repair the global history and RAS to their state before the branch at
+   * `address` was predicted, then apply its outcome `taken`. */
+  void repairHistory(uint64_t address, bool taken, BranchType type,
+                     const BranchPrediction& prediction);
+
+  /** The weight table lookups made when predicting a branch, retained for use
+   * when the branch's outcome is known. */
+  struct PredictionState {
+    /** The identifier of the prediction which recorded this state. */
+    uint64_t id = 0;
+
+    /** The position of the weight selected from each feature table within
+     * `weights_`. */
+    std::array<uint32_t, MAX_FEATURE_TABLES> positions;
+
+    /** The sum of the selected weights. */
+    int32_t sum = 0;
+  };
+
+  /** The bitlength of the BTB index; the BTB will have 2^bits entries. */
+  uint64_t btbBits_;
+
+  /** A 2^bits length vector of branch targets. */
+  std::vector<uint64_t> btb_;
+
+  /** The number of feature tables, including the bias table. */
+  uint8_t numTables_;
+
+  /** The bitlength of each feature table's index. */
+  uint8_t tableBits_;
+
+  /** The number of local history bits used as a feature; 0 if local history is
+   * not used. */
+  uint8_t localHistoryBits_;
+
+  /** The magnitude of sum below which weights are trained even on a correct
+   * prediction. */
+  int32_t threshold_;
+
+  /** The weights of all feature tables, stored contiguously with table `i`
+   * occupying positions [i << tableBits_, (i + 1) << tableBits_). */
+  std::vector<int8_t> weights_;
+
+  /** The number of global history bits used by the oldest history segment. */
+  uint16_t maxHistory_;
+
+  /** The global history of branch directions. */
+  BranchHistory history_;
+
+  /** The folded history views bounding each global history segment, ordered by
+   * increasing length. Feature table `i + 1` uses the directions between the
+   * lengths of views `i - 1` and `i`. */
+  std::vector<uint16_t> segmentFolds_;
+
+  /** The local histories of recent branch directions, indexed by instruction
+   * address. */
+  std::vector<uint16_t> localHistories_;
+
+  /** The weight table lookups made by recent predictions, indexed by prediction
+   * identifier modulo `PREDICTION_STATE_ENTRIES`. */
+  std::vector<PredictionState> predictionStates_;
+
+  /** The identifier to give the next prediction. Identifiers start from 1, so
+   * that a default constructed prediction matches no recorded state. */
+  uint64_t nextPredictionId_ = 1;
+
+  /** A return address stack. */
+  ReturnAddressStack ras_;
+
+  /** A predictor of indirect branch targets. */
+  IndirectTargetPredictor indirect_;
+};
+
+}  // namespace simeng
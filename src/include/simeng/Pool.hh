@@ -1,45 +1,121 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <new>
+#include <thread>
 #include <utility>
 #include <vector>
 
 namespace simeng {
 
+/** The memory usage of a single size class of a pool. */
+struct PoolUsage {
+  /** The size of the chunks served, or zero for allocations too large to be
+   * pooled, which are served from the free store. */
+  size_t chunkSize = 0;
+
+  /** The number of bytes currently allocated. */
+  size_t liveBytes = 0;
+
+  /** The largest number of bytes allocated at once. */
+  size_t highWaterBytes = 0;
+
+  /** The number of bytes held from the free store, including free chunks. */
+  size_t reservedBytes = 0;
+};
+
 /** A class that builds a memory pool with fixed `chunk_size`. It uses a free
  * list to keep track of free memory. The list is stored within the memory used
- * by the pool. */
+ * by the pool.
+ *
+ * A pool is owned by a single thread, which alone may allocate from it. Chunks
+ * returned by other threads are pushed onto a lock-free remote free list, and
+ * reclaimed by the owner once its own free list is exhausted. */
 template <size_t chunk_size, size_t initial_size = 2>
 class fixedPool_ {
   static_assert(initial_size && (initial_size & (initial_size - 1)) == 0 &&
                 "initial_size is not a power of 2");
 
  public:
-  ~fixedPool_() {
-    for (auto& ptr : ptrs) operator delete(ptr);
-  }
+  ~fixedPool_() { freeBlocks(); }
 
   /** Allocate `chunk_size` bytes. If allocation fails, it returns nullptr. */
   void* allocate() noexcept {
-    if (head) {
+    if (head || reclaimRemote() || grow()) {
+      if (++live > highWater) highWater = live;
       return std::exchange(head, *reinterpret_cast<void**>(head));
-    } else {
-      return grow() ? allocate() : head;
     }
+    return nullptr;
   }
 
   /** Return memory at `ptr` of size `chunk_size` bytes to the memory pool.
-   * Passing nullptr is a nop. */
+   * Must be called by the owning thread. Passing nullptr is a nop. */
   void deallocate(void* ptr) noexcept {
     if (ptr) {
       *reinterpret_cast<void**>(ptr) = head;
       head = ptr;
+      live--;
     }
   }
 
+  /** Return memory at `ptr` of size `chunk_size` bytes to the memory pool from
+   * a thread other than its owner. Passing nullptr is a nop. */
+  void deallocateRemote(void* ptr) noexcept {
+    if (ptr) {
+      void* next = remoteHead.load(std::memory_order_relaxed);
+      do {
+        *reinterpret_cast<void**>(ptr) = next;
+      } while (!remoteHead.compare_exchange_weak(next, ptr,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed));
+    }
+  }
+
+  /** Retrieve the memory usage of the pool. Remotely returned chunks are
+   * counted as live until reclaimed, which this does first. */
+  PoolUsage getUsage() noexcept {
+    reclaimRemote();
+    return {chunk_size, live * chunk_size, highWater * chunk_size,
+            reserved};
+  }
+
+  /** Return all memory held to the free store if no chunks are live. Returns
+   * whether the memory was released. */
+  bool release() noexcept {
+    reclaimRemote();
+    if (live > 0) return false;
+    freeBlocks();
+    head = nullptr;
+    n_allocated = initial_size;
+    reserved = 0;
+    return true;
+  }
+
  private:
+  /** Move the chunks returned by other threads onto the free list. Returns
+   * whether any were reclaimed. */
+  bool reclaimRemote() noexcept {
+    if (!remoteHead.load(std::memory_order_relaxed)) return false;
+    void* list = remoteHead.exchange(nullptr, std::memory_order_acquire);
+    while (list) {
+      void* next = *reinterpret_cast<void**>(list);
+      deallocate(list);
+      list = next;
+    }
+    return head;
+  }
+
+  /** Return every block to the free store. */
+  void freeBlocks() noexcept {
+    for (auto& ptr : ptrs) operator delete(ptr);
+    ptrs.clear();
+  }
+
   /** Allocate more memory and add new chunks to the free list. */
   bool grow() noexcept {
     // The space in bytes needed to fit `n_allocated` aligned chunks.
@@ -59,6 +135,7 @@ class fixedPool_ {
       space -= chunk_size;
     }
 
+    reserved += sizeof(chunk) * n_allocated;
     n_allocated = n_allocated << 1;
 
     return head;
@@ -78,6 +155,18 @@ class fixedPool_ {
 
   // Vector of all the pointers returned from operator new.
   std::vector<void*> ptrs;
+
+  // The head of the list of chunks returned by other threads.
+  std::atomic<void*> remoteHead{nullptr};
+
+  // No. of chunks currently allocated.
+  size_t live = 0;
+
+  // The largest no. of chunks allocated at once.
+  size_t highWater = 0;
+
+  // No. of bytes held from the free store.
+  size_t reserved = 0;
 };
 
 /** The class Pool is general-purpose memory pool implementation. It consists of
@@ -85,18 +174,54 @@ class fixedPool_ {
  *
  * Allocations requests that exceed the largest chunk size supported are served
  * from the free store directly. Currently the largest chunk size supported is
- * 512 bytes.
+ * 512 bytes. Besides the power-of-two chunk sizes, a class of
+ * `256 + MAX_HEADER_BYTES` bytes serves 256-byte allocations preceded by a
+ * small header, such as the buffers of the largest vector register values,
+ * which would otherwise each take a 512-byte chunk.
  *
  * All memory is freed on destruction even if deallocate has not been
  * called. If memory is exhausted, a block of memory is allocated. The size of
- * blocks increases by a factor of 2. */
+ * blocks increases by a factor of 2.
+ *
+ * Each thread uses its own pool, retrieved with `local()`, so that threads
+ * allocate without synchronisation. Memory may be returned to its pool from
+ * any thread; memory returned by a thread other than the pool's owner is
+ * reclaimed by the owner later. A thread which exits while memory from its
+ * pool is still live abandons the pool, which is then adopted by the next
+ * thread to need one. */
 class Pool {
  public:
+  /** The largest header which may accompany a 256-byte allocation for it to be
+   * served from the class above 256 bytes rather than a 512-byte chunk. */
+  static constexpr uint32_t MAX_HEADER_BYTES = 16;
+
+  /** Construct a pool owned by the calling thread. */
+  Pool() : owner_(std::this_thread::get_id()) {}
+
+  /** Retrieve the calling thread's pool, adopting an abandoned pool or
+   * creating one on first use. If the thread exits while memory allocated from
+   * its pool is still live, the pool is abandoned rather than destroyed, so
+   * that the memory remains valid. */
+  static Pool& local() {
+    struct Holder {
+      Pool* pool = adopt();
+      ~Holder() {
+        if (pool->release()) {
+          delete pool;
+        } else {
+          abandon(pool);
+        }
+      }
+    };
+    thread_local Holder holder;
+    return *holder.pool;
+  }
+
   /** Allocates `bytes` with alignment `alignof(std::max_align_t)`. If memory in
    * the pool is exhausted, a block of memory is allocated from the free
-   * store. */
+   * store. Must be called by the owning thread. */
   void* allocate(uint32_t bytes) {
-    switch (roundUp(bytes)) {
+    switch (chunkSize(bytes)) {
       case 32:
         return pool32.allocate();
       case 64:
@@ -105,39 +230,138 @@ class Pool {
         return pool128.allocate();
       case 256:
         return pool256.allocate();
+      case 256 + MAX_HEADER_BYTES:
+        return pool272.allocate();
       case 512:
         return pool512.allocate();
       default:
+        size_t live = largeLive_.fetch_add(bytes, std::memory_order_relaxed);
+        largeHighWater_ = std::max(largeHighWater_, live + bytes);
         return ::operator new(bytes);
     };
   }
 
   /** Returns the memory at `ptr` to the memory pool. If `ptr` is a nullptr, it
-   * is a nop. */
+   * is a nop. May be called from any thread. */
   void deallocate(void* ptr, uint32_t bytes) noexcept {
-    switch (roundUp(bytes)) {
+    bool remote = std::this_thread::get_id() !=
+                  owner_.load(std::memory_order_acquire);
+    switch (chunkSize(bytes)) {
       case 32:
-        pool32.deallocate(ptr);
+        deallocateChunk(pool32, ptr, remote);
         break;
       case 64:
-        pool64.deallocate(ptr);
+        deallocateChunk(pool64, ptr, remote);
         break;
       case 128:
-        pool128.deallocate(ptr);
+        deallocateChunk(pool128, ptr, remote);
         break;
       case 256:
-        pool256.deallocate(ptr);
+        deallocateChunk(pool256, ptr, remote);
+        break;
+      case 256 + MAX_HEADER_BYTES:
+        deallocateChunk(pool272, ptr, remote);
         break;
       case 512:
-        pool512.deallocate(ptr);
+        deallocateChunk(pool512, ptr, remote);
         break;
       default:
+        if (ptr) largeLive_.fetch_sub(bytes, std::memory_order_relaxed);
         ::operator delete(ptr);
         break;
     };
   }
 
+  /** Retrieve the memory usage of each size class, followed by that of the
+   * allocations served from the free store. Must be called by the owning
+   * thread. */
+  std::vector<PoolUsage> getUsage() {
+    size_t large = largeLive_.load(std::memory_order_relaxed);
+    return {pool32.getUsage(),
+            pool64.getUsage(),
+            pool128.getUsage(),
+            pool256.getUsage(),
+            pool272.getUsage(),
+            pool512.getUsage(),
+            {0, large, largeHighWater_, large}};
+  }
+
+  /** Return the memory held by each size class with no live allocations to
+   * the free store, such as between simulations. Returns whether all memory
+   * was released. Must be called by the owning thread. */
+  bool release() {
+    // Release every size class, rather than stopping at the first failure
+    bool released = pool32.release();
+    released &= pool64.release();
+    released &= pool128.release();
+    released &= pool256.release();
+    released &= pool272.release();
+    released &= pool512.release();
+    return released && largeLive_.load(std::memory_order_relaxed) == 0;
+  }
+
  private:
+  /** The pools abandoned by exited threads. */
+  struct Abandoned {
+    std::mutex mutex;
+    std::vector<Pool*> pools;
+
+    /** Free the abandoned pools whose memory has all been returned. */
+    ~Abandoned() {
+      for (Pool* pool : pools) {
+        if (pool->release()) delete pool;
+      }
+    }
+  };
+
+  /** Retrieve the pools abandoned by exited threads. */
+  static Abandoned& abandoned() {
+    static Abandoned pools;
+    return pools;
+  }
+
+  /** Take ownership of an abandoned pool for the calling thread, or create a
+   * new pool if there are none. */
+  static Pool* adopt() {
+    Abandoned& pools = abandoned();
+    std::lock_guard<std::mutex> lock(pools.mutex);
+    if (pools.pools.empty()) return new Pool();
+    Pool* pool = pools.pools.back();
+    pools.pools.pop_back();
+    pool->owner_.store(std::this_thread::get_id(), std::memory_order_release);
+    return pool;
+  }
+
+  /** Abandon `pool`, whose memory is still in use, for adoption by a later
+   * thread. */
+  static void abandon(Pool* pool) {
+    Abandoned& pools = abandoned();
+    std::lock_guard<std::mutex> lock(pools.mutex);
+    pool->owner_.store(std::thread::id(), std::memory_order_release);
+    pools.pools.push_back(pool);
+  }
+
+  /** Return `ptr` to the size class `pool`, through its remote free list if
+   * called by a thread other than the owner. */
+  template <class P>
+  static void deallocateChunk(P& pool, void* ptr, bool remote) noexcept {
+    if (remote) {
+      pool.deallocateRemote(ptr);
+    } else {
+      pool.deallocate(ptr);
+    }
+  }
+
+  /** Retrieve the size of the chunks serving allocations of `bytes` bytes;
+   * the nearest power of 2 greater than or equal to `bytes`, except for those
+   * fitting the class above 256 bytes. */
+  uint32_t chunkSize(uint32_t bytes) {
+    if (bytes > 256 && bytes <= 256 + MAX_HEADER_BYTES) {
+      return 256 + MAX_HEADER_BYTES;
+    }
+    return roundUp(bytes);
+  }
+
   /** Round up to the nearest power of 2 that is greater than or equal to v. */
   uint32_t roundUp(uint32_t v) {
     --v;
@@ -149,11 +373,22 @@ class Pool {
     return ++v;
   }
 
+  /** The thread which owns this pool, or no thread if it is abandoned. */
+  std::atomic<std::thread::id> owner_;
+
   fixedPool_<32> pool32;
   fixedPool_<128> pool128;
   fixedPool_<512> pool512;
   fixedPool_<64, 1024> pool64;
   fixedPool_<256, 1024> pool256;
+  fixedPool_<256 + MAX_HEADER_BYTES, 1024> pool272;
+
+  /** The number of bytes currently allocated from the free store. Atomic, as
+   * these may be freed by any thread. */
+  std::atomic<size_t> largeLive_{0};
+
+  /** The largest number of bytes allocated from the free store at once. */
+  size_t largeHighWater_ = 0;
 };
 
 }  // namespace simeng
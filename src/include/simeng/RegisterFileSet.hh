@@ -33,22 +33,43 @@ struct RegisterFileStructure {
 };
 
 /** A processor register file set. Holds the physical registers for each
- * register file. */
+ * register file. The registers of each file are stored contiguously in a
+ * single aligned slab of memory. */
 class RegisterFileSet {
  public:
   /** Constructs a set of register files, defined by `registerFileStructures`.
    */
   RegisterFileSet(std::vector<RegisterFileStructure> registerFileStructures);
 
-  /** Read the value of the specified register. */
+  /** The register files hold views of their own storage, so may not be copied.
+   */
+  RegisterFileSet(const RegisterFileSet&) = delete;
+  RegisterFileSet& operator=(const RegisterFileSet&) = delete;
+
+  /** Read the value of the specified register. The returned value is a view of
+   * the register's storage, and will reflect any subsequent writes to it. */
   const RegisterValue& get(Register reg) const;
 
-  /** Set a register as the specified value. */
+  /** Set a register as the specified value, copying it into place. */
   void set(Register reg, const RegisterValue& value);
 
  private:
+  /** An aligned block of register storage, sized to a typical host cache
+   * line. */
+  struct alignas(64) StorageBlock {
+    char bytes[64];
+  };
+
+  /** The backing storage for each register file. */
+  std::vector<std::vector<StorageBlock>> storage_;
+
+  /** The distance, in bytes, between consecutive registers of each register
+   * file. */
+  std::vector<uint16_t> strides_;
+
   /** The set of register files. Each entry in the outer vector corresponds to a
-   * register file, and the inner vectors are the registers. */
+   * register file, and the inner vectors hold a view of each register's
+   * storage. */
   std::vector<std::vector<RegisterValue>> registerFiles;
 };
 
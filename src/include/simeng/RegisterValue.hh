@@ -10,17 +10,49 @@
 
 namespace simeng {
 
-/** Global memory pool used by RegisterValue class. */
-extern Pool pool;
-
 /** A class that holds an arbitrary region of immutable data, providing casting
  * and data accessor functions. For values smaller than or equal to
- * `MAX_LOCAL_BYTES`, this data is held in a local value, otherwise memory is
- * allocated and the data is stored there. */
+ * `MAX_LOCAL_BYTES`, this data is held in a local value, otherwise the data is
+ * stored in a buffer allocated from the creating thread's pool and shared
+ * between copies.
+ * Alternatively, a RegisterValue may be a view of externally owned storage,
+ * such as a register file entry.
+ *
+ * Shared buffers are reference counted intrusively, with the count and the
+ * owning pool held in a header preceding the data. The count is not atomic, so
+ * copies of a value must not be made or destroyed by several threads at once;
+ * a value may, however, be released by a different thread to that which
+ * created it. */
 class RegisterValue {
  public:
   RegisterValue();
 
+  /** Release this instance's reference to any shared buffer. */
+  ~RegisterValue() { release(); }
+
+  /** Copy a RegisterValue. If `other` is a view, the referenced data is copied
+   * into a new value owned by this instance. */
+  RegisterValue(const RegisterValue& other);
+
+  /** Move a RegisterValue, preserving views. `other` is left empty. */
+  RegisterValue(RegisterValue&& other) noexcept;
+
+  /** Copy-assign a RegisterValue. If `other` is a view, the referenced data is
+   * copied into a new value owned by this instance. */
+  RegisterValue& operator=(const RegisterValue& other);
+
+  /** Move-assign a RegisterValue, preserving views. `other` is left empty. */
+  RegisterValue& operator=(RegisterValue&& other) noexcept;
+
+  /** Create a view of `bytes` bytes of externally owned data at `ptr`. No data
+   * is copied, and the view reflects any later changes to the underlying
+   * storage; the caller must ensure the storage outlives the view. */
+  static RegisterValue view(const char* ptr, uint16_t bytes);
+
+  /** Copy `other` without materialising it if it is a view. The result is only
+   * valid for as long as the storage viewed by `other` remains unchanged. */
+  static RegisterValue shallowCopy(const RegisterValue& other);
+
   /** Create a new RegisterValue from a value of arbitrary type (except
    * pointers), zero-extending the allocated memory space to the specified
    * number of bytes (defaulting to the size of the template type). */
@@ -37,15 +69,11 @@ class RegisterValue {
                                    0);
       }
     } else {
-      void* data = pool.allocate(bytes);
-      std::memset(data, 0, bytes);
+      ptr = allocateBuffer(bytes);
+      std::memset(ptr, 0, bytes);
 
-      T* view = reinterpret_cast<T*>(data);
+      T* view = reinterpret_cast<T*>(ptr);
       view[0] = value;
-
-      this->ptr = std::shared_ptr<char>(
-          static_cast<char*>(data),
-          [bytes](void* ptr) { pool.deallocate(ptr, bytes); });
     }
   }
 
@@ -59,10 +87,9 @@ class RegisterValue {
     if (isLocal()) {
       dest = this->value;
     } else {
-      dest = static_cast<char*>(pool.allocate(capacity));
+      this->ptr = allocateBuffer(capacity);
+      dest = this->ptr;
       std::memset(dest, 0, capacity);
-      this->ptr = std::shared_ptr<char>(
-          dest, [capacity](void* ptr) { pool.deallocate(ptr, capacity); });
     }
     assert(dest && "Attempted to dereference a NULL pointer");
     std::memcpy(dest, ptr, bytes);
@@ -95,11 +122,7 @@ class RegisterValue {
     assert(sizeof(T) <= bytes &&
            "Attempted to access a RegisterValue as a datatype larger than the "
            "data held");
-    if (isLocal()) {
-      return reinterpret_cast<const T*>(value);
-    } else {
-      return reinterpret_cast<const T*>(ptr.get());
-    }
+    return reinterpret_cast<const T*>(data());
   }
 
   /** Retrieve the number of bytes stored. */
@@ -108,6 +131,9 @@ class RegisterValue {
   /** Check whether this RegisterValue has an assigned value or is empty. */
   operator bool() const;
 
+  /** Check whether this RegisterValue is a view of externally owned data. */
+  bool isView() const;
+
   /** Create a new RegisterValue of size `toBytes`, copying the first
    * `fromBytes` bytes of this one. The remaining bytes of the new
    * RegisterValue are zeroed. */
@@ -117,18 +143,83 @@ class RegisterValue {
   /** Check whether the value is held locally or behind a pointer. */
   constexpr bool isLocal() const { return bytes <= MAX_LOCAL_BYTES; }
 
+  /** Check whether this instance holds a reference to a shared buffer. */
+  constexpr bool isShared() const { return !external && !isLocal(); }
+
+  /** Retrieve a pointer to the first byte of the held data. */
+  const char* data() const {
+    if (external) return external;
+    return isLocal() ? value : ptr;
+  }
+
+  /** The header preceding the data of a shared buffer. */
+  struct BufferHeader {
+    /** The pool the buffer was allocated from. */
+    Pool* pool;
+
+    /** The number of RegisterValues referencing the buffer. */
+    uint32_t references;
+  };
+
+  /** Retrieve the header of the shared buffer whose data starts at
+   * `buffer`. */
+  static BufferHeader& header(char* buffer) {
+    return *reinterpret_cast<BufferHeader*>(buffer - BUFFER_HEADER_BYTES);
+  }
+
+  /** Retrieve the reference count of the shared buffer whose data starts at
+   * `buffer`. */
+  static uint32_t& references(char* buffer) {
+    return header(buffer).references;
+  }
+
+  /** Allocate a shared buffer for `bytes` bytes of data from the calling
+   * thread's pool, with a single reference. Returns a pointer to the start of
+   * the data. */
+  static char* allocateBuffer(uint16_t bytes) {
+    Pool& pool = Pool::local();
+    char* buffer =
+        static_cast<char*>(pool.allocate(bytes + BUFFER_HEADER_BYTES)) +
+        BUFFER_HEADER_BYTES;
+    header(buffer) = {&pool, 1};
+    return buffer;
+  }
+
+  /** Release this instance's reference to its shared buffer, if it holds one,
+   * returning the buffer to its pool if no references remain. */
+  void release() {
+    if (isShared() && --references(ptr) == 0) {
+      header(ptr).pool->deallocate(ptr - BUFFER_HEADER_BYTES,
+                                   bytes + BUFFER_HEADER_BYTES);
+    }
+  }
+
   /** The maximum number of bytes that can be held locally. */
   static constexpr uint16_t MAX_LOCAL_BYTES = 16;
 
+  /** The size of the header preceding the data of a shared buffer, padded to
+   * keep the data aligned to `alignof(std::max_align_t)`. Within the pool's
+   * header allowance, so 256-byte vector values are not served from 512-byte
+   * chunks. */
+  static constexpr uint16_t BUFFER_HEADER_BYTES = 16;
+  static_assert(sizeof(BufferHeader) <= BUFFER_HEADER_BYTES);
+  static_assert(BUFFER_HEADER_BYTES <= Pool::MAX_HEADER_BYTES);
+
   /** The number of bytes held. */
   uint16_t bytes = 0;
 
-  /** The underlying pointer each instance references. */
-  std::shared_ptr<char> ptr;
+  /** The externally owned data this instance is a view of, if any. */
+  const char* external = nullptr;
+
+  union {
+    /** The underlying local member value. Aligned to 8 bytes to prevent
+     * potential alignment issue when casting. */
+    alignas(8) char value[MAX_LOCAL_BYTES];
 
-  /** The underlying local member value. Aligned to 8 bytes to prevent
-   * potential alignment issue when casting. */
-  alignas(8) char value[MAX_LOCAL_BYTES];
+    /** The data of the shared buffer referenced, for values larger than
+     * `MAX_LOCAL_BYTES`. */
+    char* ptr;
+  };
 };
 
 }  // namespace simeng
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace simeng {
+
+/** A Return Address Stack (RAS), predicting the targets of return instructions
+ * from the return addresses pushed by preceding branch-and-link instructions.
+ * The stack is held in a circular buffer; pushing onto a full stack overwrites
+ * its oldest entry.
+ *
+ * Pushes and pops are made speculatively, as predictions are made. A checkpoint
+ * records the top of the stack and the address held there, which is sufficient
+ * to undo any sequence of pushes and pops made since unless they overwrite
+ * entries below the top. */
+class ReturnAddressStack {
+ public:
+  /** The state of the stack at some point, from which it may be restored. */
+  struct Checkpoint {
+    /** The position of the top entry. */
+    uint16_t top = 0;
+
+    /** The number of valid entries. */
+    uint16_t depth = 0;
+
+    /** The address held in the top entry. */
+    uint64_t address = 0;
+  };
+
+  /** Construct a stack holding up to `size` entries. */
+  ReturnAddressStack(uint16_t size);
+
+  /** Push a return address onto the stack. */
+  void push(uint64_t address);
+
+  /** Pop the most recently pushed return address from the stack. Returns 0 if
+   * the stack is empty. */
+  uint64_t pop();
+
+  /** Retrieve a checkpoint of the current state of the stack. */
+  Checkpoint getCheckpoint() const;
+
+  /** Restore the stack to the state recorded in `checkpoint`. */
+  void restore(const Checkpoint& checkpoint);
+
+ private:
+  /** The circular buffer of return addresses. */
+  std::vector<uint64_t> entries_;
+
+  /** The position of the top entry in `entries_`. */
+  uint16_t top_ = 0;
+
+  /** The number of valid entries. */
+  uint16_t depth_ = 0;
+};
+
+}  // namespace simeng
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "simeng/BranchHistory.hh"
+#include "simeng/BranchPredictor.hh"
+#include "simeng/IndirectTargetPredictor.hh"
+#include "simeng/ReturnAddressStack.hh"
+#include "yaml-cpp/yaml.h"
+
+namespace simeng {
+
+/** A TAgged GEometric history length (TAGE) branch predictor. Conditional
+ * branch directions are predicted by a bimodal base table, backed by a series
+ * of partially tagged tables indexed with geometrically increasing lengths of
+ * global branch history. The matching tagged table using the longest history
+ * provides the prediction, falling back to the next longest match, or the base
+ * table, when its entry is newly allocated.
+ *
+ * Branch targets are predicted by a direct-mapped Branch Target Buffer (BTB),
+ * refined for indirect branches by an indirect target predictor, and return
+ * addresses by a Return Address Stack (RAS). The global history and
+ * RAS are updated speculatively as predictions are made, and repaired from the
+ * checkpoints held by a prediction if it is found to be wrong or is flushed.
+ */
+class TagePredictor : public BranchPredictor {
+ public:
+  /** The maximum number of tagged tables supported. */
+  static constexpr uint8_t MAX_TAGGED_TABLES = 16;
+
+  /** The number of predictions whose state is retained for use on update. A
+   * prediction updated after this many later predictions have been made is not
+   * used for training. */
+  static constexpr uint16_t PREDICTION_STATE_ENTRIES = 1024;
+
+  /** Initialise predictor models. */
+  TagePredictor(YAML::Node config);
+  ~TagePredictor();
+
+  /** Generate a branch prediction for the supplied instruction address, a
+   * branch type, and a known target if not 0. Returns a branch direction and
+   * branch target address. */
+  BranchPrediction predict(uint64_t address, BranchType type,
+                           uint64_t knownTarget) override;
+
+  /** Updates appropriate predictor model objects based on the address and
+   * outcome of the branch instruction. */
+  void update(uint64_t address, bool taken, uint64_t targetAddress,
+              BranchType type, const BranchPrediction& prediction) override;
+
+  /** Repairs the global history and RAS to their state before the flushed
+   * branch was predicted. */
+  void flush(uint64_t address, BranchType type,
+             const BranchPrediction& prediction) override;
+
+  /** Repairs the global history, RAS and indirect path history to their state
+   * before the mispredicted branch was predicted, then applies its corrected
+   * outcome. */
+  void repair(uint64_t address, bool taken, uint64_t targetAddress,
+              BranchType type, const BranchPrediction& prediction) override;
+
+  /** Retrieve the number of bits of state held by the direction predicting
+   * tables and global history, excluding the BTB targets and RAS. */
+  uint64_t getStorageBits() const;
+
+ private:
+  /** Repair the global history and RAS to their state before the branch at
+   * `address` was predicted, then apply its outcome `taken`. */
+  void repairHistory(uint64_t address, bool taken, BranchType type,
+                     const BranchPrediction& prediction);
+
+  /** An entry within a tagged table. */
+  struct TaggedEntry {
+    /** Whether this entry has been allocated. */
+    bool valid = false;
+
+    /** The partial tag of the address and history which allocated this
+     * entry. */
+    uint16_t tag = 0;
+
+    /** A signed saturating counter; a non-negative value predicts taken. */
+    int8_t counter = 0;
+
+    /** A saturating counter recording whether this entry's predictions have
+     * proven more accurate than the alternate prediction. */
+    uint8_t useful = 0;
+  };
+
+  /** The table lookups made when predicting a branch, retained for use when
+   * the branch's outcome is known. */
+  struct PredictionState {
+    /** The identifier of the prediction which recorded this state. */
+    uint64_t id = 0;
+
+    /** The index accessed in each tagged table. */
+    std::array<uint32_t, MAX_TAGGED_TABLES> indices;
+
+    /** The tag compared in each tagged table. */
+    std::array<uint16_t, MAX_TAGGED_TABLES> tags;
+
+    /** The tagged table providing the prediction, or -1 for the base table. */
+    int provider = -1;
+
+    /** The direction predicted by the provider. */
+    bool providerTaken = false;
+
+    /** The direction predicted by the next longest matching table, or by the
+     * base table. */
+    bool alternateTaken = false;
+
+    /** The final predicted direction. */
+    bool taken = false;
+  };
+
+  /** The bitlength of the base table and BTB index; each will have 2^bits
+   * entries. */
+  uint64_t btbBits_;
+
+  /** A 2^bits length vector of pairs containing a satCntBits_-bit saturating
+   * counter and a branch target. */
+  std::vector<std::pair<uint8_t, uint64_t>> btb_;
+
+  /** The number of bits used to form the saturating counter in a base table
+   * entry. */
+  uint64_t satCntBits_;
+
+  /** The number of tagged tables. */
+  uint8_t numTables_;
+
+  /** The bitlength of each tagged table's index. */
+  uint8_t tableBits_;
+
+  /** The bitlength of the tags held in tagged table entries. */
+  uint8_t tagBits_;
+
+  /** The tagged tables, ordered by increasing history length. */
+  std::vector<std::vector<TaggedEntry>> tables_;
+
+  /** The length of global history used to index each tagged table. */
+  std::vector<uint16_t> historyLengths_;
+
+  /** The global history of branch directions. */
+  BranchHistory history_;
+
+  /** The folded history views of the width of each tagged table's index. */
+  std::vector<uint16_t> indexFolds_;
+
+  /** The folded history views of the width of each tagged table's tags. */
+  std::vector<uint16_t> tagFolds_;
+
+  /** The folded history views of one bit less than the width of each tagged
+   * table's tags; combined with `tagFolds_` to form tags. */
+  std::vector<uint16_t> tagFoldsShort_;
+
+  /** A signed saturating counter choosing whether the alternate prediction is
+   * used in place of a newly allocated provider entry. */
+  int8_t useAlternate_ = 0;
+
+  /** The number of conditional branch updates made; used to periodically age
+   * the useful counters of all tagged entries. */
+  uint64_t updateCount_ = 0;
+
+  /** The table lookups made by recent predictions, indexed by prediction
+   * identifier modulo `PREDICTION_STATE_ENTRIES`. */
+  std::vector<PredictionState> predictionStates_;
+
+  /** The identifier to give the next prediction. Identifiers start from 1, so
+   * that a default constructed prediction matches no recorded state. */
+  uint64_t nextPredictionId_ = 1;
+
+  /** A return address stack. */
+  ReturnAddressStack ras_;
+
+  /** A predictor of indirect branch targets. */
+  IndirectTargetPredictor indirect_;
+};
+
+}  // namespace simeng
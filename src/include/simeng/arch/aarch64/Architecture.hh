@@ -5,7 +5,9 @@
 #include <unordered_map>
 
 #include "simeng/arch/Architecture.hh"
+#include "simeng/arch/aarch64/DecodeCacheFile.hh"
 #include "simeng/arch/aarch64/ExceptionHandler.hh"
+#include "simeng/arch/aarch64/FastDecoder.hh"
 #include "simeng/arch/aarch64/MicroDecoder.hh"
 #include "simeng/kernel/Linux.hh"
 
@@ -27,6 +29,15 @@ class Architecture : public arch::Architecture {
                     uint64_t instructionAddress,
                     MacroOp& output) const override;
 
+  /** Decode every instruction word within `regions` of the process image
+   * `image`, given as (address, size) pairs, into the decode cache ahead of
+   * simulation. Decoding is shared between up to `threads` host threads.
+   * Returns the number of distinct instruction words decoded. */
+  uint64_t predecodeRegions(
+      const char* image,
+      const std::vector<std::pair<uint64_t, uint64_t>>& regions,
+      uint16_t threads) const;
+
   /** Returns an Armv9.2-a register file structure description. */
   std::vector<RegisterFileStructure> getRegisterFileStructures() const override;
 
@@ -54,6 +65,14 @@ class Architecture : public arch::Architecture {
   /** Returns the current vector length set by the provided configuration. */
   uint64_t getVectorLength() const;
 
+  /** Returns the macro-op fusion rules enabled by the provided configuration,
+   * as a set of `FusionRule` flags. */
+  uint8_t getFusionRules() const;
+
+  /** Returns the number of encodings for which the fast decoder's output did
+   * not match Capstone's, when run in the verifying decoder mode. */
+  uint64_t getFastDecoderMismatches() const;
+
   /** Updates System registers of any system-based timers. */
   void updateSystemTimerRegisters(RegisterFileSet* regFile,
                                   const uint64_t iterations) const override;
@@ -65,6 +84,11 @@ class Architecture : public arch::Architecture {
   ExecutionInfo getExecutionInfo(Instruction& insn) const;
 
  private:
+  /** Produce the metadata of the instruction word `insn`, using `handle` for
+   * any Capstone decoding required. Safe to call concurrently with distinct
+   * handles. */
+  InstructionMetadata decodeMetadata(uint32_t insn, csh handle) const;
+
   /** A decoding cache, mapping an instruction word to a previously decoded
    * instruction. Instructions are added to the cache as they're decoded, to
    * reduce the overhead of future decoding. */
@@ -94,9 +118,20 @@ class Architecture : public arch::Architecture {
   /** A reference to a micro decoder object to split macro operations. */
   std::unique_ptr<MicroDecoder> microDecoder_;
 
+  /** A table-driven decoder for frequently executed encodings, used in place
+   * of Capstone on decode cache misses when enabled. */
+  std::unique_ptr<FastDecoder> fastDecoder_;
+
+  /** A persistent decode cache shared between runs of the same executable, or
+   * nullptr if none was requested. */
+  std::unique_ptr<DecodeCacheFile> decodeCacheFile_;
+
   /** The vector length used by the SVE extension in bits. */
   uint64_t VL_;
 
+  /** The enabled macro-op fusion rules, as a set of `FusionRule` flags. */
+  uint8_t fusionRules_ = 0;
+
   /** System Register of Virtual Counter Timer. */
   simeng::Register VCTreg_;
 
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "simeng/arch/aarch64/FastDecoder.hh"
+#include "simeng/arch/aarch64/Instruction.hh"
+
+namespace simeng {
+namespace arch {
+namespace aarch64 {
+
+/** The layout of a decode cache file. A file begins with a header holding, in
+ * host byte order:
+ *
+ * - The four characters "SEDC" and a 32-bit format version.
+ * - The 32-bit Capstone version the decodings were produced with.
+ * - The 32-bit version of the instruction metadata produced from Capstone's
+ *   output, `InstructionMetadata::FORMAT_VERSION`.
+ * - The 32-bit decoder mode the decodings were produced in.
+ * - The 32-bit size of a record in bytes.
+ * - The 64-bit FNV-1a hash of the executable the decodings belong to.
+ * - The 64-bit number of records.
+ * - The 64-bit size of the string table.
+ *
+ * The header is followed by one fixed-size record per decoded instruction
+ * word, sorted by word, and then by a string table holding each record's
+ * operand string. Records hold the metadata fields in the host's in-memory
+ * layout, so files are only reused by builds with a matching record size,
+ * Capstone version and metadata version. */
+namespace decodeCacheFormat {
+
+/** The characters identifying a decode cache file. */
+constexpr char MAGIC[4] = {'S', 'E', 'D', 'C'};
+
+/** The format version written to new files. */
+constexpr uint32_t VERSION = 2;
+
+}  // namespace decodeCacheFormat
+
+/** A persistent cache of instruction metadata, shared between runs of the
+ * same executable. The metadata decoded during a previous run is memory
+ * mapped on construction and looked up on decode cache misses, in place of
+ * decoding the instruction again. On destruction of the owning architecture,
+ * any newly decoded instructions are merged into the file.
+ *
+ * A file produced for a different executable, Capstone version, SimEng
+ * metadata version or decoder mode is ignored and replaced. */
+class DecodeCacheFile {
+ public:
+  /** A set of decodings to save, as pairs of instruction word and metadata. */
+  using Decodings =
+      std::vector<std::pair<uint32_t, const InstructionMetadata*>>;
+
+  /** Open the decode cache file at `path` for the executable at
+   * `executablePath`, holding decodings produced in decoder mode `mode`. If
+   * the file is missing or does not belong to the executable and mode, the
+   * cache starts empty. */
+  DecodeCacheFile(const std::string& path, const std::string& executablePath,
+                  DecoderMode mode);
+
+  /** Unmap the loaded file. */
+  ~DecodeCacheFile();
+
+  /** Retrieve the cached metadata of the instruction word `insn`, if it was
+   * decoded in a previous run. */
+  std::optional<InstructionMetadata> find(uint32_t insn) const;
+
+  /** Write the metadata of every decoding in `decodings`, together with the
+   * previously cached decodings, to the file. The file is only rewritten if
+   * `decodings` holds words it did not already contain. */
+  void save(const Decodings& decodings) const;
+
+  /** Retrieve the number of instruction words found in the cache. */
+  uint64_t getHitCount() const;
+
+ private:
+  /** A single cached decoding, as held in the file. */
+  struct Record;
+
+  /** Map the file at `path_`, if it exists and belongs to the executable. */
+  void load();
+
+  /** Find the record of the instruction word `insn` in the mapped file, or
+   * return nullptr if it is not present. */
+  const Record* lookup(uint32_t insn) const;
+
+  /** The path of the decode cache file. */
+  std::string path_;
+
+  /** The hash of the executable's contents, or zero if it could not be
+   * read. */
+  uint64_t executableHash_ = 0;
+
+  /** The decoder mode the cached decodings are produced in. */
+  DecoderMode mode_;
+
+  /** The mapped file, or nullptr if no valid file was loaded. */
+  void* mapping_ = nullptr;
+
+  /** The size of the mapped file in bytes. */
+  size_t mappingSize_ = 0;
+
+  /** The records of the mapped file, sorted by instruction word. */
+  const Record* records_ = nullptr;
+
+  /** The number of records in the mapped file. */
+  uint64_t recordCount_ = 0;
+
+  /** The string table of the mapped file. */
+  const char* strings_ = nullptr;
+
+  /** The size of the string table in bytes. */
+  uint64_t stringsSize_ = 0;
+
+  /** The number of instruction words found in the cache. Atomic, as the
+   * cache may be searched concurrently when pre-decoding. */
+  mutable std::atomic<uint64_t> hits_{0};
+};
+
+}  // namespace aarch64
+}  // namespace arch
+}  // namespace simeng
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <optional>
+#include <vector>
+
+#include "simeng/arch/aarch64/Instruction.hh"
+#include "yaml-cpp/yaml.h"
+
+using csh = size_t;
+
+namespace simeng {
+namespace arch {
+namespace aarch64 {
+
+/** The decoders used to produce instruction metadata on a decode cache miss.
+ */
+enum class DecoderMode {
+  /** Decode every instruction with Capstone. */
+  Capstone,
+  /** Decode supported encodings with the fast decoder, and the remainder with
+   * Capstone. */
+  Fast,
+  /** Decode every instruction with Capstone, and check that the fast
+   * decoder's output matches for supported encodings. */
+  Verify
+};
+
+/** A table-driven decoder for the most frequently executed AArch64 encodings,
+ * which produces instruction metadata directly from the instruction word
+ * without invoking Capstone.
+ *
+ * Each entry of the encoding table matches a class of encodings by a mask and
+ * value, and names the format from which its operands are extracted. The
+ * fixed parts of an entry's metadata (opcode, mnemonic ID, implicit registers,
+ * groups, operand types, access flags and arrangements) are taken from a
+ * template, produced once on construction by decoding a representative
+ * encoding with Capstone. Decoding a word then only requires copying the
+ * template and inserting the register numbers and immediates held in the
+ * word's fields. Entries whose representative fails to decode to the expected
+ * opcode are disabled, and the encodings they match decoded by Capstone. */
+class FastDecoder {
+ public:
+  /** The formats from which an encoding class's operands are extracted. */
+  enum class Format : uint8_t;
+
+  /** Construct a fast decoder in the mode given by the `Decoder-Mode` option
+   * of `config`, using `capstoneHandle` to produce the encoding templates. */
+  FastDecoder(YAML::Node config, csh capstoneHandle);
+  ~FastDecoder();
+
+  /** Decode the instruction word `insn`, if it belongs to a supported encoding
+   * class. Returns no metadata for unsupported encodings, which must be
+   * decoded by Capstone instead. */
+  std::optional<InstructionMetadata> decode(uint32_t insn) const;
+
+  /** Compare the fast decoder's metadata for `insn` with the `reference`
+   * produced by Capstone, reporting and counting any difference in the fields
+   * used to decode and execute the instruction. Returns true if they match. */
+  bool verify(uint32_t insn, const InstructionMetadata& fast,
+              const InstructionMetadata& reference) const;
+
+  /** Get the configured decoder mode. */
+  DecoderMode getMode() const;
+
+  /** Get the number of encodings for which the fast decoder's metadata did not
+   * match Capstone's. */
+  uint64_t getMismatchCount() const;
+
+ private:
+  /** An entry of the encoding table. */
+  struct Entry {
+    /** The bits of the instruction word which identify the encoding class. */
+    uint32_t mask;
+
+    /** The value of the masked bits for the encoding class. */
+    uint32_t value;
+
+    /** Bits set, alongside `value`, in the representative encoding decoded to
+     * produce the entry's template; used where an all-zero field would select
+     * a different alias. */
+    uint32_t sample;
+
+    /** The opcode of the encoding class, or zero to decline encodings which
+     * must be decoded by Capstone. */
+    uint32_t opcode;
+
+    /** The format of the encoding class's operands. */
+    Format format;
+
+    /** The scale applied to the encoding's immediate. */
+    uint16_t scale;
+  };
+
+  /** The encoding table. Entries are matched in order, so that aliases and
+   * declined encodings precede the more general classes they overlap. */
+  static const std::vector<Entry> table_;
+
+  /** Retrieve the register numbered `number` in the same register bank as the
+   * template register `base`. For general purpose registers, number 31
+   * refers to the stack pointer if `isSP`, and otherwise the zero register. */
+  static arm64_reg bankRegister(arm64_reg base, uint32_t number, bool isSP);
+
+  /** The configured decoder mode. */
+  DecoderMode mode_ = DecoderMode::Capstone;
+
+  /** The metadata template of each table entry. Templates of disabled entries
+   * hold the invalid encoding. */
+  std::vector<InstructionMetadata> templates_;
+
+  /** The indices of the table entries able to match each value of bits 28:25
+   * of an instruction word, in table order. */
+  std::array<std::vector<uint16_t>, 16> buckets_;
+
+  /** The number of encodings whose fast and Capstone decodings differed.
+   * Atomic, as decodings may be verified concurrently when pre-decoding. */
+  mutable std::atomic<uint64_t> mismatches_{0};
+};
+
+}  // namespace aarch64
+}  // namespace arch
+}  // namespace simeng
@@ -209,6 +209,18 @@ struct MicroOpInfo {
   int microOpIndex = 0;
 };
 
+/** The macro-op fusion rules which may be enabled, as bit flags. */
+namespace FusionRule {
+// A flag-setting compare or ALU operation followed by a conditional branch
+const uint8_t COMPARE_BRANCH = 1 << 0;
+// An `adrp` followed by an `add` forming the full address
+const uint8_t ADRP_ADD = 1 << 1;
+// An AES round `aese` followed by its `aesmc` mix columns
+const uint8_t AESE_AESMC = 1 << 2;
+// A `mov` immediate followed by a `movk` inserting further bits
+const uint8_t MOV_MOVK = 1 << 3;
+}  // namespace FusionRule
+
 /** A basic Armv9.2-a implementation of the `Instruction` interface. */
 class Instruction : public simeng::Instruction {
  public:
@@ -265,8 +277,14 @@ class Instruction : public simeng::Instruction {
   /** Retrieve previously generated memory addresses. */
   span<const MemoryAccessTarget> getGeneratedAddresses() const override;
 
-  /** Provide data from a requested memory address. */
-  void supplyData(uint64_t address, const RegisterValue& data) override;
+  /** Provide the data read for the memory access at position `index` of the
+   * generated addresses. */
+  void supplyData(size_t index, const RegisterValue& data) override;
+
+  /** Provide the data read for a contiguous block of memory accesses, starting
+   * at position `firstIndex` of the generated addresses. */
+  void supplyDataBlock(size_t firstIndex,
+                       span<const RegisterValue> data) override;
 
   /** Retrieve supplied memory data. */
   span<const RegisterValue> getData() const override;
@@ -306,6 +324,14 @@ class Instruction : public simeng::Instruction {
   /** Get this instruction's supported set of ports. */
   const std::vector<uint16_t>& getSupportedPorts() override;
 
+  /** Create a copy of this pre-decoded instruction. */
+  std::shared_ptr<simeng::Instruction> clone() const override;
+
+  /** Can this instruction be fused with the following instruction `tail`,
+   * under the fusion rules enabled by the architecture? Does not check the
+   * register dependencies between the instructions. */
+  bool canFuseWith(const simeng::Instruction& tail) const override;
+
   /** Retrieve the instruction's metadata. */
   const InstructionMetadata& getMetadata() const;
 
@@ -382,6 +408,25 @@ class Instruction : public simeng::Instruction {
   short operandsPending = 0;
 
   // Execution
+  /** A member function implementing part of an instruction's behaviour. */
+  using Handler = void (Instruction::*)();
+
+  /** Execute an instruction with the opcode `OPCODE`. Specialised for each
+   * supported opcode in Instruction_execute.cc. */
+  template <unsigned int OPCODE>
+  void executeOpcode();
+
+  /** Execute this micro-operation. */
+  void executeMicroOp();
+
+  /** Retrieve the handler implementing `execute` for this instruction's opcode
+   * or micro-opcode. */
+  Handler resolveExecuteHandler() const;
+
+  /** The handler implementing `execute`, resolved once at decode time so each
+   * execution avoids dispatching on the opcode. */
+  Handler executeHandler_ = &Instruction::executionNYI;
+
   /** Generate an ExecutionNotYetImplemented exception. */
   void executionNYI();
 
@@ -430,6 +475,23 @@ class Instruction : public simeng::Instruction {
 
   void setMemoryAddresses(std::vector<MemoryAccessTarget>&& addresses);
 
+  /** Generate the memory addresses accessed by an instruction with the opcode
+   * `OPCODE`. Specialised for each supported load or store opcode in
+   * Instruction_address.cc. */
+  template <unsigned int OPCODE>
+  void generateOpcodeAddresses();
+
+  /** Generate the memory addresses accessed by this micro-operation. */
+  void generateMicroOpAddresses();
+
+  /** Retrieve the handler implementing `generateAddresses` for this
+   * instruction's opcode or micro-opcode. */
+  Handler resolveAddressHandler() const;
+
+  /** The handler implementing `generateAddresses`, resolved once at decode
+   * time. */
+  Handler addressHandler_ = &Instruction::executionNYI;
+
   /** The memory addresses this instruction accesses, as a vector of {offset,
    * width} pairs. */
   std::vector<MemoryAccessTarget> memoryAddresses;
@@ -35,14 +35,14 @@ class neonHelp {
     const T* n = operands[0].getAsVector<T>();
     const T* m = operands[1].getAsVector<T>();
     T out[16 / sizeof(T)] = {0};
-    uint8_t offset = I / 2;
-    for (int i = 0; i < I; i++) {
-      if (i < offset) {
-        out[i] = static_cast<T>(n[i * 2] + n[(i * 2) + 1]);
-      } else {
-        out[i] =
-            static_cast<T>(m[(i - offset) * 2] + m[((i - offset) * 2) + 1]);
-      }
+    constexpr int offset = I / 2;
+    // Sum the pairs from each source in separate loops, so that neither
+    // contains a branch and both are vectorised
+    for (int i = 0; i < offset; i++) {
+      out[i] = static_cast<T>(n[i * 2] + n[(i * 2) + 1]);
+    }
+    for (int i = offset; i < I; i++) {
+      out[i] = static_cast<T>(m[(i - offset) * 2] + m[((i - offset) * 2) + 1]);
     }
     return {out, 256};
   }
@@ -128,19 +128,24 @@ class neonHelp {
    * T represents the type of operands (e.g. for vn.2d, T = uint64_t).
    * I represents the number of elements in the output array to be updated (e.g.
    * for vd.8b I = 8).
+   * F is the type of the comparison `func`; taken as a template parameter so
+   * that it is inlined and the loop vectorised.
    * Returns correctly formatted RegisterValue. */
-  template <typename T, int I>
+  template <typename T, int I, typename F>
   static RegisterValue vecCompare(
       std::array<RegisterValue, Instruction::MAX_SOURCE_REGISTERS>& operands,
-      bool cmpToZero, std::function<bool(T, T)> func) {
+      bool cmpToZero, F func) {
     const T* n = operands[0].getAsVector<T>();
-    const T* m;
-    if (!cmpToZero) m = operands[1].getAsVector<T>();
     T out[16 / sizeof(T)] = {0};
-    for (int i = 0; i < I; i++) {
-      out[i] = func(n[i], cmpToZero ? static_cast<T>(0) : m[i])
-                   ? static_cast<T>(-1)
-                   : 0;
+    if (cmpToZero) {
+      for (int i = 0; i < I; i++) {
+        out[i] = func(n[i], static_cast<T>(0)) ? static_cast<T>(-1) : 0;
+      }
+    } else {
+      const T* m = operands[1].getAsVector<T>();
+      for (int i = 0; i < I; i++) {
+        out[i] = func(n[i], m[i]) ? static_cast<T>(-1) : 0;
+      }
     }
     return {out, 256};
   }
@@ -229,19 +234,24 @@ class neonHelp {
    * uint32_t).
    * I represents the number of elements in the output array to be
    * updated (e.g. for vd.8b I = 8).
+   * F is the type of the comparison `func`; taken as a template parameter so
+   * that it is inlined and the loop vectorised.
    * Returns correctly formatted RegisterValue. */
-  template <typename T, typename C, int I>
+  template <typename T, typename C, int I, typename F>
   static RegisterValue vecFCompare(
       std::array<RegisterValue, Instruction::MAX_SOURCE_REGISTERS>& operands,
-      bool cmpToZero, std::function<bool(T, T)> func) {
+      bool cmpToZero, F func) {
     const T* n = operands[0].getAsVector<T>();
-    const T* m;
-    if (!cmpToZero) m = operands[1].getAsVector<T>();
     C out[16 / sizeof(C)] = {0};
-    for (int i = 0; i < I; i++) {
-      out[i] = func(n[i], cmpToZero ? static_cast<T>(0) : m[i])
-                   ? static_cast<C>(-1)
-                   : 0;
+    if (cmpToZero) {
+      for (int i = 0; i < I; i++) {
+        out[i] = func(n[i], static_cast<T>(0)) ? static_cast<C>(-1) : 0;
+      }
+    } else {
+      const T* m = operands[1].getAsVector<T>();
+      for (int i = 0; i < I; i++) {
+        out[i] = func(n[i], m[i]) ? static_cast<C>(-1) : 0;
+      }
     }
     return {out, 256};
   }
@@ -515,11 +525,13 @@ class neonHelp {
    * T represents the type of operands (e.g. for vn.2d, T = uint64_t).
    * I represents the number of elements in the output array to be updated (e.g.
    * for vd.8b I = 8).
+   * F is the type of the operation `func`; taken as a template parameter so
+   * that it is inlined and the loop vectorised.
    * Returns correctly formatted RegisterValue. */
-  template <typename T, int I>
+  template <typename T, int I, typename F>
   static RegisterValue vecLogicOp_2vecs(
       std::array<RegisterValue, Instruction::MAX_SOURCE_REGISTERS>& operands,
-      std::function<T(T)> func) {
+      F func) {
     const T* n = operands[0].getAsVector<T>();
     T out[16 / sizeof(T)] = {0};
     for (int i = 0; i < I; i++) {
@@ -533,11 +545,13 @@ class neonHelp {
    * T represents the type of operands (e.g. for vn.2d, T = uint64_t).
    * I represents the number of elements in the output array to be updated (e.g.
    * for vd.8b I = 8).
+   * F is the type of the operation `func`; taken as a template parameter so
+   * that it is inlined and the loop vectorised.
    * Returns correctly formatted RegisterValue. */
-  template <typename T, int I>
+  template <typename T, int I, typename F>
   static RegisterValue vecLogicOp_3vecs(
       std::array<RegisterValue, Instruction::MAX_SOURCE_REGISTERS>& operands,
-      std::function<T(T, T)> func) {
+      F func) {
     const T* n = operands[0].getAsVector<T>();
     const T* m = operands[1].getAsVector<T>();
     T out[16 / sizeof(T)] = {0};
@@ -762,15 +776,14 @@ class neonHelp {
     const N* n = operands[isXtn2 ? 1 : 0].getAsVector<N>();
 
     D out[16 / sizeof(D)] = {0};
-    int index = 0;
-
-    for (int i = 0; i < I; i++) {
-      if (isXtn2 & (i < (I / 2))) {
-        out[i] = d[i];
-      } else {
-        out[i] = static_cast<D>(n[index]);
-        index++;
-      }
+    // XTN2 retains the lower half of the destination, and narrows into the
+    // upper half
+    const int start = isXtn2 ? (I / 2) : 0;
+    for (int i = 0; i < start; i++) {
+      out[i] = d[i];
+    }
+    for (int i = start; i < I; i++) {
+      out[i] = static_cast<D>(n[i - start]);
     }
     return {out, 256};
   }
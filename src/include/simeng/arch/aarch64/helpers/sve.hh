@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstring>
+
 #include "auxiliaryFunctions.hh"
 
 namespace simeng {
@@ -7,6 +9,116 @@ namespace arch {
 namespace aarch64 {
 class sveHelp {
  public:
+  /** An unsigned integer type of the same size as T, holding the mask of a
+   * single lane of elements of type T. */
+  template <typename T>
+  using LaneMask = std::conditional_t<
+      sizeof(T) == 1, uint8_t,
+      std::conditional_t<sizeof(T) == 2, uint16_t,
+                         std::conditional_t<sizeof(T) == 4, uint32_t,
+                                            uint64_t>>>;
+
+  /** Invoke `f` with the vector length `VL_bits` as an integral constant, so
+   * that loops over the lanes of a vector within `f` have a trip count known
+   * at compile time. Each vector length accepted by the config is
+   * instantiated; any other is passed to `f` as a runtime value. */
+  template <typename F>
+  static auto sveWithVL(const uint16_t VL_bits, F f) {
+    switch (VL_bits) {
+      case 128:
+        return f(std::integral_constant<uint16_t, 128>());
+      case 256:
+        return f(std::integral_constant<uint16_t, 256>());
+      case 384:
+        return f(std::integral_constant<uint16_t, 384>());
+      case 512:
+        return f(std::integral_constant<uint16_t, 512>());
+      case 640:
+        return f(std::integral_constant<uint16_t, 640>());
+      case 768:
+        return f(std::integral_constant<uint16_t, 768>());
+      case 896:
+        return f(std::integral_constant<uint16_t, 896>());
+      case 1024:
+        return f(std::integral_constant<uint16_t, 1024>());
+      case 1152:
+        return f(std::integral_constant<uint16_t, 1152>());
+      case 1280:
+        return f(std::integral_constant<uint16_t, 1280>());
+      case 1408:
+        return f(std::integral_constant<uint16_t, 1408>());
+      case 1536:
+        return f(std::integral_constant<uint16_t, 1536>());
+      case 1664:
+        return f(std::integral_constant<uint16_t, 1664>());
+      case 1792:
+        return f(std::integral_constant<uint16_t, 1792>());
+      case 1920:
+        return f(std::integral_constant<uint16_t, 1920>());
+      case 2048:
+        return f(std::integral_constant<uint16_t, 2048>());
+      default:
+        return f(VL_bits);
+    }
+  }
+
+  /** Produce a vector whose lanes hold `op(i)`, with the lanes beyond the
+   * vector length zeroed. The loop is specialised for each vector length by
+   * `sveWithVL`.
+   * T represents the type of operands (e.g. for zn.d, T = uint64_t).
+   * Returns correctly formatted RegisterValue. */
+  template <typename T, typename Op>
+  static RegisterValue sveMap(const uint16_t VL_bits, Op op) {
+    return sveWithVL(VL_bits, [&](auto VL) -> RegisterValue {
+      const uint16_t partition_num = VL / (sizeof(T) * 8);
+      T out[256 / sizeof(T)] = {0};
+      for (int i = 0; i < partition_num; i++) {
+        out[i] = op(i);
+      }
+      return {out, 256};
+    });
+  }
+
+  /** Produce a vector whose lanes active in the predicate `p` hold `op(i)`,
+   * and whose inactive lanes hold `inactive[i]`. `op` is evaluated for every
+   * lane and the two values selected between with the lane masks, so the loop
+   * contains no branches and is vectorised by the host compiler (e.g. with
+   * AVX2 or AVX-512 where enabled by `-march=native`). `op` must therefore be
+   * safe to evaluate for inactive lanes. The loop is specialised for each
+   * vector length by `sveWithVL`.
+   * T represents the type of operands (e.g. for zn.d, T = uint64_t).
+   * Returns correctly formatted RegisterValue. */
+  template <typename T, typename Op>
+  static RegisterValue sveMergePredicated(const uint64_t* p, const T* inactive,
+                                          const uint16_t VL_bits, Op op) {
+    return sveWithVL(VL_bits, [&](auto VL) -> RegisterValue {
+      const uint16_t partition_num = VL / (sizeof(T) * 8);
+      constexpr int lanesPerWord = 64 / sizeof(T);
+      T out[256 / sizeof(T)] = {0};
+      // Iterate over the lanes covered by each 64-bit predicate word, so that
+      // the word is shared between the lanes
+      for (int base = 0; base < partition_num; base += lanesPerWord) {
+        const uint64_t word = p[base / lanesPerWord];
+        const int lanes = std::min(lanesPerWord, partition_num - base);
+        for (int j = 0; j < lanes; j++) {
+          const int i = base + j;
+          const T result = op(i);
+          const LaneMask<T> mask =
+              -static_cast<LaneMask<T>>((word >> (j * sizeof(T))) & 1);
+          // Select between the raw bits, as a select between floating-point
+          // values is not vectorised where the operation may trap
+          LaneMask<T> active;
+          LaneMask<T> merged;
+          std::memcpy(&active, &result, sizeof(T));
+          std::memcpy(&merged, &inactive[i], sizeof(T));
+          merged = (active & mask) | (merged & ~mask);
+          std::memcpy(&out[i], &merged, sizeof(T));
+        }
+      }
+      return {out, 256};
+    });
+  }
+
   /** Helper function for SVE instructions with the format `add zd, zn, zm`.
    * T represents the type of operands (e.g. for zn.d, T = uint64_t).
    * Returns correctly formatted RegisterValue. */
@@ -17,12 +129,7 @@ class sveHelp {
     const T* n = operands[0].getAsVector<T>();
     const T* m = operands[1].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      out[i] = n[i] + m[i];
-    }
-    return {out, 256};
+    return sveMap<T>(VL_bits, [&](int i) -> T { return n[i] + m[i]; });
   }
 
   /** Helper function for SVE instructions with the format `add zdn, pg/m, zdn,
@@ -39,16 +146,8 @@ class sveHelp {
     const T* d = operands[1].getAsVector<T>();
     const auto con = isFP ? metadata.operands[3].fp : metadata.operands[3].imm;
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = d[i] + con;
-      else
-        out[i] = d[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits,
+                                 [&](int i) -> T { return d[i] + con; });
   }
 
   /** Helper function for SVE instructions with the format `add zdn, pg/m, zdn,
@@ -63,16 +162,8 @@ class sveHelp {
     const T* d = operands[1].getAsVector<T>();
     const T* m = operands[2].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = d[i] + m[i];
-      else
-        out[i] = d[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits,
+                                 [&](int i) -> T { return d[i] + m[i]; });
   }
 
   /** Helper function for NEON instructions with the format `addv dd, pg, zn`.
@@ -320,18 +411,8 @@ class sveHelp {
     const uint64_t* p = operands[1].getAsVector<uint64_t>();
     const T* n = operands[2].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active) {
-        out[i] = ::fabs(n[i]);
-      } else {
-        out[i] = d[i];
-      }
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits,
+                                 [&](int i) -> T { return ::fabs(n[i]); });
   }
 
   /** Helper function for SVE instructions with the format `fadda rd,
@@ -467,18 +548,8 @@ class sveHelp {
     const uint64_t* p = operands[1].getAsVector<uint64_t>();
     const T imm = metadata.operands[2].fp;
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active) {
-        out[i] = imm;
-      } else {
-        out[i] = dn[i];
-      }
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, dn, VL_bits,
+                                 [&](int i) -> T { return imm; });
   }
 
   /** Helper function for SVE instructions with the format `fcvt zd,
@@ -580,16 +651,9 @@ class sveHelp {
     const T* n = operands[2].getAsVector<T>();
     const T* m = operands[3].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = m[i] + (d[i] * n[i]);
-      else
-        out[i] = d[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits, [&](int i) -> T {
+      return m[i] + (d[i] * n[i]);
+    });
   }
 
   /** Helper function for SVE instructions with the format `fmls zd, pg/m, zn,
@@ -605,16 +669,9 @@ class sveHelp {
     const T* n = operands[2].getAsVector<T>();
     const T* m = operands[3].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = d[i] + (-n[i] * m[i]);
-      else
-        out[i] = d[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits, [&](int i) -> T {
+      return d[i] + (-n[i] * m[i]);
+    });
   }
 
   /** Helper function for SVE instructions with the format `fmsb zd, pg/m, zn,
@@ -630,16 +687,9 @@ class sveHelp {
     const T* n = operands[2].getAsVector<T>();
     const T* m = operands[3].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = m[i] + (-d[i] * n[i]);
-      else
-        out[i] = d[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits, [&](int i) -> T {
+      return m[i] + (-d[i] * n[i]);
+    });
   }
 
   /** Helper function for SVE instructions with the format `fmul zd, zn, zm`.
@@ -652,12 +702,7 @@ class sveHelp {
     const T* n = operands[0].getAsVector<T>();
     const T* m = operands[1].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      out[i] = n[i] * m[i];
-    }
-    return {out, 256};
+    return sveMap<T>(VL_bits, [&](int i) -> T { return n[i] * m[i]; });
   }
 
   /** Helper function for SVE instructions with the format `fneg zd, pg/m, zn`.
@@ -671,17 +716,8 @@ class sveHelp {
     const uint64_t* p = operands[1].getAsVector<uint64_t>();
     const T* n = operands[2].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = -n[i];
-      else
-        out[i] = d[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits,
+                                 [&](int i) -> T { return -n[i]; });
   }
 
   /** Helper function for SVE instructions with the format `fnmls zd, pg/m, zn,
@@ -697,17 +733,9 @@ class sveHelp {
     const T* n = operands[2].getAsVector<T>();
     const T* m = operands[3].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = -d[i] + (n[i] * m[i]);
-      else
-        out[i] = d[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits, [&](int i) -> T {
+      return -d[i] + (n[i] * m[i]);
+    });
   }
 
   /** Helper function for SVE instructions with the format `fnmsb zdn, pg/m, zm,
@@ -723,17 +751,9 @@ class sveHelp {
     const T* m = operands[2].getAsVector<T>();
     const T* a = operands[3].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = -a[i] + n[i] * m[i];
-      else
-        out[i] = n[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, n, VL_bits, [&](int i) -> T {
+      return -a[i] + n[i] * m[i];
+    });
   }
 
   /** Helper function for SVE instructions with the format `frintn zd, pg/m,
@@ -777,16 +797,8 @@ class sveHelp {
     const uint64_t* p = operands[1].getAsVector<uint64_t>();
     const T* n = operands[2].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = ::sqrt(n[i]);
-      else
-        out[i] = d[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits,
+                                 [&](int i) -> T { return ::sqrt(n[i]); });
   }
 
   /** Helper function for SVE instructions with the format `inc<b, d, h, w>
@@ -906,25 +918,19 @@ class sveHelp {
   /** Helper function for SVE instructions with the format `<AND, EOR, ...>
    * zd, pg/m, zn, zm`.
    * T represents the type of operands (e.g. for zn.d, T = uint64_t).
+   * F is the type of `func`, which performs the operation on a pair of
+   * elements; taken as a template parameter so that it is inlined.
    * Returns correctly formatted RegisterValue. */
-  template <typename T>
+  template <typename T, typename F>
   static RegisterValue sveLogicOpPredicated_3vecs(
       std::array<RegisterValue, Instruction::MAX_SOURCE_REGISTERS>& operands,
-      const uint16_t VL_bits, std::function<T(T, T)> func) {
+      const uint16_t VL_bits, F func) {
     const uint64_t* p = operands[0].getAsVector<uint64_t>();
     const T* dn = operands[1].getAsVector<T>();
     const T* m = operands[2].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = func(dn[i], m[i]);
-      else
-        out[i] = dn[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, dn, VL_bits,
+                                 [&](int i) -> T { return func(dn[i], m[i]); });
   }
 
   /** Helper function for SVE instructions with the format `lsl sz, zn, #imm`.
@@ -981,17 +987,9 @@ class sveHelp {
     const T* n = operands[2].getAsVector<T>();
     const T* m = operands[3].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active) {
-        out[i] = std::max(n[i], m[i]);
-      } else
-        out[i] = d[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits, [&](int i) -> T {
+      return std::max(n[i], m[i]);
+    });
   }
 
   /** Helper function for SVE instructions with the format `fmla zd, pg/m, zn,
@@ -1007,16 +1005,9 @@ class sveHelp {
     const T* n = operands[2].getAsVector<T>();
     const T* m = operands[3].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = d[i] + (n[i] * m[i]);
-      else
-        out[i] = d[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits, [&](int i) -> T {
+      return d[i] + (n[i] * m[i]);
+    });
   }
 
   /** Helper function for SVE instructions with the format `movprfx zd,
@@ -1058,18 +1049,8 @@ class sveHelp {
     const uint64_t* p = operands[1].getAsVector<uint64_t>();
     const T* n = operands[2].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active) {
-        out[i] = n[i];
-      } else {
-        out[i] = d[i];
-      }
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits,
+                                 [&](int i) -> T { return n[i]; });
   }
 
   /** Helper function for SVE instructions with the format `mul zdn, pg/m, zdn,
@@ -1091,17 +1072,12 @@ class sveHelp {
     else
       m = operands[2].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active) {
-        out[i] = n[i] * (useImm ? imm : m[i]);
-      } else
-        out[i] = n[i];
+    if (useImm) {
+      return sveMergePredicated<T>(p, n, VL_bits,
+                                   [&](int i) -> T { return n[i] * imm; });
     }
-    return {out, 256};
+    return sveMergePredicated<T>(p, n, VL_bits,
+                                 [&](int i) -> T { return n[i] * m[i]; });
   }
 
   /** Helper function for SVE instructions with the format `mulh zdn, pg/m, zdn,
@@ -1157,13 +1133,7 @@ class sveHelp {
     const T* n = operands[0].getAsVector<T>();
     const T* m = operands[1].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      out[i] = n[i] | m[i];
-    }
-    return {out, 256};
+    return sveMap<T>(VL_bits, [&](int i) -> T { return n[i] | m[i]; });
   }
 
   /** Helper function for SVE instructions with the format `ptrue pd{,
@@ -1272,16 +1242,8 @@ class sveHelp {
     const T* n = operands[1].getAsVector<T>();
     const T* m = operands[2].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active)
-        out[i] = n[i];
-      else
-        out[i] = m[i];
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, m, VL_bits,
+                                 [&](int i) -> T { return n[i]; });
   }
 
   /** Helper function for SVE instructions with the format `sminv rd, pg, zn`.
@@ -1315,13 +1277,7 @@ class sveHelp {
     const T* n = operands[0].getAsVector<T>();
     const T* m = operands[1].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      out[i] = n[i] - m[i];
-    }
-    return {out, 256};
+    return sveMap<T>(VL_bits, [&](int i) -> T { return n[i] - m[i]; });
   }
 
   /** Helper function for SVE instructions with the format `Sub zdn, pg/m, zdn,
@@ -1336,18 +1292,8 @@ class sveHelp {
     const T* dn = operands[1].getAsVector<T>();
     const T* m = operands[2].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active) {
-        out[i] = m[i] - dn[i];
-      } else {
-        out[i] = dn[i];
-      }
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, dn, VL_bits,
+                                 [&](int i) -> T { return m[i] - dn[i]; });
   }
 
   /** Helper function for SVE instructions with the format `Sub zdn, pg/m, zdn,
@@ -1364,18 +1310,8 @@ class sveHelp {
     const T* dn = operands[1].getAsVector<T>();
     const auto imm = isFP ? metadata.operands[3].fp : metadata.operands[3].imm;
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active) {
-        out[i] = dn[i] - imm;
-      } else {
-        out[i] = dn[i];
-      }
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, dn, VL_bits,
+                                 [&](int i) -> T { return dn[i] - imm; });
   }
 
   /** Helper function for SVE instructions with the format `sxt<b,h,w> zd, pg,
@@ -1392,19 +1328,11 @@ class sveHelp {
     const uint64_t* p = operands[1].getAsVector<uint64_t>();
     const T* n = operands[2].getAsVector<T>();
 
-    const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
-    T out[256 / sizeof(T)] = {0};
-    for (int i = 0; i < partition_num; i++) {
-      uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
-      if (p[i / (64 / sizeof(T))] & shifted_active) {
-        // Cast to C to get 'least significant sub-element'
-        // Then cast back to T to sign-extend this 'sub-element'
-        out[i] = static_cast<T>(static_cast<C>(n[i]));
-      } else {
-        out[i] = d[i];
-      }
-    }
-    return {out, 256};
+    return sveMergePredicated<T>(p, d, VL_bits, [&](int i) -> T {
+      // Cast to C to get 'least significant sub-element'
+      // Then cast back to T to sign-extend this 'sub-element'
+      return static_cast<T>(static_cast<C>(n[i]));
+    });
   }
 
   /** Helper function for SVE instructions with the format `trn1 zd, zn, zm`.
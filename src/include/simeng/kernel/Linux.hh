@@ -136,6 +136,9 @@ class Linux {
   /** Retrieve the initial stack pointer. */
   uint64_t getInitialStackPointer() const;
 
+  /** Retrieve the path of the executable that created the process. */
+  std::string getProcessPath() const;
+
   /** brk syscall: change data segment size. Sets the program break to
    * `addr` if reasonable, and returns the program break. */
   int64_t brk(uint64_t addr);
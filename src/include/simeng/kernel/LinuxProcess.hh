@@ -68,6 +68,11 @@ class LinuxProcess {
   /** Get the entry point. */
   uint64_t getEntryPoint() const;
 
+  /** Get the regions of the process image holding executable code, as
+   * (address, size) pairs. */
+  const std::vector<std::pair<uint64_t, uint64_t>>& getExecutableRegions()
+      const;
+
   /** Get the initial stack pointer address. */
   uint64_t getStackPointer() const;
 
@@ -90,6 +95,10 @@ class LinuxProcess {
   /** The entry point of the process. */
   uint64_t entryPoint_ = 0;
 
+  /** The regions of the process image holding executable code, as (address,
+   * size) pairs. */
+  std::vector<std::pair<uint64_t, uint64_t>> executableRegions_;
+
   /** The address of the start of the heap region. */
   uint64_t heapStart_;
 
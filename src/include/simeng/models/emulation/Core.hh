@@ -5,6 +5,7 @@
 #include <string>
 
 #include "simeng/ArchitecturalRegisterFileSet.hh"
+#include "simeng/BranchTrace.hh"
 #include "simeng/Core.hh"
 #include "simeng/MemoryInterface.hh"
 #include "simeng/RegisterFileSet.hh"
@@ -20,10 +21,11 @@ class Core : public simeng::Core {
  public:
   /** Construct an emulation-style core, providing memory interfaces for
    * instructions and data, along with the instruction entry point and an ISA to
-   * use. */
+   * use. Executed branches are recorded to `branchTrace` if supplied. */
   Core(MemoryInterface& instructionMemory, MemoryInterface& dataMemory,
        uint64_t entryPoint, uint64_t programByteLength,
-       const arch::Architecture& isa);
+       const arch::Architecture& isa,
+       BranchTraceWriter* branchTrace = nullptr);
 
   /** Tick the core. */
   void tick() override;
@@ -97,6 +99,10 @@ class Core : public simeng::Core {
   /** Is the core waiting on a data read? */
   unsigned int pendingReads_ = 0;
 
+  /** The data read for each memory access of the pending load, indexed by the
+   * access's position in the load's generated addresses. */
+  std::vector<RegisterValue> pendingData_;
+
   /** The number of times this core has been ticked. */
   uint64_t ticks_ = 0;
 
@@ -105,6 +111,10 @@ class Core : public simeng::Core {
 
   /** The number of branches executed. */
   uint64_t branchesExecuted_ = 0;
+
+  /** The branch trace to record executed branches to, or nullptr if not
+   * tracing. */
+  BranchTraceWriter* branchTrace_;
 };
 
 }  // namespace emulation
@@ -93,20 +93,25 @@ class Core : public simeng::Core {
   pipeline::PipelineBuffer<MacroOp> fetchToDecodeBuffer_;
 
   /** The buffer between decode and execute. */
-  pipeline::PipelineBuffer<std::shared_ptr<Instruction>> decodeToExecuteBuffer_;
+  pipeline::PipelineBuffer<std::shared_ptr<Instruction>, 1>
+      decodeToExecuteBuffer_;
 
   /** The buffer between execute and writeback. */
-  std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>>>
+  std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>, 1>>
       completionSlots_;
 
   /** The previously generated addresses. */
   std::queue<simeng::MemoryAccessTarget> previousAddresses_;
 
+  /** The data read for each memory access of the load being handled, indexed
+   * by the access's position in the load's generated addresses. */
+  std::vector<RegisterValue> loadedData_;
+
   /** The fetch unit; fetches instructions from memory. */
   pipeline::FetchUnit fetchUnit_;
 
   /** The decode unit; decodes instructions into uops and reads operands. */
-  pipeline::DecodeUnit decodeUnit_;
+  pipeline::DecodeUnit<1> decodeUnit_;
 
   /** The execute unit; executes uops and sends to writeback, also forwarding
    * results. */
@@ -25,11 +25,13 @@ namespace outoforder {
 class Core : public simeng::Core {
  public:
   /** Construct a core model, providing the process memory, and an ISA, branch
-   * predictor, and port allocator to use. */
+   * predictor, and port allocator to use. Retired branches are recorded to
+   * `branchTrace` if supplied. */
   Core(MemoryInterface& instructionMemory, MemoryInterface& dataMemory,
        uint64_t processMemorySize, uint64_t entryPoint,
        const arch::Architecture& isa, BranchPredictor& branchPredictor,
-       pipeline::PortAllocator& portAllocator, YAML::Node config);
+       pipeline::PortAllocator& portAllocator, YAML::Node config,
+       BranchTraceWriter* branchTrace = nullptr);
 
   /** Tick the core. Ticks each of the pipeline stages sequentially, then ticks
    * the buffers between them. Checks for and executes pipeline flushes at the
@@ -97,12 +99,12 @@ class Core : public simeng::Core {
       renameToDispatchBuffer_;
 
   /** The issue ports; single-width buffers between issue and execute. */
-  std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>>>
+  std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>, 1>>
       issuePorts_;
 
   /** The completion slots; single-width buffers between execute and writeback.
    */
-  std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>>>
+  std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>, 1>>
       completionSlots_;
 
   /** The core's load/store queue. */
@@ -115,7 +117,7 @@ class Core : public simeng::Core {
   pipeline::ReorderBuffer reorderBuffer_;
 
   /** The decode unit; decodes instructions into uops and reads operands. */
-  pipeline::DecodeUnit decodeUnit_;
+  pipeline::DecodeUnit<> decodeUnit_;
 
   /** The rename unit; renames instruction registers. */
   pipeline::RenameUnit renameUnit_;
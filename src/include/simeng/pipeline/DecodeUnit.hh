@@ -9,14 +9,23 @@ namespace simeng {
 namespace pipeline {
 
 /** A decode unit for a pipelined processor. Splits pre-decoded macro-ops into
- * uops. */
+ * uops.
+ *
+ * If macro-op fusion is enabled, a uop which the ISA permits to be fused with
+ * the uop following it, and whose result that uop solely depends on, has the
+ * following uop attached as its fused tail. The fused pair then occupies a
+ * single slot, ROB entry, reservation station entry and issue port.
+ *
+ * `OutputWidth` is the compile-time width of the output buffer, or 0 if its
+ * width is only known at run time. */
+template <unsigned short OutputWidth = 0>
 class DecodeUnit {
  public:
   /** Constructs a decode unit with references to input/output buffers and the
-   * current branch predictor. */
+   * current branch predictor, optionally enabling macro-op fusion. */
   DecodeUnit(PipelineBuffer<MacroOp>& input,
-             PipelineBuffer<std::shared_ptr<Instruction>>& output,
-             BranchPredictor& predictor);
+             PipelineBuffer<std::shared_ptr<Instruction>, OutputWidth>& output,
+             BranchPredictor& predictor, bool fuseMacroOps = false);
 
   /** Ticks the decode unit. Breaks macro-ops into uops, and performs early
    * branch misprediction checks. */
@@ -33,20 +42,29 @@ class DecodeUnit {
    * discovering a branch misprediction early. */
   uint64_t getEarlyFlushes() const;
 
+  /** Retrieve the number of pairs of uops fused. */
+  uint64_t getFusedPairs() const;
+
   /** Clear the microOps_ queue. */
   void purgeFlushed();
 
  private:
+  /** Check whether `tail` may be fused onto the preceding uop `head`. */
+  bool canFuse(const Instruction& head, const Instruction& tail) const;
+
   /** A buffer of macro-ops to split into uops. */
   PipelineBuffer<MacroOp>& input_;
   /** An internal buffer for storing one or more uops. */
   std::deque<std::shared_ptr<Instruction>> microOps_;
   /** A buffer for writing decoded uops into. */
-  PipelineBuffer<std::shared_ptr<Instruction>>& output_;
+  PipelineBuffer<std::shared_ptr<Instruction>, OutputWidth>& output_;
 
   /** A reference to the current branch predictor. */
   BranchPredictor& predictor_;
 
+  /** Whether macro-op fusion is enabled. */
+  bool fuseMacroOps_;
+
   /** Whether the core should be flushed after this cycle. */
   bool shouldFlush_;
 
@@ -56,6 +74,9 @@ class DecodeUnit {
   /** The number of times that the decode unit requested a flush due to
    * discovering a branch misprediction early. */
   uint64_t earlyFlushes_ = 0;
+
+  /** The number of pairs of uops fused. */
+  uint64_t fusedPairs_ = 0;
 };
 
 }  // namespace pipeline
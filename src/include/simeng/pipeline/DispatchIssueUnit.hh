@@ -57,7 +57,7 @@ class DispatchIssueUnit {
    * physical registers the scoreboard needs to reflect. */
   DispatchIssueUnit(
       PipelineBuffer<std::shared_ptr<Instruction>>& fromRename,
-      std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>& issuePorts,
+      std::vector<PipelineBuffer<std::shared_ptr<Instruction>, 1>>& issuePorts,
       const RegisterFileSet& registerFileSet, PortAllocator& portAllocator,
       const std::vector<uint16_t>& physicalRegisterStructure,
       YAML::Node config);
@@ -104,8 +104,9 @@ class DispatchIssueUnit {
   /** A buffer of instructions to dispatch and read operands for. */
   PipelineBuffer<std::shared_ptr<Instruction>>& input_;
 
-  /** Ports to the execution units, for writing ready instructions to. */
-  std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>& issuePorts_;
+  /** Single-width ports to the execution units, for writing ready
+   * instructions to. */
+  std::vector<PipelineBuffer<std::shared_ptr<Instruction>, 1>>& issuePorts_;
 
   /** A reference to the physical register file set. */
   const RegisterFileSet& registerFileSet_;
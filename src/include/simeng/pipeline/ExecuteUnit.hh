@@ -1,9 +1,9 @@
 #pragma once
 
-#include <deque>
 #include <functional>
 
 #include "simeng/BranchPredictor.hh"
+#include "simeng/CircularBuffer.hh"
 #include "simeng/Instruction.hh"
 #include "simeng/pipeline/PipelineBuffer.hh"
 
@@ -23,22 +23,26 @@ struct ExecutionUnitPipelineEntry {
  * forwards results. */
 class ExecuteUnit {
  public:
-  /** Constructs an execute unit with references to an input and output buffer,
-   * the currently used branch predictor, and handlers for forwarding operands,
-   * loads/stores, and exceptions. */
+  /** Constructs an execute unit with references to a single-width input
+   * buffer, a set of
+   * single-width completion slots, the currently used branch predictor, and
+   * handlers for forwarding operands, loads/stores, and exceptions. The
+   * internal pipeline is sized to hold instructions of up to `maxLatency`
+   * cycles without allocating. */
   ExecuteUnit(
-      PipelineBuffer<std::shared_ptr<Instruction>>& input,
-      PipelineBuffer<std::shared_ptr<Instruction>>& output,
+      PipelineBuffer<std::shared_ptr<Instruction>, 1>& input,
+      span<PipelineBuffer<std::shared_ptr<Instruction>, 1>> output,
       std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
       std::function<void(const std::shared_ptr<Instruction>&)> handleLoad,
       std::function<void(const std::shared_ptr<Instruction>&)> handleStore,
       std::function<void(const std::shared_ptr<Instruction>&)> raiseException,
       BranchPredictor& predictor, bool pipelined = true,
-      const std::vector<uint16_t>& blockingGroups = {});
+      const std::vector<uint16_t>& blockingGroups = {},
+      uint16_t maxLatency = 1);
 
   /** Tick the execute unit. Places incoming instructions into the pipeline and
-   * executes an instruction that has reached the head of the pipeline, if
-   * present. */
+   * executes those that have reached the head of the pipeline, up to one per
+   * completion slot. */
   void tick();
 
   /** Query whether a branch misprediction was discovered this cycle. */
@@ -62,6 +66,13 @@ class ExecuteUnit {
   /** Retrieve the number of branch mispredictions. */
   uint64_t getBranchMispredictedCount() const;
 
+  /** Retrieve the number of indirect branch instructions that have been
+   * executed. */
+  uint64_t getIndirectBranchExecutedCount() const;
+
+  /** Retrieve the number of indirect branch mispredictions. */
+  uint64_t getIndirectBranchMispredictedCount() const;
+
   /** Retrieve the number of active execution cycles. */
   uint64_t getCycles() const;
 
@@ -70,11 +81,28 @@ class ExecuteUnit {
    * results back to dispatch/issue. */
   void execute(std::shared_ptr<Instruction>& uop);
 
-  /** A buffer of instructions to execute. */
-  PipelineBuffer<std::shared_ptr<Instruction>>& input_;
+  /** Execute the tail fused onto `head` using `head`'s results, and forward
+   * the tail's results back to dispatch/issue. */
+  void executeFusedTail(const Instruction& head,
+                        const std::shared_ptr<Instruction>& tail);
+
+  /** Update the branch predictor and statistics with the outcome of an
+   * executed branch, requesting a flush if it was mispredicted. */
+  void resolveBranch(const std::shared_ptr<Instruction>& uop);
+
+  /** Query whether instructions of group `group` block others of the same
+   * group whilst executing. */
+  bool isBlocking(uint16_t group) const {
+    size_t word = group / 64;
+    return word < blockingGroupMask_.size() &&
+           ((blockingGroupMask_[word] >> (group % 64)) & 1);
+  }
+
+  /** The single-width issue port instructions to execute are read from. */
+  PipelineBuffer<std::shared_ptr<Instruction>, 1>& input_;
 
-  /** A buffer for writing executed instructions into. */
-  PipelineBuffer<std::shared_ptr<Instruction>>& output_;
+  /** The completion slots executed instructions are written into. */
+  span<PipelineBuffer<std::shared_ptr<Instruction>, 1>> output_;
 
   /** A function handle called when forwarding operands. */
   std::function<void(span<Register>, span<RegisterValue>)> forwardOperands_;
@@ -98,15 +126,23 @@ class ExecuteUnit {
   /** The execution unit's internal pipeline, holding instructions until their
    * execution latency has expired and they are ready for their final results to
    * be calculated and forwarded. */
-  std::deque<ExecutionUnitPipelineEntry> pipeline_;
+  CircularBuffer<ExecutionUnitPipelineEntry> pipeline_;
 
-  /** A group of operation types that are blocked whilst a similar operation
-   * is being executed. */
-  std::vector<uint16_t> blockingGroups_;
+  /** A bitset of operation types that are blocked whilst a similar operation
+   * is being executed, indexed by instruction group. */
+  std::vector<uint64_t> blockingGroupMask_;
 
-  /** A queue to hold blocked instructions of a similar group type to
-   * blockingGroup_. */
-  std::deque<std::shared_ptr<Instruction>> operationsStalled_;
+  /** A queue to hold blocked instructions of a blocking group type. The front
+   * entry is the blocking instruction currently in the pipeline. */
+  CircularBuffer<std::shared_ptr<Instruction>> operationsStalled_;
+
+  /** The completion slot the next executed instruction is written to. */
+  size_t outputSlot_ = 0;
+
+  /** The number of instructions completed this tick, including loads and
+   * exceptions passed to their handlers rather than a completion slot. At
+   * most one instruction completes per completion slot each tick. */
+  size_t completed_ = 0;
 
   /** Whether the core should be flushed after this cycle. */
   bool shouldFlush_ = false;
@@ -131,6 +167,12 @@ class ExecuteUnit {
   /** The number of branch mispredictions that were observed. */
   uint64_t branchMispredicts_ = 0;
 
+  /** The number of indirect branch instructions that were executed. */
+  uint64_t indirectBranchesExecuted_ = 0;
+
+  /** The number of indirect branch mispredictions that were observed. */
+  uint64_t indirectBranchMispredicts_ = 0;
+
   /** The number of active execution cycles that were observed. */
   uint64_t cycles_ = 0;
 };
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <deque>
 #include <queue>
+#include <vector>
 
 #include "simeng/MemoryInterface.hh"
 #include "simeng/arch/Architecture.hh"
@@ -17,30 +19,106 @@ enum class LoopBufferState {
   SUPPLYING  // Feeding loop buffer content to output buffer
 };
 
-// Struct to hold information about a fetched instruction
-struct loopBufferEntry {
-  // Encoding of the instruction
-  const uint64_t encoding;
+/** A fetch block predicted to lie on the path of execution, held in the fetch
+ * target queue. */
+struct FetchTarget {
+  /** The address at which execution is predicted to enter the block. */
+  uint64_t address;
 
-  // Size of the instruction
-  const uint16_t instructionSize;
+  /** Whether a read of the block has been requested from instruction memory.
+   */
+  bool requested = false;
 
-  // PC of the instruction
-  const uint64_t address;
+  /** Whether the block's data has been supplied by instruction memory. */
+  bool ready = false;
 
-  // Branch prediction made for instruction
-  const BranchPrediction prediction;
+  /** The block's data, once supplied. */
+  RegisterValue data = {};
+};
+
+/** An entry in the fetch target buffer, recording the taken branch last seen
+ * within a fetch block. */
+struct FetchTargetBufferEntry {
+  /** Whether this entry holds a branch. */
+  bool valid = false;
+
+  /** The address of the fetch block. */
+  uint64_t block = 0;
+
+  /** The offset of the taken branch within the block. */
+  uint16_t branchOffset = 0;
+
+  /** The target of the taken branch. */
+  uint64_t target = 0;
+
+  /** The cycle this entry was last used; used to select a replacement. */
+  uint64_t lastUsed = 0;
+};
+
+/** A pre-decoded macro-op held in a micro-op cache line. */
+struct MicroOpCacheEntry {
+  /** The address of the instruction. */
+  uint64_t address;
+
+  /** The size of the instruction, in bytes. */
+  uint8_t size;
+
+  /** The pre-decoded macro-op, from which new instances are created when it is
+   * supplied. */
+  MacroOp macroOp;
+};
+
+/** A line of the micro-op cache, holding the macro-ops pre-decoded from a
+ * contiguous run of instructions within a single fetch block. */
+struct MicroOpCacheLine {
+  /** Whether this line holds any macro-ops. */
+  bool valid = false;
+
+  /** The address of the fetch block the macro-ops were decoded from. */
+  uint64_t block = 0;
+
+  /** The total number of micro-ops held. */
+  uint16_t uops = 0;
+
+  /** The macro-ops held, in program order. */
+  std::vector<MicroOpCacheEntry> entries;
+
+  /** The cycle this line was last used; used to select a replacement. */
+  uint64_t lastUsed = 0;
 };
 
 /** A fetch and pre-decode unit for a pipelined processor. Responsible for
- * reading instruction memory and maintaining the program counter. */
+ * reading instruction memory and maintaining the program counter.
+ *
+ * If given a non-zero fetch target queue (FTQ) size, the front-end is
+ * decoupled; each cycle, a fetch target buffer (FTB), a set-associative BTB
+ * indexed by fetch block, predicts the block following the last one queued and
+ * adds it to the FTQ. Reads are requested for all queued blocks as they are
+ * added, so that blocks are prefetched ahead of fetch. Fetch consumes blocks
+ * from the head of the FTQ, pre-decoding and predicting them as before; if
+ * fetch leaves the path held in the FTQ, the FTQ is resteered.
+ *
+ * If given a non-zero number of micro-op cache sets, macro-ops pre-decoded
+ * from instruction memory are also recorded in a set-associative micro-op
+ * cache, in lines of contiguous instructions from a single fetch block. When
+ * the program counter hits in the micro-op cache, macro-ops are supplied from
+ * it without accessing instruction memory or pre-decoding. A lookup following
+ * a redirect takes the configured hit latency to supply, and switching between
+ * the micro-op cache and instruction memory costs the configured penalty. */
 class FetchUnit {
  public:
   /** Construct a fetch unit with a reference to an output buffer, the ISA, and
-   * the current branch predictor, and information on the instruction memory. */
+   * the current branch predictor, information on the instruction memory, and
+   * optionally the sizes of the fetch target queue and buffer and the
+   * parameters of the micro-op cache. */
   FetchUnit(PipelineBuffer<MacroOp>& output, MemoryInterface& instructionMemory,
             uint64_t programByteLength, uint64_t entryPoint, uint8_t blockSize,
-            const arch::Architecture& isa, BranchPredictor& branchPredictor);
+            const arch::Architecture& isa, BranchPredictor& branchPredictor,
+            uint16_t targetQueueSize = 0, uint16_t targetBufferEntries = 1024,
+            uint16_t targetBufferWays = 4, uint16_t microOpCacheSets = 0,
+            uint16_t microOpCacheWays = 8, uint16_t microOpCacheLineUops = 6,
+            uint16_t microOpCacheHitLatency = 1,
+            uint16_t microOpCacheSwitchPenalty = 1);
 
   ~FetchUnit();
 
@@ -58,13 +136,29 @@ class FetchUnit {
   /** Update the program counter to the specified address. */
   void updatePC(uint64_t address);
 
-  /** Request instructions at the current program counter for a future cycle. */
+  /** Request instructions at the current program counter for a future cycle.
+   * If decoupled, instead predicts the next fetch block and requests all queued
+   * blocks. */
   void requestFromPC();
 
   /** Retrieve the number of cycles fetch terminated early due to a predicted
    * branch. */
   uint64_t getBranchStalls() const;
 
+  /** Retrieve the number of times the fetch target queue was resteered. */
+  uint64_t getTargetQueueResteers() const;
+
+  /** Retrieve the number of macro-ops supplied by the micro-op cache. */
+  uint64_t getMicroOpCacheHits() const;
+
+  /** Retrieve the number of macro-ops pre-decoded from instruction memory
+   * whilst the micro-op cache is enabled. */
+  uint64_t getMicroOpCacheMisses() const;
+
+  /** Retrieve the number of switches between supplying from the micro-op cache
+   * and from instruction memory. */
+  uint64_t getMicroOpCacheSwitches() const;
+
   /** Clear the loop buffer. */
   void flushLoopBuffer();
 
@@ -87,8 +181,13 @@ class FetchUnit {
   /** Reference to the current branch predictor. */
   BranchPredictor& branchPredictor_;
 
-  /** A loop buffer to supply a detected loop instruction stream. */
-  std::deque<loopBufferEntry> loopBuffer_;
+  /** A loop buffer to supply a detected loop instruction stream. Each entry
+   * holds a pre-decoded macro-op, with its address and branch prediction set,
+   * from which new instances are created as the loop body is supplied. */
+  std::vector<MacroOp> loopBuffer_;
+
+  /** The index of the next loop buffer entry to supply. */
+  size_t loopBufferCursor_ = 0;
 
   /** State of the loop buffer. */
   LoopBufferState loopBufferState_ = LoopBufferState::IDLE;
@@ -116,6 +215,112 @@ class FetchUnit {
 
   /** The amount of data currently in the fetch buffer. */
   uint8_t bufferedBytes_ = 0;
+
+  /** Supply completed instruction memory reads to the queued fetch blocks
+   * awaiting them. */
+  void supplyTargets();
+
+  /** Find the fetch target buffer entry for `block`, or nullptr if none is
+   * held. */
+  FetchTargetBufferEntry* findTarget(uint64_t block);
+
+  /** Train the fetch target buffer with the predicted direction and target of
+   * the branch at `address`. */
+  void trainTarget(uint64_t address, bool taken, uint64_t target);
+
+  /** Advance the loop buffer with a macro-op fetched at the current program
+   * counter, recording it if filling. Returns `true` if the loop body has been
+   * recorded and the loop buffer will begin supplying. */
+  bool trackLoopBuffer(const MacroOp& macroOp);
+
+  /** Supply macro-ops from the micro-op cache, if the program counter hits in
+   * it. Returns `true` if this cycle's fetch was handled by the micro-op cache,
+   * or `false` if fetch should proceed from instruction memory. */
+  bool supplyFromMicroOpCache();
+
+  /** Find the micro-op cache line holding the macro-op at `address`, or nullptr
+   * if none is held. If found, `index` is set to the macro-op's entry within
+   * the line. */
+  MicroOpCacheLine* findMicroOpCacheLine(uint64_t address, size_t& index);
+
+  /** Record a macro-op pre-decoded from instruction memory at the current
+   * program counter in the micro-op cache line being filled. */
+  void fillMicroOpCache(const MacroOp& macroOp, uint8_t size, bool taken);
+
+  /** Insert the line being filled into the micro-op cache, replacing any line
+   * starting at the same address or the least recently used in its set. */
+  void insertMicroOpCacheLine();
+
+  /** The maximum number of blocks held in the fetch target queue; 0 if the
+   * front-end is not decoupled. */
+  uint16_t targetQueueSize_;
+
+  /** The fetch target queue; the blocks predicted to be fetched next, oldest
+   * first. */
+  std::deque<FetchTarget> targetQueue_;
+
+  /** The address from which the next fetch block will be predicted. */
+  uint64_t targetPc_;
+
+  /** The number of ways in each fetch target buffer set. */
+  uint16_t targetBufferWays_;
+
+  /** The fetch target buffer, holding `targetBufferWays_` consecutive entries
+   * per set. */
+  std::vector<FetchTargetBufferEntry> targetBuffer_;
+
+  /** The number of cycles ticked; used to order fetch target buffer use. */
+  uint64_t ticks_ = 0;
+
+  /** The number of times the fetch target queue was resteered. */
+  uint64_t targetQueueResteers_ = 0;
+
+  /** The number of sets in the micro-op cache; 0 if it is disabled. */
+  uint16_t microOpCacheSets_;
+
+  /** The number of ways in each micro-op cache set. */
+  uint16_t microOpCacheWays_;
+
+  /** The maximum number of micro-ops held in a micro-op cache line. */
+  uint16_t microOpCacheLineUops_;
+
+  /** The number of cycles taken to supply from the micro-op cache after a
+   * redirect. */
+  uint16_t microOpCacheHitLatency_;
+
+  /** The number of cycles lost when switching between supplying from the
+   * micro-op cache and from instruction memory. */
+  uint16_t microOpCacheSwitchPenalty_;
+
+  /** The micro-op cache, holding `microOpCacheWays_` consecutive lines per
+   * set. */
+  std::vector<MicroOpCacheLine> microOpCache_;
+
+  /** The line being filled with macro-ops pre-decoded from instruction memory,
+   * not yet inserted into the micro-op cache. */
+  MicroOpCacheLine microOpCacheFill_;
+
+  /** Whether fetch is currently supplied by the micro-op cache. */
+  bool supplyingFromMicroOpCache_ = false;
+
+  /** Whether the program counter has been redirected since the micro-op cache
+   * last supplied; the next lookup is subject to the hit latency. */
+  bool microOpCacheRedirected_ = true;
+
+  /** The number of cycles remaining before fetch may continue, due to micro-op
+   * cache latencies and switch penalties. */
+  uint16_t microOpCacheStall_ = 0;
+
+  /** The number of macro-ops supplied by the micro-op cache. */
+  uint64_t microOpCacheHits_ = 0;
+
+  /** The number of macro-ops pre-decoded whilst the micro-op cache is
+   * enabled. */
+  uint64_t microOpCacheMisses_ = 0;
+
+  /** The number of switches between the micro-op cache and instruction
+   * memory. */
+  uint64_t microOpCacheSwitches_ = 0;
 };
 
 }  // namespace pipeline
@@ -18,12 +18,24 @@ enum accessType { LOAD = 0, STORE };
 
 /** A requestQueue_ entry. */
 struct requestEntry {
-  /** The memory address(es) to be accessed. */
-  std::queue<simeng::MemoryAccessTarget> reqAddresses;
+  /** The memory address(es) to be accessed, each paired with its index within
+   * the instruction's generated addresses. */
+  std::queue<std::pair<simeng::MemoryAccessTarget, uint16_t>> reqAddresses;
   /** The instruction sending the request(s). */
   std::shared_ptr<Instruction> insn;
 };
 
+/** A conflictionMap_ entry. */
+struct conflictEntry {
+  /** The load awaiting data from a conflicting store. */
+  std::shared_ptr<Instruction> load;
+  /** The index of the conflicting access within the load's generated
+   * addresses. */
+  uint16_t index;
+  /** The size of the data needed by the load at the conflicting address. */
+  uint16_t size;
+};
+
 /** A load store queue (known as "load/store buffers" or "memory order buffer").
  * Holds in-flight memory access requests to ensure load/store consistency. */
 class LoadStoreQueue {
@@ -33,7 +45,7 @@ class LoadStoreQueue {
    * and an operand forwarding handler. */
   LoadStoreQueue(
       unsigned int maxCombinedSpace, MemoryInterface& memory,
-      span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots,
+      span<PipelineBuffer<std::shared_ptr<Instruction>, 1>> completionSlots,
       std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
       bool exclusive = false, uint16_t loadBandwidth = UINT16_MAX,
       uint16_t storeBandwidth = UINT16_MAX,
@@ -47,7 +59,7 @@ class LoadStoreQueue {
   LoadStoreQueue(
       unsigned int maxLoadQueueSpace, unsigned int maxStoreQueueSpace,
       MemoryInterface& memory,
-      span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots,
+      span<PipelineBuffer<std::shared_ptr<Instruction>, 1>> completionSlots,
       std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
       bool exclusive = false, uint16_t loadBandwidth = UINT16_MAX,
       uint16_t storeBandwidth = UINT16_MAX,
@@ -111,7 +123,7 @@ class LoadStoreQueue {
       storeQueue_;
 
   /** Slots to write completed load instructions into for writeback. */
-  span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots_;
+  span<PipelineBuffer<std::shared_ptr<Instruction>, 1>> completionSlots_;
 
   /** Map of loads that have requested their data, keyed by sequence ID. */
   std::unordered_map<uint64_t, std::shared_ptr<Instruction>> requestedLoads_;
@@ -156,13 +168,10 @@ class LoadStoreQueue {
   /** A map to hold load instructions that are stalled due to a detected
    * memory reordering confliction. First key is a store's sequence id and the
    * second key the conflicting address. The value takes the form of a vector of
-   * pairs containing a pointer to the conflicted load and the size of the data
-   * needed at that address by the load. */
+   * entries holding the conflicted load, the index of the conflicting access
+   * and the size of the data needed at that address by the load. */
   std::unordered_map<
-      uint64_t,
-      std::unordered_map<
-          uint64_t,
-          std::vector<std::pair<std::shared_ptr<Instruction>, uint16_t>>>>
+      uint64_t, std::unordered_map<uint64_t, std::vector<conflictEntry>>>
       conflictionMap_;
 
   /** A map between LSQ cycles and load requests ready on that cycle. */
@@ -174,6 +183,10 @@ class LoadStoreQueue {
   /** A queue of completed loads ready for writeback. */
   std::queue<std::shared_ptr<Instruction>> completedLoads_;
 
+  /** A reusable buffer gathering the data of completed reads to consecutive
+   * accesses of a load, for supply to the load in a single block. */
+  std::vector<RegisterValue> readData_;
+
   /** Whether the LSQ can only process loads xor stores within a cycle. */
   bool exclusive_;
 
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cassert>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace simeng {
@@ -12,14 +15,24 @@ namespace pipeline {
 // implementation)
 
 /** A tickable pipelined buffer. Values are shifted from the tail slot to the
- * head slot each time `tick()` is called. */
-template <class T>
+ * head slot each time `tick()` is called. If `Width` is non-zero the width is
+ * fixed at compile time and the slots are held inline, allowing loops over
+ * them to be unrolled; otherwise the width is supplied at construction. */
+template <class T, unsigned short Width = 0>
 class PipelineBuffer {
  public:
   /** Construct a pipeline buffer of width `width`, and fill all slots with
-   * `initialValue`. */
-  PipelineBuffer(int width, const T& initialValue)
-      : width(width), buffer(width * length, initialValue) {}
+   * `initialValue`. For fixed-width buffers `width` must equal `Width`. */
+  PipelineBuffer(int width, const T& initialValue) : width(width) {
+    if constexpr (Width == 0) {
+      buffer.assign(width * length, initialValue);
+    } else {
+      assert(width == Width &&
+             "Attempted to construct a fixed-width pipeline buffer with a "
+             "different width");
+      buffer.fill(initialValue);
+    }
+  }
 
   /** Tick the buffer and move head/tail pointers, or do nothing if it's
    * stalled. */
@@ -30,26 +43,14 @@ class PipelineBuffer {
   }
 
   /** Get a tail slots pointer. */
-  T* getTailSlots() {
-    T* ptr = buffer.data();
-    return &ptr[headIsStart * width];
-  }
+  T* getTailSlots() { return &buffer[headIsStart * getWidth()]; }
   /** Get a const tail slots pointer. */
-  const T* getTailSlots() const {
-    const T* ptr = buffer.data();
-    return &ptr[headIsStart * width];
-  }
+  const T* getTailSlots() const { return &buffer[headIsStart * getWidth()]; }
 
   /** Get a head slots pointer. */
-  T* getHeadSlots() {
-    T* ptr = buffer.data();
-    return &ptr[!headIsStart * width];
-  }
+  T* getHeadSlots() { return &buffer[!headIsStart * getWidth()]; }
   /** Get a const head slots pointer. */
-  const T* getHeadSlots() const {
-    const T* ptr = buffer.data();
-    return &ptr[!headIsStart * width];
-  }
+  const T* getHeadSlots() const { return &buffer[!headIsStart * getWidth()]; }
 
   /** Check if the buffer is stalled. */
   bool isStalled() const { return isStalled_; }
@@ -61,23 +62,30 @@ class PipelineBuffer {
   void fill(const T& value) { std::fill(buffer.begin(), buffer.end(), value); }
 
   /** Get the width of the buffer slots. */
-  unsigned short getWidth() const { return width; }
+  unsigned short getWidth() const {
+    if constexpr (Width == 0) {
+      return width;
+    } else {
+      return Width;
+    }
+  }
 
  private:
+  /** The number of stages in the pipeline. */
+  static const unsigned int length = 2;
+
   /** The width of each row of slots. */
   unsigned short width;
 
-  /** The buffer. */
-  std::vector<T> buffer;
+  /** The buffer. Held inline for fixed-width buffers. */
+  std::conditional_t<Width == 0, std::vector<T>, std::array<T, Width * length>>
+      buffer;
 
   /** The offset of the head pointer; either 0 or 1. */
   bool headIsStart = 0;
 
   /** Whether the buffer is stalled or not. */
   bool isStalled_ = false;
-
-  /** The number of stages in the pipeline. */
-  static const unsigned int length = 2;
 };
 
 }  // namespace pipeline
@@ -1,21 +1,63 @@
 #pragma once
 
-#include <queue>
+#include <cstdint>
+#include <deque>
+#include <vector>
 
 #include "simeng/RegisterFileSet.hh"
 
 namespace simeng {
 namespace pipeline {
 
+/** A snapshot of the register renaming state, taken after renaming a branch
+ * instruction. Used to recover the speculative mapping state in a single step
+ * when the branch is found to be mispredicted. */
+struct RenameCheckpoint {
+  /** The ID of the instruction this checkpoint was taken after. */
+  uint64_t instructionId;
+
+  /** A copy of the mapping tables at the time the checkpoint was taken. */
+  std::vector<std::vector<uint16_t>> mappingTable;
+
+  /** Bit-vectors, one per register type, recording the physical registers
+   * allocated since the checkpoint was taken. */
+  std::vector<std::vector<uint64_t>> allocatedSince;
+
+  /** The number of eliminated mappings created before the checkpoint was
+   * taken. */
+  uint64_t eliminations;
+};
+
+/** A mapping created by renaming an eliminated instruction onto an existing
+ * physical register, rather than allocating a new one. */
+struct EliminatedMapping {
+  /** The register type of the mapping. */
+  uint8_t type;
+
+  /** The architectural register remapped. */
+  uint16_t architectural;
+
+  /** The physical register formerly mapped to the architectural register. */
+  uint16_t previous;
+
+  /** The physical register now mapped to the architectural register. */
+  uint16_t current;
+};
+
 /** A Register Alias Table (RAT) implementation. Contains information on
  * the current register renaming state. */
 class RegisterAliasTable {
  public:
   /** Construct a RAT, supplying a description of the architectural register
    * structure, and the corresponding numbers of physical registers that should
-   * be available. */
+   * be available. Up to `checkpointCount` snapshots of the renaming state may
+   * be held simultaneously; a value of 0 disables checkpointing. If
+   * `eliminateMoves` is set, one physical register of each renameable type is
+   * reserved to hold zero, and register moves and zero idioms may be eliminated
+   * by sharing physical registers between architectural registers. */
   RegisterAliasTable(std::vector<RegisterFileStructure> architecturalStructure,
-                     std::vector<uint16_t> physicalStructure);
+                     std::vector<uint16_t> physicalStructure,
+                     uint16_t checkpointCount = 0, bool eliminateMoves = false);
 
   /** Retrieve the current physical register assigned to the provided
    * architectural register. */
@@ -46,7 +88,62 @@ class RegisterAliasTable {
   /** Free the provided physical register. */
   void free(Register physical);
 
+  /** Check whether instructions writing registers of type `type` may be
+   * eliminated by this RAT. */
+  bool canEliminate(uint8_t type) const;
+
+  /** Retrieve the reserved physical register holding zero for registers of
+   * type `type`. */
+  Register getZeroRegister(uint8_t type) const;
+
+  /** Map the provided architectural register onto the existing physical
+   * register `physical`, without allocating. Must be called in program order,
+   * and matched by a later call to `commitEliminated` or `rewindEliminated`. */
+  void eliminate(Register architectural, Register physical);
+
+  /** Commit the oldest eliminated mapping. The physical register previously
+   * mapped to its architectural register is freed once no longer referenced. */
+  void commitEliminated();
+
+  /** Rewind the youngest eliminated mapping, reinstating the former physical
+   * register in the mapping table. */
+  void rewindEliminated();
+
+  /** Check whether the provided physical register is currently referenced by
+   * more than one architectural register, or is a reserved zero register. */
+  bool isShared(Register physical) const;
+
+  /** Query whether checkpointing is enabled for this RAT. */
+  bool checkpointsEnabled() const;
+
+  /** Query whether a checkpoint is available to be taken this cycle. */
+  bool canCheckpoint() const;
+
+  /** Snapshot the current renaming state, associating it with the instruction
+   * `instructionId`. Must be called in program order. */
+  void checkpoint(uint64_t instructionId);
+
+  /** Restore the renaming state recorded after instruction `instructionId`,
+   * discarding it and all younger checkpoints. If no such checkpoint exists,
+   * only the younger checkpoints are discarded and false is returned; the
+   * caller must then rewind the flushed allocations individually. */
+  bool restoreCheckpoint(uint64_t instructionId);
+
+  /** Release all checkpoints taken after instructions up to and including
+   * `instructionId`, as they can no longer be used for recovery. */
+  void releaseCheckpoints(uint64_t instructionId);
+
+  /** Get the number of checkpoints currently held. */
+  unsigned int getCheckpointCount() const;
+
  private:
+  /** Mark physical register `tag` of type `type` as free. */
+  void pushFree(uint8_t type, uint16_t tag);
+
+  /** Drop a reference to physical register `tag` of type `type`, freeing it if
+   * no references remain. */
+  void release(uint8_t type, uint16_t tag);
+
   /** The register mapping tables. Holds a map of architectural -> physical
    * register mappings for each register type. */
   std::vector<std::vector<uint16_t>> mappingTable_;
@@ -60,9 +157,42 @@ class RegisterAliasTable {
    * register mappings for each register type. Used for rewind behaviour. */
   std::vector<std::vector<uint16_t>> destinationTable_;
 
-  /** The free register queues. Holds a list of unallocated physical registers
-   * for each register type. */
-  std::vector<std::queue<uint16_t>> freeQueues_;
+  /** The register reference counts. Holds the number of architectural names,
+   * speculative or committed, referring to each physical register of each
+   * type. Only exceeds 1 for registers shared by eliminated instructions. */
+  std::vector<std::vector<uint16_t>> referenceCounts_;
+
+  /** The reserved zero physical register for each register type, or the
+   * number of physical registers of that type if none is reserved. */
+  std::vector<uint16_t> zeroRegisters_;
+
+  /** The in-flight eliminated mappings, oldest first. */
+  std::deque<EliminatedMapping> eliminated_;
+
+  /** The total number of eliminated mappings created and not rewound. */
+  uint64_t eliminations_ = 0;
+
+  /** The free register lists. Holds a bit-vector for each register type, with
+   * a set bit denoting an unallocated physical register. */
+  std::vector<std::vector<uint64_t>> freeLists_;
+
+  /** The number of unallocated physical registers for each register type. */
+  std::vector<uint16_t> freeCounts_;
+
+  /** The physical register from which the search for the next free register
+   * starts, for each register type. Rotating the search start approximates
+   * first-in-first-out reuse of freed registers. */
+  std::vector<uint16_t> freeCursors_;
+
+  /** A circular buffer of checkpoint storage, allocated once at construction.
+   * Active checkpoints are held oldest-first starting at `checkpointHead_`. */
+  std::vector<RenameCheckpoint> checkpoints_;
+
+  /** The index of the oldest active checkpoint. */
+  size_t checkpointHead_ = 0;
+
+  /** The number of active checkpoints. */
+  size_t checkpointsActive_ = 0;
 };
 
 }  // namespace pipeline
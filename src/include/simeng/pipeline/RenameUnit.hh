@@ -41,7 +41,21 @@ class RenameUnit {
    * space for a store operation. */
   uint64_t getStoreQueueStalls() const;
 
+  /** Retrieve the number of cycles stalled due to no rename checkpoint being
+   * available for a branch instruction. */
+  uint64_t getCheckpointStalls() const;
+
+  /** Retrieve the number of register moves eliminated at rename. */
+  uint64_t getMovesEliminated() const;
+
+  /** Retrieve the number of zero idioms eliminated at rename. */
+  uint64_t getZeroIdioms() const;
+
  private:
+  /** Check whether `uop` is a register move or zero idiom which can be
+   * eliminated by the register alias table. */
+  bool canEliminate(const Instruction& uop) const;
+
   /** A buffer of instructions to rename. */
   PipelineBuffer<std::shared_ptr<Instruction>>& input_;
 
@@ -75,6 +89,16 @@ class RenameUnit {
   /** The number of cycles stalled due to insufficient load/store queue space
    * for a store operation. */
   uint64_t sqStalls_ = 0;
+
+  /** The number of cycles stalled due to no rename checkpoint being available
+   * for a branch instruction. */
+  uint64_t checkpointStalls_ = 0;
+
+  /** The number of register moves eliminated. */
+  uint64_t movesEliminated_ = 0;
+
+  /** The number of zero idioms eliminated. */
+  uint64_t zeroIdioms_ = 0;
 };
 
 }  // namespace pipeline
@@ -3,6 +3,7 @@
 #include <deque>
 #include <functional>
 
+#include "simeng/BranchTrace.hh"
 #include "simeng/Instruction.hh"
 #include "simeng/pipeline/LoadStoreQueue.hh"
 #include "simeng/pipeline/RegisterAliasTable.hh"
@@ -28,13 +29,15 @@ struct latestBranch {
 class ReorderBuffer {
  public:
   /** Constructs a reorder buffer of maximum size `maxSize`, supplying a
-   * reference to the register alias table. */
+   * reference to the register alias table, and optionally a branch trace to
+   * record retired branches to. */
   ReorderBuffer(
       unsigned int maxSize, RegisterAliasTable& rat, LoadStoreQueue& lsq,
       std::function<void(const std::shared_ptr<Instruction>&)> raiseException,
       std::function<void(uint64_t branchAddress)> sendLoopBoundary,
       BranchPredictor& predictor, uint16_t loopBufSize,
-      uint16_t loopDetectionThreshold);
+      uint16_t loopDetectionThreshold,
+      BranchTraceWriter* branchTrace = nullptr);
 
   /** Add the provided instruction to the ROB. */
   void reserve(const std::shared_ptr<Instruction>& insn);
@@ -50,7 +53,8 @@ class ReorderBuffer {
   /** Retrieve the current size of the ROB. */
   unsigned int size() const;
 
-  /** Retrieve the current amount of free space in the ROB. */
+  /** Retrieve the current amount of free space in the ROB. Fused tails share
+   * the entry of the instruction they are fused onto, so occupy no space. */
   unsigned int getFreeSpace() const;
 
   /** Query whether a memory order violation was discovered in the most recent
@@ -96,6 +100,9 @@ class ReorderBuffer {
   /** The buffer containing in-flight instructions. */
   std::deque<std::shared_ptr<Instruction>> buffer_;
 
+  /** The number of fused tails held in the buffer. */
+  unsigned int fusedTails_ = 0;
+
   /** Whether the core should be flushed after the most recent commit. */
   bool shouldFlush_ = false;
 
@@ -118,6 +125,10 @@ class ReorderBuffer {
    * considered a loop. */
   uint16_t loopDetectionThreshold_;
 
+  /** The branch trace to record retired branches to, or nullptr if not
+   * tracing. */
+  BranchTraceWriter* branchTrace_;
+
   /** The next available sequence ID. */
   uint64_t seqId_ = 0;
 
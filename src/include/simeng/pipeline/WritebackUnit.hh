@@ -14,7 +14,7 @@ class WritebackUnit {
  public:
   /** Constructs a writeback unit with references to an input buffer and
    * register file to write to. */
-  WritebackUnit(std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>&
+  WritebackUnit(std::vector<PipelineBuffer<std::shared_ptr<Instruction>, 1>>&
                     completionSlots,
                 RegisterFileSet& registerFileSet,
                 std::function<void(uint64_t insnId)> flagMicroOpCommits);
@@ -27,7 +27,8 @@ class WritebackUnit {
 
  private:
   /** Buffers of completed instructions to process. */
-  std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>& completionSlots_;
+  std::vector<PipelineBuffer<std::shared_ptr<Instruction>, 1>>&
+      completionSlots_;
 
   /** The register file set to write results into. */
   RegisterFileSet& registerFileSet_;
@@ -9,8 +9,14 @@ BranchPrediction AlwaysNotTakenPredictor::predict(uint64_t address,
 }
 
 void AlwaysNotTakenPredictor::update(uint64_t address, bool taken,
-                                     uint64_t targetAddress, BranchType type) {}
+                                     uint64_t targetAddress, BranchType type,
+                                     const BranchPrediction& prediction) {}
 
-void AlwaysNotTakenPredictor::flush(uint64_t address) {}
+void AlwaysNotTakenPredictor::repair(uint64_t address, bool taken,
+                                     uint64_t targetAddress, BranchType type,
+                                     const BranchPrediction& prediction) {}
+
+void AlwaysNotTakenPredictor::flush(uint64_t address, BranchType type,
+                                    const BranchPrediction& prediction) {}
 
 }  // namespace simeng
@@ -0,0 +1,82 @@
+#include "simeng/BranchHistory.hh"
+
+#include <algorithm>
+#include <cassert>
+
+namespace simeng {
+
+BranchHistory::BranchHistory(uint16_t maxLength) {
+  // Hold at least the 64 directions of `recent_`, so that removing a direction
+  // can restore the one leaving it
+  size_t minSize = std::max<size_t>(maxLength, 64) + MAX_SPECULATIVE;
+  size_t size = 1;
+  while (size <= minSize) size <<= 1;
+  directions_.resize(size, 0);
+}
+
+uint16_t BranchHistory::addFolded(uint16_t length, uint8_t width) {
+  assert(length < directions_.size() &&
+         "Folded history length exceeds the history held");
+  assert(width > 0 && width < 32 && "Unsupported folded history width");
+
+  // Fold the directions already held into the new view
+  uint32_t value = 0;
+  for (uint16_t age = 0; age < length; age++) {
+    value ^= static_cast<uint32_t>(get(age)) << (age % width);
+  }
+  folded_.push_back({value, length, width});
+  return folded_.size() - 1;
+}
+
+uint32_t BranchHistory::getFolded(uint16_t id) const {
+  return folded_[id].value;
+}
+
+bool BranchHistory::get(uint16_t age) const {
+  return directions_[(head_ - age) & (directions_.size() - 1)];
+}
+
+uint64_t BranchHistory::getRecent() const { return recent_; }
+
+void BranchHistory::push(bool taken) {
+  head_ = (head_ + 1) & (directions_.size() - 1);
+  directions_[head_] = taken;
+  inserted_++;
+  recent_ = (recent_ << 1) | taken;
+
+  for (auto& view : folded_) {
+    // Shift in the newest direction, remove the direction which has left the
+    // view from the position it was folded into, and wrap the overflowing bit
+    view.value = (view.value << 1) | taken;
+    view.value ^= static_cast<uint32_t>(get(view.length))
+                  << (view.length % view.width);
+    view.value ^= view.value >> view.width;
+    view.value &= (1u << view.width) - 1;
+  }
+}
+
+uint64_t BranchHistory::getCheckpoint() const { return inserted_; }
+
+bool BranchHistory::restore(uint64_t checkpoint) {
+  if (checkpoint >= inserted_ || inserted_ - checkpoint > MAX_SPECULATIVE) {
+    return false;
+  }
+
+  while (inserted_ > checkpoint) {
+    bool taken = directions_[head_];
+    for (auto& view : folded_) {
+      // Reverse the update made by push(); remove the newest direction and
+      // restore the direction which left the view, then rotate the value back
+      uint32_t value = view.value ^ taken;
+      value ^= static_cast<uint32_t>(get(view.length))
+               << (view.length % view.width);
+      view.value = (value >> 1) | ((value & 1) << (view.width - 1));
+    }
+    recent_ = (recent_ >> 1) | (static_cast<uint64_t>(get(64)) << 63);
+    head_ = (head_ - 1) & (directions_.size() - 1);
+    inserted_--;
+  }
+  return true;
+}
+
+}  // namespace simeng
@@ -0,0 +1,128 @@
+#include "simeng/BranchTrace.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <limits>
+
+namespace simeng {
+
+using namespace branchTraceFormat;
+
+namespace {
+
+/** The bit of a record's flags field holding whether the branch was taken. */
+constexpr uint8_t TAKEN_FLAG = 0x80;
+
+}  // namespace
+
+BranchTraceWriter::BranchTraceWriter(const std::string& path)
+    : file_(path, std::ios::binary | std::ios::trunc) {
+  if (!file_.is_open()) {
+    std::cerr << "[SimEng:BranchTraceWriter] Could not open branch trace file "
+              << path << std::endl;
+    exit(1);
+  }
+  buffer_.reserve(RECORD_SIZE * BUFFERED_RECORDS);
+
+  file_.write(MAGIC, sizeof(MAGIC));
+  file_.write(reinterpret_cast<const char*>(&VERSION), sizeof(VERSION));
+}
+
+BranchTraceWriter::~BranchTraceWriter() {
+  flushBuffer();
+  file_.close();
+}
+
+void BranchTraceWriter::record(const BranchTraceRecord& record) {
+  // Saturate the instruction gap; a gap this long has no measurable effect on
+  // the instruction counts derived from the trace
+  uint64_t gap = record.instruction - lastInstruction_;
+  uint32_t instructions = static_cast<uint32_t>(
+      std::min<uint64_t>(gap, std::numeric_limits<uint32_t>::max()));
+  lastInstruction_ = record.instruction;
+
+  // Known targets are encoded offsets, so fit within 32 signed bits
+  int32_t knownTarget = static_cast<int32_t>(record.knownTarget);
+  uint8_t flags = static_cast<uint8_t>(record.type) |
+                  (record.taken ? TAKEN_FLAG : 0);
+
+  size_t offset = buffer_.size();
+  buffer_.resize(offset + RECORD_SIZE);
+  char* out = buffer_.data() + offset;
+  std::memcpy(out, &instructions, 4);
+  std::memcpy(out + 4, &record.address, 8);
+  std::memcpy(out + 12, &record.target, 8);
+  std::memcpy(out + 20, &knownTarget, 4);
+  std::memcpy(out + 24, &flags, 1);
+
+  records_++;
+  if (buffer_.size() >= RECORD_SIZE * BUFFERED_RECORDS) flushBuffer();
+}
+
+uint64_t BranchTraceWriter::getRecordCount() const { return records_; }
+
+void BranchTraceWriter::flushBuffer() {
+  file_.write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+}
+
+BranchTraceReader::BranchTraceReader(const std::string& path)
+    : file_(path, std::ios::binary), buffer_(RECORD_SIZE * BUFFERED_RECORDS) {
+  if (!file_.is_open()) {
+    std::cerr << "[SimEng:BranchTraceReader] Could not open branch trace file "
+              << path << std::endl;
+    exit(1);
+  }
+
+  char magic[sizeof(MAGIC)];
+  uint32_t version = 0;
+  file_.read(magic, sizeof(magic));
+  file_.read(reinterpret_cast<char*>(&version), sizeof(version));
+  if (!file_ || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+    std::cerr << "[SimEng:BranchTraceReader] " << path
+              << " is not a branch trace file" << std::endl;
+    exit(1);
+  }
+  if (version != VERSION) {
+    std::cerr << "[SimEng:BranchTraceReader] Unsupported branch trace version "
+              << version << " in " << path << std::endl;
+    exit(1);
+  }
+}
+
+bool BranchTraceReader::next(BranchTraceRecord& record) {
+  if (position_ + RECORD_SIZE > size_ && !fill()) return false;
+
+  const char* in = buffer_.data() + position_;
+  uint32_t instructions;
+  int32_t knownTarget;
+  uint8_t flags;
+  std::memcpy(&instructions, in, 4);
+  std::memcpy(&record.address, in + 4, 8);
+  std::memcpy(&record.target, in + 12, 8);
+  std::memcpy(&knownTarget, in + 20, 4);
+  std::memcpy(&flags, in + 24, 1);
+  position_ += RECORD_SIZE;
+
+  instruction_ += instructions;
+  record.instruction = instruction_;
+  // Sign extend the offset, as it is applied with unsigned arithmetic
+  record.knownTarget =
+      static_cast<uint64_t>(static_cast<int64_t>(knownTarget));
+  record.type = static_cast<BranchType>(flags & ~TAKEN_FLAG);
+  record.taken = (flags & TAKEN_FLAG) != 0;
+  return true;
+}
+
+bool BranchTraceReader::fill() {
+  // Move any partial record to the start of the buffer before reading more
+  size_t remaining = size_ - position_;
+  std::memmove(buffer_.data(), buffer_.data() + position_, remaining);
+  file_.read(buffer_.data() + remaining, buffer_.size() - remaining);
+  size_ = remaining + file_.gcount();
+  position_ = 0;
+  return size_ >= RECORD_SIZE;
+}
+
+}  // namespace simeng
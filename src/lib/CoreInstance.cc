@@ -207,11 +207,52 @@ void CoreInstance::createCore() {
   }
 
   // Construct architecture object
-  arch_ =
+  auto arch =
       std::make_unique<simeng::arch::aarch64::Architecture>(kernel_, config_);
 
+  // Decode the executable's code ahead of simulation if requested
+  uint16_t predecodeThreads =
+      config_["Core"]["Predecode-Threads"].IsDefined()
+          ? config_["Core"]["Predecode-Threads"].as<uint16_t>()
+          : 0;
+  if (predecodeThreads > 0) {
+    uint64_t decoded = arch->predecodeRegions(
+        process_->getProcessImage().get(), process_->getExecutableRegions(),
+        predecodeThreads);
+    std::cout << "[SimEng:CoreInstance] Pre-decoded " << decoded
+              << " instructions" << std::endl;
+  }
+  arch_ = std::move(arch);
+
   // Construct branch predictor object
-  predictor_ = std::make_unique<simeng::GenericPredictor>(config_);
+  std::string predictorType =
+      config_["Branch-Predictor"]["Type"].IsDefined()
+          ? config_["Branch-Predictor"]["Type"].as<std::string>()
+          : "Generic";
+  if (predictorType == "TAGE") {
+    auto tage = std::make_unique<simeng::TagePredictor>(config_);
+    std::cout << "[SimEng:CoreInstance] TAGE predictor storage budget: "
+              << tage->getStorageBits() / 8 << " bytes" << std::endl;
+    predictor_ = std::move(tage);
+  } else if (predictorType == "Perceptron") {
+    auto perceptron = std::make_unique<simeng::PerceptronPredictor>(config_);
+    std::cout << "[SimEng:CoreInstance] Perceptron predictor storage budget: "
+              << perceptron->getStorageBits() / 8 << " bytes" << std::endl;
+    predictor_ = std::move(perceptron);
+  } else {
+    predictor_ = std::make_unique<simeng::GenericPredictor>(config_);
+  }
+
+  // Open a branch trace if one has been requested
+  std::string branchTracePath =
+      config_["Core"]["Branch-Trace-File"].IsDefined()
+          ? config_["Core"]["Branch-Trace-File"].as<std::string>()
+          : "";
+  if (branchTracePath != "") {
+    branchTrace_ = std::make_unique<simeng::BranchTraceWriter>(branchTracePath);
+    std::cout << "[SimEng:CoreInstance] Recording branch trace to "
+              << branchTracePath << std::endl;
+  }
 
   // Extract port arrangement from config file
   auto config_ports = config_["Ports"];
@@ -231,7 +272,7 @@ void CoreInstance::createCore() {
   if (mode_ == SimulationMode::Emulation) {
     core_ = std::make_shared<simeng::models::emulation::Core>(
         *instructionMemory_, *dataMemory_, entryPoint, processMemorySize_,
-        *arch_);
+        *arch_, branchTrace_.get());
   } else if (mode_ == SimulationMode::InOrderPipelined) {
     core_ = std::make_shared<simeng::models::inorder::Core>(
         *instructionMemory_, *dataMemory_, processMemorySize_, entryPoint,
@@ -239,7 +280,7 @@ void CoreInstance::createCore() {
   } else if (mode_ == SimulationMode::OutOfOrder) {
     core_ = std::make_shared<simeng::models::outoforder::Core>(
         *instructionMemory_, *dataMemory_, processMemorySize_, entryPoint,
-        *arch_, *predictor_, *portAllocator_, config_);
+        *arch_, *predictor_, *portAllocator_, config_, branchTrace_.get());
   }
 
   createSpecialFileDirectory();
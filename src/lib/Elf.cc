@@ -134,7 +134,7 @@ Elf::Elf(std::string path, char** imagePointer) {
     // Each address-related field is 8 bytes in a 64-bit ELF file
     const int fieldBytes = 8;
     file.read(reinterpret_cast<char*>(&(header.type)), sizeof(header.type));
-    file.seekg(4, std::ios::cur);  // Skip flags
+    file.read(reinterpret_cast<char*>(&(header.flags)), sizeof(header.flags));
     file.read(reinterpret_cast<char*>(&(header.offset)), fieldBytes);
     file.read(reinterpret_cast<char*>(&(header.virtualAddress)), fieldBytes);
     file.read(reinterpret_cast<char*>(&(header.physicalAddress)), fieldBytes);
@@ -183,4 +183,15 @@ uint64_t Elf::getEntryPoint() const { return entryPoint_; }
 
 bool Elf::isValid() const { return isValid_; }
 
+std::vector<std::pair<uint64_t, uint64_t>> Elf::getExecutableRegions() const {
+  std::vector<std::pair<uint64_t, uint64_t>> regions;
+  for (const auto& header : headers_) {
+    // LOAD segments with the PF_X flag set
+    if (header.type == 1 && (header.flags & 0x1)) {
+      regions.push_back({header.virtualAddress, header.fileSize});
+    }
+  }
+  return regions;
+}
+
 }  // namespace simeng
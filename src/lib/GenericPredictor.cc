@@ -14,23 +14,21 @@ GenericPredictor::GenericPredictor(YAML::Node config)
           config["Branch-Predictor"]["Saturating-Count-Bits"].as<uint64_t>()),
       globalHistoryLength_(
           config["Branch-Predictor"]["Global-History-Length"].as<uint64_t>()),
-      rasSize_(config["Branch-Predictor"]["RAS-entries"].as<uint64_t>()) {
-  // Alter globalHistoryLength_ value to better suit required format in update()
+      history_(globalHistoryLength_),
+      ras_(config["Branch-Predictor"]["RAS-entries"].as<uint64_t>()),
+      indirect_(config) {
+  // Alter globalHistoryLength_ value to better suit required format in predict()
   globalHistoryLength_ = (1 << globalHistoryLength_) - 1;
 }
 
-GenericPredictor::~GenericPredictor() {
-  btb_.clear();
-  ras_.clear();
-  rasHistory_.clear();
-}
+GenericPredictor::~GenericPredictor() { btb_.clear(); }
 
 BranchPrediction GenericPredictor::predict(uint64_t address, BranchType type,
                                            uint64_t knownTarget) {
   // Get index via an XOR hash between the global history and the lower btbBits_
   // bits of the instruction address
-  uint64_t hashedIndex = (address & ((1 << btbBits_) - 1)) ^ globalHistory_;
-  btbHistory_[address] = hashedIndex;
+  uint64_t hashedIndex = (address & ((1 << btbBits_) - 1)) ^
+                         (history_.getRecent() & globalHistoryLength_);
 
   // Get prediction from BTB
   bool direction =
@@ -38,6 +36,11 @@ BranchPrediction GenericPredictor::predict(uint64_t address, BranchType type,
   uint64_t target =
       (knownTarget != 0) ? address + knownTarget : btb_[hashedIndex].second;
   BranchPrediction prediction = {direction, target};
+  // Record the index used so the same entry is updated, and the speculative
+  // state to repair on a misprediction
+  prediction.state = hashedIndex;
+  prediction.historyCheckpoint = history_.getCheckpoint();
+  prediction.rasCheckpoint = ras_.getCheckpoint();
 
   // Ammend prediction based on branch type
   if (type == BranchType::Unconditional) {
@@ -45,31 +48,29 @@ BranchPrediction GenericPredictor::predict(uint64_t address, BranchType type,
   } else if (type == BranchType::Return) {
     prediction.taken = true;
     // Return branches can use the RAS if an entry is available
-    if (ras_.size() > 0) {
-      prediction.target = ras_.back();
-      // Record top of RAS used for target prediction
-      rasHistory_[address] = ras_.back();
-      ras_.pop_back();
-    }
+    uint64_t returnAddress = ras_.pop();
+    if (returnAddress != 0) prediction.target = returnAddress;
   } else if (type == BranchType::SubroutineCall) {
     prediction.taken = true;
     // Subroutine call branches must push their assoicated return address to RAS
-    if (ras_.size() >= rasSize_) {
-      ras_.pop_front();
-    }
-    ras_.push_back(address + 4);
-    // Record that this address is a branch-and-link instruction
-    rasHistory_[address] = 0;
+    ras_.push(address + 4);
   } else if (type == BranchType::Conditional) {
     if (!prediction.taken) prediction.target = address + 4;
   }
+
+  // Predict the targets of indirect branches
+  indirect_.predict(address, type, knownTarget, prediction);
+
+  // Speculatively update global history with the predicted direction
+  history_.push(prediction.taken);
   return prediction;
 }
 
 void GenericPredictor::update(uint64_t address, bool taken,
-                              uint64_t targetAddress, BranchType type) {
-  // Get previous index calculated for the instruction address supplied
-  uint64_t hashedIndex = btbHistory_[address];
+                              uint64_t targetAddress, BranchType type,
+                              const BranchPrediction& prediction) {
+  // Get the index calculated when the prediction was made
+  uint64_t hashedIndex = prediction.state;
 
   // Calculate 2-bit saturating counter value
   uint8_t satCntVal = btb_[hashedIndex].first;
@@ -82,32 +83,44 @@ void GenericPredictor::update(uint64_t address, bool taken,
   // Update BTB entry
   btb_[hashedIndex] = {satCntVal, targetAddress};
 
-  // Update global history value with new direction
-  globalHistory_ = ((globalHistory_ << 1) | taken) & globalHistoryLength_;
-  return;
+  indirect_.update(address, taken, targetAddress, prediction);
+
+  // On a misprediction, all later predictions were made down the wrong path;
+  // repair the global history and RAS, then apply this branch's outcome
+  bool mispredicted = (taken != prediction.taken) ||
+                      (targetAddress != prediction.target);
+  if (mispredicted) repairHistory(address, taken, type, prediction);
+}
+
+void GenericPredictor::flush(uint64_t address, BranchType type,
+                             const BranchPrediction& prediction) {
+  // Repair the global history and RAS to their state before this branch was
+  // predicted. As branches are flushed youngest first, this leaves the state
+  // before the oldest flushed branch.
+  if (history_.restore(prediction.historyCheckpoint)) {
+    ras_.restore(prediction.rasCheckpoint);
+  }
+  indirect_.flush(prediction);
 }
 
-void GenericPredictor::flush(uint64_t address) {
-  // If address interacted with RAS, rewind entry
-  auto it = rasHistory_.find(address);
-  if (it != rasHistory_.end()) {
-    uint64_t target = it->second;
-    if (target != 0) {
-      // If history entry belongs to a return instruction, push target back onto
-      // stack
-      if (ras_.size() >= rasSize_) {
-        ras_.pop_front();
-      }
-      ras_.push_back(target);
-    } else {
-      // If history entry belongs to a branch-and-link instruction, pop target
-      // off of stack
-      if (ras_.size()) {
-        ras_.pop_back();
-      }
-    }
-    rasHistory_.erase(it);
+void GenericPredictor::repair(uint64_t address, bool taken,
+                              uint64_t targetAddress, BranchType type,
+                              const BranchPrediction& prediction) {
+  indirect_.repair(taken, targetAddress, prediction);
+  repairHistory(address, taken, type, prediction);
+}
+
+void GenericPredictor::repairHistory(uint64_t address, bool taken,
+                                     BranchType type,
+                                     const BranchPrediction& prediction) {
+  if (!history_.restore(prediction.historyCheckpoint)) return;
+  ras_.restore(prediction.rasCheckpoint);
+  if (type == BranchType::Return) {
+    ras_.pop();
+  } else if (type == BranchType::SubroutineCall) {
+    ras_.push(address + 4);
   }
+  history_.push(taken);
 }
 
 }  // namespace simeng
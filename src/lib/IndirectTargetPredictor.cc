@@ -0,0 +1,201 @@
+#include "simeng/IndirectTargetPredictor.hh"
+
+#include <cassert>
+#include <cmath>
+
+namespace simeng {
+
+namespace {
+
+/** The maximum value of the 2-bit confidence counters. */
+constexpr uint8_t CONFIDENCE_MAX = 3;
+
+/** The number of indirect branch updates between clearings of the useful
+ * bits. */
+constexpr uint64_t AGING_PERIOD = 1 << 16;
+
+/** Read an optional size from the `Branch-Predictor` section of `config`, or
+ * `fallback` if it is not defined. */
+uint16_t getOption(YAML::Node config, const std::string& option,
+                   uint16_t fallback) {
+  return config["Branch-Predictor"][option].IsDefined()
+             ? config["Branch-Predictor"][option].as<uint16_t>()
+             : fallback;
+}
+
+}  // namespace
+
+IndirectTargetPredictor::IndirectTargetPredictor(YAML::Node config)
+    : numTables_(getOption(config, "Indirect-Tables", 4)),
+      tableBits_(getOption(config, "Indirect-Table-Bits", 9)),
+      tagBits_(getOption(config, "Indirect-Tag-Bits", 9)),
+      tables_(numTables_, std::vector<TaggedEntry>(1 << tableBits_)),
+      historyLengths_(numTables_),
+      history_(getOption(config, "Indirect-Max-History", 64)),
+      indexFolds_(numTables_),
+      tagFolds_(numTables_),
+      tagFoldsShort_(numTables_),
+      predictionStates_(numTables_ > 0 ? PREDICTION_STATE_ENTRIES : 0) {
+  assert(numTables_ <= MAX_TABLES &&
+         "Unsupported number of indirect target predictor tables");
+  assert(tagBits_ > 1 && "Indirect target tags must be at least 2 bits");
+
+  // Space the history lengths geometrically between the minimum and maximum
+  double minHistory = getOption(config, "Indirect-Min-History", 4);
+  double maxHistory = getOption(config, "Indirect-Max-History", 64);
+  for (uint8_t i = 0; i < numTables_; i++) {
+    double ratio = (numTables_ > 1) ? static_cast<double>(i) / (numTables_ - 1)
+                                    : 0.0;
+    historyLengths_[i] = static_cast<uint16_t>(
+        std::round(minHistory * std::pow(maxHistory / minHistory, ratio)));
+
+    indexFolds_[i] = history_.addFolded(historyLengths_[i], tableBits_);
+    tagFolds_[i] = history_.addFolded(historyLengths_[i], tagBits_);
+    tagFoldsShort_[i] = history_.addFolded(historyLengths_[i], tagBits_ - 1);
+  }
+}
+
+void IndirectTargetPredictor::predict(uint64_t address, BranchType type,
+                                      uint64_t knownTarget,
+                                      BranchPrediction& prediction) {
+  if (numTables_ == 0) return;
+  prediction.indirectCheckpoint = history_.getCheckpoint();
+
+  bool indirect = isIndirectBranch(type, knownTarget);
+  if (indirect) {
+    uint64_t pc = address >> 2;
+    uint32_t indexMask = (1 << tableBits_) - 1;
+    uint16_t tagMask = (1 << tagBits_) - 1;
+
+    // Find the two longest-history tables with a matching entry
+    PredictionState state;
+    int alternate = -1;
+    for (int i = numTables_ - 1; i >= 0; i--) {
+      state.indices[i] =
+          (pc ^ (pc >> tableBits_) ^ history_.getFolded(indexFolds_[i])) &
+          indexMask;
+      state.tags[i] = (pc ^ history_.getFolded(tagFolds_[i]) ^
+                       (history_.getFolded(tagFoldsShort_[i]) << 1)) &
+                      tagMask;
+      const auto& entry = tables_[i][state.indices[i]];
+      if (!entry.valid || entry.tag != state.tags[i]) continue;
+      if (state.provider < 0) {
+        state.provider = i;
+      } else if (alternate < 0) {
+        alternate = i;
+      }
+    }
+
+    // Fall back to the BTB's target where no table provides an alternate
+    state.alternateTarget =
+        (alternate >= 0) ? tables_[alternate][state.indices[alternate]].target
+                         : prediction.target;
+    state.target = state.alternateTarget;
+    if (state.provider >= 0) {
+      // A provider without confidence may hold a newly allocated or replaced
+      // target; prefer a matching alternate table if there is one
+      const auto& entry =
+          tables_[state.provider][state.indices[state.provider]];
+      if (entry.confidence > 0 || alternate < 0) state.target = entry.target;
+    }
+    state.id = nextPredictionId_++;
+    predictionStates_[state.id % PREDICTION_STATE_ENTRIES] = state;
+
+    prediction.target = state.target;
+    prediction.indirectState = state.id;
+  }
+
+  // Speculatively update the path history with the predicted outcome
+  history_.push(getPathBit(indirect, prediction.taken, prediction.target));
+}
+
+void IndirectTargetPredictor::update(uint64_t address, bool taken,
+                                     uint64_t targetAddress,
+                                     const BranchPrediction& prediction) {
+  if (numTables_ == 0) return;
+
+  // Retrieve the lookups made by the prediction, if not since overwritten
+  const PredictionState& state =
+      predictionStates_[prediction.indirectState % PREDICTION_STATE_ENTRIES];
+  bool indirect = prediction.indirectState != 0;
+  if (indirect && state.id == prediction.indirectState) {
+    if (state.provider >= 0) {
+      auto& entry = tables_[state.provider][state.indices[state.provider]];
+      if (entry.target == targetAddress) {
+        if (entry.confidence < CONFIDENCE_MAX) entry.confidence++;
+        // The provider is useful where the alternate would have been wrong
+        if (state.alternateTarget != targetAddress) entry.useful = true;
+      } else if (entry.confidence > 0) {
+        entry.confidence--;
+      } else {
+        entry.target = targetAddress;
+        entry.useful = false;
+      }
+    }
+
+    // On a misprediction, allocate an entry in a table using longer history
+    // than the provider, if one is no longer useful
+    if (state.target != targetAddress && state.provider < numTables_ - 1) {
+      bool allocated = false;
+      for (int i = state.provider + 1; i < numTables_; i++) {
+        auto& entry = tables_[i][state.indices[i]];
+        if (!entry.useful) {
+          entry = {true, state.tags[i], targetAddress, 0, false};
+          allocated = true;
+          break;
+        }
+      }
+      if (!allocated) {
+        for (int i = state.provider + 1; i < numTables_; i++) {
+          tables_[i][state.indices[i]].useful = false;
+        }
+      }
+    }
+
+    // Periodically clear all useful bits so stale entries can be replaced
+    updateCount_++;
+    if (updateCount_ % AGING_PERIOD == 0) {
+      for (auto& table : tables_) {
+        for (auto& entry : table) {
+          entry.useful = false;
+        }
+      }
+    }
+  }
+
+  // On a misprediction, repair the path history and apply this branch's
+  // outcome
+  bool mispredicted = (taken != prediction.taken) ||
+                      (targetAddress != prediction.target);
+  if (mispredicted) repair(taken, targetAddress, prediction);
+}
+
+void IndirectTargetPredictor::flush(const BranchPrediction& prediction) {
+  if (numTables_ == 0) return;
+  history_.restore(prediction.indirectCheckpoint);
+}
+
+void IndirectTargetPredictor::repair(bool taken, uint64_t targetAddress,
+                                     const BranchPrediction& prediction) {
+  if (numTables_ == 0) return;
+  if (history_.restore(prediction.indirectCheckpoint)) {
+    history_.push(
+        getPathBit(prediction.indirectState != 0, taken, targetAddress));
+  }
+}
+
+bool IndirectTargetPredictor::getPathBit(bool indirect, bool taken,
+                                         uint64_t target) {
+  if (!indirect) return taken;
+  // Fold the word-aligned target down to its parity
+  uint64_t bits = target >> 2;
+  bits ^= bits >> 32;
+  bits ^= bits >> 16;
+  bits ^= bits >> 8;
+  bits ^= bits >> 4;
+  bits ^= bits >> 2;
+  bits ^= bits >> 1;
+  return bits & 1;
+}
+
+}  // namespace simeng
@@ -58,4 +58,20 @@ void Instruction::setWaitingCommit() { waitingCommit_ = true; }
 bool Instruction::isWaitingCommit() const { return waitingCommit_; }
 int Instruction::getMicroOpIndex() const { return microOpIndex_; }
 
+bool Instruction::isRegisterMove() const { return isRegisterMove_; }
+uint8_t Instruction::getMoveSourceIndex() const { return moveSourceIndex_; }
+bool Instruction::isZeroIdiom() const { return isZeroIdiom_; }
+
+void Instruction::setEliminated() { eliminated_ = true; }
+bool Instruction::isEliminated() const { return eliminated_; }
+
+void Instruction::setFusedTail(const std::shared_ptr<Instruction>& tail) {
+  fusedTail_ = tail;
+  tail->isFusedTail_ = true;
+}
+const std::shared_ptr<Instruction>& Instruction::getFusedTail() const {
+  return fusedTail_;
+}
+bool Instruction::isFusedTail() const { return isFusedTail_; }
+
 }  // namespace simeng
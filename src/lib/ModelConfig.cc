@@ -47,8 +47,9 @@ void ModelConfig::validate() {
   std::string root = "";
   // Core
   root = "Core";
-  subFields = {"Simulation-Mode", "Clock-Frequency", "Timer-Frequency",
-               "Micro-Operations", "Vector-Length"};
+  subFields = {"Simulation-Mode",  "Clock-Frequency",   "Timer-Frequency",
+               "Micro-Operations", "Vector-Length",     "Branch-Trace-File",
+               "Decoder-Mode",     "Decode-Cache-File", "Predecode-Threads"};
   nodeChecker<std::string>(configFile_[root][subFields[0]], subFields[0],
                            {"emulation", "inorderpipelined", "outoforder"},
                            ExpectedValue::String);
@@ -63,12 +64,32 @@ void ModelConfig::validate() {
                         {128, 256, 384, 512, 640, 768, 896, 1024, 1152, 1280,
                          1408, 1536, 1664, 1792, 1920, 2048},
                         ExpectedValue::UInteger, 512);
+  nodeChecker<std::string>(configFile_[root][subFields[5]], subFields[5],
+                           std::vector<std::string>(), ExpectedValue::String,
+                           "");
+  nodeChecker<std::string>(configFile_[root][subFields[6]], subFields[6],
+                           {"capstone", "fast", "verify"},
+                           ExpectedValue::String, "capstone");
+  nodeChecker<std::string>(configFile_[root][subFields[7]], subFields[7],
+                           std::vector<std::string>(), ExpectedValue::String,
+                           "");
+  nodeChecker<uint16_t>(configFile_[root][subFields[8]], subFields[8],
+                        std::make_pair(0, 256), ExpectedValue::UInteger, 0);
   subFields.clear();
 
   // Fetch
   root = "Fetch";
-  subFields = {"Fetch-Block-Size", "Loop-Buffer-Size",
-               "Loop-Detection-Threshold"};
+  subFields = {"Fetch-Block-Size",
+               "Loop-Buffer-Size",
+               "Loop-Detection-Threshold",
+               "Fetch-Target-Queue-Size",
+               "Fetch-Target-Buffer-Entries",
+               "Fetch-Target-Buffer-Ways",
+               "Micro-Op-Cache-Sets",
+               "Micro-Op-Cache-Ways",
+               "Micro-Op-Cache-Line-Uops",
+               "Micro-Op-Cache-Hit-Latency",
+               "Micro-Op-Cache-Switch-Penalty"};
   if (nodeChecker<uint16_t>(configFile_[root][subFields[0]], subFields[0],
                             std::make_pair(4, UINT16_MAX),
                             ExpectedValue::UInteger)) {
@@ -86,8 +107,54 @@ void ModelConfig::validate() {
                         std::make_pair(0, UINT16_MAX), ExpectedValue::UInteger);
   nodeChecker<uint16_t>(configFile_[root][subFields[2]], subFields[2],
                         std::make_pair(0, UINT16_MAX), ExpectedValue::UInteger);
+  nodeChecker<uint16_t>(configFile_[root][subFields[3]], subFields[3],
+                        std::make_pair(0, UINT16_MAX), ExpectedValue::UInteger,
+                        0);
+  if (nodeChecker<uint16_t>(configFile_[root][subFields[4]], subFields[4],
+                            std::make_pair(1, UINT16_MAX),
+                            ExpectedValue::UInteger, 1024) &&
+      nodeChecker<uint16_t>(configFile_[root][subFields[5]], subFields[5],
+                            std::make_pair(1, UINT16_MAX),
+                            ExpectedValue::UInteger, 4)) {
+    // Ensure the fetch target buffer entries divide evenly into sets
+    if (configFile_[root][subFields[4]].as<uint16_t>() %
+            configFile_[root][subFields[5]].as<uint16_t>() !=
+        0) {
+      invalid_ << "\t- Fetch-Target-Buffer-Entries must be a multiple of "
+                  "Fetch-Target-Buffer-Ways\n";
+    }
+  }
+  nodeChecker<uint16_t>(configFile_[root][subFields[6]], subFields[6],
+                        std::make_pair(0, UINT16_MAX), ExpectedValue::UInteger,
+                        0);
+  nodeChecker<uint16_t>(configFile_[root][subFields[7]], subFields[7],
+                        std::make_pair(1, UINT16_MAX), ExpectedValue::UInteger,
+                        8);
+  nodeChecker<uint16_t>(configFile_[root][subFields[8]], subFields[8],
+                        std::make_pair(1, UINT16_MAX), ExpectedValue::UInteger,
+                        6);
+  nodeChecker<uint16_t>(configFile_[root][subFields[9]], subFields[9],
+                        std::make_pair(1, UINT16_MAX), ExpectedValue::UInteger,
+                        1);
+  nodeChecker<uint16_t>(configFile_[root][subFields[10]], subFields[10],
+                        std::make_pair(0, UINT16_MAX), ExpectedValue::UInteger,
+                        1);
   subFields.clear();
 
+  // Macro-Op-Fusion
+  root = "Macro-Op-Fusion";
+  if (configFile_[root].IsDefined() && !(configFile_[root].IsNull())) {
+    for (size_t i = 0; i < configFile_[root].size(); i++) {
+      char ruleNum[50];
+      sprintf(ruleNum, "Fusion rule %zu", i);
+      nodeChecker<std::string>(
+          configFile_[root][i], ruleNum,
+          std::vector<std::string>{"Compare-Branch", "ADRP-ADD", "AESE-AESMC",
+                                   "MOV-MOVK"},
+          ExpectedValue::String);
+    }
+  }
+
   // Process-Image
   root = "Process-Image";
   subFields = {"Heap-Size", "Stack-Size"};
@@ -103,8 +170,26 @@ void ModelConfig::validate() {
 
   // Branch-Predictor
   root = "Branch-Predictor";
-  subFields = {"BTB-Tag-Bits", "Saturating-Count-Bits", "Global-History-Length",
-               "RAS-entries", "Fallback-Static-Predictor"};
+  subFields = {"BTB-Tag-Bits",
+               "Saturating-Count-Bits",
+               "Global-History-Length",
+               "RAS-entries",
+               "Fallback-Static-Predictor",
+               "Type",
+               "TAGE-Tagged-Tables",
+               "TAGE-Table-Bits",
+               "TAGE-Tag-Bits",
+               "TAGE-Min-History",
+               "TAGE-Max-History",
+               "Perceptron-Feature-Tables",
+               "Perceptron-Table-Bits",
+               "Perceptron-Max-History",
+               "Perceptron-Local-History",
+               "Indirect-Tables",
+               "Indirect-Table-Bits",
+               "Indirect-Tag-Bits",
+               "Indirect-Min-History",
+               "Indirect-Max-History"};
   nodeChecker<uint64_t>(configFile_[root][subFields[0]], subFields[0],
                         std::make_pair(1, UINT64_MAX), ExpectedValue::UInteger);
   nodeChecker<uint64_t>(configFile_[root][subFields[2]], subFields[2],
@@ -134,6 +219,55 @@ void ModelConfig::validate() {
               : (weaklyTaken - 1);
     }
   }
+  nodeChecker<std::string>(configFile_[root][subFields[5]], subFields[5],
+                           std::vector<std::string>{"Generic", "TAGE",
+                                                    "Perceptron"},
+                           ExpectedValue::String, std::string("Generic"));
+  nodeChecker<uint16_t>(configFile_[root][subFields[6]], subFields[6],
+                        std::make_pair(1, 16), ExpectedValue::UInteger, 7);
+  nodeChecker<uint16_t>(configFile_[root][subFields[7]], subFields[7],
+                        std::make_pair(1, 20), ExpectedValue::UInteger, 10);
+  nodeChecker<uint16_t>(configFile_[root][subFields[8]], subFields[8],
+                        std::make_pair(2, 16), ExpectedValue::UInteger, 9);
+  if (nodeChecker<uint16_t>(configFile_[root][subFields[9]], subFields[9],
+                            std::make_pair(1, 4096), ExpectedValue::UInteger,
+                            4) &&
+      nodeChecker<uint16_t>(configFile_[root][subFields[10]], subFields[10],
+                            std::make_pair(1, 4096), ExpectedValue::UInteger,
+                            640)) {
+    // Ensure the history lengths form a non-decreasing series
+    if (configFile_[root][subFields[9]].as<uint16_t>() >
+        configFile_[root][subFields[10]].as<uint16_t>()) {
+      invalid_ << "\t- TAGE-Min-History must not exceed TAGE-Max-History\n";
+    }
+  }
+  nodeChecker<uint16_t>(configFile_[root][subFields[11]], subFields[11],
+                        std::make_pair(2, 16), ExpectedValue::UInteger, 8);
+  nodeChecker<uint16_t>(configFile_[root][subFields[12]], subFields[12],
+                        std::make_pair(1, 20), ExpectedValue::UInteger, 10);
+  nodeChecker<uint16_t>(configFile_[root][subFields[13]], subFields[13],
+                        std::make_pair(1, 4096), ExpectedValue::UInteger, 128);
+  nodeChecker<uint16_t>(configFile_[root][subFields[14]], subFields[14],
+                        std::make_pair(0, 16), ExpectedValue::UInteger, 10);
+  nodeChecker<uint16_t>(configFile_[root][subFields[15]], subFields[15],
+                        std::make_pair(0, 16), ExpectedValue::UInteger, 4);
+  nodeChecker<uint16_t>(configFile_[root][subFields[16]], subFields[16],
+                        std::make_pair(1, 20), ExpectedValue::UInteger, 9);
+  nodeChecker<uint16_t>(configFile_[root][subFields[17]], subFields[17],
+                        std::make_pair(2, 16), ExpectedValue::UInteger, 9);
+  if (nodeChecker<uint16_t>(configFile_[root][subFields[18]], subFields[18],
+                            std::make_pair(1, 4096), ExpectedValue::UInteger,
+                            4) &&
+      nodeChecker<uint16_t>(configFile_[root][subFields[19]], subFields[19],
+                            std::make_pair(1, 4096), ExpectedValue::UInteger,
+                            64)) {
+    // Ensure the history lengths form a non-decreasing series
+    if (configFile_[root][subFields[18]].as<uint16_t>() >
+        configFile_[root][subFields[19]].as<uint16_t>()) {
+      invalid_ << "\t- Indirect-Min-History must not exceed "
+                  "Indirect-Max-History\n";
+    }
+  }
   subFields.clear();
 
   // Data Memory
@@ -346,6 +480,16 @@ void ModelConfig::validate() {
                             ExpectedValue::UInteger);
   subFields.clear();
 
+  // Rename
+  root = "Rename";
+  subFields = {"Checkpoints", "Move-Elimination"};
+  nodeChecker<uint16_t>(configFile_[root][subFields[0]], subFields[0],
+                        std::make_pair(0, UINT16_MAX), ExpectedValue::UInteger,
+                        0);
+  nodeChecker<bool>(configFile_[root][subFields[1]], subFields[1],
+                    std::vector<bool>{false, true}, ExpectedValue::Bool, false);
+  subFields.clear();
+
   // Pipeline-Widths
   root = "Pipeline-Widths";
   subFields = {"Commit", "FrontEnd", "LSQ-Completion"};
@@ -0,0 +1,202 @@
+#include "simeng/PerceptronPredictor.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+
+namespace simeng {
+
+namespace {
+
+/** The bounds of the 8-bit signed weights. */
+constexpr int8_t WEIGHT_MAX = 127;
+constexpr int8_t WEIGHT_MIN = -128;
+
+}  // namespace
+
+PerceptronPredictor::PerceptronPredictor(YAML::Node config)
+    : btbBits_(config["Branch-Predictor"]["BTB-Tag-Bits"].as<uint64_t>()),
+      btb_(1 << btbBits_, 0),
+      numTables_(config["Branch-Predictor"]["Perceptron-Feature-Tables"]
+                     .as<uint16_t>()),
+      tableBits_(
+          config["Branch-Predictor"]["Perceptron-Table-Bits"].as<uint16_t>()),
+      localHistoryBits_(config["Branch-Predictor"]["Perceptron-Local-History"]
+                            .as<uint16_t>()),
+      weights_(static_cast<size_t>(numTables_) << tableBits_, 0),
+      maxHistory_(config["Branch-Predictor"]["Perceptron-Max-History"]
+                      .as<uint16_t>()),
+      history_(maxHistory_),
+      localHistories_(localHistoryBits_ > 0 ? (1 << tableBits_) : 0, 0),
+      predictionStates_(PREDICTION_STATE_ENTRIES),
+      ras_(config["Branch-Predictor"]["RAS-entries"].as<uint64_t>()),
+      indirect_(config) {
+  assert(numTables_ > 1 && numTables_ <= MAX_FEATURE_TABLES &&
+         "Unsupported number of perceptron feature tables");
+  assert(localHistoryBits_ <= 16 && "Local histories are limited to 16 bits");
+
+  // Training threshold for the number of weights summed, as proposed by
+  // Jimenez and Lin
+  threshold_ = static_cast<int32_t>(1.93 * numTables_ + 14);
+
+  // The global history segments double in length with age, with the oldest
+  // segment ending at the maximum history length. Tables after the bias table
+  // and, if enabled, before the local history table use global history.
+  uint16_t globalTables = numTables_ - 1 - (localHistoryBits_ > 0 ? 1 : 0);
+  for (uint16_t i = 1; i <= globalTables; i++) {
+    uint16_t length = std::max<uint16_t>(maxHistory_ >> (globalTables - i), i);
+    segmentFolds_.push_back(history_.addFolded(length, tableBits_));
+  }
+}
+
+PerceptronPredictor::~PerceptronPredictor() {
+  btb_.clear();
+  weights_.clear();
+}
+
+BranchPrediction PerceptronPredictor::predict(uint64_t address,
+                                              BranchType type,
+                                              uint64_t knownTarget) {
+  uint64_t pc = address >> 2;
+  uint32_t indexMask = (1 << tableBits_) - 1;
+  uint32_t pcHash = pc ^ (pc >> tableBits_);
+
+  // Select a weight from each table, and sum them
+  PredictionState state;
+  state.positions[0] = pcHash & indexMask;
+  uint32_t previousFold = 0;
+  for (size_t i = 0; i < segmentFolds_.size(); i++) {
+    // Folding is linear, so the segment between two folded lengths is their
+    // difference
+    uint32_t fold = history_.getFolded(segmentFolds_[i]);
+    uint32_t segment = fold ^ previousFold;
+    previousFold = fold;
+    // Scale the address hash by a distinct odd factor per table, so that tables
+    // observing equal segment values select different weights
+    uint32_t index = (pcHash * (2 * i + 3)) ^ segment;
+    state.positions[i + 1] = ((i + 1) << tableBits_) | (index & indexMask);
+  }
+  if (localHistoryBits_ > 0) {
+    uint16_t local = localHistories_[pc & indexMask];
+    uint32_t index = pcHash ^ (static_cast<uint32_t>(local) << 1) ^ local;
+    state.positions[numTables_ - 1] =
+        (static_cast<uint32_t>(numTables_ - 1) << tableBits_) |
+        (index & indexMask);
+  }
+  for (uint8_t i = 0; i < numTables_; i++) {
+    state.sum += weights_[state.positions[i]];
+  }
+  state.id = nextPredictionId_++;
+  predictionStates_[state.id % PREDICTION_STATE_ENTRIES] = state;
+
+  uint64_t target = (knownTarget != 0)
+                        ? address + knownTarget
+                        : btb_[address & ((1 << btbBits_) - 1)];
+  BranchPrediction prediction = {state.sum >= 0, target};
+  prediction.state = state.id;
+  prediction.historyCheckpoint = history_.getCheckpoint();
+  prediction.rasCheckpoint = ras_.getCheckpoint();
+
+  // Ammend prediction based on branch type
+  if (type == BranchType::Unconditional) {
+    prediction.taken = true;
+  } else if (type == BranchType::Return) {
+    prediction.taken = true;
+    // Return branches can use the RAS if an entry is available
+    uint64_t returnAddress = ras_.pop();
+    if (returnAddress != 0) prediction.target = returnAddress;
+  } else if (type == BranchType::SubroutineCall) {
+    prediction.taken = true;
+    // Subroutine call branches must push their assoicated return address to RAS
+    ras_.push(address + 4);
+  } else if (type == BranchType::Conditional) {
+    if (!prediction.taken) prediction.target = address + 4;
+  }
+
+  // Predict the targets of indirect branches
+  indirect_.predict(address, type, knownTarget, prediction);
+
+  // Speculatively update global history with the predicted direction
+  history_.push(prediction.taken);
+  return prediction;
+}
+
+void PerceptronPredictor::update(uint64_t address, bool taken,
+                                 uint64_t targetAddress, BranchType type,
+                                 const BranchPrediction& prediction) {
+  btb_[address & ((1 << btbBits_) - 1)] = targetAddress;
+
+  // Retrieve the lookups made by the prediction, if not since overwritten
+  const PredictionState& state =
+      predictionStates_[prediction.state % PREDICTION_STATE_ENTRIES];
+  bool conditional =
+      (type == BranchType::Conditional || type == BranchType::LoopClosing);
+  if (conditional && state.id == prediction.state) {
+
+    // Train on a misprediction, or when the prediction was not confident
+    bool predictedTaken = state.sum >= 0;
+    if (predictedTaken != taken || std::abs(state.sum) <= threshold_) {
+      for (uint8_t i = 0; i < numTables_; i++) {
+        int8_t& weight = weights_[state.positions[i]];
+        if (taken && weight < WEIGHT_MAX) {
+          weight++;
+        } else if (!taken && weight > WEIGHT_MIN) {
+          weight--;
+        }
+      }
+    }
+
+    if (localHistoryBits_ > 0) {
+      uint16_t& local =
+          localHistories_[(address >> 2) & ((1 << tableBits_) - 1)];
+      local = ((local << 1) | taken) & ((1 << localHistoryBits_) - 1);
+    }
+  }
+
+  indirect_.update(address, taken, targetAddress, prediction);
+
+  // On a misprediction, all later predictions were made down the wrong path;
+  // repair the global history and RAS, then apply this branch's outcome
+  bool mispredicted = (taken != prediction.taken) ||
+                      (targetAddress != prediction.target);
+  if (mispredicted) repairHistory(address, taken, type, prediction);
+}
+
+void PerceptronPredictor::flush(uint64_t address, BranchType type,
+                                const BranchPrediction& prediction) {
+  // Repair the global history and RAS to their state before this branch was
+  // predicted. As branches are flushed youngest first, this leaves the state
+  // before the oldest flushed branch.
+  if (history_.restore(prediction.historyCheckpoint)) {
+    ras_.restore(prediction.rasCheckpoint);
+  }
+  indirect_.flush(prediction);
+}
+
+void PerceptronPredictor::repair(uint64_t address, bool taken,
+                                 uint64_t targetAddress, BranchType type,
+                                 const BranchPrediction& prediction) {
+  indirect_.repair(taken, targetAddress, prediction);
+  repairHistory(address, taken, type, prediction);
+}
+
+void PerceptronPredictor::repairHistory(uint64_t address, bool taken,
+                                        BranchType type,
+                                        const BranchPrediction& prediction) {
+  if (!history_.restore(prediction.historyCheckpoint)) return;
+  ras_.restore(prediction.rasCheckpoint);
+  if (type == BranchType::Return) {
+    ras_.pop();
+  } else if (type == BranchType::SubroutineCall) {
+    ras_.push(address + 4);
+  }
+  history_.push(taken);
+}
+
+uint64_t PerceptronPredictor::getStorageBits() const {
+  // 8-bit weights, the global history, and the local histories
+  return weights_.size() * 8 + maxHistory_ +
+         localHistories_.size() * localHistoryBits_;
+}
+
+}  // namespace simeng
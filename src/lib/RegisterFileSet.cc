@@ -1,5 +1,6 @@
 #include "simeng/RegisterFileSet.hh"
 
+#include <cstring>
 #include <iostream>
 
 namespace simeng {
@@ -17,11 +18,26 @@ bool Register::operator!=(const Register& other) const {
 
 RegisterFileSet::RegisterFileSet(
     std::vector<RegisterFileStructure> registerFileStructures)
-    : registerFiles(registerFileStructures.size()) {
+    : storage_(registerFileStructures.size()),
+      strides_(registerFileStructures.size()),
+      registerFiles(registerFileStructures.size()) {
   for (size_t type = 0; type < registerFileStructures.size(); type++) {
     const auto& structure = registerFileStructures[type];
-    registerFiles[type] = std::vector<RegisterValue>(
-        structure.quantity, RegisterValue(0, structure.bytes));
+    // Pad each register to 8 bytes so that any value can be read in place
+    uint16_t stride = (structure.bytes + 7) & ~7;
+    strides_[type] = stride;
+
+    // Value-initialise the slab so all registers start zeroed
+    size_t slabBytes = static_cast<size_t>(stride) * structure.quantity;
+    storage_[type].resize((slabBytes + sizeof(StorageBlock) - 1) /
+                          sizeof(StorageBlock));
+
+    const char* base = reinterpret_cast<const char*>(storage_[type].data());
+    registerFiles[type].reserve(structure.quantity);
+    for (size_t tag = 0; tag < structure.quantity; tag++) {
+      registerFiles[type].push_back(
+          RegisterValue::view(base + tag * stride, structure.bytes));
+    }
   }
 }
 
@@ -34,7 +50,10 @@ void RegisterFileSet::set(Register reg, const RegisterValue& value) {
          "Attempted to write an zero sized value to a register");
   assert(value.size() == registerFiles[reg.type][reg.tag].size() &&
          "Attempted to write an incorrectly sized value to a register");
-  registerFiles[reg.type][reg.tag] = value;
+  char* dest = reinterpret_cast<char*>(storage_[reg.type].data()) +
+               static_cast<size_t>(reg.tag) * strides_[reg.type];
+  // The source may be a view of this same register, so allow overlap
+  std::memmove(dest, value.getAsVector<char>(), value.size());
 }
 
 }  // namespace simeng
@@ -4,12 +4,68 @@
 
 namespace simeng {
 
-Pool pool = Pool();
-
 RegisterValue::RegisterValue() : bytes(0) {}
 
+RegisterValue::RegisterValue(const RegisterValue& other) { *this = other; }
+
+RegisterValue::RegisterValue(RegisterValue&& other) noexcept {
+  *this = std::move(other);
+}
+
+RegisterValue& RegisterValue::operator=(const RegisterValue& other) {
+  if (this == &other) return *this;
+  if (other.external) {
+    // Materialise the viewed data so this copy no longer depends on it
+    *this = RegisterValue(other.external, other.bytes);
+    return *this;
+  }
+
+  // Take the new reference before releasing the old, in case both refer to
+  // the same buffer
+  if (other.isShared()) references(other.ptr)++;
+  release();
+
+  bytes = other.bytes;
+  external = nullptr;
+  if (isLocal()) {
+    std::memcpy(value, other.value, MAX_LOCAL_BYTES);
+  } else {
+    ptr = other.ptr;
+  }
+  return *this;
+}
+
+RegisterValue& RegisterValue::operator=(RegisterValue&& other) noexcept {
+  if (this == &other) return *this;
+  release();
+
+  bytes = other.bytes;
+  external = other.external;
+  std::memcpy(value, other.value, MAX_LOCAL_BYTES);
+
+  // Leave `other` empty, so that it no longer holds a reference
+  other.bytes = 0;
+  other.external = nullptr;
+  return *this;
+}
+
+RegisterValue RegisterValue::view(const char* ptr, uint16_t bytes) {
+  assert(ptr && "Attempted to create a view of a NULL pointer");
+  RegisterValue result;
+  result.bytes = bytes;
+  result.external = ptr;
+  return result;
+}
+
+RegisterValue RegisterValue::shallowCopy(const RegisterValue& other) {
+  if (other.external) return view(other.external, other.bytes);
+  return other;
+}
+
 RegisterValue::operator bool() const { return (bytes > 0); }
 
+bool RegisterValue::isView() const { return external != nullptr; }
+
 RegisterValue RegisterValue::zeroExtend(uint16_t fromBytes,
                                         uint16_t toBytes) const {
   assert(bytes > 0 && "Attempted to extend an uninitialised RegisterValue");
@@ -19,8 +75,8 @@ RegisterValue RegisterValue::zeroExtend(uint16_t fromBytes,
   auto extended = RegisterValue(0, toBytes);
 
   // Get the appropriate source/destination pointers and copy the data
-  const char* src = (isLocal() ? value : ptr.get());
-  char* dest = (extended.isLocal() ? extended.value : extended.ptr.get());
+  const char* src = data();
+  char* dest = (extended.isLocal() ? extended.value : extended.ptr);
 
   std::memcpy(dest, src, fromBytes);
 
@@ -0,0 +1,37 @@
+#include "simeng/ReturnAddressStack.hh"
+
+#include <cassert>
+
+namespace simeng {
+
+ReturnAddressStack::ReturnAddressStack(uint16_t size) : entries_(size, 0) {
+  assert(size > 0 && "The RAS must hold at least one entry");
+}
+
+void ReturnAddressStack::push(uint64_t address) {
+  top_ = (top_ + 1) % entries_.size();
+  entries_[top_] = address;
+  if (depth_ < entries_.size()) depth_++;
+}
+
+uint64_t ReturnAddressStack::pop() {
+  if (depth_ == 0) return 0;
+
+  uint64_t address = entries_[top_];
+  top_ = (top_ + entries_.size() - 1) % entries_.size();
+  depth_--;
+  return address;
+}
+
+ReturnAddressStack::Checkpoint ReturnAddressStack::getCheckpoint() const {
+  return {top_, depth_, entries_[top_]};
+}
+
+void ReturnAddressStack::restore(const Checkpoint& checkpoint) {
+  top_ = checkpoint.top;
+  depth_ = checkpoint.depth;
+  // Later pushes may have overwritten the top entry
+  entries_[top_] = checkpoint.address;
+}
+
+}  // namespace simeng
@@ -0,0 +1,281 @@
+#include "simeng/TagePredictor.hh"
+
+#include <cassert>
+#include <cmath>
+
+namespace simeng {
+
+namespace {
+
+/** The bounds of the signed 3-bit counters held in tagged table entries. */
+constexpr int8_t COUNTER_MAX = 3;
+constexpr int8_t COUNTER_MIN = -4;
+
+/** The maximum value of the 2-bit useful counters. */
+constexpr uint8_t USEFUL_MAX = 3;
+
+/** The bounds of the signed 4-bit counter choosing alternate predictions. */
+constexpr int8_t USE_ALTERNATE_MAX = 7;
+constexpr int8_t USE_ALTERNATE_MIN = -8;
+
+/** The number of conditional branch updates between agings of the useful
+ * counters. */
+constexpr uint64_t AGING_PERIOD = 1 << 18;
+
+}  // namespace
+
+TagePredictor::TagePredictor(YAML::Node config)
+    : btbBits_(config["Branch-Predictor"]["BTB-Tag-Bits"].as<uint64_t>()),
+      btb_(1 << btbBits_,
+           {config["Branch-Predictor"]["Fallback-Static-Predictor"]
+                .as<uint16_t>(),
+            0}),
+      satCntBits_(
+          config["Branch-Predictor"]["Saturating-Count-Bits"].as<uint64_t>()),
+      numTables_(
+          config["Branch-Predictor"]["TAGE-Tagged-Tables"].as<uint16_t>()),
+      tableBits_(
+          config["Branch-Predictor"]["TAGE-Table-Bits"].as<uint16_t>()),
+      tagBits_(config["Branch-Predictor"]["TAGE-Tag-Bits"].as<uint16_t>()),
+      tables_(numTables_, std::vector<TaggedEntry>(1 << tableBits_)),
+      historyLengths_(numTables_),
+      history_(config["Branch-Predictor"]["TAGE-Max-History"].as<uint16_t>()),
+      indexFolds_(numTables_),
+      tagFolds_(numTables_),
+      tagFoldsShort_(numTables_),
+      predictionStates_(PREDICTION_STATE_ENTRIES),
+      ras_(config["Branch-Predictor"]["RAS-entries"].as<uint64_t>()),
+      indirect_(config) {
+  assert(numTables_ > 0 && numTables_ <= MAX_TAGGED_TABLES &&
+         "Unsupported number of TAGE tagged tables");
+  assert(tagBits_ > 1 && "TAGE tags must be at least 2 bits");
+
+  // Space the history lengths geometrically between the minimum and maximum
+  double minHistory =
+      config["Branch-Predictor"]["TAGE-Min-History"].as<uint16_t>();
+  double maxHistory =
+      config["Branch-Predictor"]["TAGE-Max-History"].as<uint16_t>();
+  for (uint8_t i = 0; i < numTables_; i++) {
+    double ratio = (numTables_ > 1) ? static_cast<double>(i) / (numTables_ - 1)
+                                    : 0.0;
+    historyLengths_[i] = static_cast<uint16_t>(
+        std::round(minHistory * std::pow(maxHistory / minHistory, ratio)));
+
+    indexFolds_[i] = history_.addFolded(historyLengths_[i], tableBits_);
+    tagFolds_[i] = history_.addFolded(historyLengths_[i], tagBits_);
+    tagFoldsShort_[i] = history_.addFolded(historyLengths_[i], tagBits_ - 1);
+  }
+}
+
+TagePredictor::~TagePredictor() {
+  btb_.clear();
+  tables_.clear();
+}
+
+BranchPrediction TagePredictor::predict(uint64_t address, BranchType type,
+                                        uint64_t knownTarget) {
+  uint64_t btbIndex = address & ((1 << btbBits_) - 1);
+  uint64_t pc = address >> 2;
+  uint32_t indexMask = (1 << tableBits_) - 1;
+  uint16_t tagMask = (1 << tagBits_) - 1;
+
+  // Find the two longest-history tagged tables with a matching entry
+  PredictionState state;
+  int alternate = -1;
+  for (int i = numTables_ - 1; i >= 0; i--) {
+    state.indices[i] =
+        (pc ^ (pc >> tableBits_) ^ history_.getFolded(indexFolds_[i])) &
+        indexMask;
+    state.tags[i] = (pc ^ history_.getFolded(tagFolds_[i]) ^
+                     (history_.getFolded(tagFoldsShort_[i]) << 1)) &
+                    tagMask;
+    const auto& entry = tables_[i][state.indices[i]];
+    if (!entry.valid || entry.tag != state.tags[i]) continue;
+    if (state.provider < 0) {
+      state.provider = i;
+    } else if (alternate < 0) {
+      alternate = i;
+    }
+  }
+
+  bool baseTaken = btb_[btbIndex].first >= (1 << (satCntBits_ - 1));
+  state.alternateTaken =
+      (alternate >= 0)
+          ? tables_[alternate][state.indices[alternate]].counter >= 0
+          : baseTaken;
+
+  if (state.provider >= 0) {
+    int8_t counter = tables_[state.provider][state.indices[state.provider]]
+                         .counter;
+    state.providerTaken = counter >= 0;
+    // A weak counter suggests a newly allocated entry, which may be less
+    // accurate than the alternate prediction
+    bool weak = (counter == 0 || counter == -1);
+    state.taken = (weak && useAlternate_ >= 0) ? state.alternateTaken
+                                                : state.providerTaken;
+  } else {
+    state.providerTaken = baseTaken;
+    state.taken = baseTaken;
+  }
+  state.id = nextPredictionId_++;
+  predictionStates_[state.id % PREDICTION_STATE_ENTRIES] = state;
+
+  uint64_t target =
+      (knownTarget != 0) ? address + knownTarget : btb_[btbIndex].second;
+  BranchPrediction prediction = {state.taken, target};
+  prediction.state = state.id;
+  prediction.historyCheckpoint = history_.getCheckpoint();
+  prediction.rasCheckpoint = ras_.getCheckpoint();
+
+  // Ammend prediction based on branch type
+  if (type == BranchType::Unconditional) {
+    prediction.taken = true;
+  } else if (type == BranchType::Return) {
+    prediction.taken = true;
+    // Return branches can use the RAS if an entry is available
+    uint64_t returnAddress = ras_.pop();
+    if (returnAddress != 0) prediction.target = returnAddress;
+  } else if (type == BranchType::SubroutineCall) {
+    prediction.taken = true;
+    // Subroutine call branches must push their assoicated return address to RAS
+    ras_.push(address + 4);
+  } else if (type == BranchType::Conditional) {
+    if (!prediction.taken) prediction.target = address + 4;
+  }
+
+  // Predict the targets of indirect branches
+  indirect_.predict(address, type, knownTarget, prediction);
+
+  // Speculatively update global history with the predicted direction
+  history_.push(prediction.taken);
+  return prediction;
+}
+
+void TagePredictor::update(uint64_t address, bool taken,
+                           uint64_t targetAddress, BranchType type,
+                           const BranchPrediction& prediction) {
+  uint64_t btbIndex = address & ((1 << btbBits_) - 1);
+  btb_[btbIndex].second = targetAddress;
+
+  // Retrieve the lookups made by the prediction, if not since overwritten
+  const PredictionState& state =
+      predictionStates_[prediction.state % PREDICTION_STATE_ENTRIES];
+  bool conditional =
+      (type == BranchType::Conditional || type == BranchType::LoopClosing);
+  if (conditional && state.id == prediction.state) {
+
+    if (state.provider >= 0) {
+      auto& entry = tables_[state.provider][state.indices[state.provider]];
+      if (state.providerTaken != state.alternateTaken) {
+        // Train the choice between a weak provider and the alternate
+        if (entry.counter == 0 || entry.counter == -1) {
+          if (state.alternateTaken == taken) {
+            if (useAlternate_ < USE_ALTERNATE_MAX) useAlternate_++;
+          } else if (useAlternate_ > USE_ALTERNATE_MIN) {
+            useAlternate_--;
+          }
+        }
+        // The provider is useful where it differs from the alternate correctly
+        if (state.providerTaken == taken) {
+          if (entry.useful < USEFUL_MAX) entry.useful++;
+        } else if (entry.useful > 0) {
+          entry.useful--;
+        }
+      }
+      if (taken && entry.counter < COUNTER_MAX) {
+        entry.counter++;
+      } else if (!taken && entry.counter > COUNTER_MIN) {
+        entry.counter--;
+      }
+    } else {
+      // Calculate saturating counter value
+      uint8_t satCntVal = btb_[btbIndex].first;
+      // Only alter value if it would transition to a valid state
+      if (!((satCntVal == (1 << satCntBits_) - 1) && taken) &&
+          !(satCntVal == 0 && !taken)) {
+        satCntVal += taken ? 1 : -1;
+      }
+      btb_[btbIndex].first = satCntVal;
+    }
+
+    // On a misprediction, allocate an entry in a table using longer history
+    // than the provider, preferring those whose entries are no longer useful
+    if (state.taken != taken && state.provider < numTables_ - 1) {
+      bool allocated = false;
+      for (int i = state.provider + 1; i < numTables_; i++) {
+        auto& entry = tables_[i][state.indices[i]];
+        if (entry.useful == 0) {
+          entry = {true, state.tags[i], static_cast<int8_t>(taken ? 0 : -1),
+                   0};
+          allocated = true;
+          break;
+        }
+      }
+      if (!allocated) {
+        for (int i = state.provider + 1; i < numTables_; i++) {
+          auto& entry = tables_[i][state.indices[i]];
+          if (entry.useful > 0) entry.useful--;
+        }
+      }
+    }
+
+    // Periodically age all useful counters so stale entries can be replaced
+    updateCount_++;
+    if (updateCount_ % AGING_PERIOD == 0) {
+      for (auto& table : tables_) {
+        for (auto& entry : table) {
+          entry.useful >>= 1;
+        }
+      }
+    }
+  }
+
+  indirect_.update(address, taken, targetAddress, prediction);
+
+  // On a misprediction, all later predictions were made down the wrong path;
+  // repair the global history and RAS, then apply this branch's outcome
+  bool mispredicted = (taken != prediction.taken) ||
+                      (targetAddress != prediction.target);
+  if (mispredicted) repairHistory(address, taken, type, prediction);
+}
+
+void TagePredictor::flush(uint64_t address, BranchType type,
+                          const BranchPrediction& prediction) {
+  // Repair the global history and RAS to their state before this branch was
+  // predicted. As branches are flushed youngest first, this leaves the state
+  // before the oldest flushed branch.
+  if (history_.restore(prediction.historyCheckpoint)) {
+    ras_.restore(prediction.rasCheckpoint);
+  }
+  indirect_.flush(prediction);
+}
+
+void TagePredictor::repair(uint64_t address, bool taken, uint64_t targetAddress,
+                           BranchType type,
+                           const BranchPrediction& prediction) {
+  indirect_.repair(taken, targetAddress, prediction);
+  repairHistory(address, taken, type, prediction);
+}
+
+void TagePredictor::repairHistory(uint64_t address, bool taken, BranchType type,
+                                  const BranchPrediction& prediction) {
+  if (!history_.restore(prediction.historyCheckpoint)) return;
+  ras_.restore(prediction.rasCheckpoint);
+  if (type == BranchType::Return) {
+    ras_.pop();
+  } else if (type == BranchType::SubroutineCall) {
+    ras_.push(address + 4);
+  }
+  history_.push(taken);
+}
+
+uint64_t TagePredictor::getStorageBits() const {
+  // Base counters, tagged entries (valid bit, 3-bit counter, 2-bit useful
+  // counter and tag), the global history, and the alternate prediction selector
+  uint64_t baseBits = btb_.size() * satCntBits_;
+  uint64_t taggedBits = static_cast<uint64_t>(numTables_) * (1 << tableBits_) *
+                        (1 + 3 + 2 + tagBits_);
+  return baseBits + taggedBits + historyLengths_.back() + 4;
+}
+
+}  // namespace simeng
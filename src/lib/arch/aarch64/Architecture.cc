@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cassert>
+#include <thread>
 
 #include "InstructionMetadata.hh"
 
@@ -24,6 +25,20 @@ Architecture::Architecture(kernel::Linux& kernel, YAML::Node config)
 
   cs_option(capstoneHandle, CS_OPT_DETAIL, CS_OPT_ON);
 
+  fastDecoder_ = std::make_unique<FastDecoder>(config, capstoneHandle);
+
+  std::string decodeCachePath =
+      config["Core"]["Decode-Cache-File"].IsDefined()
+          ? config["Core"]["Decode-Cache-File"].as<std::string>()
+          : "";
+  // Open a persistent decode cache if one has been requested. None is used
+  // when verifying the fast decoder, so that every word is decoded and checked
+  if (decodeCachePath != "" &&
+      fastDecoder_->getMode() != DecoderMode::Verify) {
+    decodeCacheFile_ = std::make_unique<DecodeCacheFile>(
+        decodeCachePath, linux_.getProcessPath(), fastDecoder_->getMode());
+  }
+
   // Generate zero-indexed system register map
   systemRegisterMap_[ARM64_SYSREG_DCZID_EL0] = systemRegisterMap_.size();
   systemRegisterMap_[ARM64_SYSREG_FPCR] = systemRegisterMap_.size();
@@ -41,6 +56,19 @@ Architecture::Architecture(kernel::Linux& kernel, YAML::Node config)
       RegisterType::SYSTEM,
       static_cast<uint16_t>(getSystemRegisterTag(ARM64_SYSREG_PMCCNTR_EL0))};
 
+  // Enable the configured macro-op fusion rules
+  const std::unordered_map<std::string, uint8_t> fusionRuleNames = {
+      {"Compare-Branch", FusionRule::COMPARE_BRANCH},
+      {"ADRP-ADD", FusionRule::ADRP_ADD},
+      {"AESE-AESMC", FusionRule::AESE_AESMC},
+      {"MOV-MOVK", FusionRule::MOV_MOVK}};
+  if (config["Macro-Op-Fusion"].IsDefined()) {
+    for (size_t i = 0; i < config["Macro-Op-Fusion"].size(); i++) {
+      fusionRules_ |=
+          fusionRuleNames.at(config["Macro-Op-Fusion"][i].as<std::string>());
+    }
+  }
+
   // Instantiate an ExecutionInfo entry for each group in the InstructionGroup
   // namespace.
   for (int i = 0; i < NUM_GROUPS; i++) {
@@ -134,6 +162,14 @@ Architecture::Architecture(kernel::Linux& kernel, YAML::Node config)
   }
 }
 Architecture::~Architecture() {
+  if (decodeCacheFile_) {
+    DecodeCacheFile::Decodings decodings;
+    decodings.reserve(decodeCache.size());
+    for (const auto& [word, instruction] : decodeCache) {
+      decodings.push_back({word, &instruction.getMetadata()});
+    }
+    decodeCacheFile_->save(decodings);
+  }
   cs_close(&capstoneHandle);
   decodeCache.clear();
   metadataCache.clear();
@@ -170,23 +206,7 @@ uint8_t Architecture::predecode(const void* ptr, uint8_t bytesAvailable,
   auto iter = decodeCache.find(insn);
   if (iter == decodeCache.end()) {
     // No decoding present. Generate a fresh decoding, and add to cache
-    cs_insn rawInsn;
-    cs_detail rawDetail;
-    rawInsn.detail = &rawDetail;
-
-    size_t size = 4;
-    uint64_t address = 0;
-
-    const uint8_t* encoding = reinterpret_cast<const uint8_t*>(ptr);
-
-    bool success =
-        cs_disasm_iter(capstoneHandle, &encoding, &size, &address, &rawInsn);
-
-    auto metadata =
-        success ? InstructionMetadata(rawInsn) : InstructionMetadata(encoding);
-
-    // Cache the metadata
-    metadataCache.emplace_front(metadata);
+    metadataCache.emplace_front(decodeMetadata(insn, capstoneHandle));
 
     // Create and cache an instruction using the metadata
     iter = decodeCache.try_emplace(insn, *this, metadataCache.front()).first;
@@ -207,6 +227,108 @@ uint8_t Architecture::predecode(const void* ptr, uint8_t bytesAvailable,
   return 4;
 }
 
+uint64_t Architecture::predecodeRegions(
+    const char* image,
+    const std::vector<std::pair<uint64_t, uint64_t>>& regions,
+    uint16_t threads) const {
+  // Gather the distinct instruction words not yet held in the decode cache
+  std::vector<uint32_t> words;
+  for (const auto& [address, size] : regions) {
+    for (uint64_t offset = (address + 3) & ~3ull; offset + 4 <= address + size;
+         offset += 4) {
+      uint32_t word;
+      memcpy(&word, image + offset, 4);
+      words.push_back(word);
+    }
+  }
+  std::sort(words.begin(), words.end());
+  words.erase(std::unique(words.begin(), words.end()), words.end());
+  words.erase(std::remove_if(words.begin(), words.end(),
+                             [](uint32_t word) {
+                               return decodeCache.count(word) > 0;
+                             }),
+              words.end());
+  if (words.empty()) return 0;
+
+  // Decode an equal share of the words on each thread. Capstone handles may
+  // not be shared between threads, so each thread is given its own
+  threads = static_cast<uint16_t>(
+      std::clamp<uint64_t>(threads, 1, std::min<uint64_t>(words.size(), 256)));
+  std::vector<csh> handles(threads);
+  for (csh& handle : handles) {
+    if (cs_open(CS_ARCH_ARM64, CS_MODE_ARM, &handle) != CS_ERR_OK) {
+      std::cerr << "[SimEng:Architecture] Could not create capstone handle"
+                << std::endl;
+      exit(1);
+    }
+    cs_option(handle, CS_OPT_DETAIL, CS_OPT_ON);
+  }
+
+  size_t share = (words.size() + threads - 1) / threads;
+  std::vector<std::vector<InstructionMetadata>> decoded(threads);
+  std::vector<std::thread> workers;
+  for (uint16_t t = 0; t < threads; t++) {
+    workers.emplace_back([&, t]() {
+      size_t begin = std::min(t * share, words.size());
+      size_t end = std::min(begin + share, words.size());
+      decoded[t].reserve(end - begin);
+      for (size_t i = begin; i < end; i++) {
+        decoded[t].push_back(decodeMetadata(words[i], handles[t]));
+      }
+    });
+  }
+  for (auto& worker : workers) worker.join();
+  for (csh& handle : handles) cs_close(&handle);
+
+  // Build the decode cache entries on this thread, as the caches are not
+  // thread-safe
+  for (uint16_t t = 0; t < threads; t++) {
+    size_t begin = std::min(t * share, words.size());
+    for (size_t i = 0; i < decoded[t].size(); i++) {
+      metadataCache.emplace_front(std::move(decoded[t][i]));
+      auto iter = decodeCache
+                      .try_emplace(words[begin + i], *this,
+                                   metadataCache.front())
+                      .first;
+      iter->second.setExecutionInfo(getExecutionInfo(iter->second));
+    }
+  }
+  return words.size();
+}
+
+InstructionMetadata Architecture::decodeMetadata(uint32_t insn,
+                                                 csh handle) const {
+  // Reuse a decoding from a previous run if one is available
+  if (decodeCacheFile_) {
+    auto cachedMetadata = decodeCacheFile_->find(insn);
+    if (cachedMetadata) return *cachedMetadata;
+  }
+
+  auto fastMetadata = fastDecoder_->decode(insn);
+  if (fastMetadata && fastDecoder_->getMode() == DecoderMode::Fast) {
+    return *fastMetadata;
+  }
+
+  cs_insn rawInsn;
+  cs_detail rawDetail;
+  rawInsn.detail = &rawDetail;
+
+  size_t size = 4;
+  uint64_t address = 0;
+
+  const uint8_t* encoding = reinterpret_cast<const uint8_t*>(&insn);
+
+  bool success = cs_disasm_iter(handle, &encoding, &size, &address, &rawInsn);
+
+  auto metadata =
+      success ? InstructionMetadata(rawInsn) : InstructionMetadata(encoding);
+
+  // When verifying, the fast decoding is discarded in favour of Capstone's
+  if (fastMetadata) fastDecoder_->verify(insn, *fastMetadata, metadata);
+
+  return metadata;
+}
+
 ExecutionInfo Architecture::getExecutionInfo(Instruction& insn) const {
   // Asusme no opcode-based override
   ExecutionInfo exeInfo = groupExecutionInfo_.at(insn.getGroup());
@@ -278,6 +400,12 @@ uint8_t Architecture::getMaxInstructionSize() const { return 4; }
 
 uint64_t Architecture::getVectorLength() const { return VL_; }
 
+uint64_t Architecture::getFastDecoderMismatches() const {
+  return fastDecoder_->getMismatchCount();
+}
+
+uint8_t Architecture::getFusionRules() const { return fusionRules_; }
+
 void Architecture::updateSystemTimerRegisters(RegisterFileSet* regFile,
                                               const uint64_t iterations) const {
   // Update the Processor Cycle Counter to total cycles completed.
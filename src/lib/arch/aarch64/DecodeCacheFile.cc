@@ -0,0 +1,305 @@
+#include "simeng/arch/aarch64/DecodeCacheFile.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#include "InstructionMetadata.hh"
+
+namespace simeng {
+namespace arch {
+namespace aarch64 {
+
+using namespace decodeCacheFormat;
+
+struct DecodeCacheFile::Record {
+  /** The instruction word decoded. */
+  uint32_t word;
+
+  /** The offset of the operand string within the string table. */
+  uint32_t operandStrOffset;
+
+  /** The length of the operand string. */
+  uint32_t operandStrLength;
+
+  /** The instruction's mnemonic ID. */
+  uint32_t id;
+
+  /** The instruction's opcode. */
+  uint32_t opcode;
+
+  /** The instruction's encoding. */
+  uint8_t encoding[4];
+
+  /** The instruction's mnemonic. */
+  char mnemonic[CS_MNEMONIC_SIZE];
+
+  /** The implicitly referenced registers. */
+  uint16_t implicitSources[InstructionMetadata::MAX_IMPLICIT_SOURCES];
+
+  /** The implicitly referenced destination registers. */
+  uint16_t
+      implicitDestinations[InstructionMetadata::MAX_IMPLICIT_DESTINATIONS];
+
+  /** The instruction groups this instruction belongs to. */
+  uint8_t groups[InstructionMetadata::MAX_GROUPS];
+
+  /** The number of implicitly referenced registers. */
+  uint8_t implicitSourceCount;
+
+  /** The number of implicitly referenced destination registers. */
+  uint8_t implicitDestinationCount;
+
+  /** The number of instruction groups this instruction belongs to. */
+  uint8_t groupCount;
+
+  /** The condition code of the instruction. */
+  uint8_t cc;
+
+  /** Whether this instruction sets the condition flags. */
+  bool setsFlags;
+
+  /** Whether this instruction performs a base-address register writeback. */
+  bool writeback;
+
+  /** The number of explicit operands. */
+  uint8_t operandCount;
+
+  /** The explicit operands. */
+  cs_arm64_op operands[InstructionMetadata::MAX_OPERANDS];
+};
+
+namespace {
+
+/** The layout of a decode cache file's header. */
+struct Header {
+  char magic[sizeof(MAGIC)];
+  uint32_t version;
+  uint32_t capstoneVersion;
+  uint32_t metadataVersion;
+  uint32_t decoderMode;
+  uint32_t recordSize;
+  uint64_t executableHash;
+  uint64_t recordCount;
+  uint64_t stringsSize;
+};
+
+/** Retrieve the version of the linked Capstone library. */
+uint32_t getCapstoneVersion() { return cs_version(nullptr, nullptr); }
+
+/** Compute the 64-bit FNV-1a hash of the file at `path`, or zero if it could
+ * not be read. */
+uint64_t hashFile(const std::string& path) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file.is_open()) return 0;
+
+  uint64_t hash = 0xcbf29ce484222325;
+  std::vector<char> buffer(1 << 16);
+  while (file) {
+    file.read(buffer.data(), buffer.size());
+    std::streamsize count = file.gcount();
+    for (std::streamsize i = 0; i < count; i++) {
+      hash ^= static_cast<uint8_t>(buffer[i]);
+      hash *= 0x100000001b3;
+    }
+  }
+  // Reserve zero to represent an unreadable executable
+  return hash == 0 ? 1 : hash;
+}
+
+}  // namespace
+
+DecodeCacheFile::DecodeCacheFile(const std::string& path,
+                                 const std::string& executablePath,
+                                 DecoderMode mode)
+    : path_(path), executableHash_(hashFile(executablePath)), mode_(mode) {
+  if (executableHash_ == 0) {
+    std::cerr << "[SimEng:DecodeCacheFile] Could not read executable \""
+              << executablePath << "\"; decode cache disabled" << std::endl;
+    return;
+  }
+  load();
+}
+
+DecodeCacheFile::~DecodeCacheFile() {
+  if (mapping_ != nullptr) munmap(mapping_, mappingSize_);
+}
+
+void DecodeCacheFile::load() {
+  int fd = open(path_.c_str(), O_RDONLY);
+  if (fd < 0) return;
+
+  struct ::stat fileStat;
+  if (fstat(fd, &fileStat) != 0 ||
+      static_cast<size_t>(fileStat.st_size) < sizeof(Header)) {
+    close(fd);
+    return;
+  }
+  mappingSize_ = fileStat.st_size;
+  mapping_ = mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapping_ == MAP_FAILED) {
+    mapping_ = nullptr;
+    return;
+  }
+
+  // Discard files produced for a different executable or build
+  Header header;
+  std::memcpy(&header, mapping_, sizeof(Header));
+  bool valid =
+      std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+      header.version == VERSION &&
+      header.capstoneVersion == getCapstoneVersion() &&
+      header.metadataVersion == InstructionMetadata::FORMAT_VERSION &&
+      header.decoderMode == static_cast<uint32_t>(mode_) &&
+      header.recordSize == sizeof(Record) &&
+      header.executableHash == executableHash_ &&
+      header.recordCount <= (mappingSize_ - sizeof(Header)) / sizeof(Record) &&
+      header.stringsSize == mappingSize_ - sizeof(Header) -
+                                header.recordCount * sizeof(Record);
+  if (!valid) {
+    munmap(mapping_, mappingSize_);
+    mapping_ = nullptr;
+    return;
+  }
+
+  const char* base = static_cast<const char*>(mapping_);
+  records_ = reinterpret_cast<const Record*>(base + sizeof(Header));
+  recordCount_ = header.recordCount;
+  strings_ = base + sizeof(Header) + recordCount_ * sizeof(Record);
+  stringsSize_ = header.stringsSize;
+}
+
+const DecodeCacheFile::Record* DecodeCacheFile::lookup(uint32_t insn) const {
+  if (records_ == nullptr) return nullptr;
+
+  const Record* end = records_ + recordCount_;
+  const Record* record = std::lower_bound(
+      records_, end, insn,
+      [](const Record& lhs, uint32_t word) { return lhs.word < word; });
+  if (record == end || record->word != insn) return nullptr;
+  return record;
+}
+
+std::optional<InstructionMetadata> DecodeCacheFile::find(uint32_t insn) const {
+  const Record* record = lookup(insn);
+  if (record == nullptr) return std::nullopt;
+  hits_++;
+
+  InstructionMetadata metadata(record->encoding);
+  metadata.id = record->id;
+  metadata.opcode = record->opcode;
+  std::memcpy(metadata.mnemonic, record->mnemonic, sizeof(metadata.mnemonic));
+  if (static_cast<uint64_t>(record->operandStrOffset) +
+          record->operandStrLength <=
+      stringsSize_) {
+    metadata.operandStr.assign(strings_ + record->operandStrOffset,
+                               record->operandStrLength);
+  }
+  std::memcpy(metadata.implicitSources, record->implicitSources,
+              sizeof(metadata.implicitSources));
+  metadata.implicitSourceCount = record->implicitSourceCount;
+  std::memcpy(metadata.implicitDestinations, record->implicitDestinations,
+              sizeof(metadata.implicitDestinations));
+  metadata.implicitDestinationCount = record->implicitDestinationCount;
+  std::memcpy(metadata.groups, record->groups, sizeof(metadata.groups));
+  metadata.groupCount = record->groupCount;
+  metadata.cc = record->cc;
+  metadata.setsFlags = record->setsFlags;
+  metadata.writeback = record->writeback;
+  std::memcpy(metadata.operands, record->operands, sizeof(metadata.operands));
+  metadata.operandCount = record->operandCount;
+  return metadata;
+}
+
+void DecodeCacheFile::save(const Decodings& decodings) const {
+  if (executableHash_ == 0) return;
+
+  // Start from the previously cached decodings, adding any new ones
+  std::vector<Record> records;
+  std::string strings;
+  if (records_ != nullptr) {
+    records.assign(records_, records_ + recordCount_);
+    strings.assign(strings_, stringsSize_);
+  }
+  for (const auto& [word, decoding] : decodings) {
+    if (lookup(word) != nullptr) continue;
+
+    const InstructionMetadata& metadata = *decoding;
+    Record record;
+    std::memset(&record, 0, sizeof(Record));
+    record.word = word;
+    record.operandStrOffset = static_cast<uint32_t>(strings.size());
+    record.operandStrLength = static_cast<uint32_t>(metadata.operandStr.size());
+    strings += metadata.operandStr;
+    record.id = metadata.id;
+    record.opcode = metadata.opcode;
+    std::memcpy(record.encoding, metadata.encoding, sizeof(record.encoding));
+    std::memcpy(record.mnemonic, metadata.mnemonic, sizeof(record.mnemonic));
+    std::memcpy(record.implicitSources, metadata.implicitSources,
+                sizeof(record.implicitSources));
+    record.implicitSourceCount = metadata.implicitSourceCount;
+    std::memcpy(record.implicitDestinations, metadata.implicitDestinations,
+                sizeof(record.implicitDestinations));
+    record.implicitDestinationCount = metadata.implicitDestinationCount;
+    std::memcpy(record.groups, metadata.groups, sizeof(record.groups));
+    record.groupCount = metadata.groupCount;
+    record.cc = metadata.cc;
+    record.setsFlags = metadata.setsFlags;
+    record.writeback = metadata.writeback;
+    std::memcpy(record.operands, metadata.operands, sizeof(record.operands));
+    record.operandCount = metadata.operandCount;
+    records.push_back(record);
+  }
+  if (records.size() == recordCount_) return;
+
+  std::sort(records.begin(), records.end(),
+            [](const Record& lhs, const Record& rhs) {
+              return lhs.word < rhs.word;
+            });
+
+  Header header;
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.capstoneVersion = getCapstoneVersion();
+  header.metadataVersion = InstructionMetadata::FORMAT_VERSION;
+  header.decoderMode = static_cast<uint32_t>(mode_);
+  header.recordSize = sizeof(Record);
+  header.executableHash = executableHash_;
+  header.recordCount = records.size();
+  header.stringsSize = strings.size();
+
+  // Write to a temporary file and rename it over the cache, so that
+  // concurrent runs never observe a partially written file
+  std::string temporaryPath = path_ + "." + std::to_string(getpid());
+  std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    std::cerr << "[SimEng:DecodeCacheFile] Could not write decode cache file "
+              << path_ << std::endl;
+    return;
+  }
+  file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+  file.write(reinterpret_cast<const char*>(records.data()),
+             records.size() * sizeof(Record));
+  file.write(strings.data(), strings.size());
+  file.close();
+  if (!file || std::rename(temporaryPath.c_str(), path_.c_str()) != 0) {
+    std::cerr << "[SimEng:DecodeCacheFile] Could not write decode cache file "
+              << path_ << std::endl;
+    std::remove(temporaryPath.c_str());
+  }
+}
+
+uint64_t DecodeCacheFile::getHitCount() const { return hits_; }
+
+}  // namespace aarch64
+}  // namespace arch
+}  // namespace simeng
@@ -0,0 +1,589 @@
+#include "simeng/arch/aarch64/FastDecoder.hh"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+#include "InstructionMetadata.hh"
+
+namespace simeng {
+namespace arch {
+namespace aarch64 {
+
+enum class FastDecoder::Format : uint8_t {
+  /** An explicitly declined encoding. */
+  None,
+  /** `rd|sp, rn|sp, #imm{, lsl #12}` */
+  AddSubImm,
+  /** `rd, rn|sp, #imm{, lsl #12}`, with flags set. */
+  AddSubImmFlags,
+  /** `rd, rn, rm{, shift #amount}` */
+  ShiftedReg,
+  /** `rd, #imm`, as the `mov` alias of `movz`. */
+  MoveWide,
+  /** `rd, #imm{, lsl #shift}`, with the shift fixed by the entry. */
+  MoveKeep,
+  /** `rt, [rn|sp{, #imm}]` */
+  LoadStoreUImm,
+  /** `rt, [rn|sp, #simm]!` */
+  LoadStorePre,
+  /** `rt, [rn|sp], #simm` */
+  LoadStorePost,
+  /** `rt1, rt2, [rn|sp{, #simm}]{!}` */
+  PairOffset,
+  /** `rt1, rt2, [rn|sp], #simm` */
+  PairPost,
+  /** `b|bl label` */
+  Branch,
+  /** `b.cond label` */
+  CondBranch,
+  /** `cbz|cbnz rt, label` */
+  CompareBranch,
+  /** `tbz|tbnz rt, #bit, label` */
+  TestBranch,
+  /** `br|blr|ret rn` */
+  BranchReg,
+  /** `adr|adrp rd, label` */
+  PcRelative,
+  /** `rd, rn, rm, cond` */
+  CondSelect,
+  /** `rd, rn, rm, ra` */
+  MulAdd,
+  /** `vd.T, vn.T, vm.T` or `zd.T, zn.T, zm.T` */
+  Vector3
+};
+
+namespace {
+
+// Extract bits `start` to `start+width` of `value`
+constexpr uint32_t field(uint32_t value, uint8_t start, uint8_t width) {
+  return (value >> start) & ((1u << width) - 1);
+}
+
+// Sign-extend the bitstring of length `length` in the low bits of `value`
+constexpr int64_t signExtend(uint32_t value, uint8_t length) {
+  return static_cast<int64_t>(static_cast<uint64_t>(value) << (64 - length)) >>
+         (64 - length);
+}
+
+/** The condition suffixes of `b.cond`, indexed by condition code. */
+const char* const conditionNames[] = {"eq", "ne", "hs", "lo", "mi", "pl",
+                                      "vs", "vc", "hi", "ls", "ge", "lt",
+                                      "gt", "le", "al", "nv"};
+
+/** The shift types of shifted register operands, indexed by encoded type. */
+const arm64_shifter shiftTypes[] = {ARM64_SFT_LSL, ARM64_SFT_LSR,
+                                    ARM64_SFT_ASR, ARM64_SFT_ROR};
+
+}  // namespace
+
+using F = FastDecoder::Format;
+
+// Encodings are grouped by class following the Arm ARM's top-level encoding
+// tables. Within each class, aliases which Capstone reports with a different
+// mnemonic ID, and encodings left to Capstone, precede the general entry.
+const std::vector<FastDecoder::Entry> FastDecoder::table_ = {
+    // Add/subtract (immediate)
+    {0xFFFFFC1F, 0x1100001F, 0, Opcode::AArch64_ADDWri, F::AddSubImm},
+    {0xFFFFFFE0, 0x110003E0, 0, Opcode::AArch64_ADDWri, F::AddSubImm},
+    {0xFF800000, 0x11000000, 0, Opcode::AArch64_ADDWri, F::AddSubImm},
+    {0xFF80001F, 0x3100001F, 0, Opcode::AArch64_ADDSWri, F::AddSubImmFlags},
+    {0xFF800000, 0x31000000, 0, Opcode::AArch64_ADDSWri, F::AddSubImmFlags},
+    {0xFF800000, 0x51000000, 0, Opcode::AArch64_SUBWri, F::AddSubImm},
+    {0xFF80001F, 0x7100001F, 0, Opcode::AArch64_SUBSWri, F::AddSubImmFlags},
+    {0xFF800000, 0x71000000, 0, Opcode::AArch64_SUBSWri, F::AddSubImmFlags},
+    {0xFFFFFC1F, 0x9100001F, 0, Opcode::AArch64_ADDXri, F::AddSubImm},
+    {0xFFFFFFE0, 0x910003E0, 0, Opcode::AArch64_ADDXri, F::AddSubImm},
+    {0xFF800000, 0x91000000, 0, Opcode::AArch64_ADDXri, F::AddSubImm},
+    {0xFF80001F, 0xB100001F, 0, Opcode::AArch64_ADDSXri, F::AddSubImmFlags},
+    {0xFF800000, 0xB1000000, 0, Opcode::AArch64_ADDSXri, F::AddSubImmFlags},
+    {0xFF800000, 0xD1000000, 0, Opcode::AArch64_SUBXri, F::AddSubImm},
+    {0xFF80001F, 0xF100001F, 0, Opcode::AArch64_SUBSXri, F::AddSubImmFlags},
+    {0xFF800000, 0xF1000000, 0, Opcode::AArch64_SUBSXri, F::AddSubImmFlags},
+
+    // Logical (shifted register); 32-bit shifts of 32 or more are unallocated
+    // and `orn` from the zero register is the unsupported `mvn` alias
+    {0x9F008000, 0x0A008000, 0, 0, F::None},
+    {0x7F2003E0, 0x2A2003E0, 0, 0, F::None},
+    {0xFFE0FFE0, 0x2A0003E0, 0, Opcode::AArch64_ORRWrs, F::ShiftedReg},
+    {0xFF20001F, 0x6A00001F, 0, Opcode::AArch64_ANDSWrs, F::ShiftedReg},
+    {0xFF200000, 0x0A000000, 0, Opcode::AArch64_ANDWrs, F::ShiftedReg},
+    {0xFF200000, 0x0A200000, 0, Opcode::AArch64_BICWrs, F::ShiftedReg},
+    {0xFF200000, 0x2A000000, 0, Opcode::AArch64_ORRWrs, F::ShiftedReg},
+    {0xFF200000, 0x2A200000, 0, Opcode::AArch64_ORNWrs, F::ShiftedReg},
+    {0xFF200000, 0x4A000000, 0, Opcode::AArch64_EORWrs, F::ShiftedReg},
+    {0xFF200000, 0x6A000000, 0, Opcode::AArch64_ANDSWrs, F::ShiftedReg},
+    {0xFF200000, 0x6A200000, 0, Opcode::AArch64_BICSWrs, F::ShiftedReg},
+    {0xFFE0FFE0, 0xAA0003E0, 0, Opcode::AArch64_ORRXrs, F::ShiftedReg},
+    {0xFF20001F, 0xEA00001F, 0, Opcode::AArch64_ANDSXrs, F::ShiftedReg},
+    {0xFF200000, 0x8A000000, 0, Opcode::AArch64_ANDXrs, F::ShiftedReg},
+    {0xFF200000, 0x8A200000, 0, Opcode::AArch64_BICXrs, F::ShiftedReg},
+    {0xFF200000, 0xAA000000, 0, Opcode::AArch64_ORRXrs, F::ShiftedReg},
+    {0xFF200000, 0xAA200000, 0, Opcode::AArch64_ORNXrs, F::ShiftedReg},
+    {0xFF200000, 0xCA000000, 0, Opcode::AArch64_EORXrs, F::ShiftedReg},
+    {0xFF200000, 0xEA000000, 0, Opcode::AArch64_ANDSXrs, F::ShiftedReg},
+    {0xFF200000, 0xEA200000, 0, Opcode::AArch64_BICSXrs, F::ShiftedReg},
+
+    // Add/subtract (shifted register); shift type 0b11 and 32-bit shifts of 32
+    // or more are unallocated, and subtraction from the zero register is the
+    // unsupported `neg` alias
+    {0x1FE00000, 0x0BC00000, 0, 0, F::None},
+    {0x9F208000, 0x0B008000, 0, 0, F::None},
+    {0x5F2003E0, 0x4B0003E0, 0, 0, F::None},
+    {0xFF20001F, 0x2B00001F, 0, Opcode::AArch64_ADDSWrs, F::ShiftedReg},
+    {0xFF20001F, 0x6B00001F, 0, Opcode::AArch64_SUBSWrs, F::ShiftedReg},
+    {0xFF200000, 0x0B000000, 0, Opcode::AArch64_ADDWrs, F::ShiftedReg},
+    {0xFF200000, 0x2B000000, 0, Opcode::AArch64_ADDSWrs, F::ShiftedReg},
+    {0xFF200000, 0x4B000000, 0, Opcode::AArch64_SUBWrs, F::ShiftedReg},
+    {0xFF200000, 0x6B000000, 0, Opcode::AArch64_SUBSWrs, F::ShiftedReg},
+    {0xFF20001F, 0xAB00001F, 0, Opcode::AArch64_ADDSXrs, F::ShiftedReg},
+    {0xFF20001F, 0xEB00001F, 0, Opcode::AArch64_SUBSXrs, F::ShiftedReg},
+    {0xFF200000, 0x8B000000, 0, Opcode::AArch64_ADDXrs, F::ShiftedReg},
+    {0xFF200000, 0xAB000000, 0, Opcode::AArch64_ADDSXrs, F::ShiftedReg},
+    {0xFF200000, 0xCB000000, 0, Opcode::AArch64_SUBXrs, F::ShiftedReg},
+    {0xFF200000, 0xEB000000, 0, Opcode::AArch64_SUBSXrs, F::ShiftedReg},
+
+    // Move wide (immediate); 32-bit shifts of 32 or more are unallocated, and
+    // a shifted `movz` of zero is not printed as the `mov` alias
+    {0x9FC00000, 0x12C00000, 0, 0, F::None},
+    {0x7FFFFFE0, 0x52A00000, 0, 0, F::None},
+    {0xFFFFFFE0, 0xD2C00000, 0, 0, F::None},
+    {0xFFFFFFE0, 0xD2E00000, 0, 0, F::None},
+    {0xFF800000, 0x52800000, 0x20, Opcode::AArch64_MOVZWi, F::MoveWide},
+    {0xFF800000, 0xD2800000, 0x20, Opcode::AArch64_MOVZXi, F::MoveWide},
+    {0xFFE00000, 0x72800000, 0, Opcode::AArch64_MOVKWi, F::MoveKeep},
+    {0xFFE00000, 0x72A00000, 0, Opcode::AArch64_MOVKWi, F::MoveKeep},
+    {0xFFE00000, 0xF2800000, 0, Opcode::AArch64_MOVKXi, F::MoveKeep},
+    {0xFFE00000, 0xF2A00000, 0, Opcode::AArch64_MOVKXi, F::MoveKeep},
+    {0xFFE00000, 0xF2C00000, 0, Opcode::AArch64_MOVKXi, F::MoveKeep},
+    {0xFFE00000, 0xF2E00000, 0, Opcode::AArch64_MOVKXi, F::MoveKeep},
+
+    // PC-relative addressing
+    {0x9F000000, 0x10000000, 0, Opcode::AArch64_ADR, F::PcRelative, 1},
+    {0x9F000000, 0x90000000, 0, Opcode::AArch64_ADRP, F::PcRelative, 4096},
+
+    // Conditional select
+    {0xFFE00C00, 0x1A800000, 0, Opcode::AArch64_CSELWr, F::CondSelect},
+    {0xFFE00C00, 0x9A800000, 0, Opcode::AArch64_CSELXr, F::CondSelect},
+
+    // Data-processing (3 source); an addend of the zero register is printed
+    // as the `mul` or `mneg` alias
+    {0xFFE0FC00, 0x1B007C00, 0, Opcode::AArch64_MADDWrrr, F::MulAdd},
+    {0xFFE0FC00, 0x1B00FC00, 0, Opcode::AArch64_MSUBWrrr, F::MulAdd},
+    {0xFFE0FC00, 0x9B007C00, 0, Opcode::AArch64_MADDXrrr, F::MulAdd},
+    {0xFFE0FC00, 0x9B00FC00, 0, Opcode::AArch64_MSUBXrrr, F::MulAdd},
+    {0xFFE08000, 0x1B000000, 0, Opcode::AArch64_MADDWrrr, F::MulAdd},
+    {0xFFE08000, 0x1B008000, 0, Opcode::AArch64_MSUBWrrr, F::MulAdd},
+    {0xFFE08000, 0x9B000000, 0, Opcode::AArch64_MADDXrrr, F::MulAdd},
+    {0xFFE08000, 0x9B008000, 0, Opcode::AArch64_MSUBXrrr, F::MulAdd},
+
+    // Branches
+    {0xFC000000, 0x14000000, 0, Opcode::AArch64_B, F::Branch},
+    {0xFC000000, 0x94000000, 0, Opcode::AArch64_BL, F::Branch},
+    {0xFF000010, 0x54000000, 0, Opcode::AArch64_Bcc, F::CondBranch},
+    {0xFF000000, 0x34000000, 0, Opcode::AArch64_CBZW, F::CompareBranch},
+    {0xFF000000, 0x35000000, 0, Opcode::AArch64_CBNZW, F::CompareBranch},
+    {0xFF000000, 0xB4000000, 0, Opcode::AArch64_CBZX, F::CompareBranch},
+    {0xFF000000, 0xB5000000, 0, Opcode::AArch64_CBNZX, F::CompareBranch},
+    {0xFF000000, 0x36000000, 0, Opcode::AArch64_TBZW, F::TestBranch},
+    {0xFF000000, 0x37000000, 0, Opcode::AArch64_TBNZW, F::TestBranch},
+    {0xFF000000, 0xB6000000, 0, Opcode::AArch64_TBZX, F::TestBranch},
+    {0xFF000000, 0xB7000000, 0, Opcode::AArch64_TBNZX, F::TestBranch},
+    {0xFFFFFC1F, 0xD61F0000, 0, Opcode::AArch64_BR, F::BranchReg},
+    {0xFFFFFC1F, 0xD63F0000, 0, Opcode::AArch64_BLR, F::BranchReg},
+    {0xFFFFFC1F, 0xD65F0000, 0, Opcode::AArch64_RET, F::BranchReg},
+
+    // Load/store register (unsigned immediate)
+    {0xFFC00000, 0x39000000, 0, Opcode::AArch64_STRBBui, F::LoadStoreUImm, 1},
+    {0xFFC00000, 0x39400000, 0, Opcode::AArch64_LDRBBui, F::LoadStoreUImm, 1},
+    {0xFFC00000, 0x79000000, 0, Opcode::AArch64_STRHHui, F::LoadStoreUImm, 2},
+    {0xFFC00000, 0x79400000, 0, Opcode::AArch64_LDRHHui, F::LoadStoreUImm, 2},
+    {0xFFC00000, 0xB9000000, 0, Opcode::AArch64_STRWui, F::LoadStoreUImm, 4},
+    {0xFFC00000, 0xB9400000, 0, Opcode::AArch64_LDRWui, F::LoadStoreUImm, 4},
+    {0xFFC00000, 0xB9800000, 0, Opcode::AArch64_LDRSWui, F::LoadStoreUImm, 4},
+    {0xFFC00000, 0xF9000000, 0, Opcode::AArch64_STRXui, F::LoadStoreUImm, 8},
+    {0xFFC00000, 0xF9400000, 0, Opcode::AArch64_LDRXui, F::LoadStoreUImm, 8},
+    {0xFFC00000, 0xBD000000, 0, Opcode::AArch64_STRSui, F::LoadStoreUImm, 4},
+    {0xFFC00000, 0xBD400000, 0, Opcode::AArch64_LDRSui, F::LoadStoreUImm, 4},
+    {0xFFC00000, 0xFD000000, 0, Opcode::AArch64_STRDui, F::LoadStoreUImm, 8},
+    {0xFFC00000, 0xFD400000, 0, Opcode::AArch64_LDRDui, F::LoadStoreUImm, 8},
+    {0xFFC00000, 0x3D800000, 0, Opcode::AArch64_STRQui, F::LoadStoreUImm, 16},
+    {0xFFC00000, 0x3DC00000, 0, Opcode::AArch64_LDRQui, F::LoadStoreUImm, 16},
+
+    // Load/store register (immediate pre-indexed and post-indexed)
+    {0xFFE00C00, 0xB8000C00, 0, Opcode::AArch64_STRWpre, F::LoadStorePre},
+    {0xFFE00C00, 0xB8400C00, 0, Opcode::AArch64_LDRWpre, F::LoadStorePre},
+    {0xFFE00C00, 0xF8000C00, 0, Opcode::AArch64_STRXpre, F::LoadStorePre},
+    {0xFFE00C00, 0xF8400C00, 0, Opcode::AArch64_LDRXpre, F::LoadStorePre},
+    {0xFFE00C00, 0xBC000C00, 0, Opcode::AArch64_STRSpre, F::LoadStorePre},
+    {0xFFE00C00, 0xBC400C00, 0, Opcode::AArch64_LDRSpre, F::LoadStorePre},
+    {0xFFE00C00, 0xFC000C00, 0, Opcode::AArch64_STRDpre, F::LoadStorePre},
+    {0xFFE00C00, 0xFC400C00, 0, Opcode::AArch64_LDRDpre, F::LoadStorePre},
+    {0xFFE00C00, 0x3C800C00, 0, Opcode::AArch64_STRQpre, F::LoadStorePre},
+    {0xFFE00C00, 0x3CC00C00, 0, Opcode::AArch64_LDRQpre, F::LoadStorePre},
+    {0xFFE00C00, 0xB8000400, 0, Opcode::AArch64_STRWpost, F::LoadStorePost},
+    {0xFFE00C00, 0xB8400400, 0, Opcode::AArch64_LDRWpost, F::LoadStorePost},
+    {0xFFE00C00, 0xF8000400, 0, Opcode::AArch64_STRXpost, F::LoadStorePost},
+    {0xFFE00C00, 0xF8400400, 0, Opcode::AArch64_LDRXpost, F::LoadStorePost},
+    {0xFFE00C00, 0xBC000400, 0, Opcode::AArch64_STRSpost, F::LoadStorePost},
+    {0xFFE00C00, 0xBC400400, 0, Opcode::AArch64_LDRSpost, F::LoadStorePost},
+    {0xFFE00C00, 0xFC000400, 0, Opcode::AArch64_STRDpost, F::LoadStorePost},
+    {0xFFE00C00, 0xFC400400, 0, Opcode::AArch64_LDRDpost, F::LoadStorePost},
+    {0xFFE00C00, 0x3C800400, 0, Opcode::AArch64_STRQpost, F::LoadStorePost},
+    {0xFFE00C00, 0x3CC00400, 0, Opcode::AArch64_LDRQpost, F::LoadStorePost},
+
+    // Load/store register pair (offset, pre-indexed and post-indexed)
+    {0xFFC00000, 0x29000000, 0, Opcode::AArch64_STPWi, F::PairOffset, 4},
+    {0xFFC00000, 0x29400000, 0, Opcode::AArch64_LDPWi, F::PairOffset, 4},
+    {0xFFC00000, 0x29800000, 0, Opcode::AArch64_STPWpre, F::PairOffset, 4},
+    {0xFFC00000, 0x29C00000, 0, Opcode::AArch64_LDPWpre, F::PairOffset, 4},
+    {0xFFC00000, 0x28800000, 0, Opcode::AArch64_STPWpost, F::PairPost, 4},
+    {0xFFC00000, 0x28C00000, 0, Opcode::AArch64_LDPWpost, F::PairPost, 4},
+    {0xFFC00000, 0xA9000000, 0, Opcode::AArch64_STPXi, F::PairOffset, 8},
+    {0xFFC00000, 0xA9400000, 0, Opcode::AArch64_LDPXi, F::PairOffset, 8},
+    {0xFFC00000, 0xA9800000, 0, Opcode::AArch64_STPXpre, F::PairOffset, 8},
+    {0xFFC00000, 0xA9C00000, 0, Opcode::AArch64_LDPXpre, F::PairOffset, 8},
+    {0xFFC00000, 0xA8800000, 0, Opcode::AArch64_STPXpost, F::PairPost, 8},
+    {0xFFC00000, 0xA8C00000, 0, Opcode::AArch64_LDPXpost, F::PairPost, 8},
+    {0xFFC00000, 0x6D000000, 0, Opcode::AArch64_STPDi, F::PairOffset, 8},
+    {0xFFC00000, 0x6D400000, 0, Opcode::AArch64_LDPDi, F::PairOffset, 8},
+    {0xFFC00000, 0x6D800000, 0, Opcode::AArch64_STPDpre, F::PairOffset, 8},
+    {0xFFC00000, 0x6DC00000, 0, Opcode::AArch64_LDPDpre, F::PairOffset, 8},
+    {0xFFC00000, 0x6C800000, 0, Opcode::AArch64_STPDpost, F::PairPost, 8},
+    {0xFFC00000, 0x6CC00000, 0, Opcode::AArch64_LDPDpost, F::PairPost, 8},
+    {0xFFC00000, 0xAD000000, 0, Opcode::AArch64_STPQi, F::PairOffset, 16},
+    {0xFFC00000, 0xAD400000, 0, Opcode::AArch64_LDPQi, F::PairOffset, 16},
+    {0xFFC00000, 0xAD800000, 0, Opcode::AArch64_STPQpre, F::PairOffset, 16},
+    {0xFFC00000, 0xADC00000, 0, Opcode::AArch64_LDPQpre, F::PairOffset, 16},
+    {0xFFC00000, 0xAC800000, 0, Opcode::AArch64_STPQpost, F::PairPost, 16},
+    {0xFFC00000, 0xACC00000, 0, Opcode::AArch64_LDPQpost, F::PairPost, 16},
+
+    // Advanced SIMD three same
+    {0xFFE0FC00, 0x0E208400, 0, Opcode::AArch64_ADDv8i8, F::Vector3},
+    {0xFFE0FC00, 0x0E608400, 0, Opcode::AArch64_ADDv4i16, F::Vector3},
+    {0xFFE0FC00, 0x0EA08400, 0, Opcode::AArch64_ADDv2i32, F::Vector3},
+    {0xFFE0FC00, 0x4E208400, 0, Opcode::AArch64_ADDv16i8, F::Vector3},
+    {0xFFE0FC00, 0x4E608400, 0, Opcode::AArch64_ADDv8i16, F::Vector3},
+    {0xFFE0FC00, 0x4EA08400, 0, Opcode::AArch64_ADDv4i32, F::Vector3},
+    {0xFFE0FC00, 0x4EE08400, 0, Opcode::AArch64_ADDv2i64, F::Vector3},
+    {0xFFE0FC00, 0x2E208400, 0, Opcode::AArch64_SUBv8i8, F::Vector3},
+    {0xFFE0FC00, 0x2E608400, 0, Opcode::AArch64_SUBv4i16, F::Vector3},
+    {0xFFE0FC00, 0x2EA08400, 0, Opcode::AArch64_SUBv2i32, F::Vector3},
+    {0xFFE0FC00, 0x6E208400, 0, Opcode::AArch64_SUBv16i8, F::Vector3},
+    {0xFFE0FC00, 0x6E608400, 0, Opcode::AArch64_SUBv8i16, F::Vector3},
+    {0xFFE0FC00, 0x6EA08400, 0, Opcode::AArch64_SUBv4i32, F::Vector3},
+    {0xFFE0FC00, 0x6EE08400, 0, Opcode::AArch64_SUBv2i64, F::Vector3},
+    {0xFFE0FC00, 0x0E201C00, 0, Opcode::AArch64_ANDv8i8, F::Vector3},
+    {0xFFE0FC00, 0x4E201C00, 0, Opcode::AArch64_ANDv16i8, F::Vector3},
+    {0xFFE0FC00, 0x2E201C00, 0, Opcode::AArch64_EORv8i8, F::Vector3},
+    {0xFFE0FC00, 0x6E201C00, 0, Opcode::AArch64_EORv16i8, F::Vector3},
+    {0xFFE0FC00, 0x0E20D400, 0, Opcode::AArch64_FADDv2f32, F::Vector3},
+    {0xFFE0FC00, 0x4E20D400, 0, Opcode::AArch64_FADDv4f32, F::Vector3},
+    {0xFFE0FC00, 0x4E60D400, 0, Opcode::AArch64_FADDv2f64, F::Vector3},
+    {0xFFE0FC00, 0x0EA0D400, 0, Opcode::AArch64_FSUBv2f32, F::Vector3},
+    {0xFFE0FC00, 0x4EA0D400, 0, Opcode::AArch64_FSUBv4f32, F::Vector3},
+    {0xFFE0FC00, 0x4EE0D400, 0, Opcode::AArch64_FSUBv2f64, F::Vector3},
+    {0xFFE0FC00, 0x2E20DC00, 0, Opcode::AArch64_FMULv2f32, F::Vector3},
+    {0xFFE0FC00, 0x6E20DC00, 0, Opcode::AArch64_FMULv4f32, F::Vector3},
+    {0xFFE0FC00, 0x6E60DC00, 0, Opcode::AArch64_FMULv2f64, F::Vector3},
+
+    // SVE integer and floating-point arithmetic (unpredicated)
+    {0xFFE0FC00, 0x04200000, 0, Opcode::AArch64_ADD_ZZZ_B, F::Vector3},
+    {0xFFE0FC00, 0x04600000, 0, Opcode::AArch64_ADD_ZZZ_H, F::Vector3},
+    {0xFFE0FC00, 0x04A00000, 0, Opcode::AArch64_ADD_ZZZ_S, F::Vector3},
+    {0xFFE0FC00, 0x04E00000, 0, Opcode::AArch64_ADD_ZZZ_D, F::Vector3},
+    {0xFFE0FC00, 0x04200400, 0, Opcode::AArch64_SUB_ZZZ_B, F::Vector3},
+    {0xFFE0FC00, 0x04600400, 0, Opcode::AArch64_SUB_ZZZ_H, F::Vector3},
+    {0xFFE0FC00, 0x04A00400, 0, Opcode::AArch64_SUB_ZZZ_S, F::Vector3},
+    {0xFFE0FC00, 0x04E00400, 0, Opcode::AArch64_SUB_ZZZ_D, F::Vector3},
+    {0xFFE0FC00, 0x65800000, 0, Opcode::AArch64_FADD_ZZZ_S, F::Vector3},
+    {0xFFE0FC00, 0x65C00000, 0, Opcode::AArch64_FADD_ZZZ_D, F::Vector3},
+    {0xFFE0FC00, 0x65800400, 0, Opcode::AArch64_FSUB_ZZZ_S, F::Vector3},
+    {0xFFE0FC00, 0x65C00400, 0, Opcode::AArch64_FSUB_ZZZ_D, F::Vector3},
+    {0xFFE0FC00, 0x65800800, 0, Opcode::AArch64_FMUL_ZZZ_S, F::Vector3},
+    {0xFFE0FC00, 0x65C00800, 0, Opcode::AArch64_FMUL_ZZZ_D, F::Vector3}};
+
+FastDecoder::FastDecoder(YAML::Node config, csh capstoneHandle) {
+  if (config["Core"]["Decoder-Mode"].IsDefined()) {
+    std::string mode = config["Core"]["Decoder-Mode"].as<std::string>();
+    if (mode == "fast") {
+      mode_ = DecoderMode::Fast;
+    } else if (mode == "verify") {
+      mode_ = DecoderMode::Verify;
+    }
+  }
+  if (mode_ == DecoderMode::Capstone) return;
+
+  // Produce each entry's template by decoding its representative encoding
+  templates_.reserve(table_.size());
+  for (const auto& entry : table_) {
+    uint32_t word = entry.value | entry.sample;
+    const uint8_t* encoding = reinterpret_cast<const uint8_t*>(&word);
+    cs_insn rawInsn;
+    cs_detail rawDetail;
+    rawInsn.detail = &rawDetail;
+    size_t size = 4;
+    uint64_t address = 0;
+
+    bool success = entry.opcode != 0 &&
+                   cs_disasm_iter(capstoneHandle, &encoding, &size, &address,
+                                  &rawInsn) &&
+                   rawInsn.opcode == entry.opcode;
+    if (success) {
+      templates_.emplace_back(rawInsn);
+      // Operand strings describe the representative encoding; they are only
+      // printed for diagnostics, so are not regenerated when decoding
+      templates_.back().operandStr.clear();
+    } else {
+      if (entry.opcode != 0 && mode_ == DecoderMode::Verify) {
+        std::cout << "[SimEng:FastDecoder] Disabled fast decoding of opcode "
+                  << entry.opcode << std::endl;
+      }
+      templates_.emplace_back(reinterpret_cast<const uint8_t*>(&word));
+    }
+  }
+
+  // Bucket the entries by the top-level encoding group in bits 28:25
+  for (uint32_t group = 0; group < buckets_.size(); group++) {
+    uint32_t groupBits = group << 25;
+    for (size_t i = 0; i < table_.size(); i++) {
+      uint32_t groupMask = table_[i].mask & (0xFu << 25);
+      if ((groupBits & groupMask) == (table_[i].value & groupMask)) {
+        buckets_[group].push_back(static_cast<uint16_t>(i));
+      }
+    }
+  }
+}
+
+FastDecoder::~FastDecoder() {}
+
+arm64_reg FastDecoder::bankRegister(arm64_reg base, uint32_t number,
+                                    bool isSP) {
+  // Templates may hold any register of the 64-bit or 32-bit general purpose
+  // banks, where an alias fixes the zero register or stack pointer
+  bool isX = (base >= ARM64_REG_X0 && base <= ARM64_REG_X28) ||
+             base == ARM64_REG_X29 || base == ARM64_REG_X30 ||
+             base == ARM64_REG_XZR || base == ARM64_REG_SP;
+  if (isX) {
+    if (number == 31) return isSP ? ARM64_REG_SP : ARM64_REG_XZR;
+    if (number == 30) return ARM64_REG_X30;
+    if (number == 29) return ARM64_REG_X29;
+    return static_cast<arm64_reg>(ARM64_REG_X0 + number);
+  }
+  bool isW = (base >= ARM64_REG_W0 && base <= ARM64_REG_W30) ||
+             base == ARM64_REG_WZR || base == ARM64_REG_WSP;
+  if (isW) {
+    if (number == 31) return isSP ? ARM64_REG_WSP : ARM64_REG_WZR;
+    return static_cast<arm64_reg>(ARM64_REG_W0 + number);
+  }
+  // Entries of the vector, scalar FP and SVE banks always use register zero
+  // in their template, and the banks are contiguous
+  return static_cast<arm64_reg>(base + number);
+}
+
+std::optional<InstructionMetadata> FastDecoder::decode(uint32_t insn) const {
+  if (mode_ == DecoderMode::Capstone) return std::nullopt;
+
+  // Find the first matching entry
+  const Entry* entry = nullptr;
+  const InstructionMetadata* tmpl = nullptr;
+  for (uint16_t index : buckets_[field(insn, 25, 4)]) {
+    if ((insn & table_[index].mask) == table_[index].value) {
+      entry = &table_[index];
+      tmpl = &templates_[index];
+      break;
+    }
+  }
+  if (entry == nullptr || tmpl->id == ARM64_INS_INVALID) return std::nullopt;
+
+  InstructionMetadata metadata = *tmpl;
+  std::memcpy(metadata.encoding, &insn, sizeof(metadata.encoding));
+  cs_arm64_op* ops = metadata.operands;
+
+  // Replace the register held in `op` with register `number` of its bank
+  auto setReg = [](cs_arm64_op& op, uint32_t number, bool isSP = false) {
+    op.reg = bankRegister(op.reg, number, isSP);
+  };
+  auto setBase = [](cs_arm64_op& op, uint32_t number) {
+    op.mem.base = bankRegister(op.mem.base, number, true);
+  };
+
+  uint32_t rd = field(insn, 0, 5);
+  uint32_t rn = field(insn, 5, 5);
+  uint32_t rm = field(insn, 16, 5);
+  switch (entry->format) {
+    case F::AddSubImm:
+      [[fallthrough]];
+    case F::AddSubImmFlags:
+      setReg(ops[0], rd, entry->format == F::AddSubImm);
+      setReg(ops[1], rn, true);
+      ops[2].imm = field(insn, 10, 12);
+      ops[2].shift = field(insn, 22, 1)
+                         ? decltype(ops[2].shift){ARM64_SFT_LSL, 12}
+                         : decltype(ops[2].shift){ARM64_SFT_INVALID, 0};
+      break;
+    case F::ShiftedReg: {
+      setReg(ops[0], rd);
+      setReg(ops[1], rn);
+      setReg(ops[2], rm);
+      // Capstone omits the shift of operands shifted by `lsl #0`
+      uint32_t type = field(insn, 22, 2);
+      uint32_t amount = field(insn, 10, 6);
+      ops[2].shift = (type == 0 && amount == 0)
+                         ? decltype(ops[2].shift){ARM64_SFT_INVALID, 0}
+                         : decltype(ops[2].shift){shiftTypes[type], amount};
+      break;
+    }
+    case F::MoveWide:
+      setReg(ops[0], rd);
+      ops[1].imm = static_cast<int64_t>(field(insn, 5, 16))
+                   << (16 * field(insn, 21, 2));
+      break;
+    case F::MoveKeep:
+      setReg(ops[0], rd);
+      ops[1].imm = field(insn, 5, 16);
+      break;
+    case F::LoadStoreUImm:
+      setReg(ops[0], rd);
+      setBase(ops[1], rn);
+      ops[1].mem.disp = field(insn, 10, 12) * entry->scale;
+      break;
+    case F::LoadStorePre:
+      setReg(ops[0], rd);
+      setBase(ops[1], rn);
+      ops[1].mem.disp = signExtend(field(insn, 12, 9), 9);
+      break;
+    case F::LoadStorePost:
+      setReg(ops[0], rd);
+      setBase(ops[1], rn);
+      ops[2].imm = signExtend(field(insn, 12, 9), 9);
+      break;
+    case F::PairOffset:
+      setReg(ops[0], rd);
+      setReg(ops[1], field(insn, 10, 5));
+      setBase(ops[2], rn);
+      ops[2].mem.disp = signExtend(field(insn, 15, 7), 7) * entry->scale;
+      break;
+    case F::PairPost:
+      setReg(ops[0], rd);
+      setReg(ops[1], field(insn, 10, 5));
+      setBase(ops[2], rn);
+      ops[3].imm = signExtend(field(insn, 15, 7), 7) * entry->scale;
+      break;
+    case F::Branch:
+      ops[0].imm = signExtend(field(insn, 0, 26), 26) * 4;
+      break;
+    case F::CondBranch:
+      ops[0].imm = signExtend(field(insn, 5, 19), 19) * 4;
+      metadata.cc = field(insn, 0, 4);
+      std::snprintf(metadata.mnemonic, CS_MNEMONIC_SIZE, "b.%s",
+                    conditionNames[metadata.cc]);
+      break;
+    case F::CompareBranch:
+      setReg(ops[0], rd);
+      ops[1].imm = signExtend(field(insn, 5, 19), 19) * 4;
+      break;
+    case F::TestBranch:
+      setReg(ops[0], rd);
+      ops[1].imm = (field(insn, 31, 1) << 5) | field(insn, 19, 5);
+      ops[2].imm = signExtend(field(insn, 5, 14), 14) * 4;
+      break;
+    case F::BranchReg:
+      setReg(ops[0], rn);
+      break;
+    case F::PcRelative:
+      setReg(ops[0], rd);
+      ops[1].imm =
+          signExtend((field(insn, 5, 19) << 2) | field(insn, 29, 2), 21) *
+          entry->scale;
+      break;
+    case F::CondSelect:
+      setReg(ops[0], rd);
+      setReg(ops[1], rn);
+      setReg(ops[2], rm);
+      metadata.cc = field(insn, 12, 4);
+      break;
+    case F::MulAdd:
+      setReg(ops[0], rd);
+      setReg(ops[1], rn);
+      setReg(ops[2], rm);
+      setReg(ops[3], field(insn, 10, 5));
+      break;
+    case F::Vector3:
+      setReg(ops[0], rd);
+      setReg(ops[1], rn);
+      setReg(ops[2], rm);
+      break;
+    case F::None:
+      return std::nullopt;
+  }
+  return metadata;
+}
+
+bool FastDecoder::verify(uint32_t insn, const InstructionMetadata& fast,
+                         const InstructionMetadata& reference) const {
+  std::string difference;
+  if (fast.id != reference.id) {
+    difference = "mnemonic ID";
+  } else if (fast.opcode != reference.opcode) {
+    difference = "opcode";
+  } else if (fast.cc != reference.cc) {
+    difference = "condition code";
+  } else if (fast.setsFlags != reference.setsFlags ||
+             fast.writeback != reference.writeback) {
+    difference = "flags";
+  } else if (fast.implicitSourceCount != reference.implicitSourceCount ||
+             !std::equal(fast.implicitSources,
+                         fast.implicitSources + fast.implicitSourceCount,
+                         reference.implicitSources) ||
+             fast.implicitDestinationCount !=
+                 reference.implicitDestinationCount ||
+             !std::equal(
+                 fast.implicitDestinations,
+                 fast.implicitDestinations + fast.implicitDestinationCount,
+                 reference.implicitDestinations)) {
+    difference = "implicit registers";
+  } else if (fast.groupCount != reference.groupCount ||
+             !std::equal(fast.groups, fast.groups + fast.groupCount,
+                         reference.groups)) {
+    difference = "groups";
+  } else if (fast.operandCount != reference.operandCount) {
+    difference = "operand count";
+  } else {
+    for (uint8_t i = 0; i < fast.operandCount && difference.empty(); i++) {
+      const cs_arm64_op& a = fast.operands[i];
+      const cs_arm64_op& b = reference.operands[i];
+      bool match = a.type == b.type && a.access == b.access &&
+                   a.vas == b.vas && a.vector_index == b.vector_index &&
+                   a.shift.type == b.shift.type &&
+                   a.shift.value == b.shift.value && a.ext == b.ext;
+      if (match && a.type == ARM64_OP_MEM) {
+        match = a.mem.base == b.mem.base && a.mem.index == b.mem.index &&
+                a.mem.disp == b.mem.disp;
+      } else if (match && a.type == ARM64_OP_REG) {
+        match = a.reg == b.reg;
+      } else if (match && a.type == ARM64_OP_IMM) {
+        match = a.imm == b.imm;
+      }
+      if (!match) difference = "operand " + std::to_string(i);
+    }
+  }
+  if (difference.empty()) return true;
+
+  mismatches_++;
+  std::cout << "[SimEng:FastDecoder] Mismatched " << difference
+            << " decoding 0x" << std::hex << std::setfill('0') << std::setw(8)
+            << insn << std::dec << std::setfill(' ') << " ("
+            << reference.mnemonic << ")" << std::endl;
+  return false;
+}
+
+DecoderMode FastDecoder::getMode() const { return mode_; }
+
+uint64_t FastDecoder::getMismatchCount() const { return mismatches_; }
+
+}  // namespace aarch64
+}  // namespace arch
+}  // namespace simeng
@@ -21,6 +21,8 @@ Instruction::Instruction(const Architecture& architecture,
   isLastMicroOp_ = microOpInfo.isLastMicroOp;
   microOpIndex_ = microOpInfo.microOpIndex;
   decode();
+  executeHandler_ = resolveExecuteHandler();
+  addressHandler_ = resolveAddressHandler();
 }
 
 Instruction::Instruction(const Architecture& architecture,
@@ -83,26 +85,32 @@ void Instruction::supplyOperand(uint8_t i, const RegisterValue& value) {
   assert(value.size() > 0 &&
          "Attempted to provide an uninitialised RegisterValue");
 
-  operands[i] = value;
+  // Register file reads are views of the register storage, which remains
+  // unchanged until this instruction has retired; avoid copying them
+  operands[i] = RegisterValue::shallowCopy(value);
   operandsPending--;
 }
 
-void Instruction::supplyData(uint64_t address, const RegisterValue& data) {
-  for (size_t i = 0; i < memoryAddresses.size(); i++) {
-    if (memoryAddresses[i].address == address && !memoryData[i]) {
-      if (!data) {
-        // Raise exception for failed read
-        // TODO: Move this logic to caller and distinguish between different
-        // memory faults (e.g. bus error, page fault, seg fault)
-        exception_ = InstructionException::DataAbort;
-        exceptionEncountered_ = true;
-        memoryData[i] = RegisterValue(0, memoryAddresses[i].size);
-      } else {
-        memoryData[i] = data;
-      }
-      dataPending_--;
-      return;
-    }
+void Instruction::supplyData(size_t index, const RegisterValue& data) {
+  assert(index < memoryData.size() && !memoryData[index] &&
+         "Attempted to supply data to an invalid or filled memory access");
+  if (!data) {
+    // Raise exception for failed read
+    // TODO: Move this logic to caller and distinguish between different
+    // memory faults (e.g. bus error, page fault, seg fault)
+    exception_ = InstructionException::DataAbort;
+    exceptionEncountered_ = true;
+    memoryData[index] = RegisterValue(0, memoryAddresses[index].size);
+  } else {
+    memoryData[index] = data;
+  }
+  dataPending_--;
+}
+
+void Instruction::supplyDataBlock(size_t firstIndex,
+                                  span<const RegisterValue> data) {
+  for (size_t i = 0; i < data.size(); i++) {
+    supplyData(firstIndex + i, data[i]);
   }
 }
 
@@ -203,6 +211,50 @@ const std::vector<uint16_t>& Instruction::getSupportedPorts() {
   return supportedPorts_;
 }
 
+std::shared_ptr<simeng::Instruction> Instruction::clone() const {
+  return std::make_shared<Instruction>(*this);
+}
+
+bool Instruction::canFuseWith(const simeng::Instruction& tail) const {
+  uint8_t rules = architecture_.getFusionRules();
+  if (rules == 0) return false;
+
+  uint16_t tailOpcode =
+      static_cast<const Instruction&>(tail).getMetadata().opcode;
+  switch (metadata.opcode) {
+    case Opcode::AArch64_ADDSWri:
+    case Opcode::AArch64_ADDSWrs:
+    case Opcode::AArch64_ADDSXri:
+    case Opcode::AArch64_ADDSXrs:
+    case Opcode::AArch64_ANDSWri:
+    case Opcode::AArch64_ANDSWrs:
+    case Opcode::AArch64_ANDSXri:
+    case Opcode::AArch64_ANDSXrs:
+    case Opcode::AArch64_SUBSWri:
+    case Opcode::AArch64_SUBSWrs:
+    case Opcode::AArch64_SUBSWrx:
+    case Opcode::AArch64_SUBSXri:
+    case Opcode::AArch64_SUBSXrs:
+    case Opcode::AArch64_SUBSXrx:
+      return (rules & FusionRule::COMPARE_BRANCH) &&
+             tailOpcode == Opcode::AArch64_Bcc;
+    case Opcode::AArch64_ADRP:
+      return (rules & FusionRule::ADRP_ADD) &&
+             tailOpcode == Opcode::AArch64_ADDXri;
+    case Opcode::AArch64_AESErr:
+      return (rules & FusionRule::AESE_AESMC) &&
+             tailOpcode == Opcode::AArch64_AESMCrr;
+    case Opcode::AArch64_MOVZWi:
+      return (rules & FusionRule::MOV_MOVK) &&
+             tailOpcode == Opcode::AArch64_MOVKWi;
+    case Opcode::AArch64_MOVZXi:
+      return (rules & FusionRule::MOV_MOVK) &&
+             tailOpcode == Opcode::AArch64_MOVKXi;
+    default:
+      return false;
+  }
+}
+
 const InstructionMetadata& Instruction::getMetadata() const { return metadata; }
 
 /** Extend `value` according to `extendType`, and left-shift the result by
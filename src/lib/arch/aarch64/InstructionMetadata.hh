@@ -35,6 +35,12 @@ struct InstructionMetadata {
   static const size_t MAX_OPERANDS =
       sizeof(cs_arm64::operands) / sizeof(cs_arm64_op);
 
+  /** The version of the metadata produced for each encoding. Must be
+   * incremented whenever a change alters the metadata of any encoding, such as
+   * a change to the revisions applied to Capstone's output, so that decodings
+   * persisted by earlier builds are discarded. */
+  static constexpr uint32_t FORMAT_VERSION = 1;
+
   /** The instruction's mnemonic ID. */
   unsigned int id;
 
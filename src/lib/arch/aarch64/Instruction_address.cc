@@ -18,1488 +18,2210 @@ void generateContiguousAddresses(
 span<const MemoryAccessTarget> Instruction::generateAddresses() {
   assert((isLoad() || isStoreAddress()) &&
          "generateAddresses called on non-load-or-store instruction");
-  if (isMicroOp_) {
-    switch (microOpcode_) {
-      case MicroOpcode::LDR_ADDR: {
-        std::vector<simeng::MemoryAccessTarget> addresses;
-        generateContiguousAddresses(
-            operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1,
-            dataSize_, addresses);
-
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case MicroOpcode::STR_ADDR: {
-        std::vector<simeng::MemoryAccessTarget> addresses;
-        generateContiguousAddresses(
-            operands[0].get<uint64_t>() + metadata.operands[0].mem.disp, 1,
-            dataSize_, addresses);
-
-        setMemoryAddresses(addresses);
-        break;
-      }
-      default:
-        exceptionEncountered_ = true;
-        exception_ = InstructionException::ExecutionNotYetImplemented;
-        break;
+  (this->*addressHandler_)();
+  return getGeneratedAddresses();
+}
+
+void Instruction::generateMicroOpAddresses() {
+  switch (microOpcode_) {
+    case MicroOpcode::LDR_ADDR: {
+      std::vector<simeng::MemoryAccessTarget> addresses;
+      generateContiguousAddresses(
+          operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1,
+          dataSize_, addresses);
+
+      setMemoryAddresses(addresses);
+      break;
     }
-  } else {
-    const uint16_t VL_bits = architecture_.getVectorLength();
-    switch (metadata.opcode) {
-      case Opcode::AArch64_CASALW: {  // casal ws, wt, [xn|sp]
-        setMemoryAddresses({{operands[2].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_CASALX: {  // casal xs, xt, [xn|sp]
-        setMemoryAddresses({{operands[2].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LD1i32: {  // ld1 {vt.s}[index], [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_LD1i64: {  // ld1 {vt.d}[index], [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LD1i64_POST: {  // ld1 {vt.d}[index], [xn], #8
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LD1RD_IMM: {  // ld1rd {zt.d}, pg/z, [xn, #imm]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        for (int i = 0; i < 4; i++) {
-          if (p[i] != 0) {
-            setMemoryAddresses(
-                {{operands[1].get<uint64_t>() + metadata.operands[2].mem.disp,
-                  8}});
-            break;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_LD1RQ_D_IMM: {  // ld1rqd {zd.d}, pg/z, [xn{, #imm}]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-
-        uint64_t addr =
-            operands[1].get<uint64_t>() + metadata.operands[2].mem.disp;
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(2);
-
-        for (int i = 0; i < 2; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({addr, 8});
-          }
-          addr += 8;
-        }
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LD1RW_IMM: {  // ld1rw {zt.s}, pg/z, [xn, #imm]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        for (int i = 0; i < 4; i++) {
-          if (p[i] != 0) {
-            setMemoryAddresses(
-                {{operands[1].get<uint64_t>() + metadata.operands[2].mem.disp,
-                  4}});
-            break;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_LD1Rv16b: {  // ld1r {vt.16b}, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv16b_POST: {  // ld1r {vt.16b}, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv1d: {  // ld1r {vt.1d}, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv1d_POST: {  // ld1r {vt.1d}, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv2d: {  // ld1r {vt.2d}, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv2d_POST: {  // ld1r {vt.2d}, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv2s: {  // ld1r {vt.2s}, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv2s_POST: {  // ld1r {vt.2s}, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv4h: {  // ld1r {vt.4h}, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv4h_POST: {  // ld1r {vt.4h}, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv8b: {  // ld1r {vt.8b}, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv8b_POST: {  // ld1r {vt.8b}, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv8h: {  // ld1r {vt.8h}, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv8h_POST: {  // ld1r {vt.8h}, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv4s: {  // ld1r {vt.4s}, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Rv4s_POST: {  // ld1r {vt.4s}, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Onev16b: {  // ld1 {vt.16b}, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Onev16b_POST: {  // ld1 {vt.16b}, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Twov16b: {  // ld1 {vt1.16b, vt2.16b}, [xn]
-        uint64_t base = operands[0].get<uint64_t>();
-        setMemoryAddresses({{base, 16}, {base + 16, 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1Twov16b_POST: {  // ld1 {vt1.16b, vt2.16b}, [xn],
-                                               //   #imm
-        uint64_t base = operands[0].get<uint64_t>();
-        setMemoryAddresses({{base, 16}, {base + 16, 16}});
-        break;
-      }
-      case Opcode::AArch64_LD1B: {  // ld1b {zt.b}, pg/z, [xn, xm]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 8;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t offset = operands[2].get<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << (i % 64);
-          if (p[i / 64] & shifted_active) {
-            addresses.push_back({base + (offset + i), 1});
-          }
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LD1D: {  // ld1d {zt.d}, pg/z, [xn, xm, lsl #3]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t offset = operands[2].get<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({base + ((offset + i) * 8), 8});
-          }
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LD1D_IMM_REAL: {  // ld1d {zt.d}, pg/z, [xn{, #imm,
-                                             // mul vl}]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[2].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        uint64_t addr = base + (offset * partition_num * 8);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({addr, 8});
-          }
-          addr += 8;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LD1H: {  // ld1h {zt.h}, pg/z, [xn, xm, lsl #1]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 16;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t offset = operands[2].get<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 32) * 2);
-          if (p[i / 32] & shifted_active) {
-            addresses.push_back({base + ((offset + i) * 2), 2});
-          }
-        }
-
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_LD1W: {  // ld1w {zt.s}, pg/z, [xn, xm, lsl #2]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 32;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t offset = operands[2].get<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 16) * 4);
-          if (p[i / 16] & shifted_active) {
-            addresses.push_back({base + ((offset + i) * 4), 4});
-          }
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LD1W_IMM_REAL: {  // ld1w {zt.s}, pg/z, [xn{, #imm,
-                                             // mul vl}]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 32;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[2].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        uint64_t addr = base + (offset * partition_num * 4);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 16) * 4);
-          if (p[i / 16] & shifted_active) {
-            addresses.push_back({addr, 4});
-          }
-          addr += 4;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LD2D: {  // ld2d {zt1.d, zt2.d}, pg/z, [xn|sp, xm,
-                                    // lsl #3]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        uint64_t offset = operands[2].get<uint64_t>();
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num * 2);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t addr = base + (offset * 8);
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({addr, 8});
-            addresses.push_back({addr + 8, 8});
-          }
-          offset = offset + 2;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LD2D_IMM: {  // ld2d {zt1.d, zt2.d}, pg/z,
-                                        // [xn|sp{, #imm, MUL VL}]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<int64_t>(metadata.operands[3].mem.disp);
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num * 2);
-
-        uint64_t addr = base + (offset * partition_num * 8);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({addr, 8});
-            addresses.push_back({addr + 8, 8});
-          }
-          addr += 16;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LD3D_IMM: {  // ld3d {zt1.d, zt2.d, zt3.d}, pg/z,
-                                        // [xn|sp{, #imm, MUL VL}]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<int64_t>(metadata.operands[4].mem.disp);
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num * 3);
-
-        uint64_t addr = base + (offset * partition_num * 8);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({addr, 8});
-            addresses.push_back({addr + 8, 8});
-            addresses.push_back({addr + 16, 8});
-          }
-          addr += 24;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LD4D_IMM: {  // ld4d {zt1.d, zt2.d, zt3.d, zt4.d},
-                                        // pg/z, [xn|sp{, #imm, MUL VL}]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const int64_t offset =
-            static_cast<int64_t>(metadata.operands[5].mem.disp);
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num * 4);
-
-        uint64_t addr = base + (offset * partition_num * 8);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({addr, 8});
-            addresses.push_back({addr + 8, 8});
-            addresses.push_back({addr + 16, 8});
-            addresses.push_back({addr + 24, 8});
-          }
-          addr += 32;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LD2Twov4s: {  // ld2 {vt1.4s, vt2.4s}, [xn]
-        [[fallthrough]];
-      }
-      case Opcode::AArch64_LD2Twov4s_POST: {  // ld2 {vt1.4s, vt2.4s}, [xn],
-                                              // #imm
-        const uint64_t base = operands[2].get<uint64_t>();
-        setMemoryAddresses({{base, 16}, {base + 16, 16}});
-        break;
-      }
-      case Opcode::AArch64_LDADDLW:  // ldaddl ws, wt, [xn]
-        [[fallthrough]];
-      case Opcode::AArch64_LDADDW: {  // ldadd ws, wt, [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_LDARB: {  // ldarb wt, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 1}});
-        break;
-      }
-      case Opcode::AArch64_LDARW: {  // ldar wt, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_LDARX: {  // ldar xt, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LDAXRW: {  // ldaxr wd, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_LDAXRX: {  // ldaxr xd, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_LDRBBpost: {  // ldrb wt, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 1}});
-        break;
-      }
-      case Opcode::AArch64_LDRBBpre: {  // ldrb wt, [xn, #imm]!
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
-        break;
-      }
-      case Opcode::AArch64_LDRBBroW: {  // ldrb wt,
-                                        //  [xn, wm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 1}});
-        break;
-      }
-      case Opcode::AArch64_LDRBBroX: {  // ldrb wt,
-                                        //  [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 1}});
-        break;
-      }
-      case Opcode::AArch64_LDRBBui: {  // ldrb wt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
-        break;
-      }
-      case Opcode::AArch64_LDRDroW: {  // ldr dt, [xn, wm{, extend {amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 8}});
-        break;
-      }
-      case Opcode::AArch64_LDRDroX: {  // ldr dt, [xn, xm{, extend {amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 8}});
-        break;
-      }
-      case Opcode::AArch64_LDRBui:     // ldr bt, [xn, #imm]
-      case Opcode::AArch64_LDRBpre:    // ldr bt, [xn, #imm]!
-      case Opcode::AArch64_LDRDui:     // ldr dt, [xn, #imm]
-      case Opcode::AArch64_LDRDpre:    // ldr dt, [xn, #imm]!
-      case Opcode::AArch64_LDRHui:     // ldr ht, [xn, #imm]
-      case Opcode::AArch64_LDRHpre:    // ldr ht, [xn, #imm]!
-      case Opcode::AArch64_LDRQui:     // ldr qt, [xn, #imm]
-      case Opcode::AArch64_LDRQpre:    // ldr qt, [xn, #imm]!
-      case Opcode::AArch64_LDRSui:     // ldr st, [xn, #imm]
-      case Opcode::AArch64_LDRSpre:    // ldr st, [xn, #imm]!
-      case Opcode::AArch64_LDRWui:     // ldr wt, [xn, #imm]
-      case Opcode::AArch64_LDRWpre:    // ldr wt, [xn, #imm]!
-      case Opcode::AArch64_LDRXui:     // ldr xt, [xn, #imm]
-      case Opcode::AArch64_LDRXpre: {  // ldr xt, [xn, #imm]!
-        std::vector<simeng::MemoryAccessTarget> addresses;
-        generateContiguousAddresses(
-            operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1,
-            dataSize_, addresses);
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_LDRBpost:    // ldr bt, [xn], #imm
-      case Opcode::AArch64_LDRDpost:    // ldr dt, [xn], #imm
-      case Opcode::AArch64_LDRHpost:    // ldr ht, [xn], #imm
-      case Opcode::AArch64_LDRQpost:    // ldr qt, [xn], #imm
-      case Opcode::AArch64_LDRSpost:    // ldr st, [xn], #imm
-      case Opcode::AArch64_LDRWpost:    // ldr wt, [xn], #imm
-      case Opcode::AArch64_LDRXpost: {  // ldr xt, [xn], #imm
-        std::vector<simeng::MemoryAccessTarget> addresses;
-        generateContiguousAddresses(operands[0].get<uint64_t>(), 1, dataSize_,
-                                    addresses);
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_LDRHHpost: {  // ldrh wt, [xn], #imm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRHHpre: {  // ldrh wt, [xn, #imm]!
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRHHroW: {  // ldrh wt, [xn, wm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRHHroX: {  // ldrh wt, [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRHHui: {  // ldrh wt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRQroX: {  // ldr qt, [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 16}});
-        break;
-      }
-      case Opcode::AArch64_LDRSroW: {  // ldr st, [xn, wm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDRSroX: {  // ldr st, [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDRSWl: {  // ldrsw xt, #imm
-        setMemoryAddresses(
-            {{metadata.operands[1].imm + instructionAddress_, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDRWroW: {  // ldr wt, [xn, wm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDRWroX: {  // ldr wt, [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDRXl: {  // ldr xt, #imm
-        setMemoryAddresses(
-            {{metadata.operands[1].imm + instructionAddress_, 8}});
-        break;
-      }
-      case Opcode::AArch64_LDRXroW: {  // ldr xt, [xn, wn{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 8}});
-        break;
-      }
-      case Opcode::AArch64_LDRXroX: {  // ldr xt, [xn, xn{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 8}});
-        break;
-      }
-      case Opcode::AArch64_LDR_PXI: {  // ldr pt, [xn{, #imm, mul vl}]
-        const uint64_t PL_bits = VL_bits / 8;
-        const uint16_t partition_num = PL_bits / 8;
-
-        const uint64_t base = operands[0].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[1].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses(partition_num);
-
-        uint64_t addr = base + (offset * partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          addresses[i] = {addr, 1};
-          addr += 1;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LDR_ZXI: {  // ldr zt, [xn{, #imm, mul vl}]
-        const uint16_t partition_num = VL_bits / 8;
-
-        const uint64_t base = operands[0].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[1].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses(partition_num);
-
-        uint64_t addr = base + (offset * partition_num);
-        for (int i = 0; i < partition_num; i++) {
-          addresses[i] = {addr, 1};
-          addr += 1;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_LDNPSi: {  // ldnp st1, st2, [xn, #imm]
-        uint64_t base =
-            operands[0].get<uint64_t>() + metadata.operands[2].mem.disp;
-        setMemoryAddresses({{base, 4}, {base + 4, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDPDi:      // ldp dt1, dt2, [xn, #imm]
-      case Opcode::AArch64_LDPDpre:    // ldp dt1, dt2, [xn, #imm!]
-      case Opcode::AArch64_LDPQi:      // ldp qt1, qt2, [xn, #imm]
-      case Opcode::AArch64_LDPQpre:    // ldp qt1, qt2, [xn, #imm!]
-      case Opcode::AArch64_LDPSi:      // ldp st1, st2, [xn, #imm]
-      case Opcode::AArch64_LDPSpre:    // ldp st1, st2, [xn, #imm!]
-      case Opcode::AArch64_LDPWi:      // ldp wt1, wt2, [xn, #imm]
-      case Opcode::AArch64_LDPWpre:    // ldp wt1, wt2, [xn, #imm!]
-      case Opcode::AArch64_LDPXi:      // ldp xt1, xt2, [xn, #imm]
-      case Opcode::AArch64_LDPXpre: {  // ldp xt1, xt2, [xn, #imm!]
-        std::vector<simeng::MemoryAccessTarget> addresses;
-        generateContiguousAddresses(
-            operands[0].get<uint64_t>() + metadata.operands[2].mem.disp, 2,
-            dataSize_, addresses);
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_LDPDpost:    // ldp dt1, dt2, [xn], #imm
-      case Opcode::AArch64_LDPQpost:    // ldp qt1, qt2, [xn], #imm
-      case Opcode::AArch64_LDPSpost:    // ldp st1, st2, [xn], #imm
-      case Opcode::AArch64_LDPWpost:    // ldp wt1, wt2, [xn], #imm
-      case Opcode::AArch64_LDPXpost: {  // ldp xt1, xt2, [xn], #imm
-        std::vector<simeng::MemoryAccessTarget> addresses;
-        generateContiguousAddresses(operands[0].get<uint64_t>(), 2, dataSize_,
-                                    addresses);
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_LDPSWi: {  // ldpsw xt1, xt2, [xn {, #imm}]
-        uint64_t base =
-            operands[0].get<uint64_t>() + metadata.operands[2].mem.disp;
-        setMemoryAddresses({{base, 4}, {base + 4, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDRSBWroX: {  // ldrsb wt, [xn, xm{, extend
-                                         // {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 1}});
-        break;
-      }
-      case Opcode::AArch64_LDRSBWui: {  // ldrsb xt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
-        break;
-      }
-      case Opcode::AArch64_LDRSBXui: {  // ldrsb xt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
-        break;
-      }
-      case Opcode::AArch64_LDRSHWroW: {  // ldrsh wt, [xn, wm{, extend
-                                         // {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRSHWroX: {  // ldrsh wt, [xn, xm{, extend
-                                         // {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRSHWui: {  // ldrsh wt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRSHXroW: {  // ldrsh xt, [xn, wm{, extend
-                                         // {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRSHXroX: {  // ldrsh xt, [xn, xm{, extend
-                                         // {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRSHXui: {  // ldrsh xt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDRSWpost: {  // ldrsw xt, [xn], #simm
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_LDRSWroX: {  // ldrsw xt, [xn, xm{, extend
-                                        // {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDRSWui: {  // ldrsw xt, [xn{, #pimm}]
-        uint64_t base =
-            operands[0].get<uint64_t>() + metadata.operands[1].mem.disp;
-        setMemoryAddresses({{base, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDURBBi: {  // ldurb wt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
-        break;
-      }
-      case Opcode::AArch64_LDURDi: {  // ldur dt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 8}});
-        break;
-      }
-      case Opcode::AArch64_LDURHHi: {  // ldurh wt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
-        break;
-      }
-      case Opcode::AArch64_LDURQi: {  // ldur qt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp,
-              16}});
-        break;
-      }
-      case Opcode::AArch64_LDURSWi: {  // ldursw xt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDURSi: {  // ldur sd, [<xn|sp>{, #imm}]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDURWi: {  // ldur wt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 4}});
-        break;
-      }
-      case Opcode::AArch64_LDURXi: {  // ldur xt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 8}});
-        break;
-      }
-      case Opcode::AArch64_LDXRW: {  // ldxr wt, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_LDXRX: {  // ldxr xt, [xn]
-        setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_PRFMui: {  // prfm op, [xn, xm{, extend {#amount}}]
-        // TODO: Implement prefetching
-        break;
-      }
-      case Opcode::AArch64_ST1B: {  // st1b {zt.b}, pg, [xn, xm]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 8;
-
-        const uint64_t base = operands[2].get<uint64_t>();
-        const uint64_t offset = operands[3].get<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << (i % 64);
-          if (p[i / 64] & shifted_active) {
-            addresses.push_back({base + (offset + i), 1});
-          }
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_SST1B_D_REAL: {  // st1b {zd.d}, pg, [xn, zm.d]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[2].get<uint64_t>();
-        const uint64_t* offset = operands[3].getAsVector<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            uint64_t addr = base + offset[i];
-            addresses.push_back({addr, 1});
-          }
-        }
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_SST1D_REAL: {  // st1d {zt.d}, pg, [xn, zm.d]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[2].get<uint64_t>();
-        const uint64_t* offset = operands[3].getAsVector<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            uint64_t addr = base + offset[i];
-            addresses.push_back({addr, 8});
-          }
-        }
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_SST1D_SCALED_SCALED_REAL: {  // st1d {zt.d}, pg, [xn,
-                                                        // zm.d, lsl #3]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[2].get<uint64_t>();
-        const uint64_t* offset = operands[3].getAsVector<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            uint64_t addr = base + (offset[i] << 3);
-            addresses.push_back({addr, 8});
-          }
-        }
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_ST1D: {  // st1d {zt.d}, pg, [xn, xm, lsl #3]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[2].get<uint64_t>();
-        const uint64_t offset = operands[3].get<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({base + ((offset + i) * 8), 8});
-          }
-        }
-
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_ST1D_IMM: {  // st1d {zt.d}, pg, [xn{, #imm, mul vl}]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[2].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[2].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        uint64_t addr = base + (offset * partition_num * 8);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({addr, 8});
-          }
-          addr += 8;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_ST2D_IMM: {  // st2d {zt1.d, zt2.d}, pg, [<xn|sp>{,
-                                        // #imm, mul vl}]
-        const uint64_t* p = operands[2].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[3].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<int64_t>(metadata.operands[3].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num * 2);
-
-        uint64_t addr = base + (offset * partition_num * 8);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({addr, 8});
-            addresses.push_back({addr + 8, 8});
-          }
-          addr += 16;
-        }
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_ST1W: {  // st1w {zt.s}, pg, [xn, xm, lsl #2]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 32;
-
-        const uint64_t base = operands[2].get<uint64_t>();
-        const uint64_t offset = operands[3].get<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 16) * 4);
-          if (p[i / 16] & shifted_active) {
-            addresses.push_back({base + ((offset + i) * 4), 4});
-          }
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_ST1W_D: {  // st1w {zt.d}, pg, [xn, xm, lsl #2]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[2].get<uint64_t>();
-        const uint64_t offset = operands[3].get<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            addresses.push_back({base + ((offset + i) * 4), 4});
-          }
-        }
-
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_ST1W_IMM: {  // st1w {zt.s}, pg, [xn{, #imm, mul vl}]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 32;
-
-        const uint64_t base = operands[2].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[2].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        uint64_t addr = base + (offset * partition_num * 4);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 16) * 4);
-          if (p[i / 16] & shifted_active) {
-            addresses.push_back({addr, 4});
-          }
-          addr += 4;
-        }
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_SST1W_D_IMM: {  // st1w {zt.d}, pg, [zn.d{, #imm}]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t* n = operands[2].getAsVector<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[2].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            uint64_t addr = n[i] + (offset * 4);
-            addresses.push_back({addr, 8});
-          }
-        }
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_SST1W_IMM: {  // st1w {zt.s}, pg, [zn.s{, #imm}]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 32;
-
-        const uint32_t* n = operands[2].getAsVector<uint32_t>();
-        const uint64_t offset = static_cast<uint64_t>(
-            static_cast<uint32_t>(metadata.operands[2].mem.disp));
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 16) * 4);
-          if (p[i / 16] & shifted_active) {
-            uint64_t addr = static_cast<uint64_t>(n[i]) + (offset * 4);
-            addresses.push_back({addr, 4});
-          }
-        }
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_GLD1D_REAL: {  // ld1d {zt.d}, pg/z, [xn, zm.d]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t* offset = operands[2].getAsVector<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            uint64_t addr = base + offset[i];
-            addresses.push_back({addr, 8});
-          }
-        }
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_GLD1D_SCALED_REAL: {  // ld1d {zt.d}, pg/z, [xn,
-                                                 // zm.d, LSL #3]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t* offset = operands[2].getAsVector<uint64_t>();
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            uint64_t addr = base + (offset[i] << 3);
-            addresses.push_back({addr, 8});
-          }
-        }
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_GLD1D_IMM_REAL: {  // ld1d {zd.d}, pg/z, [zn.d{,
-                                              // #imm}]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t* n = operands[1].getAsVector<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[2].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            uint64_t addr = n[i] + (offset * 8);
-            addresses.push_back({addr, 8});
-          }
-        }
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_GLD1SW_D_IMM_REAL: {  // ld1sw {zd.d}, pg/z, [zn.d{,
-                                                 // #imm}]
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t* n = operands[1].getAsVector<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[2].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            uint64_t addr = n[i] + (offset * 4);
-            addresses.push_back({addr, 4});
-          }
-        }
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_SST1D_IMM: {  // st1d {zt.d}, pg, [zn.d{, #imm}]
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-
-        const uint64_t* n = operands[2].getAsVector<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[2].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            uint64_t addr = n[i] + (offset * 8);
-            addresses.push_back({addr, 8});
-          }
-        }
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_ST1Twov16b: {  // st1v {vt.16b, vt2.16b}, [xn]
-        const uint64_t base = operands[2].get<uint64_t>();
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(32);
-
-        for (int i = 0; i < 32; i++) {
-          addresses.push_back({base + i, 1});
-        }
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_ST1i8_POST:
-        [[fallthrough]];
-      case Opcode::AArch64_ST1i8: {  // st1 {vt.b}[index], [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 1}});
-        break;
-      }
-      case Opcode::AArch64_ST1i16_POST:
-        [[fallthrough]];
-      case Opcode::AArch64_ST1i16: {  // st1 {vt.h}[index], [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 2}});
-        break;
-      }
-      case Opcode::AArch64_ST1i32_POST:
-        [[fallthrough]];
-      case Opcode::AArch64_ST1i32: {  // st1 {vt.s}[index], [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_ST1i64_POST:
-        [[fallthrough]];
-      case Opcode::AArch64_ST1i64: {  // st1 {vt.d}[index], [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_ST2Twov4s_POST: {  // st2 {vt1.4s, vt2.4s}, [xn],
-                                              // #imm
-        const uint64_t base = operands[2].get<uint64_t>();
-        std::vector<MemoryAccessTarget> addresses;
-        addresses.reserve(8);
-        for (int i = 0; i < 8; i++) {
-          addresses.push_back({base + 4 * i, 4});
-        }
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_STLRB: {  // stlrb wt, [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 1}});
-        break;
-      }
-      case Opcode::AArch64_STLRW: {  // stlr wt, [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_STLRX: {  // stlr xt, [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_STLXRW: {  // stlxr ws, wt, [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_STLXRX: {  // stlxr ws, xt, [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
-        break;
-      }
-      case Opcode::AArch64_STPDi:      // stp dt1, dt2, [xn, #imm]
-      case Opcode::AArch64_STPDpre:    // stp dt1, dt2, [xn, #imm]!
-      case Opcode::AArch64_STPQi:      // stp qt1, qt2, [xn, #imm]
-      case Opcode::AArch64_STPQpre:    // stp qt1, qt2, [xn, #imm]!
-      case Opcode::AArch64_STPSi:      // stp st1, st2, [xn, #imm]
-      case Opcode::AArch64_STPSpre:    // stp st1, st2, [xn, #imm]!
-      case Opcode::AArch64_STPWi:      // stp wt1, wt2, [xn, #imm]
-      case Opcode::AArch64_STPWpre:    // stp wt1, wt2, [xn, #imm]!
-      case Opcode::AArch64_STPXi:      // stp xt1, xt2, [xn, #imm]
-      case Opcode::AArch64_STPXpre: {  // stp xt1, xt2, [xn, #imm]!
-        std::vector<simeng::MemoryAccessTarget> addresses;
-        generateContiguousAddresses(
-            operands[2].get<uint64_t>() + metadata.operands[2].mem.disp, 2,
-            dataSize_, addresses);
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_STPDpost:    // stp dt1, dt2, [xn], #imm
-      case Opcode::AArch64_STPQpost:    // stp qt1, qt2, [xn], #imm
-      case Opcode::AArch64_STPSpost:    // stp st1, st2, [xn], #imm
-      case Opcode::AArch64_STPWpost:    // stp wt1, wt2, [xn], #imm
-      case Opcode::AArch64_STPXpost: {  // stp xt1, xt2, [xn], #imm
-        std::vector<simeng::MemoryAccessTarget> addresses;
-        generateContiguousAddresses(operands[2].get<uint64_t>(), 2, dataSize_,
-                                    addresses);
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_STRBBpost: {  // strb wd, [xn], #imm
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 1}});
-        break;
-      }
-      case Opcode::AArch64_STRBBpre: {  // strb wd, [xn, #imm]!
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
-        break;
-      }
-      case Opcode::AArch64_STRBBroW: {  // strb wd,
-                                        //  [xn, wm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 1}});
-        break;
-      }
-      case Opcode::AArch64_STRBBroX: {  // strb wd,
-                                        //  [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 1}});
-        break;
-      }
-      case Opcode::AArch64_STRBBui: {  // strb wd, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
-        break;
-      }
-      case Opcode::AArch64_STRDroW: {  // str dt, [xn, wm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 8}});
-        break;
-      }
-      case Opcode::AArch64_STRDroX: {  // str dt, [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 8}});
-        break;
-      }
-      case Opcode::AArch64_STRBui:     // str bt, [xn, #imm]
-      case Opcode::AArch64_STRBpre:    // str bt, [xn, #imm]!
-      case Opcode::AArch64_STRDui:     // str dt, [xn, #imm]
-      case Opcode::AArch64_STRDpre:    // str dt, [xn, #imm]!
-      case Opcode::AArch64_STRHui:     // str ht, [xn, #imm]
-      case Opcode::AArch64_STRHpre:    // str ht, [xn, #imm]!
-      case Opcode::AArch64_STRQui:     // str qt, [xn, #imm]
-      case Opcode::AArch64_STRQpre:    // str qt, [xn, #imm]!
-      case Opcode::AArch64_STRSui:     // str st, [xn, #imm]
-      case Opcode::AArch64_STRSpre:    // str st, [xn, #imm]!
-      case Opcode::AArch64_STRWui:     // str wt, [xn, #imm]
-      case Opcode::AArch64_STRWpre:    // str wt, [xn, #imm]!
-      case Opcode::AArch64_STRXui:     // str xt, [xn, #imm]
-      case Opcode::AArch64_STRXpre: {  // str xt, [xn, #imm]!
-        std::vector<simeng::MemoryAccessTarget> addresses;
-        generateContiguousAddresses(
-            operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 1,
-            dataSize_, addresses);
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_STRBpost:    // str bt, [xn], #imm
-      case Opcode::AArch64_STRDpost:    // str dt, [xn], #imm
-      case Opcode::AArch64_STRHpost:    // str ht, [xn], #imm
-      case Opcode::AArch64_STRQpost:    // str qt, [xn], #imm
-      case Opcode::AArch64_STRSpost:    // str st, [xn], #imm
-      case Opcode::AArch64_STRWpost:    // str wt, [xn], #imm
-      case Opcode::AArch64_STRXpost: {  // str xt, [xn], #imm
-        std::vector<simeng::MemoryAccessTarget> addresses;
-        generateContiguousAddresses(operands[1].get<uint64_t>(), 1, dataSize_,
-                                    addresses);
-        setMemoryAddresses(addresses);
-        break;
-      }
-      case Opcode::AArch64_STRHHpost: {  // strh wt, [xn], #imm
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 2}});
-        break;
-      }
-      case Opcode::AArch64_STRHHpre: {  // strh wd, [xn, #imm]!
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
-        break;
-      }
-      case Opcode::AArch64_STRHHroW: {  // strh wd,
-                                        //  [xn, wm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 2}});
-        break;
-      }
-      case Opcode::AArch64_STRHHroX: {  // strh wd,
-                                        //  [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 2}});
-        break;
-      }
-      case Opcode::AArch64_STRHHui: {  // strh wt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
-        break;
-      }
-      case Opcode::AArch64_STRQroX: {  // str qt, [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 16}});
-        break;
-      }
-      case Opcode::AArch64_STRSroW: {  // str st, [xn, wm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 4}});
-        break;
-      }
-      case Opcode::AArch64_STRSroX: {  // str st, [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 4}});
-        break;
-      }
-      case Opcode::AArch64_STRWroW: {  // str wd, [xn, wm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 4}});
-        break;
-      }
-      case Opcode::AArch64_STRWroX: {  // str wt, [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 4}});
-        break;
-      }
-      case Opcode::AArch64_STRXroW: {  // str xd, [xn, wm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 8}});
-        break;
-      }
-      case Opcode::AArch64_STRXroX: {  // str xt, [xn, xm{, extend {#amount}}]
-        uint64_t offset =
-            extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
-        setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 8}});
-        break;
-      }
-      case Opcode::AArch64_STR_PXI: {  // str pt, [xn{, #imm, mul vl}]
-        const uint64_t PL_bits = VL_bits / 8;
-        const uint16_t partition_num = PL_bits / 8;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[1].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses(partition_num);
-
-        uint64_t addr = base + (offset * partition_num);
-
-        for (int i = 0; i < partition_num; i++) {
-          addresses[i] = {addr, 1};
-          addr += 1;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_STR_ZXI: {  // str zt, [xn{, #imm, mul vl}]
-        const uint16_t partition_num = VL_bits / 8;
-
-        const uint64_t base = operands[1].get<uint64_t>();
-        const uint64_t offset =
-            static_cast<uint64_t>(metadata.operands[1].mem.disp);
-
-        std::vector<MemoryAccessTarget> addresses(partition_num);
-
-        uint64_t addr = base + (offset * partition_num);
-        for (int i = 0; i < partition_num; i++) {
-          addresses[i] = {addr, 1};
-          addr += 1;
-        }
-
-        setMemoryAddresses(std::move(addresses));
-        break;
-      }
-      case Opcode::AArch64_STURBBi: {  // sturb wd, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
-        break;
-      }
-      case Opcode::AArch64_STURDi: {  // stur dt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 8}});
-        break;
-      }
-      case Opcode::AArch64_STURHHi: {  // sturh wt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
-        break;
-      }
-      case Opcode::AArch64_STURQi: {  // stur qt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp,
-              16}});
-        break;
-      }
-      case Opcode::AArch64_STURSi: {  // stur st, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 4}});
-        break;
-      }
-      case Opcode::AArch64_STURWi: {  // stur wt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 4}});
-        break;
-      }
-      case Opcode::AArch64_STURXi: {  // stur xt, [xn, #imm]
-        setMemoryAddresses(
-            {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 8}});
-        break;
-      }
-      case Opcode::AArch64_STXRW: {  // stxr ws, wt, [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
-        break;
-      }
-      case Opcode::AArch64_STXRX: {  // stxr ws, xt, [xn]
-        setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
-        break;
-      }
-      default:
-        exceptionEncountered_ = true;
-        exception_ = InstructionException::ExecutionNotYetImplemented;
-        break;
+    case MicroOpcode::STR_ADDR: {
+      std::vector<simeng::MemoryAccessTarget> addresses;
+      generateContiguousAddresses(
+          operands[0].get<uint64_t>() + metadata.operands[0].mem.disp, 1,
+          dataSize_, addresses);
+
+      setMemoryAddresses(addresses);
+      break;
     }
+    default:
+      exceptionEncountered_ = true;
+      exception_ = InstructionException::ExecutionNotYetImplemented;
+      break;
+  }
+}
+
+// casal ws, wt, [xn|sp]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_CASALW>() {
+  setMemoryAddresses({{operands[2].get<uint64_t>(), 4}});
+}
+
+// casal xs, xt, [xn|sp]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_CASALX>() {
+  setMemoryAddresses({{operands[2].get<uint64_t>(), 8}});
+}
+
+// ld1 {vt.s}[index], [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1i32>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
+}
+
+// ld1 {vt.d}[index], [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1i64>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
+}
+
+// ld1 {vt.d}[index], [xn], #8
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1i64_POST>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
+}
+
+// ld1rd {zt.d}, pg/z, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1RD_IMM>() {
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  for (int i = 0; i < 4; i++) {
+    if (p[i] != 0) {
+      setMemoryAddresses(
+          {{operands[1].get<uint64_t>() + metadata.operands[2].mem.disp,
+            8}});
+      break;
+    }
+  }
+}
+
+// ld1rqd {zd.d}, pg/z, [xn{, #imm}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1RQ_D_IMM>() {
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+  uint64_t addr =
+      operands[1].get<uint64_t>() + metadata.operands[2].mem.disp;
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(2);
+
+  for (int i = 0; i < 2; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({addr, 8});
+    }
+    addr += 8;
+  }
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ld1rw {zt.s}, pg/z, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1RW_IMM>() {
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  for (int i = 0; i < 4; i++) {
+    if (p[i] != 0) {
+      setMemoryAddresses(
+          {{operands[1].get<uint64_t>() + metadata.operands[2].mem.disp,
+            4}});
+      break;
+    }
+  }
+}
+
+// ld1r {vt.16b}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv16b>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1r {vt.16b}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv16b_POST>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1r {vt.1d}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv1d>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
+}
+
+// ld1r {vt.1d}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv1d_POST>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
+}
+
+// ld1r {vt.2d}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv2d>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1r {vt.2d}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv2d_POST>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1r {vt.2s}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv2s>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1r {vt.2s}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv2s_POST>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
+}
+
+// ld1r {vt.4h}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv4h>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
+}
+
+// ld1r {vt.4h}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv4h_POST>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
+}
+
+// ld1r {vt.8b}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv8b>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
+}
+
+// ld1r {vt.8b}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv8b_POST>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
+}
+
+// ld1r {vt.8h}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv8h>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1r {vt.8h}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv8h_POST>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1r {vt.4s}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv4s>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1r {vt.4s}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv4s_POST>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1 {vt.16b}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Onev16b>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1 {vt.16b}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Onev16b_POST>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 16}});
+}
+
+// ld1 {vt1.16b, vt2.16b}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Twov16b>() {
+  uint64_t base = operands[0].get<uint64_t>();
+  setMemoryAddresses({{base, 16}, {base + 16, 16}});
+}
+
+// ld1 {vt1.16b, vt2.16b}, [xn],   #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Twov16b_POST>() {
+  uint64_t base = operands[0].get<uint64_t>();
+  setMemoryAddresses({{base, 16}, {base + 16, 16}});
+}
+
+// ld1b {zt.b}, pg/z, [xn, xm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 8;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t offset = operands[2].get<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << (i % 64);
+    if (p[i / 64] & shifted_active) {
+      addresses.push_back({base + (offset + i), 1});
+    }
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ld1d {zt.d}, pg/z, [xn, xm, lsl #3]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t offset = operands[2].get<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({base + ((offset + i) * 8), 8});
+    }
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ld1d {zt.d}, pg/z, [xn{, #imm, mul vl}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1D_IMM_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[2].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  uint64_t addr = base + (offset * partition_num * 8);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({addr, 8});
+    }
+    addr += 8;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ld1h {zt.h}, pg/z, [xn, xm, lsl #1]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 16;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t offset = operands[2].get<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 32) * 2);
+    if (p[i / 32] & shifted_active) {
+      addresses.push_back({base + ((offset + i) * 2), 2});
+    }
+  }
+
+  setMemoryAddresses(addresses);
+}
+
+// ld1w {zt.s}, pg/z, [xn, xm, lsl #2]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1W>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 32;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t offset = operands[2].get<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 16) * 4);
+    if (p[i / 16] & shifted_active) {
+      addresses.push_back({base + ((offset + i) * 4), 4});
+    }
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ld1w {zt.s}, pg/z, [xn{, #imm, mul vl}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1W_IMM_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 32;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[2].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  uint64_t addr = base + (offset * partition_num * 4);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 16) * 4);
+    if (p[i / 16] & shifted_active) {
+      addresses.push_back({addr, 4});
+    }
+    addr += 4;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ld2d {zt1.d, zt2.d}, pg/z, [xn|sp, xm, lsl #3]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD2D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  uint64_t offset = operands[2].get<uint64_t>();
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num * 2);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t addr = base + (offset * 8);
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({addr, 8});
+      addresses.push_back({addr + 8, 8});
+    }
+    offset = offset + 2;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ld2d {zt1.d, zt2.d}, pg/z, [xn|sp{, #imm, MUL VL}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD2D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<int64_t>(metadata.operands[3].mem.disp);
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num * 2);
+
+  uint64_t addr = base + (offset * partition_num * 8);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({addr, 8});
+      addresses.push_back({addr + 8, 8});
+    }
+    addr += 16;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ld3d {zt1.d, zt2.d, zt3.d}, pg/z, [xn|sp{, #imm, MUL VL}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD3D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<int64_t>(metadata.operands[4].mem.disp);
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num * 3);
+
+  uint64_t addr = base + (offset * partition_num * 8);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({addr, 8});
+      addresses.push_back({addr + 8, 8});
+      addresses.push_back({addr + 16, 8});
+    }
+    addr += 24;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ld4d {zt1.d, zt2.d, zt3.d, zt4.d}, pg/z, [xn|sp{, #imm, MUL VL}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD4D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const int64_t offset =
+      static_cast<int64_t>(metadata.operands[5].mem.disp);
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num * 4);
+
+  uint64_t addr = base + (offset * partition_num * 8);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({addr, 8});
+      addresses.push_back({addr + 8, 8});
+      addresses.push_back({addr + 16, 8});
+      addresses.push_back({addr + 24, 8});
+    }
+    addr += 32;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ld2 {vt1.4s, vt2.4s}, [xn]
+// ld2 {vt1.4s, vt2.4s}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LD2Twov4s_POST>() {
+  const uint64_t base = operands[2].get<uint64_t>();
+  setMemoryAddresses({{base, 16}, {base + 16, 16}});
+}
+
+// ldaddl ws, wt, [xn]
+// ldadd ws, wt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDADDW>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
+}
+
+// ldarb wt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDARB>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 1}});
+}
+
+// ldar wt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDARW>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 4}});
+}
+
+// ldar xt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDARX>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
+}
+
+// ldaxr wd, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDAXRW>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 4}});
+}
+
+// ldaxr xd, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDAXRX>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
+}
+
+// ldrb wt, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRBBpost>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 1}});
+}
+
+// ldrb wt, [xn, #imm]!
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRBBpre>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
+}
+
+// ldrb wt,  [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRBBroW>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 1}});
+}
+
+// ldrb wt,  [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRBBroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 1}});
+}
+
+// ldrb wt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRBBui>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
+}
+
+// ldr dt, [xn, wm{, extend {amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRDroW>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 8}});
+}
+
+// ldr dt, [xn, xm{, extend {amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRDroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 8}});
+}
+
+// ldr bt, [xn, #imm]
+// ldr bt, [xn, #imm]!
+// ldr dt, [xn, #imm]
+// ldr dt, [xn, #imm]!
+// ldr ht, [xn, #imm]
+// ldr ht, [xn, #imm]!
+// ldr qt, [xn, #imm]
+// ldr qt, [xn, #imm]!
+// ldr st, [xn, #imm]
+// ldr st, [xn, #imm]!
+// ldr wt, [xn, #imm]
+// ldr wt, [xn, #imm]!
+// ldr xt, [xn, #imm]
+// ldr xt, [xn, #imm]!
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRXpre>() {
+  std::vector<simeng::MemoryAccessTarget> addresses;
+  generateContiguousAddresses(
+      operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1,
+      dataSize_, addresses);
+  setMemoryAddresses(addresses);
+}
+
+// ldr bt, [xn], #imm
+// ldr dt, [xn], #imm
+// ldr ht, [xn], #imm
+// ldr qt, [xn], #imm
+// ldr st, [xn], #imm
+// ldr wt, [xn], #imm
+// ldr xt, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRXpost>() {
+  std::vector<simeng::MemoryAccessTarget> addresses;
+  generateContiguousAddresses(operands[0].get<uint64_t>(), 1, dataSize_,
+                              addresses);
+  setMemoryAddresses(addresses);
+}
+
+// ldrh wt, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRHHpost>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 2}});
+}
+
+// ldrh wt, [xn, #imm]!
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRHHpre>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
+}
+
+// ldrh wt, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRHHroW>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
+}
+
+// ldrh wt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRHHroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
+}
+
+// ldrh wt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRHHui>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
+}
+
+// ldr qt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRQroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 16}});
+}
+
+// ldr st, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSroW>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 4}});
+}
+
+// ldr st, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 4}});
+}
+
+// ldrsw xt, #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSWl>() {
+  setMemoryAddresses(
+      {{metadata.operands[1].imm + instructionAddress_, 4}});
+}
+
+// ldr wt, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRWroW>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 4}});
+}
+
+// ldr wt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRWroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 4}});
+}
+
+// ldr xt, #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRXl>() {
+  setMemoryAddresses(
+      {{metadata.operands[1].imm + instructionAddress_, 8}});
+}
+
+// ldr xt, [xn, wn{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRXroW>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 8}});
+}
+
+// ldr xt, [xn, xn{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRXroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 8}});
+}
+
+// ldr pt, [xn{, #imm, mul vl}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDR_PXI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t PL_bits = VL_bits / 8;
+  const uint16_t partition_num = PL_bits / 8;
+
+  const uint64_t base = operands[0].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[1].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses(partition_num);
+
+  uint64_t addr = base + (offset * partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    addresses[i] = {addr, 1};
+    addr += 1;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ldr zt, [xn{, #imm, mul vl}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDR_ZXI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint16_t partition_num = VL_bits / 8;
+
+  const uint64_t base = operands[0].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[1].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses(partition_num);
+
+  uint64_t addr = base + (offset * partition_num);
+  for (int i = 0; i < partition_num; i++) {
+    addresses[i] = {addr, 1};
+    addr += 1;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// ldnp st1, st2, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDNPSi>() {
+  uint64_t base =
+      operands[0].get<uint64_t>() + metadata.operands[2].mem.disp;
+  setMemoryAddresses({{base, 4}, {base + 4, 4}});
+}
+
+// ldp dt1, dt2, [xn, #imm]
+// ldp dt1, dt2, [xn, #imm!]
+// ldp qt1, qt2, [xn, #imm]
+// ldp qt1, qt2, [xn, #imm!]
+// ldp st1, st2, [xn, #imm]
+// ldp st1, st2, [xn, #imm!]
+// ldp wt1, wt2, [xn, #imm]
+// ldp wt1, wt2, [xn, #imm!]
+// ldp xt1, xt2, [xn, #imm]
+// ldp xt1, xt2, [xn, #imm!]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDPXpre>() {
+  std::vector<simeng::MemoryAccessTarget> addresses;
+  generateContiguousAddresses(
+      operands[0].get<uint64_t>() + metadata.operands[2].mem.disp, 2,
+      dataSize_, addresses);
+  setMemoryAddresses(addresses);
+}
+
+// ldp dt1, dt2, [xn], #imm
+// ldp qt1, qt2, [xn], #imm
+// ldp st1, st2, [xn], #imm
+// ldp wt1, wt2, [xn], #imm
+// ldp xt1, xt2, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDPXpost>() {
+  std::vector<simeng::MemoryAccessTarget> addresses;
+  generateContiguousAddresses(operands[0].get<uint64_t>(), 2, dataSize_,
+                              addresses);
+  setMemoryAddresses(addresses);
+}
+
+// ldpsw xt1, xt2, [xn {, #imm}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDPSWi>() {
+  uint64_t base =
+      operands[0].get<uint64_t>() + metadata.operands[2].mem.disp;
+  setMemoryAddresses({{base, 4}, {base + 4, 4}});
+}
+
+// ldrsb wt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSBWroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 1}});
+}
+
+// ldrsb xt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSBWui>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
+}
+
+// ldrsb xt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSBXui>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
+}
+
+// ldrsh wt, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHWroW>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
+}
+
+// ldrsh wt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHWroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
+}
+
+// ldrsh wt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHWui>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
+}
+
+// ldrsh xt, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHXroW>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
+}
+
+// ldrsh xt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHXroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 2}});
+}
+
+// ldrsh xt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHXui>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
+}
+
+// ldrsw xt, [xn], #simm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSWpost>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 4}});
+}
+
+// ldrsw xt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSWroX>() {
+  uint64_t offset =
+      extendOffset(operands[1].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[0].get<uint64_t>() + offset, 4}});
+}
+
+// ldrsw xt, [xn{, #pimm}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSWui>() {
+  uint64_t base =
+      operands[0].get<uint64_t>() + metadata.operands[1].mem.disp;
+  setMemoryAddresses({{base, 4}});
+}
+
+// ldurb wt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURBBi>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
+}
+
+// ldur dt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURDi>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 8}});
+}
+
+// ldurh wt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURHHi>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
+}
+
+// ldur qt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURQi>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp,
+        16}});
+}
+
+// ldursw xt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURSWi>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 4}});
+}
+
+// ldur sd, [<xn|sp>{, #imm}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURSi>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 4}});
+}
+
+// ldur wt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURWi>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 4}});
+}
+
+// ldur xt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURXi>() {
+  setMemoryAddresses(
+      {{operands[0].get<uint64_t>() + metadata.operands[1].mem.disp, 8}});
+}
+
+// ldxr wt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDXRW>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 4}});
+}
+
+// ldxr xt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_LDXRX>() {
+  setMemoryAddresses({{operands[0].get<uint64_t>(), 8}});
+}
+
+// prfm op, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_PRFMui>() {
+  // TODO: Implement prefetching
+}
+
+// st1b {zt.b}, pg, [xn, xm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 8;
+
+  const uint64_t base = operands[2].get<uint64_t>();
+  const uint64_t offset = operands[3].get<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << (i % 64);
+    if (p[i / 64] & shifted_active) {
+      addresses.push_back({base + (offset + i), 1});
+    }
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// st1b {zd.d}, pg, [xn, zm.d]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_SST1B_D_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[2].get<uint64_t>();
+  const uint64_t* offset = operands[3].getAsVector<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      uint64_t addr = base + offset[i];
+      addresses.push_back({addr, 1});
+    }
+  }
+  setMemoryAddresses(addresses);
+}
+
+// st1d {zt.d}, pg, [xn, zm.d]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_SST1D_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[2].get<uint64_t>();
+  const uint64_t* offset = operands[3].getAsVector<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      uint64_t addr = base + offset[i];
+      addresses.push_back({addr, 8});
+    }
+  }
+  setMemoryAddresses(addresses);
+}
+
+// st1d {zt.d}, pg, [xn, zm.d, lsl #3]
+template <>
+void Instruction::generateOpcodeAddresses<
+    Opcode::AArch64_SST1D_SCALED_SCALED_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[2].get<uint64_t>();
+  const uint64_t* offset = operands[3].getAsVector<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      uint64_t addr = base + (offset[i] << 3);
+      addresses.push_back({addr, 8});
+    }
+  }
+  setMemoryAddresses(addresses);
+}
+
+// st1d {zt.d}, pg, [xn, xm, lsl #3]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[2].get<uint64_t>();
+  const uint64_t offset = operands[3].get<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({base + ((offset + i) * 8), 8});
+    }
+  }
+
+  setMemoryAddresses(addresses);
+}
+
+// st1d {zt.d}, pg, [xn{, #imm, mul vl}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[2].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[2].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  uint64_t addr = base + (offset * partition_num * 8);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({addr, 8});
+    }
+    addr += 8;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// st2d {zt1.d, zt2.d}, pg, [<xn|sp>{, #imm, mul vl}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST2D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[2].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[3].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<int64_t>(metadata.operands[3].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num * 2);
+
+  uint64_t addr = base + (offset * partition_num * 8);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({addr, 8});
+      addresses.push_back({addr + 8, 8});
+    }
+    addr += 16;
+  }
+  setMemoryAddresses(std::move(addresses));
+}
+
+// st1w {zt.s}, pg, [xn, xm, lsl #2]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1W>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 32;
+
+  const uint64_t base = operands[2].get<uint64_t>();
+  const uint64_t offset = operands[3].get<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 16) * 4);
+    if (p[i / 16] & shifted_active) {
+      addresses.push_back({base + ((offset + i) * 4), 4});
+    }
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// st1w {zt.d}, pg, [xn, xm, lsl #2]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1W_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[2].get<uint64_t>();
+  const uint64_t offset = operands[3].get<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      addresses.push_back({base + ((offset + i) * 4), 4});
+    }
+  }
+
+  setMemoryAddresses(addresses);
+}
+
+// st1w {zt.s}, pg, [xn{, #imm, mul vl}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1W_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 32;
+
+  const uint64_t base = operands[2].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[2].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  uint64_t addr = base + (offset * partition_num * 4);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 16) * 4);
+    if (p[i / 16] & shifted_active) {
+      addresses.push_back({addr, 4});
+    }
+    addr += 4;
+  }
+  setMemoryAddresses(std::move(addresses));
+}
+
+// st1w {zt.d}, pg, [zn.d{, #imm}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_SST1W_D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t* n = operands[2].getAsVector<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[2].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      uint64_t addr = n[i] + (offset * 4);
+      addresses.push_back({addr, 8});
+    }
+  }
+  setMemoryAddresses(addresses);
+}
+
+// st1w {zt.s}, pg, [zn.s{, #imm}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_SST1W_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 32;
+
+  const uint32_t* n = operands[2].getAsVector<uint32_t>();
+  const uint64_t offset = static_cast<uint64_t>(
+      static_cast<uint32_t>(metadata.operands[2].mem.disp));
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 16) * 4);
+    if (p[i / 16] & shifted_active) {
+      uint64_t addr = static_cast<uint64_t>(n[i]) + (offset * 4);
+      addresses.push_back({addr, 4});
+    }
+  }
+  setMemoryAddresses(addresses);
+}
+
+// ld1d {zt.d}, pg/z, [xn, zm.d]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_GLD1D_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t* offset = operands[2].getAsVector<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      uint64_t addr = base + offset[i];
+      addresses.push_back({addr, 8});
+    }
+  }
+  setMemoryAddresses(addresses);
+}
+
+// ld1d {zt.d}, pg/z, [xn, zm.d, LSL #3]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_GLD1D_SCALED_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t* offset = operands[2].getAsVector<uint64_t>();
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      uint64_t addr = base + (offset[i] << 3);
+      addresses.push_back({addr, 8});
+    }
+  }
+  setMemoryAddresses(addresses);
+}
+
+// ld1d {zd.d}, pg/z, [zn.d{, #imm}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_GLD1D_IMM_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t* n = operands[1].getAsVector<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[2].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      uint64_t addr = n[i] + (offset * 8);
+      addresses.push_back({addr, 8});
+    }
+  }
+  setMemoryAddresses(addresses);
+}
+
+// ld1sw {zd.d}, pg/z, [zn.d{, #imm}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_GLD1SW_D_IMM_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t* n = operands[1].getAsVector<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[2].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      uint64_t addr = n[i] + (offset * 4);
+      addresses.push_back({addr, 4});
+    }
+  }
+  setMemoryAddresses(addresses);
+}
+
+// st1d {zt.d}, pg, [zn.d{, #imm}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_SST1D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+
+  const uint64_t* n = operands[2].getAsVector<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[2].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      uint64_t addr = n[i] + (offset * 8);
+      addresses.push_back({addr, 8});
+    }
+  }
+  setMemoryAddresses(addresses);
+}
+
+// st1v {vt.16b, vt2.16b}, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1Twov16b>() {
+  const uint64_t base = operands[2].get<uint64_t>();
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(32);
+
+  for (int i = 0; i < 32; i++) {
+    addresses.push_back({base + i, 1});
+  }
+  setMemoryAddresses(std::move(addresses));
+}
+
+// st1 {vt.b}[index], [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1i8>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 1}});
+}
+
+// st1 {vt.h}[index], [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1i16>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 2}});
+}
+
+// st1 {vt.s}[index], [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1i32>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
+}
+
+// st1 {vt.d}[index], [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1i64>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
+}
+
+// st2 {vt1.4s, vt2.4s}, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_ST2Twov4s_POST>() {
+  const uint64_t base = operands[2].get<uint64_t>();
+  std::vector<MemoryAccessTarget> addresses;
+  addresses.reserve(8);
+  for (int i = 0; i < 8; i++) {
+    addresses.push_back({base + 4 * i, 4});
+  }
+  setMemoryAddresses(std::move(addresses));
+}
+
+// stlrb wt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STLRB>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 1}});
+}
+
+// stlr wt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STLRW>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
+}
+
+// stlr xt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STLRX>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
+}
+
+// stlxr ws, wt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STLXRW>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
+}
+
+// stlxr ws, xt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STLXRX>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
+}
+
+// stp dt1, dt2, [xn, #imm]
+// stp dt1, dt2, [xn, #imm]!
+// stp qt1, qt2, [xn, #imm]
+// stp qt1, qt2, [xn, #imm]!
+// stp st1, st2, [xn, #imm]
+// stp st1, st2, [xn, #imm]!
+// stp wt1, wt2, [xn, #imm]
+// stp wt1, wt2, [xn, #imm]!
+// stp xt1, xt2, [xn, #imm]
+// stp xt1, xt2, [xn, #imm]!
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STPXpre>() {
+  std::vector<simeng::MemoryAccessTarget> addresses;
+  generateContiguousAddresses(
+      operands[2].get<uint64_t>() + metadata.operands[2].mem.disp, 2,
+      dataSize_, addresses);
+  setMemoryAddresses(addresses);
+}
+
+// stp dt1, dt2, [xn], #imm
+// stp qt1, qt2, [xn], #imm
+// stp st1, st2, [xn], #imm
+// stp wt1, wt2, [xn], #imm
+// stp xt1, xt2, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STPXpost>() {
+  std::vector<simeng::MemoryAccessTarget> addresses;
+  generateContiguousAddresses(operands[2].get<uint64_t>(), 2, dataSize_,
+                              addresses);
+  setMemoryAddresses(addresses);
+}
+
+// strb wd, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRBBpost>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 1}});
+}
+
+// strb wd, [xn, #imm]!
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRBBpre>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
+}
+
+// strb wd,  [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRBBroW>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 1}});
+}
+
+// strb wd,  [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRBBroX>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 1}});
+}
+
+// strb wd, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRBBui>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
+}
+
+// str dt, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRDroW>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 8}});
+}
+
+// str dt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRDroX>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 8}});
+}
+
+// str bt, [xn, #imm]
+// str bt, [xn, #imm]!
+// str dt, [xn, #imm]
+// str dt, [xn, #imm]!
+// str ht, [xn, #imm]
+// str ht, [xn, #imm]!
+// str qt, [xn, #imm]
+// str qt, [xn, #imm]!
+// str st, [xn, #imm]
+// str st, [xn, #imm]!
+// str wt, [xn, #imm]
+// str wt, [xn, #imm]!
+// str xt, [xn, #imm]
+// str xt, [xn, #imm]!
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRXpre>() {
+  std::vector<simeng::MemoryAccessTarget> addresses;
+  generateContiguousAddresses(
+      operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 1,
+      dataSize_, addresses);
+  setMemoryAddresses(addresses);
+}
+
+// str bt, [xn], #imm
+// str dt, [xn], #imm
+// str ht, [xn], #imm
+// str qt, [xn], #imm
+// str st, [xn], #imm
+// str wt, [xn], #imm
+// str xt, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRXpost>() {
+  std::vector<simeng::MemoryAccessTarget> addresses;
+  generateContiguousAddresses(operands[1].get<uint64_t>(), 1, dataSize_,
+                              addresses);
+  setMemoryAddresses(addresses);
+}
+
+// strh wt, [xn], #imm
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRHHpost>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 2}});
+}
+
+// strh wd, [xn, #imm]!
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRHHpre>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
+}
+
+// strh wd,  [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRHHroW>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 2}});
+}
+
+// strh wd,  [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRHHroX>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 2}});
+}
+
+// strh wt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRHHui>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
+}
+
+// str qt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRQroX>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 16}});
+}
+
+// str st, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRSroW>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 4}});
+}
+
+// str st, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRSroX>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 4}});
+}
+
+// str wd, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRWroW>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 4}});
+}
+
+// str wt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRWroX>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 4}});
+}
+
+// str xd, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRXroW>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint32_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 8}});
+}
+
+// str xt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STRXroX>() {
+  uint64_t offset =
+      extendOffset(operands[2].get<uint64_t>(), metadata.operands[1]);
+  setMemoryAddresses({{operands[1].get<uint64_t>() + offset, 8}});
+}
+
+// str pt, [xn{, #imm, mul vl}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STR_PXI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t PL_bits = VL_bits / 8;
+  const uint16_t partition_num = PL_bits / 8;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[1].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses(partition_num);
+
+  uint64_t addr = base + (offset * partition_num);
+
+  for (int i = 0; i < partition_num; i++) {
+    addresses[i] = {addr, 1};
+    addr += 1;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// str zt, [xn{, #imm, mul vl}]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STR_ZXI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint16_t partition_num = VL_bits / 8;
+
+  const uint64_t base = operands[1].get<uint64_t>();
+  const uint64_t offset =
+      static_cast<uint64_t>(metadata.operands[1].mem.disp);
+
+  std::vector<MemoryAccessTarget> addresses(partition_num);
+
+  uint64_t addr = base + (offset * partition_num);
+  for (int i = 0; i < partition_num; i++) {
+    addresses[i] = {addr, 1};
+    addr += 1;
+  }
+
+  setMemoryAddresses(std::move(addresses));
+}
+
+// sturb wd, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STURBBi>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 1}});
+}
+
+// stur dt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STURDi>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 8}});
+}
+
+// sturh wt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STURHHi>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 2}});
+}
+
+// stur qt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STURQi>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp,
+        16}});
+}
+
+// stur st, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STURSi>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 4}});
+}
+
+// stur wt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STURWi>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 4}});
+}
+
+// stur xt, [xn, #imm]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STURXi>() {
+  setMemoryAddresses(
+      {{operands[1].get<uint64_t>() + metadata.operands[1].mem.disp, 8}});
+}
+
+// stxr ws, wt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STXRW>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 4}});
+}
+
+// stxr ws, xt, [xn]
+template <>
+void Instruction::generateOpcodeAddresses<Opcode::AArch64_STXRX>() {
+  setMemoryAddresses({{operands[1].get<uint64_t>(), 8}});
+}
+
+Instruction::Handler Instruction::resolveAddressHandler() const {
+  if (isMicroOp_) return &Instruction::generateMicroOpAddresses;
+  switch (metadata.opcode) {
+    case Opcode::AArch64_CASALW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_CASALW>;
+    case Opcode::AArch64_CASALX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_CASALX>;
+    case Opcode::AArch64_LD1i32:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1i32>;
+    case Opcode::AArch64_LD1i64:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1i64>;
+    case Opcode::AArch64_LD1i64_POST:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1i64_POST>;
+    case Opcode::AArch64_LD1RD_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1RD_IMM>;
+    case Opcode::AArch64_LD1RQ_D_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1RQ_D_IMM>;
+    case Opcode::AArch64_LD1RW_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1RW_IMM>;
+    case Opcode::AArch64_LD1Rv16b:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv16b>;
+    case Opcode::AArch64_LD1Rv16b_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1Rv16b_POST>;
+    case Opcode::AArch64_LD1Rv1d:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv1d>;
+    case Opcode::AArch64_LD1Rv1d_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1Rv1d_POST>;
+    case Opcode::AArch64_LD1Rv2d:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv2d>;
+    case Opcode::AArch64_LD1Rv2d_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1Rv2d_POST>;
+    case Opcode::AArch64_LD1Rv2s:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv2s>;
+    case Opcode::AArch64_LD1Rv2s_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1Rv2s_POST>;
+    case Opcode::AArch64_LD1Rv4h:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv4h>;
+    case Opcode::AArch64_LD1Rv4h_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1Rv4h_POST>;
+    case Opcode::AArch64_LD1Rv8b:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv8b>;
+    case Opcode::AArch64_LD1Rv8b_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1Rv8b_POST>;
+    case Opcode::AArch64_LD1Rv8h:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv8h>;
+    case Opcode::AArch64_LD1Rv8h_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1Rv8h_POST>;
+    case Opcode::AArch64_LD1Rv4s:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Rv4s>;
+    case Opcode::AArch64_LD1Rv4s_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1Rv4s_POST>;
+    case Opcode::AArch64_LD1Onev16b:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Onev16b>;
+    case Opcode::AArch64_LD1Onev16b_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1Onev16b_POST>;
+    case Opcode::AArch64_LD1Twov16b:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1Twov16b>;
+    case Opcode::AArch64_LD1Twov16b_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1Twov16b_POST>;
+    case Opcode::AArch64_LD1B:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1B>;
+    case Opcode::AArch64_LD1D:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1D>;
+    case Opcode::AArch64_LD1D_IMM_REAL:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1D_IMM_REAL>;
+    case Opcode::AArch64_LD1H:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1H>;
+    case Opcode::AArch64_LD1W:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD1W>;
+    case Opcode::AArch64_LD1W_IMM_REAL:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD1W_IMM_REAL>;
+    case Opcode::AArch64_LD2D:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD2D>;
+    case Opcode::AArch64_LD2D_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD2D_IMM>;
+    case Opcode::AArch64_LD3D_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD3D_IMM>;
+    case Opcode::AArch64_LD4D_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LD4D_IMM>;
+    case Opcode::AArch64_LD2Twov4s:
+    case Opcode::AArch64_LD2Twov4s_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_LD2Twov4s_POST>;
+    case Opcode::AArch64_LDADDLW:
+    case Opcode::AArch64_LDADDW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDADDW>;
+    case Opcode::AArch64_LDARB:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDARB>;
+    case Opcode::AArch64_LDARW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDARW>;
+    case Opcode::AArch64_LDARX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDARX>;
+    case Opcode::AArch64_LDAXRW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDAXRW>;
+    case Opcode::AArch64_LDAXRX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDAXRX>;
+    case Opcode::AArch64_LDRBBpost:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRBBpost>;
+    case Opcode::AArch64_LDRBBpre:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRBBpre>;
+    case Opcode::AArch64_LDRBBroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRBBroW>;
+    case Opcode::AArch64_LDRBBroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRBBroX>;
+    case Opcode::AArch64_LDRBBui:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRBBui>;
+    case Opcode::AArch64_LDRDroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRDroW>;
+    case Opcode::AArch64_LDRDroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRDroX>;
+    case Opcode::AArch64_LDRBui:
+    case Opcode::AArch64_LDRBpre:
+    case Opcode::AArch64_LDRDui:
+    case Opcode::AArch64_LDRDpre:
+    case Opcode::AArch64_LDRHui:
+    case Opcode::AArch64_LDRHpre:
+    case Opcode::AArch64_LDRQui:
+    case Opcode::AArch64_LDRQpre:
+    case Opcode::AArch64_LDRSui:
+    case Opcode::AArch64_LDRSpre:
+    case Opcode::AArch64_LDRWui:
+    case Opcode::AArch64_LDRWpre:
+    case Opcode::AArch64_LDRXui:
+    case Opcode::AArch64_LDRXpre:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRXpre>;
+    case Opcode::AArch64_LDRBpost:
+    case Opcode::AArch64_LDRDpost:
+    case Opcode::AArch64_LDRHpost:
+    case Opcode::AArch64_LDRQpost:
+    case Opcode::AArch64_LDRSpost:
+    case Opcode::AArch64_LDRWpost:
+    case Opcode::AArch64_LDRXpost:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRXpost>;
+    case Opcode::AArch64_LDRHHpost:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRHHpost>;
+    case Opcode::AArch64_LDRHHpre:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRHHpre>;
+    case Opcode::AArch64_LDRHHroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRHHroW>;
+    case Opcode::AArch64_LDRHHroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRHHroX>;
+    case Opcode::AArch64_LDRHHui:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRHHui>;
+    case Opcode::AArch64_LDRQroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRQroX>;
+    case Opcode::AArch64_LDRSroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSroW>;
+    case Opcode::AArch64_LDRSroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSroX>;
+    case Opcode::AArch64_LDRSWl:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSWl>;
+    case Opcode::AArch64_LDRWroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRWroW>;
+    case Opcode::AArch64_LDRWroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRWroX>;
+    case Opcode::AArch64_LDRXl:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRXl>;
+    case Opcode::AArch64_LDRXroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRXroW>;
+    case Opcode::AArch64_LDRXroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRXroX>;
+    case Opcode::AArch64_LDR_PXI:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDR_PXI>;
+    case Opcode::AArch64_LDR_ZXI:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDR_ZXI>;
+    case Opcode::AArch64_LDNPSi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDNPSi>;
+    case Opcode::AArch64_LDPDi:
+    case Opcode::AArch64_LDPDpre:
+    case Opcode::AArch64_LDPQi:
+    case Opcode::AArch64_LDPQpre:
+    case Opcode::AArch64_LDPSi:
+    case Opcode::AArch64_LDPSpre:
+    case Opcode::AArch64_LDPWi:
+    case Opcode::AArch64_LDPWpre:
+    case Opcode::AArch64_LDPXi:
+    case Opcode::AArch64_LDPXpre:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDPXpre>;
+    case Opcode::AArch64_LDPDpost:
+    case Opcode::AArch64_LDPQpost:
+    case Opcode::AArch64_LDPSpost:
+    case Opcode::AArch64_LDPWpost:
+    case Opcode::AArch64_LDPXpost:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDPXpost>;
+    case Opcode::AArch64_LDPSWi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDPSWi>;
+    case Opcode::AArch64_LDRSBWroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSBWroX>;
+    case Opcode::AArch64_LDRSBWui:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSBWui>;
+    case Opcode::AArch64_LDRSBXui:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSBXui>;
+    case Opcode::AArch64_LDRSHWroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHWroW>;
+    case Opcode::AArch64_LDRSHWroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHWroX>;
+    case Opcode::AArch64_LDRSHWui:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHWui>;
+    case Opcode::AArch64_LDRSHXroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHXroW>;
+    case Opcode::AArch64_LDRSHXroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHXroX>;
+    case Opcode::AArch64_LDRSHXui:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSHXui>;
+    case Opcode::AArch64_LDRSWpost:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSWpost>;
+    case Opcode::AArch64_LDRSWroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSWroX>;
+    case Opcode::AArch64_LDRSWui:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDRSWui>;
+    case Opcode::AArch64_LDURBBi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURBBi>;
+    case Opcode::AArch64_LDURDi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURDi>;
+    case Opcode::AArch64_LDURHHi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURHHi>;
+    case Opcode::AArch64_LDURQi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURQi>;
+    case Opcode::AArch64_LDURSWi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURSWi>;
+    case Opcode::AArch64_LDURSi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURSi>;
+    case Opcode::AArch64_LDURWi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURWi>;
+    case Opcode::AArch64_LDURXi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDURXi>;
+    case Opcode::AArch64_LDXRW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDXRW>;
+    case Opcode::AArch64_LDXRX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_LDXRX>;
+    case Opcode::AArch64_PRFMui:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_PRFMui>;
+    case Opcode::AArch64_ST1B:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1B>;
+    case Opcode::AArch64_SST1B_D_REAL:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_SST1B_D_REAL>;
+    case Opcode::AArch64_SST1D_REAL:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_SST1D_REAL>;
+    case Opcode::AArch64_SST1D_SCALED_SCALED_REAL:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_SST1D_SCALED_SCALED_REAL>;
+    case Opcode::AArch64_ST1D:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1D>;
+    case Opcode::AArch64_ST1D_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1D_IMM>;
+    case Opcode::AArch64_ST2D_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST2D_IMM>;
+    case Opcode::AArch64_ST1W:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1W>;
+    case Opcode::AArch64_ST1W_D:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1W_D>;
+    case Opcode::AArch64_ST1W_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1W_IMM>;
+    case Opcode::AArch64_SST1W_D_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_SST1W_D_IMM>;
+    case Opcode::AArch64_SST1W_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_SST1W_IMM>;
+    case Opcode::AArch64_GLD1D_REAL:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_GLD1D_REAL>;
+    case Opcode::AArch64_GLD1D_SCALED_REAL:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_GLD1D_SCALED_REAL>;
+    case Opcode::AArch64_GLD1D_IMM_REAL:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_GLD1D_IMM_REAL>;
+    case Opcode::AArch64_GLD1SW_D_IMM_REAL:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_GLD1SW_D_IMM_REAL>;
+    case Opcode::AArch64_SST1D_IMM:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_SST1D_IMM>;
+    case Opcode::AArch64_ST1Twov16b:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1Twov16b>;
+    case Opcode::AArch64_ST1i8_POST:
+    case Opcode::AArch64_ST1i8:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1i8>;
+    case Opcode::AArch64_ST1i16_POST:
+    case Opcode::AArch64_ST1i16:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1i16>;
+    case Opcode::AArch64_ST1i32_POST:
+    case Opcode::AArch64_ST1i32:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1i32>;
+    case Opcode::AArch64_ST1i64_POST:
+    case Opcode::AArch64_ST1i64:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_ST1i64>;
+    case Opcode::AArch64_ST2Twov4s_POST:
+      return &Instruction::generateOpcodeAddresses<
+          Opcode::AArch64_ST2Twov4s_POST>;
+    case Opcode::AArch64_STLRB:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STLRB>;
+    case Opcode::AArch64_STLRW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STLRW>;
+    case Opcode::AArch64_STLRX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STLRX>;
+    case Opcode::AArch64_STLXRW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STLXRW>;
+    case Opcode::AArch64_STLXRX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STLXRX>;
+    case Opcode::AArch64_STPDi:
+    case Opcode::AArch64_STPDpre:
+    case Opcode::AArch64_STPQi:
+    case Opcode::AArch64_STPQpre:
+    case Opcode::AArch64_STPSi:
+    case Opcode::AArch64_STPSpre:
+    case Opcode::AArch64_STPWi:
+    case Opcode::AArch64_STPWpre:
+    case Opcode::AArch64_STPXi:
+    case Opcode::AArch64_STPXpre:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STPXpre>;
+    case Opcode::AArch64_STPDpost:
+    case Opcode::AArch64_STPQpost:
+    case Opcode::AArch64_STPSpost:
+    case Opcode::AArch64_STPWpost:
+    case Opcode::AArch64_STPXpost:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STPXpost>;
+    case Opcode::AArch64_STRBBpost:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRBBpost>;
+    case Opcode::AArch64_STRBBpre:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRBBpre>;
+    case Opcode::AArch64_STRBBroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRBBroW>;
+    case Opcode::AArch64_STRBBroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRBBroX>;
+    case Opcode::AArch64_STRBBui:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRBBui>;
+    case Opcode::AArch64_STRDroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRDroW>;
+    case Opcode::AArch64_STRDroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRDroX>;
+    case Opcode::AArch64_STRBui:
+    case Opcode::AArch64_STRBpre:
+    case Opcode::AArch64_STRDui:
+    case Opcode::AArch64_STRDpre:
+    case Opcode::AArch64_STRHui:
+    case Opcode::AArch64_STRHpre:
+    case Opcode::AArch64_STRQui:
+    case Opcode::AArch64_STRQpre:
+    case Opcode::AArch64_STRSui:
+    case Opcode::AArch64_STRSpre:
+    case Opcode::AArch64_STRWui:
+    case Opcode::AArch64_STRWpre:
+    case Opcode::AArch64_STRXui:
+    case Opcode::AArch64_STRXpre:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRXpre>;
+    case Opcode::AArch64_STRBpost:
+    case Opcode::AArch64_STRDpost:
+    case Opcode::AArch64_STRHpost:
+    case Opcode::AArch64_STRQpost:
+    case Opcode::AArch64_STRSpost:
+    case Opcode::AArch64_STRWpost:
+    case Opcode::AArch64_STRXpost:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRXpost>;
+    case Opcode::AArch64_STRHHpost:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRHHpost>;
+    case Opcode::AArch64_STRHHpre:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRHHpre>;
+    case Opcode::AArch64_STRHHroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRHHroW>;
+    case Opcode::AArch64_STRHHroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRHHroX>;
+    case Opcode::AArch64_STRHHui:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRHHui>;
+    case Opcode::AArch64_STRQroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRQroX>;
+    case Opcode::AArch64_STRSroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRSroW>;
+    case Opcode::AArch64_STRSroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRSroX>;
+    case Opcode::AArch64_STRWroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRWroW>;
+    case Opcode::AArch64_STRWroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRWroX>;
+    case Opcode::AArch64_STRXroW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRXroW>;
+    case Opcode::AArch64_STRXroX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STRXroX>;
+    case Opcode::AArch64_STR_PXI:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STR_PXI>;
+    case Opcode::AArch64_STR_ZXI:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STR_ZXI>;
+    case Opcode::AArch64_STURBBi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STURBBi>;
+    case Opcode::AArch64_STURDi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STURDi>;
+    case Opcode::AArch64_STURHHi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STURHHi>;
+    case Opcode::AArch64_STURQi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STURQi>;
+    case Opcode::AArch64_STURSi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STURSi>;
+    case Opcode::AArch64_STURWi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STURWi>;
+    case Opcode::AArch64_STURXi:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STURXi>;
+    case Opcode::AArch64_STXRW:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STXRW>;
+    case Opcode::AArch64_STXRX:
+      return &Instruction::generateOpcodeAddresses<Opcode::AArch64_STXRX>;
+    default:
+      return &Instruction::executionNYI;
   }
-  return getGeneratedAddresses();
 }
 
 }  // namespace aarch64
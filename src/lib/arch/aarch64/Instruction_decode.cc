@@ -511,6 +511,74 @@ void Instruction::decode() {
       !(isScalarData_ || isVectorData_)) {
     isScalarData_ = true;
   }
+
+  // Identify register moves and zero idioms, which may be eliminated at rename.
+  // Only forms whose result fully overwrites the destination register are
+  // considered; e.g. `mov wd, wn` zeroes the upper 32 bits of xd, and so is not
+  // an exact copy of its source
+  if (destinationRegisterCount == 1 && !exceptionEncountered_) {
+    const auto& ops = metadata.operands;
+    switch (metadata.opcode) {
+      case Opcode::AArch64_ADDXri:  // mov <xd|sp>, <xn|sp>
+        if (ops[2].imm == 0) {
+          isRegisterMove_ = true;
+          moveSourceIndex_ = 0;
+        }
+        break;
+      case Opcode::AArch64_ORRWrs:  // mov wd, wzr
+        if (ops[1].reg == ARM64_REG_WZR && ops[2].reg == ARM64_REG_WZR) {
+          isZeroIdiom_ = true;
+        }
+        break;
+      case Opcode::AArch64_ORRXrs:  // mov xd, xn
+        if (ops[1].reg == ARM64_REG_XZR && isNoShift_) {
+          if (ops[2].reg == ARM64_REG_XZR) {
+            isZeroIdiom_ = true;
+          } else {
+            isRegisterMove_ = true;
+            moveSourceIndex_ = 1;
+          }
+        }
+        break;
+      case Opcode::AArch64_ORR_ZZZ:  // mov zd.d, zn.d
+        if (ops[1].reg == ops[2].reg) {
+          isRegisterMove_ = true;
+          moveSourceIndex_ = 0;
+        }
+        break;
+      case Opcode::AArch64_EORWrs:  // eor wd, wn, wn
+        [[fallthrough]];
+      case Opcode::AArch64_EORXrs:  // eor xd, xn, xn
+        [[fallthrough]];
+      case Opcode::AArch64_SUBWrs:  // sub wd, wn, wn
+        [[fallthrough]];
+      case Opcode::AArch64_SUBXrs:  // sub xd, xn, xn
+        if (ops[1].reg == ops[2].reg && isNoShift_) isZeroIdiom_ = true;
+        break;
+      case Opcode::AArch64_EORv16i8:  // eor vd.16b, vn.16b, vn.16b
+        if (ops[1].reg == ops[2].reg) isZeroIdiom_ = true;
+        break;
+      case Opcode::AArch64_DUP_ZI_B:  // mov zd.b, #0
+        [[fallthrough]];
+      case Opcode::AArch64_DUP_ZI_D:  // mov zd.d, #0
+        [[fallthrough]];
+      case Opcode::AArch64_DUP_ZI_H:  // mov zd.h, #0
+        [[fallthrough]];
+      case Opcode::AArch64_DUP_ZI_S:  // mov zd.s, #0
+        [[fallthrough]];
+      case Opcode::AArch64_MOVID:  // movi dd, #0
+        [[fallthrough]];
+      case Opcode::AArch64_MOVIv2d_ns:  // movi vd.2d, #0
+        [[fallthrough]];
+      case Opcode::AArch64_MOVZWi:  // mov wd, #0
+        [[fallthrough]];
+      case Opcode::AArch64_MOVZXi:  // mov xd, #0
+        if (ops[1].imm == 0) isZeroIdiom_ = true;
+        break;
+      default:
+        break;
+    }
+  }
 }
 
 void Instruction::nyi() {
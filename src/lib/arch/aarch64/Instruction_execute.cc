@@ -37,4998 +37,8713 @@ void Instruction::execute() {
   assert(
       canExecute() &&
       "Attempted to execute an instruction before all operands were provided");
-  const uint16_t VL_bits = architecture_.getVectorLength();
   executed_ = true;
-  if (isMicroOp_) {
-    switch (microOpcode_) {
-      case MicroOpcode::LDR_ADDR: {
-        uint16_t regSize =
-            (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
-        for (size_t dest = 0; dest < getDestinationRegisters().size(); dest++) {
-          results[dest] = memoryData[dest].zeroExtend(dataSize_, regSize);
-        }
-        break;
-      }
-      case MicroOpcode::OFFSET_IMM: {
-        results[0] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case MicroOpcode::STR_DATA: {
-        setMemoryAddresses({{0, 0}});
-        memoryData[0] = operands[0];
-        break;
-      }
-      default:
-        return executionNYI();
+  (this->*executeHandler_)();
+
+#ifndef NDEBUG
+  // Instructions raising an exception may not have produced their results
+  if (exceptionEncountered_) return;
+
+  // Check if upper bits of vector registers are zeroed because Z
+  // configuration extend to 256 bytes whilst V configurations only extend
+  // to 16 bytes. Thus upper 240 bytes must be ignored by being set to 0.
+  for (int i = 0; i < destinationRegisterCount; i++) {
+    if ((destinationRegisters[i].type == RegisterType::VECTOR) && !isSVEData_) {
+      if (results[i].size() != 256)
+        std::cerr << "[SimEng:Instruction_execute] " << metadata.mnemonic
+                  << " opcode: " << metadata.opcode
+                  << " has not been zero extended correctly\n";
     }
+  }
+#endif
+}
+
+void Instruction::executeMicroOp() {
+  switch (microOpcode_) {
+    case MicroOpcode::LDR_ADDR: {
+      uint16_t regSize =
+          (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
+      for (size_t dest = 0; dest < getDestinationRegisters().size(); dest++) {
+        results[dest] = memoryData[dest].zeroExtend(dataSize_, regSize);
+      }
+      break;
+    }
+    case MicroOpcode::OFFSET_IMM: {
+      results[0] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+      break;
+    }
+    case MicroOpcode::STR_DATA: {
+      setMemoryAddresses({{0, 0}});
+      memoryData[0] = operands[0];
+      break;
+    }
+    default:
+      return executionNYI();
+  }
+}
+
+// adc xd, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADCXr>() {
+  auto [result, nzcv] = arithmeticHelp::addCarry_3ops<uint64_t>(operands);
+  results[0] = result;
+}
+
+// addpl xd, xn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDPL_XXI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto x = operands[0].get<uint64_t>();
+  auto y = static_cast<int64_t>(metadata.operands[2].imm);
+  // convert PL from VL_bits
+  const uint64_t PL = VL_bits / 64;
+  results[0] = x + (PL * y);
+}
+
+// addp vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDPv16i8>() {
+  results[0] = neonHelp::vecAddp_3ops<uint8_t, 16>(operands);
+}
+
+// addp vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDPv2i64>() {
+  results[0] = neonHelp::vecAddp_3ops<uint64_t, 2>(operands);
+}
+
+// addp dd, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDPv2i64p>() {
+  results[0] = neonHelp::vecSumElems_2ops<uint64_t, 2>(operands);
+}
+
+// addp vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDPv4i32>() {
+  results[0] = neonHelp::vecAddp_3ops<uint32_t, 4>(operands);
+}
+
+// addp vd.8h, vn.8h, vm.8h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDPv8i16>() {
+  results[0] = neonHelp::vecAddp_3ops<uint16_t, 8>(operands);
+}
+
+// adds wd, wn, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDSWri>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addShift_imm<uint32_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = {result, 8};
+}
+
+// adds wd, wn, wm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDSWrs>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addShift_3ops<uint32_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = {result, 8};
+}
+
+// adds wd, wn, wm{, extend {#amount}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDSWrx>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addExtend_3ops<uint32_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = {result, 8};
+}
+
+// adds xd, xn, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDSXri>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addShift_imm<uint64_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = result;
+}
+
+// adds xd, xn, xm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDSXrs>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addShift_3ops<uint64_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = result;
+}
+
+// adds xd, xn, wm{, extend {#amount}}
+// adds xd, xn, xm{, extend {#amount}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDSXrx64>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addExtend_3ops<uint64_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = RegisterValue(result, 8);
+}
+
+// addvl xd, xn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDVL_XXI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto x = operands[0].get<uint64_t>();
+  auto y = static_cast<int64_t>(metadata.operands[2].imm);
+  // convert VL from LEN (number of 128-bits) to bytes
+  const uint64_t VL = VL_bits / 8;
+  results[0] = x + (VL * y);
+}
+
+// addv bd, vn.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDVv8i8v>() {
+  results[0] = neonHelp::vecSumElems_2ops<uint8_t, 8>(operands);
+}
+
+// add wd, wn, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDWri>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addShift_imm<uint32_t>(operands, metadata, false);
+  results[0] = {result, 8};
+}
+
+// add wd, wn, wm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDWrs>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addShift_3ops<uint32_t>(operands, metadata, false);
+  results[0] = {result, 8};
+}
+
+// add wd, wn, wm{, extend #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDWrx>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addExtend_3ops<uint32_t>(operands, metadata, false);
+  results[0] = {result, 8};
+}
+
+// add xd, xn, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDXri>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addShift_imm<uint64_t>(operands, metadata, false);
+  results[0] = result;
+}
+
+// add xd, xn, xm, {shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDXrs>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addShift_3ops<uint64_t>(operands, metadata, false);
+  results[0] = result;
+}
+
+// add xd, xn, wm{, extend {#amount}}
+// add xd, xn, xm{, extend {#amount}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDXrx64>() {
+  auto [result, nzcv] =
+      arithmeticHelp::addExtend_3ops<uint64_t>(operands, metadata, false);
+  results[0] = result;
+}
+
+// add zdn.b, pg/m, zdn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADD_ZPmZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAddPredicated_vecs<uint8_t>(operands, VL_bits);
+}
+
+// add zdn.d, pg/m, zdn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADD_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveAddPredicated_vecs<uint64_t>(operands, VL_bits);
+}
+
+// add zdn.h, pg/m, zdn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADD_ZPmZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveAddPredicated_vecs<uint16_t>(operands, VL_bits);
+}
+
+// add zdn.s, pg/m, zdn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADD_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveAddPredicated_vecs<uint32_t>(operands, VL_bits);
+}
+
+// add zd.b, zn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADD_ZZZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAdd_3ops<uint8_t>(operands, VL_bits);
+}
+
+// add zd.d, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADD_ZZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAdd_3ops<uint64_t>(operands, VL_bits);
+}
+
+// add zd.h, zn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADD_ZZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAdd_3ops<uint16_t>(operands, VL_bits);
+}
+
+// add zd.s, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADD_ZZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAdd_3ops<uint32_t>(operands, VL_bits);
+}
+
+// add vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDv16i8>() {
+  results[0] = neonHelp::vecAdd_3ops<uint8_t, 16>(operands);
+}
+
+// add dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDv1i64>() {
+  results[0] = neonHelp::vecAdd_3ops<uint64_t, 1>(operands);
+}
+
+// add vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDv2i32>() {
+  results[0] = neonHelp::vecAdd_3ops<uint32_t, 2>(operands);
+}
+
+// add vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDv2i64>() {
+  results[0] = neonHelp::vecAdd_3ops<uint64_t, 2>(operands);
+}
+
+// add vd.4h, vn.4h, vm.4h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDv4i16>() {
+  results[0] = neonHelp::vecAdd_3ops<uint16_t, 4>(operands);
+}
+
+// add vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDv4i32>() {
+  results[0] = neonHelp::vecAdd_3ops<uint32_t, 4>(operands);
+}
+
+// add vd.8h, vn.8h, vm.8h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDv8i16>() {
+  results[0] = neonHelp::vecAdd_3ops<uint16_t, 8>(operands);
+}
+
+// add vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADDv8i8>() {
+  results[0] = neonHelp::vecAdd_3ops<uint8_t, 8>(operands);
+}
+
+// adr xd, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADR>() {
+  results[0] = instructionAddress_ + metadata.operands[1].imm;
+}
+
+// adrp xd, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADRP>() {
+  // Clear lowest 12 bits of address and add immediate (already shifted by
+  // decoder)
+  results[0] =
+      (instructionAddress_ & ~(0xFFF)) + metadata.operands[1].imm;
+}
+
+// adr zd.d, [zn.d, zm.d]
+// adr zd.d, [zn.d, zm.d, lsl #1]
+// adr zd.d, [zn.d, zm.d, lsl #2]
+// adr zd.d, [zn.d, zm.d, lsl #3]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADR_LSL_ZZZ_D_3>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAdr_packedOffsets<uint64_t>(operands, metadata,
+                                                       VL_bits);
+}
+
+// adr zd.s, [zn.s, zm.s]
+// adr zd.s, [zn.s, zm.s, lsl #1]
+// adr zd.s, [zn.s, zm.s, lsl #2]
+// adr zd.s, [zn.s, zm.s, lsl #3]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ADR_LSL_ZZZ_S_3>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAdr_packedOffsets<uint32_t>(operands, metadata,
+                                                       VL_bits);
+}
+
+// ands wd, wn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ANDSWri>() {
+  auto [result, nzcv] = logicalHelp::logicOp_imm<uint32_t>(
+      operands, metadata, true,
+      [](uint32_t x, uint32_t y) -> uint32_t { return x & y; });
+  results[0] = nzcv;
+  results[1] = {result, 8};
+}
+
+// ands wd, wn, wm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ANDSWrs>() {
+  auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint32_t>(
+      operands, metadata, true,
+      [](uint32_t x, uint32_t y) -> uint32_t { return x & y; });
+  results[0] = nzcv;
+  results[1] = {result, 8};
+}
+
+// ands xd, xn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ANDSXri>() {
+  auto [result, nzcv] = logicalHelp::logicOp_imm<uint64_t>(
+      operands, metadata, true,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
+  results[0] = nzcv;
+  results[1] = result;
+}
+
+// ands xd, xn, xm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ANDSXrs>() {
+  auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint64_t>(
+      operands, metadata, true,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
+  results[0] = nzcv;
+  results[1] = result;
+}
+
+// and wd, wn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ANDWri>() {
+  auto [result, nzcv] = logicalHelp::logicOp_imm<uint32_t>(
+      operands, metadata, false,
+      [](uint32_t x, uint32_t y) -> uint32_t { return x & y; });
+  results[0] = {result, 8};
+}
+
+// and wd, wn, wm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ANDWrs>() {
+  auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint32_t>(
+      operands, metadata, false,
+      [](uint32_t x, uint32_t y) -> uint32_t { return x & y; });
+  results[0] = {result, 8};
+}
+
+// and xd, xn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ANDXri>() {
+  auto [result, nzcv] = logicalHelp::logicOp_imm<uint64_t>(
+      operands, metadata, false,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
+  results[0] = result;
+}
+
+// and xd, xn, xm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ANDXrs>() {
+  auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint64_t>(
+      operands, metadata, false,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
+  results[0] = result;
+}
+
+// and pd.b, pg/z, pn.b, pm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_AND_PPzPP>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOp_preds<uint8_t>(
+      operands, VL_bits,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
+}
+
+// and zdn, zdn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_AND_ZI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* dn = operands[0].getAsVector<uint64_t>();
+  const uint64_t imm = static_cast<uint64_t>(metadata.operands[2].imm);
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint64_t out[32] = {0};
+  for (int i = 0; i < partition_num; i++) {
+    out[i] = dn[i] & imm;
+  }
+  results[0] = {out, 256};
+}
+
+// and zdn.b, pg/m, zdn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_AND_ZPmZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint8_t>(
+      operands, VL_bits,
+      [](uint8_t x, uint8_t y) -> uint8_t { return x & y; });
+}
+
+// and zdn.d, pg/m, zdn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_AND_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint64_t>(
+      operands, VL_bits,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
+}
+
+// and zdn.h, pg/m, zdn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_AND_ZPmZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint16_t>(
+      operands, VL_bits,
+      [](uint16_t x, uint16_t y) -> uint16_t { return x & y; });
+}
+
+// and zdn.s, pg/m, zdn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_AND_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint32_t>(
+      operands, VL_bits,
+      [](uint32_t x, uint32_t y) -> uint32_t { return x & y; });
+}
+
+// and vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ANDv16i8>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 16>(
+      operands, [](uint8_t x, uint8_t y) -> uint8_t { return x & y; });
+}
+
+// and vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ANDv8i8>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 8>(
+      operands, [](uint8_t x, uint8_t y) -> uint8_t { return x & y; });
+}
+
+// asrv wd, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ASRVWr>() {
+  results[0] = {logicalHelp::asrv_3gpr<int32_t>(operands), 8};
+}
+
+// asrv xd, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ASRVXr>() {
+  results[0] = logicalHelp::asrv_3gpr<int64_t>(operands);
+}
+
+// b label
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_B>() {
+  branchTaken_ = true;
+  branchAddress_ = instructionAddress_ + metadata.operands[0].imm;
+}
+
+// bfm wd, wn, #immr, #imms
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BFMWri>() {
+  results[0] = {
+      bitmanipHelp::bfm_2imms<uint32_t>(operands, metadata, false, false),
+      8};
+}
+
+// bfm xd, xn, #immr, #imms
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BFMXri>() {
+  results[0] =
+      bitmanipHelp::bfm_2imms<uint64_t>(operands, metadata, false, false);
+}
+
+// bics wd, wn, wm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BICSWrs>() {
+  auto [result, nzcv] =
+      logicalHelp::bicShift_3ops<uint32_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = {result, 8};
+}
+
+// bics xd, xn, xm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BICSXrs>() {
+  auto [result, nzcv] =
+      logicalHelp::bicShift_3ops<uint64_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = result;
+}
+
+// bic wd, wn, wm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BICWrs>() {
+  auto [result, nzcv] =
+      logicalHelp::bicShift_3ops<uint32_t>(operands, metadata, false);
+  results[0] = {result, 8};
+}
+
+// bic xd, xn, xm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BICXrs>() {
+  auto [result, nzcv] =
+      logicalHelp::bicShift_3ops<uint64_t>(operands, metadata, false);
+  results[0] = result;
+}
+
+// bic vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BICv16i8>() {
+  results[0] = neonHelp::vecBic_3ops<uint8_t, 16>(operands);
+}
+
+// bic vd.4s, #imm{, lsl #shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BICv4i32>() {
+  results[0] = neonHelp::vecBicShift_imm<uint32_t, 4>(operands, metadata);
+}
+
+// bic vd.8h, #imm{, lsl #shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BICv8i16>() {
+  results[0] = neonHelp::vecBicShift_imm<uint16_t, 8>(operands, metadata);
+}
+
+// bic vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BICv8i8>() {
+  results[0] = neonHelp::vecBic_3ops<uint8_t, 8>(operands);
+}
+
+// bif vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BIFv16i8>() {
+  results[0] = neonHelp::vecBitwiseInsert<16>(operands, true);
+}
+
+// bit vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BITv16i8>() {
+  results[0] = neonHelp::vecBitwiseInsert<16>(operands, false);
+}
+
+// bit vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BITv8i8>() {
+  results[0] = neonHelp::vecBitwiseInsert<8>(operands, false);
+}
+
+// bl #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BL>() {
+  branchTaken_ = true;
+  branchAddress_ = instructionAddress_ + metadata.operands[0].imm;
+  results[0] = static_cast<uint64_t>(instructionAddress_ + 4);
+}
+
+// blr xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BLR>() {
+  branchTaken_ = true;
+  branchAddress_ = operands[0].get<uint64_t>();
+  results[0] = static_cast<uint64_t>(instructionAddress_ + 4);
+}
+
+// br xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BR>() {
+  branchTaken_ = true;
+  branchAddress_ = operands[0].get<uint64_t>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BRK>() {
+  // TODO: Generate breakpoint exception
+}
+
+// bsl vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_BSLv16i8>() {
+  results[0] = neonHelp::vecBsl<16>(operands);
+}
+
+// b.cond label
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_Bcc>() {
+  if (AuxFunc::conditionHolds(metadata.cc, operands[0].get<uint8_t>())) {
+    branchTaken_ = true;
+    branchAddress_ = instructionAddress_ + metadata.operands[0].imm;
   } else {
-    switch (metadata.opcode) {
-      case Opcode::AArch64_ADCXr: {  // adc xd, xn, xm
-        auto [result, nzcv] = arithmeticHelp::addCarry_3ops<uint64_t>(operands);
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_ADDPL_XXI: {  // addpl xd, xn, #imm
-        auto x = operands[0].get<uint64_t>();
-        auto y = static_cast<int64_t>(metadata.operands[2].imm);
-        // convert PL from VL_bits
-        const uint64_t PL = VL_bits / 64;
-        results[0] = x + (PL * y);
-        break;
-      }
-      case Opcode::AArch64_ADDPv16i8: {  // addp vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecAddp_3ops<uint8_t, 16>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDPv2i64: {  // addp vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecAddp_3ops<uint64_t, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDPv2i64p: {  // addp dd, vn.2d
-        results[0] = neonHelp::vecSumElems_2ops<uint64_t, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDPv4i32: {  // addp vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecAddp_3ops<uint32_t, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDPv8i16: {  // addp vd.8h, vn.8h, vm.8h
-        results[0] = neonHelp::vecAddp_3ops<uint16_t, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDSWri: {  // adds wd, wn, #imm{, shift}
-        auto [result, nzcv] =
-            arithmeticHelp::addShift_imm<uint32_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ADDSWrs: {  // adds wd, wn, wm{, shift}
-        auto [result, nzcv] =
-            arithmeticHelp::addShift_3ops<uint32_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ADDSWrx: {  // adds wd, wn, wm{, extend {#amount}}
-        auto [result, nzcv] =
-            arithmeticHelp::addExtend_3ops<uint32_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ADDSXri: {  // adds xd, xn, #imm{, shift}
-        auto [result, nzcv] =
-            arithmeticHelp::addShift_imm<uint64_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = result;
-        break;
-      }
-      case Opcode::AArch64_ADDSXrs: {  // adds xd, xn, xm{, shift}
-        auto [result, nzcv] =
-            arithmeticHelp::addShift_3ops<uint64_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = result;
-        break;
-      }
-      case Opcode::AArch64_ADDSXrx:      // adds xd, xn, wm{, extend {#amount}}
-      case Opcode::AArch64_ADDSXrx64: {  // adds xd, xn, xm{, extend {#amount}}
-        auto [result, nzcv] =
-            arithmeticHelp::addExtend_3ops<uint64_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = RegisterValue(result, 8);
-        break;
-      }
-      case Opcode::AArch64_ADDVL_XXI: {  // addvl xd, xn, #imm
-        auto x = operands[0].get<uint64_t>();
-        auto y = static_cast<int64_t>(metadata.operands[2].imm);
-        // convert VL from LEN (number of 128-bits) to bytes
-        const uint64_t VL = VL_bits / 8;
-        results[0] = x + (VL * y);
-        break;
-      }
-      case Opcode::AArch64_ADDVv8i8v: {  // addv bd, vn.8b
-        results[0] = neonHelp::vecSumElems_2ops<uint8_t, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDWri: {  // add wd, wn, #imm{, shift}
-        auto [result, nzcv] =
-            arithmeticHelp::addShift_imm<uint32_t>(operands, metadata, false);
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ADDWrs: {  // add wd, wn, wm{, shift #amount}
-        auto [result, nzcv] =
-            arithmeticHelp::addShift_3ops<uint32_t>(operands, metadata, false);
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ADDWrx: {  // add wd, wn, wm{, extend #amount}
-        auto [result, nzcv] =
-            arithmeticHelp::addExtend_3ops<uint32_t>(operands, metadata, false);
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ADDXri: {  // add xd, xn, #imm{, shift}
-        auto [result, nzcv] =
-            arithmeticHelp::addShift_imm<uint64_t>(operands, metadata, false);
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_ADDXrs: {  // add xd, xn, xm, {shift #amount}
-        auto [result, nzcv] =
-            arithmeticHelp::addShift_3ops<uint64_t>(operands, metadata, false);
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_ADDXrx:      // add xd, xn, wm{, extend {#amount}}
-      case Opcode::AArch64_ADDXrx64: {  // add xd, xn, xm{, extend {#amount}}
-        auto [result, nzcv] =
-            arithmeticHelp::addExtend_3ops<uint64_t>(operands, metadata, false);
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_ADD_ZPmZ_B: {  // add zdn.b, pg/m, zdn.b, zm.b
-        results[0] = sveHelp::sveAddPredicated_vecs<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ADD_ZPmZ_D: {  // add zdn.d, pg/m, zdn.d, zm.d
-        results[0] =
-            sveHelp::sveAddPredicated_vecs<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ADD_ZPmZ_H: {  // add zdn.h, pg/m, zdn.h, zm.h
-        results[0] =
-            sveHelp::sveAddPredicated_vecs<uint16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ADD_ZPmZ_S: {  // add zdn.s, pg/m, zdn.s, zm.s
-        results[0] =
-            sveHelp::sveAddPredicated_vecs<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ADD_ZZZ_B: {  // add zd.b, zn.b, zm.b
-        results[0] = sveHelp::sveAdd_3ops<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ADD_ZZZ_D: {  // add zd.d, zn.d, zm.d
-        results[0] = sveHelp::sveAdd_3ops<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ADD_ZZZ_H: {  // add zd.h, zn.h, zm.h
-        results[0] = sveHelp::sveAdd_3ops<uint16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ADD_ZZZ_S: {  // add zd.s, zn.s, zm.s
-        results[0] = sveHelp::sveAdd_3ops<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ADDv16i8: {  // add vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecAdd_3ops<uint8_t, 16>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDv1i64: {  // add dd, dn, dm
-        results[0] = neonHelp::vecAdd_3ops<uint64_t, 1>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDv2i32: {  // add vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecAdd_3ops<uint32_t, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDv2i64: {  // add vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecAdd_3ops<uint64_t, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDv4i16: {  // add vd.4h, vn.4h, vm.4h
-        results[0] = neonHelp::vecAdd_3ops<uint16_t, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDv4i32: {  // add vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecAdd_3ops<uint32_t, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDv8i16: {  // add vd.8h, vn.8h, vm.8h
-        results[0] = neonHelp::vecAdd_3ops<uint16_t, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADDv8i8: {  // add vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecAdd_3ops<uint8_t, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_ADR: {  // adr xd, #imm
-        results[0] = instructionAddress_ + metadata.operands[1].imm;
-        break;
-      }
-      case Opcode::AArch64_ADRP: {  // adrp xd, #imm
-        // Clear lowest 12 bits of address and add immediate (already shifted by
-        // decoder)
-        results[0] =
-            (instructionAddress_ & ~(0xFFF)) + metadata.operands[1].imm;
-        break;
-      }
-      case Opcode::AArch64_ADR_LSL_ZZZ_D_0:    // adr zd.d, [zn.d, zm.d]
-      case Opcode::AArch64_ADR_LSL_ZZZ_D_1:    // adr zd.d, [zn.d, zm.d, lsl #1]
-      case Opcode::AArch64_ADR_LSL_ZZZ_D_2:    // adr zd.d, [zn.d, zm.d, lsl #2]
-      case Opcode::AArch64_ADR_LSL_ZZZ_D_3: {  // adr zd.d, [zn.d, zm.d, lsl #3]
-        results[0] = sveHelp::sveAdr_packedOffsets<uint64_t>(operands, metadata,
-                                                             VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ADR_LSL_ZZZ_S_0:    // adr zd.s, [zn.s, zm.s]
-      case Opcode::AArch64_ADR_LSL_ZZZ_S_1:    // adr zd.s, [zn.s, zm.s, lsl #1]
-      case Opcode::AArch64_ADR_LSL_ZZZ_S_2:    // adr zd.s, [zn.s, zm.s, lsl #2]
-      case Opcode::AArch64_ADR_LSL_ZZZ_S_3: {  // adr zd.s, [zn.s, zm.s, lsl #3]
-        results[0] = sveHelp::sveAdr_packedOffsets<uint32_t>(operands, metadata,
-                                                             VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ANDSWri: {  // ands wd, wn, #imm
-        auto [result, nzcv] = logicalHelp::logicOp_imm<uint32_t>(
-            operands, metadata, true,
-            [](uint32_t x, uint32_t y) -> uint32_t { return x & y; });
-        results[0] = nzcv;
-        results[1] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ANDSWrs: {  // ands wd, wn, wm{, shift #amount}
-        auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint32_t>(
-            operands, metadata, true,
-            [](uint32_t x, uint32_t y) -> uint32_t { return x & y; });
-        results[0] = nzcv;
-        results[1] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ANDSXri: {  // ands xd, xn, #imm
-        auto [result, nzcv] = logicalHelp::logicOp_imm<uint64_t>(
-            operands, metadata, true,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
-        results[0] = nzcv;
-        results[1] = result;
-        break;
-      }
-      case Opcode::AArch64_ANDSXrs: {  // ands xd, xn, xm{, shift #amount}
-        auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint64_t>(
-            operands, metadata, true,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
-        results[0] = nzcv;
-        results[1] = result;
-        break;
-      }
-      case Opcode::AArch64_ANDWri: {  // and wd, wn, #imm
-        auto [result, nzcv] = logicalHelp::logicOp_imm<uint32_t>(
-            operands, metadata, false,
-            [](uint32_t x, uint32_t y) -> uint32_t { return x & y; });
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ANDWrs: {  // and wd, wn, wm{, shift #amount}
-        auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint32_t>(
-            operands, metadata, false,
-            [](uint32_t x, uint32_t y) -> uint32_t { return x & y; });
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ANDXri: {  // and xd, xn, #imm
-        auto [result, nzcv] = logicalHelp::logicOp_imm<uint64_t>(
-            operands, metadata, false,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_ANDXrs: {  // and xd, xn, xm{, shift #amount}
-        auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint64_t>(
-            operands, metadata, false,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_AND_PPzPP: {  // and pd.b, pg/z, pn.b, pm.b
-        results[0] = sveHelp::sveLogicOp_preds<uint8_t>(
-            operands, VL_bits,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
-        break;
-      }
-      case Opcode::AArch64_AND_ZI: {  // and zdn, zdn, #imm
-        const uint64_t* dn = operands[0].getAsVector<uint64_t>();
-        const uint64_t imm = static_cast<uint64_t>(metadata.operands[2].imm);
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint64_t out[32] = {0};
-        for (int i = 0; i < partition_num; i++) {
-          out[i] = dn[i] & imm;
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_AND_ZPmZ_B: {  // and zdn.b, pg/m, zdn.b, zm.b
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint8_t>(
-            operands, VL_bits,
-            [](uint8_t x, uint8_t y) -> uint8_t { return x & y; });
-        break;
-      }
-      case Opcode::AArch64_AND_ZPmZ_D: {  // and zdn.d, pg/m, zdn.d, zm.d
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint64_t>(
-            operands, VL_bits,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x & y; });
-        break;
-      }
-      case Opcode::AArch64_AND_ZPmZ_H: {  // and zdn.h, pg/m, zdn.h, zm.h
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint16_t>(
-            operands, VL_bits,
-            [](uint16_t x, uint16_t y) -> uint16_t { return x & y; });
-        break;
-      }
-      case Opcode::AArch64_AND_ZPmZ_S: {  // and zdn.s, pg/m, zdn.s, zm.s
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint32_t>(
-            operands, VL_bits,
-            [](uint32_t x, uint32_t y) -> uint32_t { return x & y; });
-        break;
-      }
-      case Opcode::AArch64_ANDv16i8: {  // and vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 16>(
-            operands, [](uint8_t x, uint8_t y) -> uint8_t { return x & y; });
-        break;
-      }
-      case Opcode::AArch64_ANDv8i8: {  // and vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 8>(
-            operands, [](uint8_t x, uint8_t y) -> uint8_t { return x & y; });
-        break;
-      }
-      case Opcode::AArch64_ASRVWr: {  // asrv wd, wn, wm
-        results[0] = {logicalHelp::asrv_3gpr<int32_t>(operands), 8};
-        break;
-      }
-      case Opcode::AArch64_ASRVXr: {  // asrv xd, xn, xm
-        results[0] = logicalHelp::asrv_3gpr<int64_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_B: {  // b label
-        branchTaken_ = true;
-        branchAddress_ = instructionAddress_ + metadata.operands[0].imm;
-        break;
-      }
-      case Opcode::AArch64_BFMWri: {  // bfm wd, wn, #immr, #imms
-        results[0] = {
-            bitmanipHelp::bfm_2imms<uint32_t>(operands, metadata, false, false),
-            8};
-        break;
-      }
-      case Opcode::AArch64_BFMXri: {  // bfm xd, xn, #immr, #imms
-        results[0] =
-            bitmanipHelp::bfm_2imms<uint64_t>(operands, metadata, false, false);
-        break;
-      }
-      case Opcode::AArch64_BICSWrs: {  // bics wd, wn, wm{, shift #amount}
-        auto [result, nzcv] =
-            logicalHelp::bicShift_3ops<uint32_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_BICSXrs: {  // bics xd, xn, xm{, shift #amount}
-        auto [result, nzcv] =
-            logicalHelp::bicShift_3ops<uint64_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = result;
-        break;
-      }
-      case Opcode::AArch64_BICWrs: {  // bic wd, wn, wm{, shift #amount}
-        auto [result, nzcv] =
-            logicalHelp::bicShift_3ops<uint32_t>(operands, metadata, false);
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_BICXrs: {  // bic xd, xn, xm{, shift #amount}
-        auto [result, nzcv] =
-            logicalHelp::bicShift_3ops<uint64_t>(operands, metadata, false);
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_BICv16i8: {  // bic vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecBic_3ops<uint8_t, 16>(operands);
-        break;
-      }
-      case Opcode::AArch64_BICv4i32: {  // bic vd.4s, #imm{, lsl #shift}
-        results[0] = neonHelp::vecBicShift_imm<uint32_t, 4>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_BICv8i16: {  // bic vd.8h, #imm{, lsl #shift}
-        results[0] = neonHelp::vecBicShift_imm<uint16_t, 8>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_BICv8i8: {  // bic vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecBic_3ops<uint8_t, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_BIFv16i8: {  // bif vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecBitwiseInsert<16>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_BITv16i8: {  // bit vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecBitwiseInsert<16>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_BITv8i8: {  // bit vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecBitwiseInsert<8>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_BL: {  // bl #imm
-        branchTaken_ = true;
-        branchAddress_ = instructionAddress_ + metadata.operands[0].imm;
-        results[0] = static_cast<uint64_t>(instructionAddress_ + 4);
-        break;
-      }
-      case Opcode::AArch64_BLR: {  // blr xn
-        branchTaken_ = true;
-        branchAddress_ = operands[0].get<uint64_t>();
-        results[0] = static_cast<uint64_t>(instructionAddress_ + 4);
-        break;
-      }
-      case Opcode::AArch64_BR: {  // br xn
-        branchTaken_ = true;
-        branchAddress_ = operands[0].get<uint64_t>();
-        break;
-      }
-      case Opcode::AArch64_BRK: {
-        // TODO: Generate breakpoint exception
-        break;
-      }
-      case Opcode::AArch64_BSLv16i8: {  // bsl vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecBsl<16>(operands);
-        break;
-      }
-      case Opcode::AArch64_Bcc: {  // b.cond label
-        if (AuxFunc::conditionHolds(metadata.cc, operands[0].get<uint8_t>())) {
-          branchTaken_ = true;
-          branchAddress_ = instructionAddress_ + metadata.operands[0].imm;
-        } else {
-          branchTaken_ = false;
-          branchAddress_ = instructionAddress_ + 4;
-        }
-        break;
-      }
-      case Opcode::AArch64_CASALW: {  // casal ws, wt, [xn|sp]
-        // LOAD / STORE
-        const uint32_t s = operands[0].get<uint32_t>();
-        const uint32_t t = operands[1].get<uint32_t>();
-        const uint32_t n = memoryData[0].get<uint32_t>();
-        if (n == s) memoryData[0] = t;
-        break;
-      }
-      case Opcode::AArch64_CASALX: {  // casal xs, xt, [xn|sp]
-        // LOAD / STORE
-        const uint64_t s = operands[0].get<uint64_t>();
-        const uint64_t t = operands[1].get<uint64_t>();
-        const uint64_t n = memoryData[0].get<uint64_t>();
-        if (n == s) memoryData[0] = t;
-        break;
-      }
-      case Opcode::AArch64_CBNZW: {  // cbnz wn, #imm
-        auto [taken, addr] = conditionalHelp::condBranch_cmpToZero<uint32_t>(
-            operands, metadata, instructionAddress_,
-            [](uint32_t x) -> bool { return x != 0; });
-        branchTaken_ = taken;
-        branchAddress_ = addr;
-        break;
-      }
-      case Opcode::AArch64_CBNZX: {  // cbnz xn, #imm
-        auto [taken, addr] = conditionalHelp::condBranch_cmpToZero<uint64_t>(
-            operands, metadata, instructionAddress_,
-            [](uint64_t x) -> bool { return x != 0; });
-        branchTaken_ = taken;
-        branchAddress_ = addr;
-        break;
-      }
-      case Opcode::AArch64_CBZW: {  // cbz wn, #imm
-        auto [taken, addr] = conditionalHelp::condBranch_cmpToZero<uint32_t>(
-            operands, metadata, instructionAddress_,
-            [](uint32_t x) -> bool { return x == 0; });
-        branchTaken_ = taken;
-        branchAddress_ = addr;
-        break;
-      }
-      case Opcode::AArch64_CBZX: {  // cbz xn, #imm
-        auto [taken, addr] = conditionalHelp::condBranch_cmpToZero<uint64_t>(
-            operands, metadata, instructionAddress_,
-            [](uint64_t x) -> bool { return x == 0; });
-        branchTaken_ = taken;
-        branchAddress_ = addr;
-        break;
-      }
-      case Opcode::AArch64_CCMNWi: {  // ccmn wn, #imm, #nzcv, cc
-        results[0] = conditionalHelp::ccmn_imm<uint32_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_CCMNXi: {  // ccmn xn, #imm, #nzcv, cc
-        results[0] = conditionalHelp::ccmn_imm<uint64_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_CCMPWi: {  // ccmp wn, #imm, #nzcv, cc
-        results[0] = conditionalHelp::ccmp_imm<uint32_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_CCMPWr: {  // ccmp wn, wm, #nzcv, cc
-        results[0] = conditionalHelp::ccmp_reg<uint32_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_CCMPXi: {  // ccmp xn, #imm, #nzcv, cc
-        results[0] = conditionalHelp::ccmp_imm<uint64_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_CCMPXr: {  // ccmp xn, xm, #nzcv, cc
-        results[0] = conditionalHelp::ccmp_reg<uint64_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_CLZXr: {  // clz xd, xn
-        results[0] = arithmeticHelp::clz_reg<int64_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_CMEQv16i8: {  // cmeq vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecCompare<uint8_t, 16>(
-            operands, false,
-            [](uint8_t x, uint8_t y) -> bool { return (x == y); });
-        break;
-      }
-      case Opcode::AArch64_CMEQv16i8rz: {  // cmeq vd.16b, vn.16b, #0
-        results[0] = neonHelp::vecCompare<uint8_t, 16>(
-            operands, true,
-            [](uint8_t x, uint8_t y) -> bool { return (x == y); });
-        break;
-      }
-      case Opcode::AArch64_CMEQv4i32: {  // cmeq vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecCompare<uint32_t, 4>(
-            operands, false,
-            [](uint32_t x, uint32_t y) -> bool { return (x == y); });
-        break;
-      }
-      case Opcode::AArch64_CMEQv8i8: {  // cmeq vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecCompare<int8_t, 8>(
-            operands, false,
-            [](int8_t x, int8_t y) -> bool { return (x == y); });
-        break;
-      }
-      case Opcode::AArch64_CMEQv8i8rz: {  // cmeq vd.8b, vn.8b, #0
-        results[0] = neonHelp::vecCompare<int8_t, 8>(
-            operands, true,
-            [](int8_t x, int8_t y) -> bool { return (x == y); });
-        break;
-      }
-      case Opcode::AArch64_CMHIv4i32: {  // cmhi vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecCompare<uint32_t, 4>(
-            operands, false,
-            [](uint32_t x, uint32_t y) -> bool { return (x > y); });
-        break;
-      }
-      case Opcode::AArch64_CMHSv16i8: {  // cmhs vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecCompare<int8_t, 16>(
-            operands, false,
-            [](int8_t x, int8_t y) -> bool { return (x >= y); });
-        break;
-      }
-      case Opcode::AArch64_CMPEQ_PPzZI_B: {  // cmpeq pd.b, pg/z, zn.b, #imm
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint8_t>(
-            operands, metadata, VL_bits, true,
-            [](uint8_t x, uint8_t y) -> bool { return x == y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPEQ_PPzZI_D: {  // cmpeq pd.d, pg/z, zn.d, #imm
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint64_t>(
-            operands, metadata, VL_bits, true,
-            [](uint64_t x, uint64_t y) -> bool { return x == y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPEQ_PPzZI_H: {  // cmpeq pd.h, pg/z, zn.h, #imm
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint16_t>(
-            operands, metadata, VL_bits, true,
-            [](uint16_t x, uint16_t y) -> bool { return x == y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPEQ_PPzZI_S: {  // cmpeq pd.s, pg/z, zn.s, #imm
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint32_t>(
-            operands, metadata, VL_bits, true,
-            [](uint32_t x, uint32_t y) -> bool { return x == y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPEQ_PPzZZ_B: {  // cmpeq pd.b, pg/z, zn.b, zm.b
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint8_t>(
-            operands, metadata, VL_bits, false,
-            [](uint8_t x, uint8_t y) -> bool { return x == y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPEQ_PPzZZ_D: {  // cmpeq pd.d, pg/z, zn.d, zm.d
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint64_t>(
-            operands, metadata, VL_bits, false,
-            [](uint64_t x, uint64_t y) -> bool { return x == y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPEQ_PPzZZ_H: {  // cmpeq pd.h, pg/z, zn.h, zm.h
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint16_t>(
-            operands, metadata, VL_bits, false,
-            [](uint16_t x, uint16_t y) -> bool { return x == y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPEQ_PPzZZ_S: {  // cmpeq pd.s, pg/z, zn.s, zm.s
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint32_t>(
-            operands, metadata, VL_bits, false,
-            [](uint32_t x, uint32_t y) -> bool { return x == y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPGT_PPzZZ_B: {  // cmpgt pd.b, pg/z, zn.b, zm.b
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int8_t>(
-            operands, metadata, VL_bits, false,
-            [](int8_t x, int8_t y) -> bool { return x > y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPGT_PPzZZ_D: {  // cmpgt pd.d, pg/z, zn.d, zm.d
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int64_t>(
-            operands, metadata, VL_bits, false,
-            [](int64_t x, int64_t y) -> bool { return x > y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPGT_PPzZZ_H: {  // cmpgt pd.h, pg/z, zn.h, zm.h
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int16_t>(
-            operands, metadata, VL_bits, false,
-            [](int16_t x, int16_t y) -> bool { return x > y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPGT_PPzZZ_S: {  // cmpgt pd.s, pg/z, zn.s, zm.s
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int32_t>(
-            operands, metadata, VL_bits, false,
-            [](int32_t x, int32_t y) -> bool { return x > y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPHI_PPzZZ_B: {  // cmphi pd.b, pg/z, zn.b, zm.b
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint8_t>(
-            operands, metadata, VL_bits, false,
-            [](uint8_t x, uint8_t y) -> bool { return x > y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPHI_PPzZZ_D: {  // cmphi pd.d, pg/z, zn.d, zm.d
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint64_t>(
-            operands, metadata, VL_bits, false,
-            [](uint64_t x, uint64_t y) -> bool { return x > y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPHI_PPzZZ_H: {  // cmphi pd.h, pg/z, zn.h, zm.h
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint16_t>(
-            operands, metadata, VL_bits, false,
-            [](uint16_t x, uint16_t y) -> bool { return x > y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPHI_PPzZZ_S: {  // cmphi pd.s, pg/z, zn.s, zm.s
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint32_t>(
-            operands, metadata, VL_bits, false,
-            [](uint32_t x, uint32_t y) -> bool { return x > y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPNE_PPzZI_B: {  // cmpne pd.b, pg/z. zn.b, #imm
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int8_t>(
-            operands, metadata, VL_bits, true,
-            [](int8_t x, int8_t y) -> bool { return x != y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPNE_PPzZI_D: {  // cmpne pd.d, pg/z. zn.d, #imm
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int64_t>(
-            operands, metadata, VL_bits, true,
-            [](int64_t x, int64_t y) -> bool { return x != y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPNE_PPzZI_H: {  // cmpne pd.h, pg/z. zn.h, #imm
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int16_t>(
-            operands, metadata, VL_bits, true,
-            [](int16_t x, int16_t y) -> bool { return x != y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPNE_PPzZI_S: {  // cmpne pd.s, pg/z. zn.s, #imm
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int32_t>(
-            operands, metadata, VL_bits, true,
-            [](int32_t x, int32_t y) -> bool { return x != y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPNE_PPzZZ_B: {  // cmpne pd.b, pg/z, zn.b, zm.b
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int8_t>(
-            operands, metadata, VL_bits, false,
-            [](int8_t x, int8_t y) -> bool { return x != y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPNE_PPzZZ_D: {  // cmpne pd.d, pg/z, zn.d, zm.d
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int64_t>(
-            operands, metadata, VL_bits, false,
-            [](int64_t x, int64_t y) -> bool { return x != y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPNE_PPzZZ_H: {  // cmpne pd.h, pg/z, zn.h, zm.h
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int16_t>(
-            operands, metadata, VL_bits, false,
-            [](int16_t x, int16_t y) -> bool { return x != y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CMPNE_PPzZZ_S: {  // cmpne pd.s, pg/z, zn.s, zm.s
-        auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int32_t>(
-            operands, metadata, VL_bits, false,
-            [](int32_t x, int32_t y) -> bool { return x != y; });
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_CNTB_XPiI: {  // cntb xd{, pattern{, #imm}}
-        results[0] = sveHelp::sveCnt_gpr<uint8_t>(metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CNTD_XPiI: {  // cntd xd{, pattern{, #imm}}
-        results[0] = sveHelp::sveCnt_gpr<uint64_t>(metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CNTH_XPiI: {  // cnth xd{, pattern{, #imm}}
-        results[0] = sveHelp::sveCnt_gpr<uint16_t>(metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CNTP_XPP_B: {  // cntp xd, pg, pn.b
-        results[0] = sveHelp::sveCntp<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CNTP_XPP_D: {  // cntp xd, pg, pn.d
-        results[0] = sveHelp::sveCntp<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CNTP_XPP_H: {  // cntp xd, pg, pn.h
-        results[0] = sveHelp::sveCntp<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CNTP_XPP_S: {  // cntp xd, pg, pn.s
-        results[0] = sveHelp::sveCntp<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CNTW_XPiI: {  // cntw xd{, pattern{, #imm}}
-        results[0] = sveHelp::sveCnt_gpr<uint32_t>(metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CNTv8i8: {  // cnt vd.8b, vn.8b
-        results[0] = neonHelp::vecCountPerByte<uint8_t, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_CPY_ZPzI_B: {  // cpy zd.b, pg/z, #imm{, shift}
-        results[0] = sveHelp::sveCpy_imm<int8_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CPY_ZPzI_D: {  // cpy zd.d, pg/z, #imm{, shift}
-        results[0] = sveHelp::sveCpy_imm<int64_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CPY_ZPzI_H: {  // cpy zd.h, pg/z, #imm{, shift}
-        results[0] = sveHelp::sveCpy_imm<int16_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_CPY_ZPzI_S: {  // cpy zd.s, pg/z, #imm{, shift}
-        results[0] = sveHelp::sveCpy_imm<int32_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_DUPi32: {  // dup vd, vn.s[index]
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint32_t, 1>(operands, metadata, false);
-        break;
-      }
-      case Opcode::AArch64_DUPi64: {  // dup vd, vn.d[index]
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint64_t, 1>(operands, metadata, false);
-        break;
-      }
-      case Opcode::AArch64_CSELWr: {  // csel wd, wn, wm, cc
-        results[0] = {
-            conditionalHelp::cs_4ops<uint32_t>(
-                operands, metadata, [](uint32_t x) -> uint32_t { return x; }),
-            8};
-        break;
-      }
-      case Opcode::AArch64_CSELXr: {  // csel xd, xn, xm, cc
-        results[0] = conditionalHelp::cs_4ops<uint64_t>(
-            operands, metadata, [](uint64_t x) -> uint64_t { return x; });
-        break;
-      }
-      case Opcode::AArch64_CSINCWr: {  // csinc wd, wn, wm, cc
-        results[0] = {conditionalHelp::cs_4ops<uint32_t>(
-                          operands, metadata,
-                          [](uint32_t x) -> uint32_t { return x + 1; }),
-                      8};
-        break;
-      }
-      case Opcode::AArch64_CSINCXr: {  // csinc xd, xn, xm, cc
-        results[0] = conditionalHelp::cs_4ops<uint64_t>(
-            operands, metadata, [](uint64_t x) -> uint64_t { return x + 1; });
-        break;
-      }
-      case Opcode::AArch64_CSINVWr: {  // csinv wd, wn, wm, cc
-        results[0] = {
-            conditionalHelp::cs_4ops<uint32_t>(
-                operands, metadata, [](uint32_t x) -> uint32_t { return ~x; }),
-            8};
-        break;
-      }
-      case Opcode::AArch64_CSINVXr: {  // csinv xd, xn, xm, cc
-        results[0] = conditionalHelp::cs_4ops<uint64_t>(
-            operands, metadata, [](uint64_t x) -> uint64_t { return ~x; });
-        break;
-      }
-      case Opcode::AArch64_CSNEGWr: {  // csneg wd, wn, wm, cc
-        results[0] = {
-            conditionalHelp::cs_4ops<int32_t>(
-                operands, metadata, [](int32_t x) -> int32_t { return -x; }),
-            8};
-        break;
-      }
-      case Opcode::AArch64_CSNEGXr: {  // csneg xd, xn, xm, cc
-        results[0] = conditionalHelp::cs_4ops<uint64_t>(
-            operands, metadata, [](uint64_t x) -> uint64_t { return -x; });
-        break;
-      }
-      case Opcode::AArch64_DECB_XPiI: {  // decb xdn{, pattern{, MUL #imm}}
-        results[0] =
-            sveHelp::sveDec_scalar<int8_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_DECD_XPiI: {  // decd xdn{, pattern{, MUL #imm}}
-        results[0] =
-            sveHelp::sveDec_scalar<int64_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_DMB: {  // dmb option|#imm
-        // TODO: Respect memory barriers
-        break;
-      }
-      case Opcode::AArch64_DUPM_ZI: {  // dupm zd.t, #imm
-        const uint64_t imm = static_cast<uint64_t>(metadata.operands[1].imm);
-        uint64_t out[32] = {0};
-        for (int i = 0; i < (VL_bits / 64); i++) {
-          out[i] = imm;
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_DUP_ZI_B: {  // dup zd.b, #imm{, shift}
-        results[0] = sveHelp::sveDup_immOrScalar<int8_t>(operands, metadata,
-                                                         VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_DUP_ZI_D: {  // dup zd.d, #imm{, shift}
-        results[0] = sveHelp::sveDup_immOrScalar<int64_t>(operands, metadata,
-                                                          VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_DUP_ZI_H: {  // dup zd.h, #imm{, shift}
-        results[0] = sveHelp::sveDup_immOrScalar<int16_t>(operands, metadata,
-                                                          VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_DUP_ZI_S: {  // dup zd.s, #imm{, shift}
-        results[0] = sveHelp::sveDup_immOrScalar<int32_t>(operands, metadata,
-                                                          VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_DUP_ZR_B: {  // dup zd.b, wn
-        results[0] = sveHelp::sveDup_immOrScalar<int8_t>(operands, metadata,
-                                                         VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_DUP_ZR_D: {  // dup zd.d, xn
-        results[0] = sveHelp::sveDup_immOrScalar<int64_t>(operands, metadata,
-                                                          VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_DUP_ZR_H: {  // dup zd.h, wn
-        results[0] = sveHelp::sveDup_immOrScalar<int16_t>(operands, metadata,
-                                                          VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_DUP_ZR_S: {  // dup zd.s, wn
-        results[0] = sveHelp::sveDup_immOrScalar<int32_t>(operands, metadata,
-                                                          VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_DUP_ZZI_D: {  // dup zd.d, zn.d[#imm]
-        results[0] =
-            sveHelp::sveDup_vecIndexed<uint64_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_DUP_ZZI_Q: {  // dup zd.q, zn.q[#imm]
-        // No data-type for quadwords, but as data is just being moved around we
-        // can use uint64_t.
-        const uint16_t index =
-            2 * static_cast<uint16_t>(metadata.operands[1].vector_index);
-        const uint64_t* n = operands[0].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 128;
-        uint64_t out[32] = {0};
-
-        if (index < partition_num) {
-          const uint64_t elementHi = n[index];
-          const uint64_t elementLo = n[index + 1];
-          for (int i = 0; i < partition_num; i++) {
-            out[2 * i] = elementHi;      // Copy over top half of quadword
-            out[2 * i + 1] = elementLo;  // Copy over lower half of quadword
-          }
-        }
-        results[0] = out;
-        break;
-      }
-      case Opcode::AArch64_DUP_ZZI_S: {  // dup zd.s, zn.s[#imm]
-        results[0] =
-            sveHelp::sveDup_vecIndexed<uint32_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_DUPv16i8gpr: {  // dup vd.16b, wn
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint8_t, 16>(operands, metadata, true);
-        break;
-      }
-      case Opcode::AArch64_DUPv2i32gpr: {  // dup vd.2s, wn
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint32_t, 2>(operands, metadata, true);
-        break;
-      }
-      case Opcode::AArch64_DUPv2i32lane: {  // dup vd.2s, vn.s[index]
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint32_t, 2>(operands, metadata, false);
-        break;
-      }
-      case Opcode::AArch64_DUPv2i64gpr: {  // dup vd.2d, xn
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint64_t, 2>(operands, metadata, true);
-        break;
-      }
-      case Opcode::AArch64_DUPv2i64lane: {  // dup vd.2d, vn.d[index]
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint64_t, 2>(operands, metadata, false);
-        break;
-      }
-      case Opcode::AArch64_DUPv4i16gpr: {  // dup vd.4h, wn
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint16_t, 4>(operands, metadata, true);
-        break;
-      }
-      case Opcode::AArch64_DUPv4i32gpr: {  // dup vd.4s, wn
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint32_t, 4>(operands, metadata, true);
-        break;
-      }
-      case Opcode::AArch64_DUPv4i32lane: {  // dup vd.4s, vn.s[index]
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint32_t, 4>(operands, metadata, false);
-        break;
-      }
-      case Opcode::AArch64_DUPv8i16gpr: {  // dup vd.8h, wn
-        results[0] =
-            neonHelp::vecDup_gprOrIndex<uint16_t, 8>(operands, metadata, true);
-        break;
-      }
-      case Opcode::AArch64_EORWri: {  // eor wd, wn, #imm
-        auto [result, nzcv] = logicalHelp::logicOp_imm<uint32_t>(
-            operands, metadata, false,
-            [](uint32_t x, uint32_t y) -> uint32_t { return x ^ y; });
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_EORWrs: {  // eor wd, wn, wm{, shift #imm}
-        auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint32_t>(
-            operands, metadata, false,
-            [](uint32_t x, uint32_t y) -> uint32_t { return x ^ y; });
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_EORXri: {  // eor xd, xn, #imm
-        auto [result, nzcv] = logicalHelp::logicOp_imm<uint64_t>(
-            operands, metadata, false,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x ^ y; });
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_EORXrs: {  // eor xd, xn, xm{, shift #amount}
-        auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint64_t>(
-            operands, metadata, false,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x ^ y; });
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_EOR_PPzPP: {
-        results[0] = sveHelp::sveLogicOp_preds<uint8_t>(
-            operands, VL_bits,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x ^ y; });
-        break;
-      }
-      case Opcode::AArch64_EOR_ZPmZ_B: {  // eor zdn.b, pg/m, zdn.b, zm.b
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint8_t>(
-            operands, VL_bits,
-            [](uint8_t x, uint8_t y) -> uint8_t { return x ^ y; });
-        break;
-      }
-      case Opcode::AArch64_EOR_ZPmZ_D: {  // eor zdn.d, pg/m, zdn.d, zm.d
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint64_t>(
-            operands, VL_bits,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x ^ y; });
-        break;
-      }
-      case Opcode::AArch64_EOR_ZPmZ_H: {  // eor zdn.h, pg/m, zdn.h, zm.h
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint16_t>(
-            operands, VL_bits,
-            [](uint16_t x, uint16_t y) -> uint16_t { return x ^ y; });
-        break;
-      }
-      case Opcode::AArch64_EOR_ZPmZ_S: {  // eor zdn.s, pg/m, zdn.s, zm.s
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint32_t>(
-            operands, VL_bits,
-            [](uint32_t x, uint32_t y) -> uint32_t { return x ^ y; });
-        break;
-      }
-      case Opcode::AArch64_EORv16i8: {  // eor vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 16>(
-            operands, [](uint8_t x, uint8_t y) -> uint8_t { return x ^ y; });
-        break;
-      }
-      case Opcode::AArch64_EORv8i8: {  // eor vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 8>(
-            operands, [](uint8_t x, uint8_t y) -> uint8_t { return x ^ y; });
-        break;
-      }
-      case Opcode::AArch64_EXTRWrri: {  // extr wd, wn, wm, #lsb
-        results[0] = {
-            bitmanipHelp::extrLSB_registers<uint32_t>(operands, metadata), 8};
-        break;
-      }
-      case Opcode::AArch64_EXTRXrri: {  // extr xd, xn, xm, #lsb
-        results[0] =
-            bitmanipHelp::extrLSB_registers<uint64_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_EXTv16i8: {  // ext vd.16b, vn.16b, vm.16b, #index
-        results[0] =
-            neonHelp::vecExtVecs_index<uint8_t, 16>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_EXTv8i8: {  // ext vd.8b, vn.8b, vm.8b, #index
-        results[0] = neonHelp::vecExtVecs_index<uint8_t, 8>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FABD32: {  // fabd sd, sn, sm
-        results[0] = floatHelp::fabd_3ops<float>(operands);
-        break;
-      }
-      case Opcode::AArch64_FABD64: {  // fabd dd, dn, dm
-        results[0] = floatHelp::fabd_3ops<double>(operands);
-        break;
-      }
-      case Opcode::AArch64_FABSDr: {  // fabs dd, dn
-        results[0] = floatHelp::fabs_2ops<double>(operands);
-        break;
-      }
-      case Opcode::AArch64_FABSSr: {  // fabs sd, sn
-        results[0] = floatHelp::fabs_2ops<float>(operands);
-        break;
-      }
-      case Opcode::AArch64_FABS_ZPmZ_D: {  // fabs zd.d, pg/m, zn.d
-        results[0] = sveHelp::sveFabsPredicated<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FABS_ZPmZ_S: {  // fabs zd.s, pg/m, zn.s
-        results[0] = sveHelp::sveFabsPredicated<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FABSv2f64: {  // fabs vd.2d, vn.2d
-        results[0] = neonHelp::vecFabs_2ops<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FABSv4f32: {  // fabs vd.4s, vn.4s
-        results[0] = neonHelp::vecFabs_2ops<float, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_FADDA_VPZ_D: {  // fadda dd, pg/m, dn, zm.d
-        results[0] = sveHelp::sveFaddaPredicated<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FADDDrr: {  // fadd dd, dn, dm
-        results[0] = {arithmeticHelp::add_3ops<double>(operands), 256};
-        break;
-      }
-      case Opcode::AArch64_FADDPv2f32: {  // faddp vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecAddp_3ops<float, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FADDPv2f64: {  // faddp vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecAddp_3ops<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FADDPv2i32p: {  // faddp dd, vn.2s
-        results[0] = neonHelp::vecSumElems_2ops<float, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FADDPv2i64p: {  // faddp dd, vn.2d
-        results[0] = neonHelp::vecSumElems_2ops<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FADDPv4f32: {  // faddp vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecAddp_3ops<float, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_FADDSrr: {  // fadd sd, sn, sm
-        results[0] = {arithmeticHelp::add_3ops<float>(operands), 256};
-        break;
-      }
-      case Opcode::AArch64_FADD_ZPmI_D: {  // fadd zdn.d, pg/m, zdn.d, const
-        results[0] = sveHelp::sveAddPredicated_const<double>(operands, metadata,
-                                                             VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FADD_ZPmI_S: {  // fadd zdn.s, pg/m, zdn.s, const
-        results[0] =
-            sveHelp::sveAddPredicated_const<float>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FADD_ZPmZ_D: {  // fadd zdn.d, pg/m, zdn.d, zm.d
-        results[0] = sveHelp::sveAddPredicated_vecs<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FADD_ZPmZ_S: {  // fadd zdn.s, pg/m, zdn.s, zm.s
-        results[0] = sveHelp::sveAddPredicated_vecs<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FADD_ZZZ_D: {  // fadd zd.d, zn.d, zm.d
-        results[0] = sveHelp::sveAdd_3ops<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FADD_ZZZ_S: {  // fadd zd.s, zn.s, zm.s
-        results[0] = sveHelp::sveAdd_3ops<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FADDv2f32: {  // fadd vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecAdd_3ops<float, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FADDv2f64: {  // fadd vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecAdd_3ops<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FADDv4f32: {  // fadd vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecAdd_3ops<float, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_FCADD_ZPmZ_D: {  // fcadd zdn.d, pg/m, zdn.d, zm.d,
-                                            // #imm
-        results[0] =
-            sveHelp::sveFcaddPredicated<double>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FCCMPDrr:     // fccmp sn, sm, #nzcv, cc
-      case Opcode::AArch64_FCCMPEDrr: {  // fccmpe sn, sm, #nzcv, cc
-        results[0] = floatHelp::fccmp<double>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FCCMPESrr: {  // fccmpe sn, sm, #nzcv, cc
-        results[0] = floatHelp::fccmp<float>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FCCMPSrr: {  // fccmp sn, sm, #nzcv, cc
-        results[0] = floatHelp::fccmp<float>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FCMEQv2i32rz: {  // fcmeq vd.2s, vd.2s, #0.0
-        results[0] = neonHelp::vecFCompare<float, uint32_t, 2>(
-            operands, true, [](float x, float y) -> bool { return x == y; });
-        break;
-      }
-      case Opcode::AArch64_FCMEQv4i32rz: {  // fcmeq vd.4s vn.4s, #0.0
-        results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
-            operands, true, [](float x, float y) -> bool { return x == y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGE_PPzZ0_D: {  // fcmge pd.d, pg/z, zn.d, #0.0
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<double>(
-            operands, metadata, VL_bits, true,
-            [](double x, double y) -> bool { return x >= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGE_PPzZ0_S: {  // fcmge pd.s, pg/z, zn.s, #0.0
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
-            operands, metadata, VL_bits, true,
-            [](float x, float y) -> bool { return x >= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGE_PPzZZ_D: {  // fcmge pd.d, pg/z, zn.d, zm.d
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<double>(
-            operands, metadata, VL_bits, false,
-            [](double x, double y) -> bool { return x >= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGE_PPzZZ_S: {  // fcmge pd.s, pg/z, zn.s, zm.s
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
-            operands, metadata, VL_bits, false,
-            [](float x, float y) -> bool { return x >= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGEv2f32: {  // fcmge vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecFCompare<float, uint32_t, 2>(
-            operands, false, [](float x, float y) -> bool { return x >= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGEv2f64: {  // fcmge vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecFCompare<double, uint64_t, 2>(
-            operands, false, [](float x, double y) -> bool { return x >= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGEv2i64rz: {  // fcmge vd.2d, vn.2d, 0.0
-        results[0] = neonHelp::vecFCompare<double, uint64_t, 2>(
-            operands, true, [](double x, double y) -> bool { return x >= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGEv4f32: {  // fcmge vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
-            operands, false, [](float x, float y) -> bool { return x >= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGEv4i32rz: {  // fcmge vd.4s, vn.4s, 0.0
-        results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
-            operands, true, [](float x, float y) -> bool { return x >= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGT_PPzZ0_D: {  // fcmgt pd.d, pg/z, zn.d, #0.0
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<double>(
-            operands, metadata, VL_bits, true,
-            [](double x, double y) -> bool { return x > y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGT_PPzZ0_S: {  // fcmgt pd.s, pg/z, zn.s, #0.0
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
-            operands, metadata, VL_bits, true,
-            [](float x, float y) -> bool { return x > y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGT_PPzZZ_D: {  // fcmgt pd.d, pg/z, zn.d, zm.d
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<double>(
-            operands, metadata, VL_bits, false,
-            [](double x, double y) -> bool { return x > y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGT_PPzZZ_S: {  // fcmgt pd.s, pg/z, zn.s, zm.
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
-            operands, metadata, VL_bits, false,
-            [](float x, float y) -> bool { return x > y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGTv2i32rz: {  // fcmgt vd.2s, vn.2s, #0.0
-        results[0] = neonHelp::vecFCompare<float, uint32_t, 2>(
-            operands, true, [](float x, float y) -> bool { return x > y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGTv2i64rz: {  // fcmgt vd.2d, vn.2d, #0.0
-        results[0] = neonHelp::vecFCompare<double, uint64_t, 2>(
-            operands, true, [](double x, double y) -> bool { return x > y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGTv4f32: {  // fcmgt vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
-            operands, false, [](float x, float y) -> bool { return x > y; });
-        break;
-      }
-      case Opcode::AArch64_FCMGTv4i32rz: {  // fcmgt vd.4s, vn.4s, #0.0
-        results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
-            operands, true, [](float x, float y) -> bool { return x > y; });
-        break;
-      }
-      case Opcode::AArch64_FCMLA_ZPmZZ_D: {  // fcmla zda, pg/m, zn, zm, #imm
-        results[0] =
-            sveHelp::sveFcmlaPredicated<double>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FCMLE_PPzZ0_D: {  // fcmle pd.d, pg/z, zn.d, #0.0
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<double>(
-            operands, metadata, VL_bits, true,
-            [](double x, double y) -> bool { return x <= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMLE_PPzZ0_S: {  // fcmle pd.s, pg/z, zn.s, #0.0
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
-            operands, metadata, VL_bits, true,
-            [](float x, float y) -> bool { return x <= y; });
-        break;
-      }
-      case Opcode::AArch64_FCMLT_PPzZ0_S: {  // fcmlt pd.s, pg/z, zn.s, #0.0
-        results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
-            operands, metadata, VL_bits, true,
-            [](float x, float y) -> bool { return x < y; });
-        break;
-      }
-      case Opcode::AArch64_FCMLTv2i32rz: {  // fcmlt vd.2s, vn.2s, #0.0
-        results[0] = neonHelp::vecFCompare<float, uint32_t, 2>(
-            operands, true, [](float x, float y) -> bool { return x < y; });
-        break;
-      }
-      case Opcode::AArch64_FCMLTv2i64rz: {  // fcmlt vd.2d, vn.2d, #0.0
-        results[0] = neonHelp::vecFCompare<double, uint64_t, 2>(
-            operands, true, [](double x, double y) -> bool { return x < y; });
-        break;
-      }
-      case Opcode::AArch64_FCMLTv4i32rz: {  // fcmlt vd.4s, vn.4s, #0.0
-        results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
-            operands, true, [](float x, float y) -> bool { return x < y; });
-        break;
-      }
-      case Opcode::AArch64_FCMPDri: {  // fcmp dn, #imm
-        results[0] = floatHelp::fcmp<double>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_FCMPDrr: {  // fcmp dn, dm
-        results[0] = floatHelp::fcmp<double>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_FCMPEDri: {  // fcmpe dn, #imm
-        results[0] = floatHelp::fcmp<double>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_FCMPEDrr: {  // fcmpe dn, dm
-        results[0] = floatHelp::fcmp<double>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_FCMPESri: {  // fcmpe sn, #imm
-        results[0] = floatHelp::fcmp<float>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_FCMPESrr: {  // fcmpe sn, sm
-        results[0] = floatHelp::fcmp<float>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_FCMPSri: {  // fcmp sn, #imm
-        results[0] = floatHelp::fcmp<float>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_FCMPSrr: {  // fcmp sn, sm
-        results[0] = floatHelp::fcmp<float>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_FCPY_ZPmI_D: {  // fcpy zd.d, pg/m, #const
-        results[0] = sveHelp::sveFcpy_imm<double>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FCPY_ZPmI_S: {  // fcpy zd.s, pg/m, #const
-        results[0] = sveHelp::sveFcpy_imm<float>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FCSELDrrr: {  // fcsel dd, dn, dm, cond
-        results[0] = {
-            conditionalHelp::cs_4ops<double>(
-                operands, metadata, [](double x) -> double { return x; }),
-            256};
-        break;
-      }
-      case Opcode::AArch64_FCSELSrrr: {  // fcsel sd, sn, sm, cond
-        results[0] = {
-            conditionalHelp::cs_4ops<float>(operands, metadata,
-                                            [](float x) -> float { return x; }),
-            256};
-        break;
-      }
-      case Opcode::AArch64_FCVTASUWDr: {  // fcvtas wd, dn
-        results[0] = {static_cast<int32_t>(round(operands[0].get<double>())),
-                      8};
-        break;
-      }
-      case Opcode::AArch64_FCVTASUXDr: {  // fcvtas xd, dn
-        results[0] = static_cast<int64_t>(round(operands[0].get<double>()));
-        break;
-      }
-      case Opcode::AArch64_FCVTDSr: {  // fcvt dd, sn
-        // TODO: Handle NaNs, denorms, and saturation?
-        results[0] = neonHelp::vecFcvtl<double, float, 1>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_FCVTLv2i32: {  // fcvtl vd.2d, vn.2s
-        results[0] = neonHelp::vecFcvtl<double, float, 2>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_FCVTLv4i32: {  // fcvtl2 vd.2d, vn.4s
-        results[0] = neonHelp::vecFcvtl<double, float, 2>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_FCVTNv2i32: {  // fcvtn vd.2s, vn.2d
-        results[0] = neonHelp::vecFcvtn<float, double, 2>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_FCVTNv4i32: {  // fcvtn2 vd.4s, vn.2d
-        results[0] = neonHelp::vecFcvtn<float, double, 4>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_FCVTSDr: {  // fcvt sd, dn
-        // TODO: Handle NaNs, denorms, and saturation?
-        results[0] = neonHelp::vecFcvtl<float, double, 1>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_FCVTZSUWDr: {  // fcvtzs wd, dn
-        // TODO: Handle NaNs, denorms, and saturation
-        results[0] = {
-            static_cast<int32_t>(std::trunc(operands[0].get<double>())), 8};
-        break;
-      }
-      case Opcode::AArch64_FCVTZSUWSr: {  // fcvtzs wd, sn
-        // TODO: Handle NaNs, denorms, and saturation
-        results[0] = {
-            static_cast<int32_t>(std::trunc(operands[0].get<float>())), 8};
-        break;
-      }
-      case Opcode::AArch64_FCVTZSUXDr: {
-        // TODO: Handle NaNs, denorms, and saturation
-        results[0] = {
-            static_cast<int64_t>(std::trunc(operands[0].get<double>())), 8};
-        break;
-      }
-      case Opcode::AArch64_FCVTZS_ZPmZ_DtoD: {  // fcvtzs zd.d, pg/m, zn.d
-        results[0] =
-            sveHelp::sveFcvtzsPredicated<int64_t, double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FCVTZS_ZPmZ_DtoS: {  // fcvtzs zd.s, pg/m, zn.d
-        results[0] =
-            sveHelp::sveFcvtzsPredicated<int32_t, double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FCVTZS_ZPmZ_StoD: {  // fcvtzs zd.d, pg/m, zn.s
-        results[0] =
-            sveHelp::sveFcvtzsPredicated<int64_t, float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FCVTZS_ZPmZ_StoS: {  // fcvtzs zd.s, pg/m, zn.s
-        results[0] =
-            sveHelp::sveFcvtzsPredicated<int32_t, float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FCVTZSv2f64: {  // fcvtzs vd.2d, vn.2d
-        results[0] = neonHelp::vecFcvtzs<int64_t, double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FCVTZUUWDr: {  // fcvtzu wd, dn
-        // TODO: Handle NaNs, denorms, and saturation
-        results[0] = {
-            static_cast<int32_t>(std::trunc(operands[0].get<double>())), 8};
-        break;
-      }
-      case Opcode::AArch64_FCVTZUUWSr: {  // fcvtzu wd, sn
-        // TODO: Handle NaNs, denorms, and saturation
-        results[0] = {
-            static_cast<int32_t>(std::trunc(operands[0].get<float>())), 8};
-        break;
-      }
-      case Opcode::AArch64_FCVTZUUXDr: {  // fcvtzu xd, dn
-        // TODO: Handle NaNs, denorms, and saturation
-        results[0] =
-            static_cast<int64_t>(std::trunc(operands[0].get<double>()));
-        break;
-      }
-      case Opcode::AArch64_FCVTZUUXSr: {  // fcvtzu xd, sn
-        // TODO: Handle NaNs, denorms, and saturation
-        results[0] = static_cast<int64_t>(std::trunc(operands[0].get<float>()));
-        break;
-      }
-      case Opcode::AArch64_FCVT_ZPmZ_DtoS: {  // fcvt zd.s, pg/m, zn.d
-        results[0] =
-            sveHelp::sveFcvtPredicated<float, double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FCVT_ZPmZ_StoD: {  // fcvt zd.d, pg/m, zn.s
-        results[0] =
-            sveHelp::sveFcvtPredicated<double, float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FDIVDrr: {  // fdiv dd, dn, dm
-        results[0] = {divideHelp::div_3ops<double>(operands), 256};
-        break;
-      }
-      case Opcode::AArch64_FDIVR_ZPmZ_D: {  // fdivr zdn.d, pg/m, zdn.d, zm.d
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<double>(
-            operands, VL_bits,
-            [](double x, double y) -> double { return (y / x); });
-        break;
-      }
-      case Opcode::AArch64_FDIVR_ZPmZ_S: {  // fdivr zdn.s, pg/m, zdn.s, zm.s
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<float>(
-            operands, VL_bits,
-            [](float x, float y) -> float { return (y / x); });
-        break;
-      }
-      case Opcode::AArch64_FDIVSrr: {  // fdiv sd, sn, sm
-        results[0] = {divideHelp::div_3ops<float>(operands), 256};
-        break;
-      }
-      case Opcode::AArch64_FDIV_ZPmZ_D: {  // fdiv zdn.d, pg/m, zdn.d, zm.d
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<double>(
-            operands, VL_bits,
-            [](double x, double y) -> double { return (x / y); });
-        break;
-      }
-      case Opcode::AArch64_FDIVv2f64: {  // fdiv vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecLogicOp_3vecs<double, 2>(
-            operands, [](double x, double y) -> double { return x / y; });
-        break;
-      }
-      case Opcode::AArch64_FDUP_ZI_D: {  // fdup zd.d, #imm
-        results[0] = sveHelp::sveDup_immOrScalar<double>(operands, metadata,
-                                                         VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_FDUP_ZI_S: {  // fdup zd.s, #imm
-        results[0] = sveHelp::sveDup_immOrScalar<float>(operands, metadata,
-                                                        VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_FMADDDrrr: {  // fmadd dn, dm, da
-        results[0] = {multiplyHelp::madd_4ops<double>(operands), 256};
-        break;
-      }
-      case Opcode::AArch64_FMADDSrrr: {  // fmadd sn, sm, sa
-        results[0] = {multiplyHelp::madd_4ops<float>(operands), 256};
-        break;
-      }
-      case Opcode::AArch64_FMAD_ZPmZZ_D: {  // fmad zd.d, pg/m, zn.d, zm.d
-        results[0] = sveHelp::sveFmadPredicated_vecs<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FMAD_ZPmZZ_S: {  // fmad zd.s, pg/m, zn.s, zm.s
-        results[0] = sveHelp::sveFmadPredicated_vecs<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FMAXNMDrr: {  // fmaxnm dd, dn, dm
-        results[0] = floatHelp::fmaxnm_3ops<double>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMAXNMPv2i64p: {  // fmaxnmp dd, vd.2d
-        results[0] = neonHelp::vecMaxnmp_2ops<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMAXNMSrr: {  // fmaxnm sd, sn, sm
-        results[0] = floatHelp::fmaxnm_3ops<float>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMAXNMv2f64: {  // fmaxnm vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecLogicOp_3vecs<double, 2>(
-            operands,
-            [](double x, double y) -> double { return std::fmax(x, y); });
-        break;
-      }
-      case Opcode::AArch64_FMINNMDrr: {  // fminnm dd, dn, dm
-        results[0] = floatHelp::fminnm_3ops<double>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMINNMPv2i64p: {  // fminnmp dd, vd.2d
-        results[0] = neonHelp::vecMinv_2ops<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMINNMSrr: {  // fminnm sd, sn, sm
-        results[0] = floatHelp::fminnm_3ops<float>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMINNMv2f64: {  // fminnm vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecLogicOp_3vecs<double, 2>(
-            operands,
-            [](double x, double y) -> double { return std::fmin(x, y); });
-        break;
-      }
-      case Opcode::AArch64_FMLA_ZPmZZ_D: {  // fmla zd.d, pg/m, zn.d, zm.d
-        results[0] = sveHelp::sveMlaPredicated_vecs<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FMLA_ZPmZZ_S: {  // fmla zd.s, pg/m, zn.s, zm.s
-        results[0] = sveHelp::sveMlaPredicated_vecs<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FMLAv2f32: {  // fmla vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecFmla_3vecs<float, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMLAv2f64: {  // fmla vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecFmla_3vecs<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMLAv2i32_indexed: {  // fmla vd.2s, vn.2s,
-                                                 // vm.2s[index]
-        results[0] =
-            neonHelp::vecFmlaIndexed_3vecs<float, 2>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FMLAv2i64_indexed: {  // fmla vd.2d, vn.2d,
-                                                 // vm.d[index]
-        results[0] =
-            neonHelp::vecFmlaIndexed_3vecs<double, 2>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FMLAv4f32: {  // fmla vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecFmla_3vecs<float, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMLAv4i32_indexed: {  // fmla vd.4s, vn.4s,
-                                                 // vm.s[index]
-        results[0] =
-            neonHelp::vecFmlaIndexed_3vecs<float, 4>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FMLS_ZPmZZ_D: {  // fmls zd.d, pg/m, zn.d, zm.d
-        results[0] = sveHelp::sveFmlsPredicated_vecs<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FMLS_ZPmZZ_S: {  // fmls zd.s, pg/m, zn.s, zm.s
-        results[0] = sveHelp::sveFmlsPredicated_vecs<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FMLSv2f64: {  // fmls vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecFmls_3vecs<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMLSv2i64_indexed: {
-        results[0] =
-            neonHelp::vecFmlsIndexed_3vecs<double, 2>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FMLSv4f32: {  // fmls vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecFmls_3vecs<float, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_FMLSv4i32_indexed: {  // fmls vd.4s, vn.4s,
-                                                 // vm.s[index]
-        results[0] =
-            neonHelp::vecFmlsIndexed_3vecs<float, 4>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FMOVDXHighr: {  // fmov xd, vn.d[1]
-        results[0] = operands[0].getAsVector<double>()[1];
-        break;
-      }
-      case Opcode::AArch64_FMOVDXr: {  // fmov xd, dn
-        results[0] = operands[0].get<double>();
-        break;
-      }
-      case Opcode::AArch64_FMOVDi: {  // fmov dn, #imm
-        results[0] = {metadata.operands[1].fp, 256};
-        break;
-      }
-      case Opcode::AArch64_FMOVDr: {  // fmov dd, dn
-        results[0] = {operands[0].get<double>(), 256};
-        break;
-      }
-      case Opcode::AArch64_FMOVSWr: {  // fmov wd, sn
-        results[0] = {operands[0].get<float>(), 8};
-        break;
-      }
-      case Opcode::AArch64_FMOVSi: {  // fmov sn, #imm
-        results[0] = {static_cast<float>(metadata.operands[1].fp), 256};
-        break;
-      }
-      case Opcode::AArch64_FMOVSr: {  // fmov sd, sn
-        results[0] = {operands[0].get<float>(), 256};
-        break;
-      }
-      case Opcode::AArch64_FMOVWSr: {  // fmov sd, wn
-        results[0] = {operands[0].get<float>(), 256};
-        break;
-      }
-      case Opcode::AArch64_FMOVXDHighr: {  // fmov vd.d[1], xn
-        double out[2] = {operands[0].get<double>(), operands[1].get<double>()};
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_FMOVXDr: {  // fmov dd, xn
-        results[0] = {operands[0].get<double>(), 256};
-        break;
-      }
-      case Opcode::AArch64_FMOVv2f32_ns: {  // fmov vd.2s, #imm
-        results[0] = neonHelp::vecMovi_imm<float, 2>(metadata);
-        break;
-      }
-      case Opcode::AArch64_FMOVv2f64_ns: {  // fmov vd.2d, #imm
-        results[0] = neonHelp::vecMovi_imm<double, 2>(metadata);
-        break;
-      }
-      case Opcode::AArch64_FMOVv4f32_ns: {  // fmov vd.4s, #imm
-        results[0] = neonHelp::vecMovi_imm<float, 4>(metadata);
-        break;
-      }
-      case Opcode::AArch64_FMSB_ZPmZZ_D: {  // fmsb zd.d, pg/m, zn.d, zm.d
-        results[0] = sveHelp::sveFmsbPredicated_vecs<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FMSB_ZPmZZ_S: {  // fmsb zd.s, pg/m, zn.s, zm.s
-        results[0] = sveHelp::sveFmsbPredicated_vecs<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FMSUBDrrr: {  // fmsub dn, dm, da
-        results[0] = {multiplyHelp::msub_4ops<double>(operands), 256};
-        break;
-      }
-      case Opcode::AArch64_FMSUBSrrr: {  // fmsub sn, sm, sa
-        results[0] = {multiplyHelp::msub_4ops<float>(operands), 256};
-        break;
-      }
-      case Opcode::AArch64_FMULDrr: {  // fmul dd, dn, dm
-        results[0] = {multiplyHelp::mul_3ops<double>(operands), 256};
-        break;
-      }
-      case Opcode::AArch64_FMULSrr: {  // fmul sd, sn, sm
-        results[0] = {multiplyHelp::mul_3ops<float>(operands), 256};
-        break;
-      }
-      case Opcode::AArch64_FMUL_ZPmI_D: {  // fmul zd.d, pg/m, zn.d, #imm
-        results[0] = sveHelp::sveMulPredicated<double>(operands, metadata,
-                                                       VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_FMUL_ZPmI_S: {  // fmul zd.s, pg/m, zn.s, #imm
-        results[0] =
-            sveHelp::sveMulPredicated<float>(operands, metadata, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_FMUL_ZPmZ_D: {  // fmul zdn.d, pg/m, zdn.d, zm.d
-        results[0] = sveHelp::sveMulPredicated<double>(operands, metadata,
-                                                       VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_FMUL_ZPmZ_S: {  // fmul zdn.s, pg/m, zdn.s, zm.s
-        results[0] = sveHelp::sveMulPredicated<float>(operands, metadata,
-                                                      VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_FMUL_ZZZ_D: {  // fmul zd.d, zn.d, zm.d
-        results[0] = sveHelp::sveFmul_3ops<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FMUL_ZZZ_S: {  // fmul zd.s, zn.s, zm.s
-        results[0] = sveHelp::sveFmul_3ops<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FMULv1i32_indexed: {  // fmul sd, sn, vm.s[index]
-        results[0] =
-            neonHelp::vecFmulIndexed_vecs<float, 1>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FMULv1i64_indexed: {  // fmul dd, dn, vm.d[index]
-        results[0] =
-            neonHelp::vecFmulIndexed_vecs<double, 1>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FMULv2f32: {  // fmul vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecLogicOp_3vecs<float, 2>(
-            operands, [](float x, float y) -> float { return x * y; });
-        break;
-      }
-      case Opcode::AArch64_FMULv2f64: {  // fmul vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecLogicOp_3vecs<double, 2>(
-            operands, [](double x, double y) -> double { return x * y; });
-        break;
-      }
-      case Opcode::AArch64_FMULv2i32_indexed: {  // fmul vd.2s, vn.2s,
-                                                 // vm.s[index]
-        results[0] =
-            neonHelp::vecFmulIndexed_vecs<float, 2>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FMULv2i64_indexed: {  // fmul vd.2d, vn.2d,
-                                                 // vm.d[index]
-        results[0] =
-            neonHelp::vecFmulIndexed_vecs<double, 2>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FMULv4f32: {  // fmul vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecLogicOp_3vecs<float, 4>(
-            operands, [](float x, float y) -> float { return x * y; });
-        break;
-      }
-      case Opcode::AArch64_FMULv4i32_indexed: {  // fmul vd.4s, vn.4s,
-                                                 // vm.s[index]
-        results[0] =
-            neonHelp::vecFmulIndexed_vecs<float, 4>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_FNEGDr: {  // fneg dd, dn
-        results[0] = {-operands[0].get<double>(), 256};
-        break;
-      }
-      case Opcode::AArch64_FNEGSr: {  // fneg sd, sn
-        results[0] = {-operands[0].get<float>(), 256};
-        break;
-      }
-      case Opcode::AArch64_FNEG_ZPmZ_D: {  // fneg zd.d, pg/m, zn.d
-        results[0] = sveHelp::sveFnegPredicated<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FNEG_ZPmZ_S: {  // fneg zd.s, pg/m, zn.s
-        results[0] = sveHelp::sveFnegPredicated<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FNEGv2f64: {  // fneg vd.2d, vn.2d
-        results[0] = neonHelp::vecFneg_2ops<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FNEGv4f32: {  // fneg vd.4s, vn.4s
-        results[0] = neonHelp::vecFneg_2ops<float, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_FNMADDDrrr: {  // fnmadd dd, dn, dm, da
-        results[0] = floatHelp::fnmadd_4ops<double>(operands);
-        break;
-      }
-      case Opcode::AArch64_FNMADDSrrr: {  // fnmadd sd, sn, sm, sa
-        results[0] = floatHelp::fnmadd_4ops<float>(operands);
-        break;
-      }
-      case Opcode::AArch64_FNMLS_ZPmZZ_D: {  // fnmls zd.d, pg/m, zn.d, zm.d
-        results[0] = sveHelp::sveFnmlsPredicated<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FNMLS_ZPmZZ_S: {  // fnmls zd.s, pg/m, zn.s, zm.s
-        results[0] = sveHelp::sveFnmlsPredicated<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FNMSB_ZPmZZ_D: {  // fnmsb zdn.d, pg/m, zm.d, za.d
-        results[0] = sveHelp::sveFnmsbPredicated<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FNMSB_ZPmZZ_S: {  // fnmsb zdn.s, pg/m, zm.s, za.s
-        results[0] = sveHelp::sveFnmsbPredicated<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FNMSUBDrrr: {  // fnmsub dd, dn, dm, da
-        results[0] = floatHelp::fnmsub_4ops<double>(operands);
-        break;
-      }
-      case Opcode::AArch64_FNMSUBSrrr: {  // fnmsub sd, sn, sm, sa
-        results[0] = floatHelp::fnmsub_4ops<float>(operands);
-        break;
-      }
-      case Opcode::AArch64_FNMULDrr: {  // fnmul dd, dn, dm
-        results[0] = neonHelp::vecLogicOp_3vecs<double, 1>(
-            operands, [](double x, double y) -> double { return -(x * y); });
-        break;
-      }
-      case Opcode::AArch64_FNMULSrr: {  // fnmul sd, sn, sm
-        results[0] = neonHelp::vecLogicOp_3vecs<float, 1>(
-            operands, [](float x, float y) -> float { return -(x * y); });
-        break;
-      }
-      case Opcode::AArch64_FRINTADr: {  // frinta dd, dn
-        results[0] = {round(operands[0].get<double>()), 256};
-        break;
-      }
-      case Opcode::AArch64_FRINTN_ZPmZ_D: {  // frintn zd.d, pg/m, zn.d
-        results[0] =
-            sveHelp::sveFrintnPredicated<int64_t, double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FRINTN_ZPmZ_S: {  // frintn zd.s, pg/m, zn.s
-        results[0] =
-            sveHelp::sveFrintnPredicated<int32_t, float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FRSQRTEv1i32: {  // frsqrte sd, sn
-        results[0] = neonHelp::vecFrsqrte_2ops<float, 1>(operands);
-        break;
-      }
-      case Opcode::AArch64_FRSQRTEv1i64: {  // frsqrte dd, dn
-        results[0] = neonHelp::vecFrsqrte_2ops<double, 1>(operands);
-        break;
-      }
-      case Opcode::AArch64_FRSQRTEv2f32: {  // frsqrte vd.2s, vn.2s
-        results[0] = neonHelp::vecFrsqrte_2ops<float, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FRSQRTEv2f64: {  // frsqrte vd.2d, vn.2d
-        results[0] = neonHelp::vecFrsqrte_2ops<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FRSQRTEv4f32: {  // frsqrte vd.4s, vn.4s
-        results[0] = neonHelp::vecFrsqrte_2ops<float, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_FRSQRTS32: {  // frsqrts sd, sn, sm
-        results[0] = neonHelp::vecFrsqrts_3ops<float, 1>(operands);
-        break;
-      }
-      case Opcode::AArch64_FRSQRTS64: {  // frsqrts dd, dn, dm
-        results[0] = neonHelp::vecFrsqrts_3ops<double, 1>(operands);
-        break;
-      }
-      case Opcode::AArch64_FRSQRTSv2f32: {  // frsqrts vd.2s, vn.2s, vn.2s
-        results[0] = neonHelp::vecFrsqrts_3ops<float, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FRSQRTSv2f64: {  // frsqrts vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecFrsqrts_3ops<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FRSQRTSv4f32: {  // frsqrts vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecFrsqrts_3ops<float, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_FSQRTDr: {  // fsqrt dd, dn
-        results[0] = {::sqrt(operands[0].get<double>()), 256};
-        break;
-      }
-      case Opcode::AArch64_FSQRTSr: {  // fsqrt sd, sn
-        results[0] = {::sqrtf(operands[0].get<float>()), 256};
-        break;
-      }
-      case Opcode::AArch64_FSQRT_ZPmZ_D: {  // fsqrt zd.d, pg/m, zn.d
-        results[0] =
-            sveHelp::sveFsqrtPredicated_2vecs<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FSQRT_ZPmZ_S: {  // fsqrt zd.s, pg/m, zn.s
-        results[0] =
-            sveHelp::sveFsqrtPredicated_2vecs<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FSQRTv2f64: {  // fsqrt vd.2d, vn.2d
-        results[0] = neonHelp::vecFsqrt_2ops<double, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_FSQRTv4f32: {  // fsqrt vd.4s, vn.4s
-        results[0] = neonHelp::vecFsqrt_2ops<float, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_FSUBDrr: {  // fsub dd, dn, dm
-        results[0] = neonHelp::vecLogicOp_3vecs<double, 1>(
-            operands, [](double x, double y) -> double { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_FSUBR_ZPmZ_D: {  // fsubr zdn.d, pg/m, zdn.d, zm.d
-        results[0] =
-            sveHelp::sveSubrPredicated_3vecs<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FSUBR_ZPmZ_S: {  // fsubr zdn.s, pg/m, zdn.s, zm.s
-        results[0] = sveHelp::sveSubrPredicated_3vecs<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FSUBSrr: {  // fsub ss, sn, sm
-        results[0] = neonHelp::vecLogicOp_3vecs<float, 1>(
-            operands, [](double x, double y) -> double { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_FSUB_ZPmI_D: {  // fsub zdn.d, pg/m, zdn.d, #imm
-        results[0] =
-            sveHelp::sveSubPredicated_imm<double>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FSUB_ZPmI_S: {  // fsub zdn.s, pg/m, zdn.s, #imm
-        results[0] =
-            sveHelp::sveSubPredicated_imm<float>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FSUB_ZPmZ_D: {  // fsub zdn.d, pg/m, zdn.d, zm.d
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<double>(
-            operands, VL_bits,
-            [](double x, double y) -> double { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_FSUB_ZPmZ_S: {  // fsub zdn.s, pg/m, zdn.s, zm.s
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<float>(
-            operands, VL_bits, [](float x, float y) -> float { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_FSUB_ZZZ_D: {  // fsub zd.d, zn.d, zm.d
-        results[0] = sveHelp::sveSub_3vecs<double>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FSUB_ZZZ_S: {  // fsub zd.s, zn.s, zm.s
-        results[0] = sveHelp::sveSub_3vecs<float>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_FSUBv2f32: {
-        results[0] = neonHelp::vecLogicOp_3vecs<float, 2>(
-            operands, [](float x, float y) -> float { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_FSUBv2f64: {  // fsub vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecLogicOp_3vecs<double, 2>(
-            operands, [](double x, double y) -> double { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_FSUBv4f32: {  // fsub vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecLogicOp_3vecs<float, 4>(
-            operands, [](float x, float y) -> float { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_GLD1D_IMM_REAL: {  // ld1d {zd.d}, pg/z, [zn.d{,
-                                              // #imm}]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint64_t out[32] = {0};
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            out[i] = memoryData[index].get<uint64_t>();
-            index++;
-          }
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_GLD1D_REAL:  // ld1d {zt.d}, pg/z, [xn, zm.d]
-        // LOAD
-        [[fallthrough]];
-      case Opcode::AArch64_GLD1D_SCALED_REAL: {  // ld1d {zt.d}, pg/z, [xn,
-                                                 // zm.d, LSL #3]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        uint64_t out[32] = {0};
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            out[i] = memoryData[index].get<uint64_t>();
-            index++;
-          }
-        }
-
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_GLD1SW_D_IMM_REAL: {  // ld1sw {zd.d}, pg/z, [zn.d{,
-                                                 // #imm}]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        int64_t out[32] = {0};
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            out[i] = static_cast<int64_t>(memoryData[index].get<int32_t>());
-            index++;
-          }
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_HINT: {  // nop|yield|wfe|wfi|etc...
-        // TODO: Observe hints
-        break;
-      }
-      case Opcode::AArch64_INCB_XPiI: {  // incb xdn{, pattern{, #imm}}
-        results[0] =
-            sveHelp::sveInc_gprImm<int8_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INCD_XPiI: {  // incd xdn{, pattern{, #imm}}
-        results[0] =
-            sveHelp::sveInc_gprImm<int64_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INCD_ZPiI: {  // incd zdn.d{, pattern{, #imm}}
-        results[0] = sveHelp::sveInc_imm<int64_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INCH_XPiI: {  // inch xdn{, pattern{, #imm}}
-        results[0] =
-            sveHelp::sveInc_gprImm<int16_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INCH_ZPiI: {  // inch zdn.h{, pattern{, #imm}}
-        results[0] = sveHelp::sveInc_imm<int16_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INCP_XP_B: {  // incp xdn, pm.b
-        results[0] = sveHelp::sveIncp_gpr<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INCP_XP_D: {  // incp xdn, pm.d
-        results[0] = sveHelp::sveIncp_gpr<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INCP_XP_H: {  // incp xdn, pm.h
-        results[0] = sveHelp::sveIncp_gpr<uint16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INCP_XP_S: {  // incp xdn, pm.s
-        results[0] = sveHelp::sveIncp_gpr<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INCW_XPiI: {  // incw xdn{, pattern{, #imm}}
-        results[0] =
-            sveHelp::sveInc_gprImm<int32_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INCW_ZPiI: {  // incw zdn.s{, pattern{, #imm}}
-        results[0] = sveHelp::sveInc_imm<int32_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_INDEX_II_B: {  // index zd.b, #imm, #imm
-        results[0] =
-            sveHelp::sveIndex<int8_t>(operands, metadata, VL_bits, true, true);
-        break;
-      }
-      case Opcode::AArch64_INDEX_II_D: {  // index zd.d, #imm, #imm
-        results[0] =
-            sveHelp::sveIndex<int64_t>(operands, metadata, VL_bits, true, true);
-        break;
-      }
-      case Opcode::AArch64_INDEX_II_H: {  // index zd.h, #imm, #imm
-        results[0] =
-            sveHelp::sveIndex<int16_t>(operands, metadata, VL_bits, true, true);
-        break;
-      }
-      case Opcode::AArch64_INDEX_II_S: {  // index zd.s, #imm, #imm
-        results[0] =
-            sveHelp::sveIndex<int32_t>(operands, metadata, VL_bits, true, true);
-        break;
-      }
-      case Opcode::AArch64_INDEX_IR_B: {  // index zd.b, #imm, wn
-        results[0] = sveHelp::sveIndex<int8_t, int32_t>(operands, metadata,
-                                                        VL_bits, true, false);
-        break;
-      }
-      case Opcode::AArch64_INDEX_IR_D: {  // index zd.d, #imm, xn
-        results[0] = sveHelp::sveIndex<int64_t, int64_t>(operands, metadata,
-                                                         VL_bits, true, false);
-        break;
-      }
-      case Opcode::AArch64_INDEX_IR_H: {  // index zd.h, #imm, wn
-        results[0] = sveHelp::sveIndex<int16_t, int32_t>(operands, metadata,
-                                                         VL_bits, true, false);
-        break;
-      }
-      case Opcode::AArch64_INDEX_IR_S: {  // index zd.s, #imm, wn
-        results[0] = sveHelp::sveIndex<int32_t, int32_t>(operands, metadata,
-                                                         VL_bits, true, false);
-        break;
-      }
-      case Opcode::AArch64_INDEX_RI_B: {  // index zd.b, wn, #imm
-        results[0] = sveHelp::sveIndex<int8_t, int32_t>(operands, metadata,
-                                                        VL_bits, false, true);
-        break;
-      }
-      case Opcode::AArch64_INDEX_RI_D: {  // index zd.d, xn, #imm
-        results[0] = sveHelp::sveIndex<int64_t, int64_t>(operands, metadata,
-                                                         VL_bits, false, true);
-        break;
-      }
-      case Opcode::AArch64_INDEX_RI_H: {  // index zd.h, wn, #imm
-        results[0] = sveHelp::sveIndex<int16_t, int32_t>(operands, metadata,
-                                                         VL_bits, false, true);
-        break;
-      }
-      case Opcode::AArch64_INDEX_RI_S: {  // index zd.s, wn, #imm
-        results[0] = sveHelp::sveIndex<int32_t, int32_t>(operands, metadata,
-                                                         VL_bits, false, true);
-        break;
-      }
-      case Opcode::AArch64_INDEX_RR_B: {  // index zd.b, wn, wm
-        results[0] = sveHelp::sveIndex<int8_t, int32_t>(operands, metadata,
-                                                        VL_bits, false, false);
-        break;
-      }
-      case Opcode::AArch64_INDEX_RR_D: {  // index zd.d, xn, xm
-        results[0] = sveHelp::sveIndex<int64_t, int64_t>(operands, metadata,
-                                                         VL_bits, false, false);
-        break;
-      }
-      case Opcode::AArch64_INDEX_RR_H: {  // index zd.h, wn, wm
-        results[0] = sveHelp::sveIndex<int16_t, int32_t>(operands, metadata,
-                                                         VL_bits, false, false);
-        break;
-      }
-      case Opcode::AArch64_INDEX_RR_S: {  // index zd.s, wn, wm
-        results[0] = sveHelp::sveIndex<int32_t, int32_t>(operands, metadata,
-                                                         VL_bits, false, false);
-        break;
-      }
-      case Opcode::AArch64_INSvi16gpr: {  // ins vd.h[index], wn
-        results[0] = neonHelp::vecInsIndex_gpr<uint16_t, uint32_t, 8>(operands,
-                                                                      metadata);
-        break;
-      }
-      case Opcode::AArch64_INSvi32gpr: {  // ins vd.s[index], wn
-        results[0] = neonHelp::vecInsIndex_gpr<uint32_t, uint32_t, 4>(operands,
-                                                                      metadata);
-        break;
-      }
-      case Opcode::AArch64_INSvi32lane: {  // ins vd.s[index1], vn.s[index2]
-        results[0] = neonHelp::vecIns_2Index<uint32_t, 4>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_INSvi64gpr: {  // ins vd.d[index], xn
-        results[0] = neonHelp::vecInsIndex_gpr<uint64_t, uint64_t, 2>(operands,
-                                                                      metadata);
-        break;
-      }
-      case Opcode::AArch64_INSvi64lane: {  // ins vd.d[index1], vn.d[index2]
-        results[0] = neonHelp::vecIns_2Index<uint64_t, 2>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_INSvi8gpr: {  // ins vd.b[index], wn
-        results[0] = neonHelp::vecInsIndex_gpr<uint8_t, uint32_t, 16>(operands,
-                                                                      metadata);
-        break;
-      }
-      case Opcode::AArch64_LD1B: {  // ld1b  {zt.b}, pg/z, [xn, xm]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 8;
-        uint16_t index = 0;
-        uint8_t out[256] = {0};
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << (i % 64);
-          if (p[i / 64] & shifted_active) {
-            out[i] = memoryData[index].get<uint8_t>();
-            index++;
-          } else {
-            out[i] = 0;
-          }
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1D: {  // ld1d  {zt.d}, pg/z, [xn, xm, lsl #3]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        uint64_t out[32] = {0};
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            out[i] = memoryData[index].get<uint64_t>();
-            index++;
-          } else {
-            out[i] = 0;
-          }
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1D_IMM_REAL: {  // ld1d  {zt.d}, pg/z, [xn{, #imm,
-                                             // mul vl}]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        uint64_t out[32] = {0};
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            out[i] = memoryData[index].get<uint64_t>();
-            index++;
-          } else {
-            out[i] = 0;
-          }
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1H: {  // ld1h  {zt.h}, pg/z, [xn, xm, lsl #1]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 16;
-        uint16_t index = 0;
-        uint16_t out[128] = {0};
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 32) * 2);
-          if (p[i / 32] & shifted_active) {
-            out[i] = memoryData[index].get<uint16_t>();
-            index++;
-          } else {
-            out[i] = 0;
-          }
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1Onev16b: {  // ld1 {vt.16b} [xn]
-        results[0] = memoryData[0].zeroExtend(memoryData[0].size(), 256);
-        break;
-      }
-      case Opcode::AArch64_LD1Onev16b_POST: {  // ld1 {vt.16b}, [xn], #imm
-        results[0] = memoryData[0].zeroExtend(memoryData[0].size(), 256);
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LD1RD_IMM: {  // ld1rd {zt.d}, pg/z, [xn, #imm]
-        // LOAD
-        const uint16_t partition_num = VL_bits / 64;
-        uint64_t out[32] = {0};
-        uint16_t index = 0;
-        // Check if any lanes are active, otherwise set all to 0 and break early
-        bool active = false;
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        for (int i = 0; i < 4; i++) {
-          if (p[i] != 0) {
-            active = true;
-            break;
-          }
-        }
-
-        if (active) {
-          uint64_t data = memoryData[0].get<uint64_t>();
-          for (int i = 0; i < partition_num; i++) {
-            uint64_t shifted_active = p[index / 8] & 1ull << ((index % 8) * 8);
-            out[i] = shifted_active ? data : 0;
-            index++;
-          }
-        }
-
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1RQ_D_IMM: {  // ld1rqd {zd.d}, pg/z, [xn{, #imm}]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-        uint64_t out[32] = {0};
-        uint16_t index = 0;
-
-        // Get mini-vector (quadword)
-        uint64_t mini[2] = {0};
-        for (int i = 0; i < 2; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            mini[i] = memoryData[index].get<uint64_t>();
-            index++;
-          }
-        }
-
-        // Duplicate mini-vector into output vector
-        for (int i = 0; i < (partition_num / 2); i++) {
-          out[2 * i] = mini[0];
-          out[(2 * i) + 1] = mini[1];
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1RW_IMM: {  // ld1rw {zt.s}, pg/z, [xn, #imm]
-        // LOAD
-        const uint16_t partition_num = VL_bits / 32;
-        uint32_t out[64] = {0};
-        uint16_t index = 0;
-        // Check if any lanes are active, otherwise set all to 0 and break early
-        bool active = false;
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        for (int i = 0; i < 4; i++) {
-          if (p[i] != 0) {
-            active = true;
-            break;
-          }
-        }
-        if (active) {
-          uint32_t data = memoryData[0].get<uint32_t>();
-          for (int i = 0; i < partition_num; i++) {
-            uint64_t shifted_active = p[index / 16] & 1ull
-                                                          << ((index % 16) * 4);
-            out[i] = shifted_active ? data : 0;
-            index++;
-          }
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1Rv16b: {  // ld1r {vt.16b}, [xn]
-        // LOAD
-        uint8_t val = memoryData[0].get<uint8_t>();
-        uint8_t out[16] = {val, val, val, val, val, val, val, val,
-                           val, val, val, val, val, val, val, val};
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1Rv16b_POST: {  // ld1r {vt.16b}, [xn], #imm
-        // LOAD
-        uint8_t val = memoryData[0].get<uint8_t>();
-        uint8_t out[16] = {val, val, val, val, val, val, val, val,
-                           val, val, val, val, val, val, val, val};
-        results[0] = {out, 256};
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LD1Rv1d: {  // ld1r {vt.1d}, [xn]
-        // LOAD
-        uint64_t val = memoryData[0].get<uint64_t>();
-        uint64_t out[2] = {val, 0};
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1Rv1d_POST: {  // ld1r {vt.1d}, [xn], #imm
-        // LOAD
-        uint64_t val = memoryData[0].get<uint64_t>();
-        uint64_t out[2] = {val, 0};
-        results[0] = {out, 256};
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LD1Rv2d: {  // ld1r {vt.2d}, [xn]
-        // LOAD
-        uint64_t val = memoryData[0].get<uint64_t>();
-        uint64_t out[2] = {val, val};
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1Rv2d_POST: {  // ld1r {vt.2d}, [xn], #imm
-        // LOAD
-        uint64_t val = memoryData[0].get<uint64_t>();
-        uint64_t out[2] = {val, val};
-        results[0] = {out, 256};
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LD1Rv2s: {  // ld1r {vt.2s}, [xn]
-        // LOAD
-        uint32_t val = memoryData[0].get<uint32_t>();
-        uint32_t out[4] = {val, val, 0, 0};
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1Rv2s_POST: {  // ld1r {vt.2s}, [xn], #imm
-        // LOAD
-        uint32_t val = memoryData[0].get<uint32_t>();
-        uint32_t out[4] = {val, val, 0, 0};
-        results[0] = {out, 256};
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LD1Rv4h: {  // ld1r {vt.4h}, [xn]
-        // LOAD
-        uint16_t val = memoryData[0].get<uint16_t>();
-        uint16_t out[8] = {val, val, val, val, 0, 0, 0, 0};
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1Rv4h_POST: {  // ld1r {vt.4h}, [xn], #imm
-        // LOAD
-        uint16_t val = memoryData[0].get<uint16_t>();
-        uint16_t out[8] = {val, val, val, val, 0, 0, 0, 0};
-        results[0] = {out, 256};
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LD1Rv4s: {  // ld1r {vt.4s}, [xn]
-        // LOAD
-        uint32_t val = memoryData[0].get<uint32_t>();
-        uint32_t out[4] = {val, val, val, val};
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1Rv4s_POST: {  // ld1r {vt.4s}, [xn], #imm
-        // LOAD
-        uint32_t val = memoryData[0].get<uint32_t>();
-        uint32_t out[4] = {val, val, val, val};
-        results[0] = {out, 256};
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LD1Rv8b: {  // ld1r {vt.8b}, [xn]
-        // LOAD
-        uint8_t val = memoryData[0].get<uint8_t>();
-        uint8_t out[16] = {val, val, val, val, val, val, val, val,
-                           0,   0,   0,   0,   0,   0,   0,   0};
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1Rv8b_POST: {  // ld1r {vt.8b}, [xn], #imm
-        // LOAD
-        uint8_t val = memoryData[0].get<uint8_t>();
-        uint8_t out[16] = {val, val, val, val, val, val, val, val,
-                           0,   0,   0,   0,   0,   0,   0,   0};
-        results[0] = {out, 256};
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LD1Rv8h: {  // ld1r {vt.8h}, [xn]
-        // LOAD
-        uint16_t val = memoryData[0].get<uint16_t>();
-        uint16_t out[8] = {val, val, val, val, val, val, val, val};
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1Rv8h_POST: {  // ld1r {vt.8h}, [xn], #imm
-        // LOAD
-        uint16_t val = memoryData[0].get<uint16_t>();
-        uint16_t out[8] = {val, val, val, val, val, val, val, val};
-        results[0] = {out, 256};
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LD1Twov16b: {  // ld1 {vt1.16b, vt2.16b}, [xn]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(memoryData[0].size(), 256);
-        results[1] = memoryData[1].zeroExtend(memoryData[1].size(), 256);
-        break;
-      }
-      case Opcode::AArch64_LD1Twov16b_POST: {  // ld1 {vt1.16b, vt2.16b}, [xn],
-                                               //   #imm
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(memoryData[0].size(), 256);
-        results[1] = memoryData[1].zeroExtend(memoryData[1].size(), 256);
-        results[2] = operands[0].get<uint64_t>() + metadata.operands[3].imm;
-        break;
-      }
-      case Opcode::AArch64_LD1W: {  // ld1w  {zt.s}, pg/z, [xn, xm, lsl #2]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 32;
-        uint16_t index = 0;
-        uint32_t out[64] = {0};
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 16) * 4);
-          if (p[i / 16] & shifted_active) {
-            out[i] = memoryData[index].get<uint32_t>();
-            index++;
-          } else {
-            out[i] = 0;
-          }
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1W_IMM_REAL: {  // ld1w  {zt.s}, pg/z, [xn{, #imm,
-                                             // mul vl}]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 32;
-        uint16_t index = 0;
-        uint32_t out[64] = {0};
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 16) * 4);
-          if (p[i / 16] & shifted_active) {
-            out[i] = memoryData[index].get<uint32_t>();
-            index++;
-          } else {
-            out[i] = 0;
-          }
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1i32: {  // ld1 {vt.s}[index], [xn]
-        // LOAD
-        const int index = metadata.operands[0].vector_index;
-        const uint32_t* vt = operands[0].getAsVector<uint32_t>();
-        uint32_t out[4];
-        for (int i = 0; i < 4; i++) {
-          out[i] = (i == index) ? memoryData[0].get<uint32_t>() : vt[i];
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1i64: {  // ld1 {vt.d}[index], [xn]
-        // LOAD
-        const int index = metadata.operands[0].vector_index;
-        const uint64_t* vt = operands[0].getAsVector<uint64_t>();
-        uint64_t out[2];
-        for (int i = 0; i < 2; i++) {
-          out[i] = (i == index) ? memoryData[0].get<uint64_t>() : vt[i];
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LD1i64_POST: {  // ld1 {vt.d}[index], [xn], #8
-        // LOAD
-        const int index = metadata.operands[0].vector_index;
-        const uint64_t* vt = operands[0].getAsVector<uint64_t>();
-        uint64_t out[2];
-        for (int i = 0; i < 2; i++) {
-          out[i] = (i == index) ? memoryData[0].get<uint64_t>() : vt[i];
-        }
-        results[0] = {out, 256};
-        results[1] = operands[1].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LD2D:  // ld2d {zt1.d, zt2.d}, pg/z, [<xn|sp>, xm,
-                                  // lsl #3]
-      case Opcode::AArch64_LD2D_IMM: {  // ld2d {zt1.d, zt2.d}, pg/z, [<xn|sp>{,
-                                        // #imm, mul vl}]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        uint64_t out1[32] = {0};
-        uint64_t out2[32] = {0};
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            out1[i] = memoryData[index].get<uint64_t>();
-            index++;
-            out2[i] = memoryData[index].get<uint64_t>();
-            index++;
-          } else {
-            out1[i] = 0;
-            out2[i] = 0;
-          }
-        }
-        results[0] = {out1, 256};
-        results[1] = {out2, 256};
-        break;
-      }
-      case Opcode::AArch64_LD2Twov4s: {  // ld2 {vt1.4s, vt2.4s} [xn]
-        const float* region1 = memoryData[0].getAsVector<float>();
-        const float* region2 = memoryData[1].getAsVector<float>();
-
-        // LD2 multistruct uses de-interleaving
-        float t1[4] = {region1[0], region1[2], region2[0], region2[2]};
-        float t2[4] = {region1[1], region1[3], region2[1], region2[3]};
-        results[0] = {t1, 256};
-        results[1] = {t2, 256};
-        break;
-      }
-      case Opcode::AArch64_LD2Twov4s_POST: {  // ld2 {vt1.4s, vt2.4s}, [xn],
-                                              // #imm
-        // LOAD
-        const float* region1 = memoryData[0].getAsVector<float>();
-        const float* region2 = memoryData[1].getAsVector<float>();
-        float t1[4] = {region1[0], region1[2], region2[0], region2[2]};
-        float t2[4] = {region1[1], region1[3], region2[1], region2[3]};
-        results[0] = {t1, 256};
-        results[1] = {t2, 256};
-        uint64_t offset = 32;
-        if (metadata.operandCount == 4) {
-          offset = operands[3].get<uint64_t>();
-        }
-        results[2] = operands[2].get<uint64_t>() + offset;
-        break;
-      }
-      case Opcode::AArch64_LD3D_IMM: {  // ld3d {zt1.d, zt2.d, zt3.d}, pg/z,
-                                        // [xn|sp{, #imm, MUL VL}]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        uint64_t out1[32] = {0};
-        uint64_t out2[32] = {0};
-        uint64_t out3[32] = {0};
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            out1[i] = memoryData[index].get<uint64_t>();
-            index++;
-            out2[i] = memoryData[index].get<uint64_t>();
-            index++;
-            out3[i] = memoryData[index].get<uint64_t>();
-            index++;
-          } else {
-            out1[i] = 0;
-            out2[i] = 0;
-            out3[i] = 0;
-          }
-        }
-        results[0] = {out1, 256};
-        results[1] = {out2, 256};
-        results[2] = {out3, 256};
-        break;
-      }
-      case Opcode::AArch64_LD4D_IMM: {  // ld4d {zt1.d, zt2.d, zt3.d, zt4.d},
-                                        // pg/z, [xn|sp{, #imm, MUL VL}]
-        // LOAD
-        const uint64_t* p = operands[0].getAsVector<uint64_t>();
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        uint64_t out1[32] = {0};
-        uint64_t out2[32] = {0};
-        uint64_t out3[32] = {0};
-        uint64_t out4[32] = {0};
-
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            out1[i] = memoryData[index].get<uint64_t>();
-            index++;
-            out2[i] = memoryData[index].get<uint64_t>();
-            index++;
-            out3[i] = memoryData[index].get<uint64_t>();
-            index++;
-            out4[i] = memoryData[index].get<uint64_t>();
-            index++;
-          } else {
-            out1[i] = 0;
-            out2[i] = 0;
-            out3[i] = 0;
-            out4[i] = 0;
-          }
-        }
-
-        results[0] = {out1, 256};
-        results[1] = {out2, 256};
-        results[2] = {out3, 256};
-        results[3] = {out4, 256};
-        break;
-      }
-      case Opcode::AArch64_LDADDLW:  // ldaddl ws, wt, [xn]
-        // LOAD
-        [[fallthrough]];
-      case Opcode::AArch64_LDADDW: {  // ldadd ws, wt, [xn]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 8);
-        memoryData[0] = RegisterValue(
-            memoryData[0].get<uint32_t>() + operands[0].get<uint32_t>(), 4);
-        break;
-      }
-      case Opcode::AArch64_LDARB: {  // ldarb wt, [xn]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(1, 8);
-        break;
-      }
-      case Opcode::AArch64_LDARW: {  // ldar wt, [xn]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDARX: {  // ldar xt, [xn]
-        // LOAD
-        results[0] = memoryData[0];
-        break;
-      }
-      case Opcode::AArch64_LDAXRW: {  // ldaxr wd, [xn]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDAXRX: {  // ldaxr xd, [xn]
-        // LOAD
-        results[0] = memoryData[0];
-        break;
-      }
-      case Opcode::AArch64_LDNPSi: {  // ldnp st1, st2, [xn, #imm]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 256);
-        results[1] = memoryData[1].zeroExtend(4, 256);
-        break;
-      }
-      case Opcode::AArch64_LDPDi:    // ldp dt1, dt2, [xn, #imm]
-      case Opcode::AArch64_LDPQi:    // ldp qt1, qt2, [xn, #imm]
-      case Opcode::AArch64_LDPSi:    // ldp st1, st2, [xn, #imm]
-      case Opcode::AArch64_LDPWi:    // ldp wt1, wt2, [xn, #imm]
-      case Opcode::AArch64_LDPXi: {  // ldp xt1, xt2, [xn, #imm]
-        uint16_t regSize =
-            (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
-        results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
-        results[1] = memoryData[1].zeroExtend(dataSize_, regSize);
-        break;
-      }
-      case Opcode::AArch64_LDPDpost:    // ldp dt1, dt2, [xn], #imm
-      case Opcode::AArch64_LDPQpost:    // ldp qt1, qt2, [xn], #imm
-      case Opcode::AArch64_LDPSpost:    // ldp st1, st2, [xn], #imm
-      case Opcode::AArch64_LDPWpost:    // ldp wt1, wt2, [xn], #imm
-      case Opcode::AArch64_LDPXpost: {  // ldp xt1, xt2, [xn], #imm
-        uint16_t regSize =
-            (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
-        results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
-        results[1] = memoryData[1].zeroExtend(dataSize_, regSize);
-        results[2] = operands[0].get<uint64_t>() + metadata.operands[3].imm;
-        break;
-      }
-      case Opcode::AArch64_LDPDpre:    // ldp dt1, dt2, [xn, #imm]!
-      case Opcode::AArch64_LDPQpre:    // ldp qt1, qt2, [xn, #imm]!
-      case Opcode::AArch64_LDPSpre:    // ldp st1, st2, [xn, #imm]!
-      case Opcode::AArch64_LDPWpre:    // ldp wt1, wt2, [xn, #imm]!
-      case Opcode::AArch64_LDPXpre: {  // ldp xt1, xt2, [xn, #imm]!
-        uint16_t regSize =
-            (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
-        results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
-        results[1] = memoryData[1].zeroExtend(dataSize_, regSize);
-        results[2] =
-            operands[0].get<uint64_t>() + metadata.operands[2].mem.disp;
-        break;
-      }
-      case Opcode::AArch64_LDPSWi: {  // ldpsw xt1, xt2, [xn {, #imm}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 8);
-        results[1] = memoryData[1].zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRBBpost: {  // ldrb wt, [xn], #imm
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(1, 8);
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LDRBBpre: {  // ldrb wt, [xn, #imm]!
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(1, 8);
-        results[1] =
-            operands[0].get<uint64_t>() + metadata.operands[1].mem.disp;
-        break;
-      }
-      case Opcode::AArch64_LDRBBroW: {  // ldrb wt,
-                                        //  [xn, wm{, extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(1, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRBBroX: {  // ldrb wt,
-                                        //  [xn, xm{, extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(1, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRBBui: {  // ldrb wt, [xn, #imm]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(1, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRBui:    // ldr bt, [xn, #imm]
-      case Opcode::AArch64_LDRDui:    // ldr dt, [xn, #imm]
-      case Opcode::AArch64_LDRHui:    // ldr ht, [xn, #imm]
-      case Opcode::AArch64_LDRQui:    // ldr qt, [xn, #imm]
-      case Opcode::AArch64_LDRSui:    // ldr st, [xn, #imm]
-      case Opcode::AArch64_LDRWui:    // ldr wt, [xn, #imm]
-      case Opcode::AArch64_LDRXui: {  // ldr xt, [xn, #imm]
-        uint16_t regSize =
-            (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
-        results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
-        break;
-      }
-      case Opcode::AArch64_LDRBpost:    // ldr bt, [xn], #imm
-      case Opcode::AArch64_LDRDpost:    // ldr dt, [xn], #imm
-      case Opcode::AArch64_LDRHpost:    // ldr ht, [xn], #imm
-      case Opcode::AArch64_LDRQpost:    // ldr qt, [xn], #imm
-      case Opcode::AArch64_LDRSpost:    // ldr st, [xn], #imm
-      case Opcode::AArch64_LDRWpost:    // ldr wt, [xn], #imm
-      case Opcode::AArch64_LDRXpost: {  // ldr xt, [xn], #imm
-        uint16_t regSize =
-            (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
-        results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LDRBpre:    // ldr bt, [xn, #imm]!
-      case Opcode::AArch64_LDRDpre:    // ldr dt, [xn, #imm]!
-      case Opcode::AArch64_LDRHpre:    // ldr ht, [xn, #imm]!
-      case Opcode::AArch64_LDRQpre:    // ldr qt, [xn, #imm]!
-      case Opcode::AArch64_LDRSpre:    // ldr st, [xn, #imm]!
-      case Opcode::AArch64_LDRWpre:    // ldr wt, [xn, #imm]!
-      case Opcode::AArch64_LDRXpre: {  // ldr xt, [xn, #imm]!
-        uint16_t regSize =
-            (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
-        results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
-        results[1] =
-            operands[0].get<uint64_t>() + metadata.operands[1].mem.disp;
-        break;
-      }
-      case Opcode::AArch64_LDRDroW: {  // ldr dt, [xn, wm, {extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(memoryAddresses[0].size, 256);
-        break;
-      }
-      case Opcode::AArch64_LDRDroX: {  // ldr dt, [xn, xm, {extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(memoryAddresses[0].size, 256);
-        break;
-      }
-      case Opcode::AArch64_LDRHHpost: {  // ldrh wt, [xn], #imm
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(2, 8);
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LDRHHpre: {  // ldrh wt, [xn, #imm]!
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(2, 8);
-        results[1] =
-            operands[0].get<uint64_t>() + metadata.operands[1].mem.disp;
-        break;
-      }
-      case Opcode::AArch64_LDRHHroW: {  // ldrh wt, [xn, wm, {extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(2, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRHHroX: {  // ldrh wt, [xn, xm, {extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(2, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRHHui: {  // ldrh wt, [xn, #imm]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(2, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRQroX: {  // ldr qt, [xn, xm, {extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(16, 256);
-        break;
-      }
-      case Opcode::AArch64_LDRSBWroX: {  // ldrsb wt, [xn, xm{, extend
-                                         // {#amount}}]
-        // LOAD
-        results[0] =
-            RegisterValue(static_cast<int32_t>(memoryData[0].get<int8_t>()), 4)
-                .zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRSBWui: {  // ldrsb wt, [xn, #imm]
-        // LOAD
-        results[0] =
-            RegisterValue(static_cast<int32_t>(memoryData[0].get<int8_t>()))
-                .zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRSBXui: {  // ldrsb xt, [xn, #imm]
-        // LOAD
-        results[0] = static_cast<int64_t>(memoryData[0].get<int8_t>());
-        break;
-      }
-      case Opcode::AArch64_LDRSHWroW: {  // ldrsh wt, [xn, wm{, extend
-                                         // {#amount}}]
-        // LOAD
-        results[0] =
-            RegisterValue(static_cast<int32_t>(memoryData[0].get<int16_t>()), 4)
-                .zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRSHWroX: {  // ldrsh wt, [xn, xm{, extend
-                                         // {#amount}}]
-        // LOAD
-        results[0] =
-            RegisterValue(static_cast<int32_t>(memoryData[0].get<int16_t>()), 4)
-                .zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRSHWui: {  // ldrsh wt, [xn, #imm]
-        // LOAD
-        results[0] =
-            RegisterValue(static_cast<int32_t>(memoryData[0].get<int16_t>()), 4)
-                .zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRSHXroW: {  // ldrsh xt, [xn, wm{, extend
-                                         // {#amount}}]
-        // LOAD
-        results[0] = static_cast<int64_t>(memoryData[0].get<int16_t>());
-        break;
-      }
-      case Opcode::AArch64_LDRSHXroX: {  // ldrsh xt, [xn, xm{, extend
-                                         // {#amount}}]
-        // LOAD
-        results[0] = static_cast<int64_t>(memoryData[0].get<int16_t>());
-        break;
-      }
-      case Opcode::AArch64_LDRSHXui: {  // ldrsh xt, [xn, #imm]
-        // LOAD
-        results[0] = static_cast<int64_t>(memoryData[0].get<int16_t>());
-        break;
-      }
-      case Opcode::AArch64_LDRSWl: {  // ldrsw xt, #imm
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRSWpost: {  // ldrsw xt, [xn], #simm
-        // LOAD
-        results[0] = static_cast<int64_t>(memoryData[0].get<int32_t>());
-        results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_LDRSWroX: {  // ldrsw xt, [xn, xm{, extend
-                                        // {#amount}}]
-        // LOAD
-        results[0] = static_cast<int64_t>(memoryData[0].get<int32_t>());
-        break;
-      }
-      case Opcode::AArch64_LDRSWui: {  // ldrsw xt, [xn{, #pimm}]
-        // LOAD
-        results[0] = static_cast<int64_t>(memoryData[0].get<int32_t>());
-        break;
-      }
-      case Opcode::AArch64_LDRSroW: {  // ldr st, [xn, wm, {extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 256);
-        break;
-      }
-      case Opcode::AArch64_LDRSroX: {  // ldr st, [xn, xm, {extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 256);
-        break;
-      }
-      case Opcode::AArch64_LDRWroW: {  // ldr wt, [xn, wm, {extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRWroX: {  // ldr wt, [xn, xm, {extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDRXl: {  // ldr xt, #imm
-        // LOAD
-        results[0] = memoryData[0];
-        break;
-      }
-      case Opcode::AArch64_LDRXroW: {  // ldr xt, [xn, wn{, extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0];
-        break;
-      }
-      case Opcode::AArch64_LDRXroX: {  // ldr xt, [xn, xn{, extend {#amount}}]
-        // LOAD
-        results[0] = memoryData[0];
-        break;
-      }
-      case Opcode::AArch64_LDR_PXI: {  // ldr pt, [xn{, #imm, mul vl}]
-        // LOAD
-        const uint64_t PL_bits = VL_bits / 8;
-        const uint16_t partition_num = PL_bits / 8;
-
-        uint64_t out[4] = {0};
-        for (int i = 0; i < partition_num; i++) {
-          uint8_t data = memoryData[i].get<uint8_t>();
-          for (int j = 0; j < 8; j++) {
-            out[i / 8] |= (data & (1 << j)) ? 1ull << ((j + (i * 8)) % 64) : 0;
-          }
-        }
-        results[0] = out;
-        break;
-      }
-      case Opcode::AArch64_LDR_ZXI: {  // ldr zt, [xn{, #imm, mul vl}]
-        // LOAD
-        const uint16_t partition_num = VL_bits / 8;
-        uint8_t out[256] = {0};
-
-        for (int i = 0; i < partition_num; i++) {
-          out[i] = memoryData[i].get<uint8_t>();
-        }
-        results[0] = {out, 256};
-        break;
-      }
-      case Opcode::AArch64_LDTRSBXi: {  // ldtrsb xt, [xn, #imm]
-        // LOAD
-        // TODO: implement
-        results[0] = RegisterValue(0, 8);
-        break;
-      }
-      case Opcode::AArch64_LDURBBi: {  // ldurb wt, [xn, #imm]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(1, 8);
-        break;
-      }
-      case Opcode::AArch64_LDURDi: {  // ldur dt, [xn, #imm]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(8, 256);
-        break;
-      }
-      case Opcode::AArch64_LDURHHi: {  // ldurh wt, [xn, #imm]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(2, 8);
-        break;
-      }
-      case Opcode::AArch64_LDURQi: {  // ldur qt, [xn, #imm]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(16, 256);
-        break;
-      }
-      case Opcode::AArch64_LDURSWi: {  // ldursw xt, [xn, #imm]
-        // LOAD
-        results[0] = static_cast<int64_t>(memoryData[0].get<int32_t>());
-        break;
-      }
-      case Opcode::AArch64_LDURSi: {  // ldur sd, [<xn|sp>{, #imm}]
-        // LOAD
-        results[0] = {memoryData[0].get<float>(), 256};
-        break;
-      }
-      case Opcode::AArch64_LDURWi: {  // ldur wt, [xn, #imm]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDURXi: {  // ldur xt, [xn, #imm]
-        // LOAD
-        results[0] = memoryData[0];
-        break;
-      }
-      case Opcode::AArch64_LDXRW: {  // ldxr wt, [xn]
-        // LOAD
-        results[0] = memoryData[0].zeroExtend(4, 8);
-        break;
-      }
-      case Opcode::AArch64_LDXRX: {  // ldxr xt, [xn]
-        // LOAD
-        results[0] = memoryData[0];
-        break;
-      }
-      case Opcode::AArch64_LSLVWr: {  // lslv wd, wn, wm
-        results[0] = {
-            logicalHelp::logicalShiftLR_3ops<uint32_t>(operands, true), 8};
-        break;
-      }
-      case Opcode::AArch64_LSLVXr: {  // lslv xd, xn, xm
-        results[0] = logicalHelp::logicalShiftLR_3ops<uint64_t>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_LSL_ZZI_S: {  // lsl zd.s, zn.s, #imm
-        results[0] = sveHelp::sveLsl_imm<uint32_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_LSRVWr: {  // lsrv wd, wn, wm
-        results[0] = {
-            logicalHelp::logicalShiftLR_3ops<uint32_t>(operands, false), 8};
-        break;
-      }
-      case Opcode::AArch64_LSRVXr: {  // lsrv xd, xn, xm
-        results[0] =
-            logicalHelp::logicalShiftLR_3ops<uint64_t>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_MADDWrrr: {  // madd wd, wn, wm, wa
-        results[0] = {multiplyHelp::madd_4ops<uint32_t>(operands), 8};
-        break;
-      }
-      case Opcode::AArch64_MADDXrrr: {  // madd xd, xn, xm, xa
-        results[0] = multiplyHelp::madd_4ops<uint64_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_MLA_ZPmZZ_B: {  // mla zda.b, pg/m, zn.b, zm.b
-        results[0] = sveHelp::sveMlaPredicated_vecs<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_MLA_ZPmZZ_D: {  // mla zda.d, pg/m, zn.d, zm.d
-        results[0] =
-            sveHelp::sveMlaPredicated_vecs<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_MLA_ZPmZZ_H: {  // mla zda.h, pg/m, zn.h, zm.h
-        results[0] =
-            sveHelp::sveMlaPredicated_vecs<uint16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_MLA_ZPmZZ_S: {  // mla zda.s, pg/m, zn.s, zm.s
-        results[0] =
-            sveHelp::sveMlaPredicated_vecs<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_MOVID: {  // movi dd, #imm
-        results[0] = {static_cast<uint64_t>(metadata.operands[1].imm), 256};
-        break;
-      }
-      case Opcode::AArch64_MOVIv16b_ns: {  // movi vd.16b, #imm
-        results[0] = neonHelp::vecMovi_imm<uint8_t, 16>(metadata);
-        break;
-      }
-      case Opcode::AArch64_MOVIv2d_ns: {  // movi vd.2d, #imm
-        results[0] = neonHelp::vecMovi_imm<uint64_t, 2>(metadata);
-        break;
-      }
-      case Opcode::AArch64_MOVIv2i32: {  // movi vd.2s, #imm{, lsl #shift}
-        results[0] = neonHelp::vecMoviShift_imm<uint32_t, 2>(metadata, false);
-        break;
-      }
-      case Opcode::AArch64_MOVIv4i32: {  // movi vd.4s, #imm{, LSL #shift}
-        results[0] = neonHelp::vecMoviShift_imm<uint32_t, 4>(metadata, false);
-        break;
-      }
-      case Opcode::AArch64_MOVIv8b_ns: {  // movi vd.8b, #imm
-        results[0] = neonHelp::vecMovi_imm<uint8_t, 8>(metadata);
-        break;
-      }
-      case Opcode::AArch64_MOVKWi: {  // movk wd, #imm
-        results[0] = {
-            arithmeticHelp::movkShift_imm<uint32_t>(operands, metadata), 8};
-        break;
-      }
-      case Opcode::AArch64_MOVKXi: {  // movk xd, #imm
-        results[0] =
-            arithmeticHelp::movkShift_imm<uint64_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_MOVNWi: {  // movn wd, #imm{, LSL #shift}
-        results[0] = {arithmeticHelp::movnShift_imm<uint32_t>(
-                          metadata, [](uint64_t x) -> uint32_t { return ~x; }),
-                      8};
-        break;
-      }
-      case Opcode::AArch64_MOVNXi: {  // movn xd, #imm{, LSL #shift}
-        results[0] = arithmeticHelp::movnShift_imm<uint64_t>(
-            metadata, [](uint64_t x) -> uint64_t { return ~x; });
-        break;
-      }
-      case Opcode::AArch64_MOVPRFX_ZPmZ_D: {  // movprfx zd.d, pg/m, zn.d
-        results[0] = sveHelp::sveMovprfxPredicated_destUnchanged<uint64_t>(
-            operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_MOVPRFX_ZPzZ_D: {  // movprfx zd.d, pg/z, zn.d
-        results[0] = sveHelp::sveMovprfxPredicated_destToZero<uint64_t>(
-            operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_MOVPRFX_ZPzZ_S: {  // movprfx zd.s, pg/z, zn.s
-        results[0] = sveHelp::sveMovprfxPredicated_destToZero<uint32_t>(
-            operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_MOVPRFX_ZZ: {  // movprfx zd, zn
-        // TODO: Adopt hint logic of the MOVPRFX instruction
-        results[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_MOVZWi: {  // movz wd, #imm
-        results[0] = {arithmeticHelp::movnShift_imm<uint32_t>(
-                          metadata, [](uint64_t x) -> uint32_t { return x; }),
-                      8};
-        break;
-      }
-      case Opcode::AArch64_MOVZXi: {  // movz xd, #imm
-        results[0] = arithmeticHelp::movnShift_imm<uint64_t>(
-            metadata, [](uint64_t x) -> uint64_t { return x; });
-        break;
-      }
-      case Opcode::AArch64_MRS: {  // mrs xt, (systemreg|Sop0_op1_Cn_Cm_op2)
-        results[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_MSR: {  // mrs (systemreg|Sop0_op1_Cn_Cm_op2), xt
-        results[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_MSUBWrrr: {  // msub wd, wn, wm, wa
-        results[0] = {multiplyHelp::msub_4ops<uint32_t>(operands), 8};
-        break;
-      }
-      case Opcode::AArch64_MSUBXrrr: {  // msub xd, xn, xm, xa
-        results[0] = multiplyHelp::msub_4ops<uint64_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_MUL_ZPmZ_B: {  // mul zdn.b, pg/m, zdn.b, zm.b
-        results[0] = sveHelp::sveMulPredicated<uint8_t>(operands, metadata,
-                                                        VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_MUL_ZPmZ_D: {  // mul zdn.d, pg/m, zdn.d, zm.d
-        results[0] = sveHelp::sveMulPredicated<uint64_t>(operands, metadata,
-                                                         VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_MUL_ZPmZ_H: {  // mul zdn.h, pg/m, zdn.h, zm.h
-        results[0] = sveHelp::sveMulPredicated<uint16_t>(operands, metadata,
-                                                         VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_MUL_ZPmZ_S: {  // mul zdn.s, pg/m, zdn.s, zm.s
-        results[0] = sveHelp::sveMulPredicated<uint32_t>(operands, metadata,
-                                                         VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_MVNIv2i32: {  // mvni vd.2s, #imm{, lsl #shift}
-        results[0] = neonHelp::vecMoviShift_imm<uint32_t, 2>(metadata, true);
-        break;
-      }
-      case Opcode::AArch64_MVNIv2s_msl: {  // mvni vd.2s, #imm, msl #amount
-        results[0] = neonHelp::vecMoviShift_imm<uint32_t, 2>(metadata, true);
-        break;
-      }
-      case Opcode::AArch64_MVNIv4i16: {  // mvni vd.4h, #imm{, lsl #shift}
-        results[0] = neonHelp::vecMoviShift_imm<uint16_t, 4>(metadata, true);
-        break;
-      }
-      case Opcode::AArch64_MVNIv4i32: {  // mvni vd.4s, #imm{, lsl #shift}
-        results[0] = neonHelp::vecMoviShift_imm<uint32_t, 4>(metadata, true);
-        break;
-      }
-      case Opcode::AArch64_MVNIv4s_msl: {  // mvni vd.4s #imm, msl #amount
-        results[0] = neonHelp::vecMoviShift_imm<uint32_t, 4>(metadata, true);
-        break;
-      }
-      case Opcode::AArch64_MVNIv8i16: {  // mvni vd.8h, #imm{, lsl #shift}
-        results[0] = neonHelp::vecMoviShift_imm<uint16_t, 8>(metadata, true);
-        break;
-      }
-      case Opcode::AArch64_NEGv2i64: {  // neg vd.2d, vn.2d
-        results[0] = neonHelp::vecFneg_2ops<int64_t, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_NOTv16i8: {  // not vd.16b, vn.16b
-        results[0] = neonHelp::vecLogicOp_2vecs<uint8_t, 16>(
-            operands, [](uint8_t x) -> uint8_t { return ~x; });
-        break;
-      }
-      case Opcode::AArch64_NOTv8i8: {  // not vd.8b, vn.8b
-        results[0] = neonHelp::vecLogicOp_2vecs<uint8_t, 8>(
-            operands, [](uint8_t x) -> uint8_t { return ~x; });
-        break;
-      }
-      case Opcode::AArch64_ORNWrs: {  // orn wd, wn, wm{, shift{ #amount}}
-        auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint32_t>(
-            operands, metadata, false,
-            [](uint32_t x, uint32_t y) -> uint32_t { return x | (~y); });
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ORNXrs: {  // orn xd, xn, xm{, shift{ #amount}}
-        auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint64_t>(
-            operands, metadata, false,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x | (~y); });
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_ORRWri: {  // orr wd, wn, #imm
-        auto [result, nzcv] = logicalHelp::logicOp_imm<uint32_t>(
-            operands, metadata, false,
-            [](uint32_t x, uint32_t y) -> uint32_t { return x | y; });
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ORRWrs: {  // orr wd, wn, wm{, shift{ #amount}}
-        results[0] = {
-            comparisonHelp::orrShift_3ops<uint32_t>(operands, metadata), 8};
-        break;
-      }
-      case Opcode::AArch64_ORRXri: {  // orr xd, xn, #imm
-        auto [result, nzcv] = logicalHelp::logicOp_imm<uint64_t>(
-            operands, metadata, false,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x | y; });
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_ORRXrs: {  // orr xd, xn, xm{, shift{ #amount}}
-        results[0] =
-            comparisonHelp::orrShift_3ops<uint64_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_ORR_PPzPP: {  // orr pd.b, pg/z, pn.b, pm.b
-        results[0] = sveHelp::sveLogicOp_preds<uint8_t>(
-            operands, VL_bits,
-            [](uint64_t x, uint64_t y) -> uint64_t { return x | y; });
-        break;
-      }
-      case Opcode::AArch64_ORR_ZZZ: {  // orr zd.d, zn.d, zm.d
-        results[0] = sveHelp::sveOrr_3vecs<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_ORRv16i8: {  // orr vd.16b, Vn.16b, Vm.16b
-        results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 16>(
-            operands, [](uint8_t x, uint8_t y) -> uint8_t { return x | y; });
-        break;
-      }
-      case Opcode::AArch64_ORRv8i8: {  // orr vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 8>(
-            operands, [](uint8_t x, uint8_t y) -> uint8_t { return x | y; });
-        break;
-      }
-      case Opcode::AArch64_PFALSE: {  // pfalse pd.b
-        uint64_t out[4] = {0, 0, 0, 0};
-        results[0] = out;
-        break;
-      }
-      case Opcode::AArch64_PRFMui: {  // prfm op, [xn, xm{, extend{, #amount}}]
-        break;
-      }
-      case Opcode::AArch64_PTEST_PP: {  // ptest pg, pn.b
-        const uint64_t* g = operands[0].getAsVector<uint64_t>();
-        const uint64_t* s = operands[1].getAsVector<uint64_t>();
-        std::array<uint64_t, 4> masked_n = {(g[0] & s[0]), (g[1] & s[1]),
-                                            (g[2] & s[2]), (g[3] & s[3])};
-        // Byte count = 1 as destination predicate is regarding single bytes.
-        results[0] = AuxFunc::getNZCVfromPred(masked_n, VL_bits, 1);
-        break;
-      }
-      case Opcode::AArch64_PTRUE_B: {  // ptrue pd.b{, pattern}
-        results[0] = sveHelp::svePtrue<uint8_t>(metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_PTRUE_D: {  // ptrue pd.d{, pattern}
-        results[0] = sveHelp::svePtrue<uint64_t>(metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_PTRUE_H: {  // ptrue pd.h{, pattern}
-        results[0] = sveHelp::svePtrue<uint16_t>(metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_PTRUE_S: {  // ptrue pd.s{, pattern}
-        results[0] = sveHelp::svePtrue<uint32_t>(metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_PUNPKHI_PP: {  // punpkhi pd.h, pn.b
-        results[0] = sveHelp::svePunpk(operands, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_PUNPKLO_PP: {  // punpklo pd.h, pn.b
-        results[0] = sveHelp::svePunpk(operands, VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_RBITWr: {  // rbit wd, wn
-        results[0] = {bitmanipHelp::rbit<uint32_t>(operands, metadata), 8};
-        break;
-      }
-      case Opcode::AArch64_RBITXr: {  // rbit xd, xn
-        results[0] = bitmanipHelp::rbit<uint64_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_RDVLI_XI: {  // rdvl xd, #imm
-        int8_t imm = static_cast<int8_t>(metadata.operands[1].imm);
-        results[0] = (uint64_t)(imm * (VL_bits / 8));
-        break;
-      }
-      case Opcode::AArch64_RET: {  // ret {xr}
-        branchTaken_ = true;
-        branchAddress_ = operands[0].get<uint64_t>();
-        break;
-      }
-      case Opcode::AArch64_REV16v16i8: {  // rev16 Vd.16b, Vn.16b
-        results[0] = neonHelp::vecRev<int8_t, 16, 16>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV16v8i8: {  // rev16 Vd.8b, Vn.8b
-        results[0] = neonHelp::vecRev<int8_t, 16, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV32v16i8: {  // rev32 Vd.16b, Vn.16b
-        results[0] = neonHelp::vecRev<int8_t, 32, 16>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV32v4i16: {  // rev32 Vd.4h, Vn.4h
-        results[0] = neonHelp::vecRev<int16_t, 32, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV32v8i16: {  // rev32 Vd.8h, Vn.8h
-        results[0] = neonHelp::vecRev<int16_t, 32, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV32v8i8: {  // rev32 Vd.8b, Vn.8b
-        results[0] = neonHelp::vecRev<int8_t, 32, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV64v16i8: {  // rev64 Vd.16b, Vn.16b
-        results[0] = neonHelp::vecRev<int8_t, 64, 16>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV64v2i32: {  // rev64 Vd.2s, Vn.2s
-        results[0] = neonHelp::vecRev<int32_t, 64, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV64v4i16: {  // rev64 Vd.4h, Vn.4h
-        results[0] = neonHelp::vecRev<int16_t, 64, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV64v4i32: {  // rev64 Vd.4s, Vn.4s
-        results[0] = neonHelp::vecRev<int32_t, 64, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV64v8i16: {  // rev64 Vd.8h, Vn.8h
-        results[0] = neonHelp::vecRev<int16_t, 64, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV64v8i8: {  // rev64 Vd.8b Vn.8b
-        results[0] = neonHelp::vecRev<int8_t, 64, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_REVXr: {  // rev xd, xn
-        results[0] = bitmanipHelp::rev<uint64_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_REV_PP_B: {  // rev pd.b, pn.b
-        results[0] = sveHelp::sveRev_predicates<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_REV_PP_D: {  // rev pd.d, pn.d
-        results[0] = sveHelp::sveRev_predicates<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_REV_PP_H: {  // rev pd.h, pn.h
-        results[0] = sveHelp::sveRev_predicates<uint16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_REV_PP_S: {  // rev pd.s, pn.s
-        results[0] = sveHelp::sveRev_predicates<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_REV_ZZ_B: {  // rev zd.b, zn.b
-        results[0] = sveHelp::sveRev_vecs<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_REV_ZZ_D: {  // rev zd.d, zn.d
-        results[0] = sveHelp::sveRev_vecs<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_REV_ZZ_H: {  // rev zd.h, zn.h
-        results[0] = sveHelp::sveRev_vecs<uint16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_REV_ZZ_S: {  // rev zd.s, zn.s
-        results[0] = sveHelp::sveRev_vecs<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_RORVWr: {  // rorv wd, wn, wm
-        results[0] = {logicalHelp::rorv_3ops<uint32_t>(operands), 8};
-        break;
-      }
-      case Opcode::AArch64_RORVXr: {  // rorv xd, xn, xm
-        results[0] = logicalHelp::rorv_3ops<uint64_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_SBCWr: {  // sbc wd, wn, wm
-        results[0] = {arithmeticHelp::sbc<uint32_t>(operands), 8};
-        break;
-      }
-      case Opcode::AArch64_SBCXr: {  // sbc xd, xn, xm
-        results[0] = arithmeticHelp::sbc<uint64_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_SBFMWri: {  // sbfm wd, wn, #immr, #imms
-        results[0] = {
-            bitmanipHelp::bfm_2imms<uint32_t>(operands, metadata, true, true),
-            8};
-        break;
-      }
-      case Opcode::AArch64_SBFMXri: {  // sbfm xd, xn, #immr, #imms
-        results[0] =
-            bitmanipHelp::bfm_2imms<uint64_t>(operands, metadata, true, true);
-        break;
-      }
-      case Opcode::AArch64_SCVTFSXDri: {  // scvtf dd, xn, #fbits
-        results[0] =
-            floatHelp::scvtf_FixedPoint<double, int64_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_SCVTFSXSri: {  // scvtf sd, xn, #fbits
-        results[0] =
-            floatHelp::scvtf_FixedPoint<float, int64_t>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_SCVTFUWDri: {  // scvtf dd, wn
-        results[0] = {static_cast<double>(operands[0].get<int32_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_SCVTFUWSri: {  // scvtf sd, wn
-        results[0] = {static_cast<float>(operands[0].get<int32_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_SCVTFUXDri: {  // scvtf dd, xn
-        results[0] = {static_cast<double>(operands[0].get<int64_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_SCVTFUXSri: {  // scvtf sd, xn
-        results[0] = {static_cast<float>(operands[0].get<int64_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_SCVTF_ZPmZ_DtoD: {  // scvtf zd.d, pg/m, zn.d
-        results[0] =
-            sveHelp::sveFcvtPredicated<double, int64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SCVTF_ZPmZ_DtoS: {  // scvtf zd.s, pg/m, zn.d
-        results[0] =
-            sveHelp::sveFcvtPredicated<float, int64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SCVTF_ZPmZ_StoD: {  // scvtf zd.d, pg/m, zn.s
-        results[0] =
-            sveHelp::sveFcvtPredicated<double, int32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SCVTF_ZPmZ_StoS: {  // scvtf zd.s, pg/m, zn.s
-        results[0] =
-            sveHelp::sveFcvtPredicated<float, int32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SCVTFv1i32: {  // scvtf sd, sn
-        results[0] = {static_cast<float>(operands[0].get<int32_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_SCVTFv1i64: {  // scvtf dd, dn
-        results[0] = {static_cast<double>(operands[0].get<int64_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_SCVTFv2f32: {  // scvtf vd.2s, vn.2s
-        results[0] = neonHelp::vecScvtf_2vecs<float, int32_t, 2>(
-            operands, [](int32_t x) -> float { return static_cast<float>(x); });
-        break;
-      }
-      case Opcode::AArch64_SCVTFv2f64: {  // scvtf vd.2d, vn.2d
-        results[0] = neonHelp::vecScvtf_2vecs<double, int64_t, 2>(
-            operands,
-            [](int64_t x) -> double { return static_cast<double>(x); });
-        break;
-      }
-      case Opcode::AArch64_SCVTFv4f32: {  // scvtf vd.4s, vn.4s
-        results[0] = neonHelp::vecScvtf_2vecs<float, int32_t, 4>(
-            operands, [](int32_t x) -> float { return static_cast<float>(x); });
-        break;
-      }
-      case Opcode::AArch64_SDIVWr: {  // sdiv wd, wn, wm
-        results[0] = {divideHelp::div_3ops<int32_t>(operands), 8};
-        break;
-      }
-      case Opcode::AArch64_SDIVXr: {  // sdiv xd, xn, xm
-        results[0] = {divideHelp::div_3ops<int64_t>(operands), 8};
-        break;
-      }
-      case Opcode::AArch64_SEL_ZPZZ_D: {  // sel zd.d, pg, zn.d, zm.d
-        results[0] = sveHelp::sveSel_zpzz<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SEL_ZPZZ_S: {  // sel zd.s, pg, zn.s, zm.s
-        results[0] = sveHelp::sveSel_zpzz<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SHLd: {  // shl dd, dn #imm
-        results[0] =
-            neonHelp::vecShlShift_vecImm<uint64_t, 1>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_SHLv4i32_shift: {  // shl vd.4s, vn.4s, #imm
-        results[0] =
-            neonHelp::vecShlShift_vecImm<uint32_t, 4>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_SMADDLrrr: {  // smaddl xd, wn, wm, xa
-        results[0] = multiplyHelp::maddl_4ops<int64_t, int32_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_SMAX_ZI_S: {  // smax zdn.s, zdn.s, #imm
-        results[0] =
-            sveHelp::sveMax_vecImm<int32_t>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SMAX_ZPmZ_S: {  // smax zd.s, pg/m, zn.s, zm.s
-        results[0] = sveHelp::sveMaxPredicated_vecs<int32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SMAXv4i32: {  // smax vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecLogicOp_3vecs<int32_t, 4>(
-            operands,
-            [](int32_t x, int32_t y) -> int32_t { return std::max(x, y); });
-        break;
-      }
-      case Opcode::AArch64_SMINV_VPZ_S: {  // sminv sd, pg, zn.s
-        results[0] = sveHelp::sveSminv<int32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SMINVv4i32v: {  // sminv sd, vn.4s
-        results[0] = neonHelp::vecMinv_2ops<int32_t, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_SMIN_ZPmZ_S: {  // smin zd.s, pg/m, zn.s, zm.s
-        results[0] = sveHelp::sveLogicOpPredicated_3vecs<int32_t>(
-            operands, VL_bits,
-            [](int32_t x, int32_t y) -> int32_t { return std::min(x, y); });
-        break;
-      }
-      case Opcode::AArch64_SMINv4i32: {  // smin vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecLogicOp_3vecs<int32_t, 4>(
-            operands,
-            [](int32_t x, int32_t y) -> int32_t { return std::min(x, y); });
-        break;
-      }
-      case Opcode::AArch64_SMSUBLrrr: {  // smsubl xd, wn, wm, xa
-        results[0] = arithmeticHelp::msubl_4ops<int64_t, int32_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_SMULH_ZPmZ_B: {  // smulh zdn.b, pg/m, zdn.b, zm.b
-        results[0] =
-            sveHelp::sveMulhPredicated<int8_t, int16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SMULH_ZPmZ_H: {  // smulh zdn.h, pg/m, zdn.h, zm.h
-        results[0] =
-            sveHelp::sveMulhPredicated<int16_t, int32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SMULH_ZPmZ_S: {  // smulh zdn.s, pg/m, zdn.s, zm.s
-        results[0] =
-            sveHelp::sveMulhPredicated<int32_t, int64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SMULHrr: {  // smulh xd, xn, xm
-        // TODO: signed
-        results[0] = AuxFunc::mulhi(operands[0].get<uint64_t>(),
-                                    operands[1].get<uint64_t>());
-        break;
-      }
-      case Opcode::AArch64_SSHLLv2i32_shift: {  // sshll vd.2d, vn.2s, #imm
-        results[0] = neonHelp::vecShllShift_vecImm<int64_t, int32_t, 2>(
-            operands, metadata, false);
-        break;
-      }
-      case Opcode::AArch64_SSHLLv4i32_shift: {  // sshll2 vd.2d, vn.4s, #imm
-        results[0] = neonHelp::vecShllShift_vecImm<int64_t, int32_t, 2>(
-            operands, metadata, true);
-        break;
-      }
-      case Opcode::AArch64_SSHRv4i32_shift: {  // sshr vd.4s, vn.4s, #imm
-        results[0] = neonHelp::vecSshrShift_imm<int32_t, 4>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_SST1B_D_REAL: {  // st1b {zd.d}, pg, [xn, zm.d]
-        // STORE
-        const uint64_t* d = operands[0].getAsVector<uint64_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            memoryData[index] = static_cast<uint8_t>(d[i]);
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_SST1D_REAL: {  // st1d {zt.d}, pg, [xn, zm.d]
-        // STORE
-        const uint64_t* d = operands[0].getAsVector<uint64_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            memoryData[index] = d[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_SST1D_IMM: {  // st1d {zd.d}, pg, [zn.d{, #imm}]
-        // STORE
-        const uint64_t* t = operands[0].getAsVector<uint64_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            memoryData[index] = t[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_SST1D_SCALED_SCALED_REAL: {  // st1d {zt.d}, pg, [xn,
-                                                        // zm.d, lsl #
-                                                        // 3]
-        // STORE
-        const uint64_t* d = operands[0].getAsVector<uint64_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            memoryData[index] = d[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_SST1W_D_IMM: {  // st1w {zt.d}, pg, [zn.d{, #imm}]
-        // STORE
-        const uint64_t* t = operands[0].getAsVector<uint64_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            memoryData[index] = t[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_SST1W_IMM: {  // st1w {zt.s}, pg, [zn.s{, #imm}]
-        // STORE
-        const uint32_t* t = operands[0].getAsVector<uint32_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 32;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 16) * 4);
-          if (p[i / 16] & shifted_active) {
-            memoryData[index] = t[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_ST1B: {  // st1b {zt.b}, pg, [xn, xm]
-        // STORE
-        const uint8_t* d = operands[0].getAsVector<uint8_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 8;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << (i % 64);
-          if (p[i / 64] & shifted_active) {
-            memoryData[index] = d[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_ST1D: {  // st1d {zt.d}, pg, [xn, xm, lsl #3]
-        // STORE
-        const uint64_t* d = operands[0].getAsVector<uint64_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            memoryData[index] = d[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_ST1D_IMM: {  // st1d {zt.d}, pg, [xn{, #imm, mul vl}]
-        // STORE
-        const uint64_t* d = operands[0].getAsVector<uint64_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            memoryData[index] = d[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_ST1Twov16b: {  // st1v {vt.16b, vt2.16b}, [xn]
-        // STORE
-        const uint8_t* t = operands[0].getAsVector<uint8_t>();
-        const uint8_t* t2 = operands[1].getAsVector<uint8_t>();
-        for (int i = 0; i < 16; i++) {
-          memoryData[i] = t[i];
-        }
-        for (int i = 0; i < 16; i++) {
-          memoryData[i + 16] = t2[i];
-        }
-        break;
-      }
-      case Opcode::AArch64_ST1W: {  // st1w {zt.s}, pg, [xn, xm, lsl #2]
-        // STORE
-        const uint32_t* d = operands[0].getAsVector<uint32_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 32;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 16) * 4);
-          if (p[i / 16] & shifted_active) {
-            memoryData[index] = d[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_ST1W_D: {  // st1w {zt.d}, pg, [xn, xm, lsl #2]
-        // STORE
-        const uint64_t* d = operands[0].getAsVector<uint64_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            memoryData[index] = static_cast<uint32_t>(d[i]);
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_ST1W_IMM: {  // st1w {zt.s}, pg, [xn{, #imm, mul vl}]
-        // STORE
-        const uint32_t* d = operands[0].getAsVector<uint32_t>();
-        const uint64_t* p = operands[1].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 32;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 16) * 4);
-          if (p[i / 16] & shifted_active) {
-            memoryData[index] = d[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_ST1i16: {  // st1 {vt.h}[index], [xn]
-        // STORE
-        const uint16_t* t = operands[0].getAsVector<uint16_t>();
-        memoryData[0] = t[metadata.operands[0].vector_index];
-        break;
-      }
-      case Opcode::AArch64_ST1i16_POST: {  // st1 {vt.h}[index], [xn], xm
-                                           // st1 {vt.h}[index], [xn], #2
-        // STORE
-        const uint16_t* t = operands[0].getAsVector<uint16_t>();
-        memoryData[0] = t[metadata.operands[0].vector_index];
-        uint64_t offset = 2;
-        if (metadata.operandCount == 3) {
-          offset = operands[2].get<uint64_t>();
-        }
-        results[0] = operands[1].get<uint64_t>() + offset;
-        break;
-      }
-      case Opcode::AArch64_ST1i32: {  // st1 {vt.s}[index], [xn]
-        // STORE
-        const uint32_t* t = operands[0].getAsVector<uint32_t>();
-        memoryData[0] = t[metadata.operands[0].vector_index];
-        break;
-      }
-      case Opcode::AArch64_ST1i32_POST: {  // st1 {vt.s}[index], [xn], xm
-                                           // st1 {vt.s}[index], [xn], #4
-        // STORE
-        const uint32_t* t = operands[0].getAsVector<uint32_t>();
-        memoryData[0] = t[metadata.operands[0].vector_index];
-        uint64_t offset = 4;
-        if (metadata.operandCount == 3) {
-          offset = operands[2].get<uint64_t>();
-        }
-        results[0] = operands[1].get<uint64_t>() + offset;
-        break;
-      }
-      case Opcode::AArch64_ST1i64: {  // st1 {vt.d}[index], [xn]
-        // STORE
-        const uint64_t* t = operands[0].getAsVector<uint64_t>();
-        memoryData[0] = t[metadata.operands[0].vector_index];
-        break;
-      }
-      case Opcode::AArch64_ST1i64_POST: {  // st1 {vt.d}[index], [xn], xm
-                                           // st1 {vt.d}[index], [xn], #8
-        // STORE
-        const uint64_t* t = operands[0].getAsVector<uint64_t>();
-        memoryData[0] = t[metadata.operands[0].vector_index];
-        uint64_t offset = 8;
-        if (metadata.operandCount == 3) {
-          offset = operands[2].get<uint64_t>();
-        }
-        results[0] = operands[1].get<uint64_t>() + offset;
-        break;
-      }
-      case Opcode::AArch64_ST1i8: {  // st1 {vt.b}[index], [xn]
-        // STORE
-        const uint8_t* t = operands[0].getAsVector<uint8_t>();
-        memoryData[0] = t[metadata.operands[0].vector_index];
-        break;
-      }
-      case Opcode::AArch64_ST1i8_POST: {  // st1 {vt.b}[index], [xn], xm
-                                          // st1 {vt.b}[index], [xn], #1
-        // STORE
-        const uint8_t* t = operands[0].getAsVector<uint8_t>();
-        memoryData[0] = t[metadata.operands[0].vector_index];
-        uint64_t offset = 1;
-        if (metadata.operandCount == 3) {
-          offset = operands[2].get<uint64_t>();
-        }
-        results[0] = RegisterValue(operands[1].get<uint64_t>() + offset, 8);
-        break;
-      }
-      case Opcode::AArch64_ST2D_IMM: {  // st2d {zt1.d, zt2.d}, pg, [<xn|sp>{,
-                                        // #imm, mul vl}]
-        // STORE
-        const uint64_t* d1 = operands[0].getAsVector<uint64_t>();
-        const uint64_t* d2 = operands[1].getAsVector<uint64_t>();
-        const uint64_t* p = operands[2].getAsVector<uint64_t>();
-
-        const uint16_t partition_num = VL_bits / 64;
-        uint16_t index = 0;
-        for (int i = 0; i < partition_num; i++) {
-          uint64_t shifted_active = 1ull << ((i % 8) * 8);
-          if (p[i / 8] & shifted_active) {
-            memoryData[index] = d1[i];
-            index++;
-            memoryData[index] = d2[i];
-            index++;
-          }
-        }
-        break;
-      }
-      case Opcode::AArch64_ST2Twov4s_POST: {  // st2 {vt1.4s, vt2.4s}, [xn],
-                                              // #imm
-        // STORE
-        const float* t1 = operands[0].getAsVector<float>();
-        const float* t2 = operands[1].getAsVector<float>();
-        for (int i = 0; i < 4; i++) {
-          memoryData[2 * i] = t1[i];
-          memoryData[2 * i + 1] = t2[i];
-        }
-        uint64_t offset = 32;
-        if (metadata.operandCount == 4) {
-          offset = operands[3].get<uint64_t>();
-        }
-        results[0] = operands[2].get<uint64_t>() + offset;
-        break;
-      }
-      case Opcode::AArch64_STLRB: {  // stlrb wt, [xn]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STLRW:    // stlr wt, [xn]
-      case Opcode::AArch64_STLRX: {  // stlr xt, [xn]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STLXRW:    // stlxr ws, wt, [xn]
-      case Opcode::AArch64_STLXRX: {  // stlxr ws, xt, [xn]
-        // STORE
-        memoryData[0] = operands[0];
-        // TODO: Implement atomic memory access
-        results[0] = static_cast<uint64_t>(0);
-        break;
-      }
-      case Opcode::AArch64_STPDi:    // stp dt1, dt2, [xn, #imm]
-      case Opcode::AArch64_STPQi:    // stp qt1, qt2, [xn, #imm]
-      case Opcode::AArch64_STPSi:    // stp st1, st2, [xn, #imm]
-      case Opcode::AArch64_STPWi:    // stp wt1, wt2, [xn, #imm]
-      case Opcode::AArch64_STPXi: {  // stp xt1, xt2, [xn, #imm]
-        memoryData[0] = operands[0];
-        memoryData[1] = operands[1];
-        break;
-      }
-      case Opcode::AArch64_STPDpost:    // stp dt1, dt2, [xn], #imm
-      case Opcode::AArch64_STPQpost:    // stp qt1, qt2, [xn], #imm
-      case Opcode::AArch64_STPSpost:    // stp st1, st2, [xn], #imm
-      case Opcode::AArch64_STPWpost:    // stp wt1, wt2, [xn], #imm
-      case Opcode::AArch64_STPXpost: {  // stp xt1, xt2, [xn], #imm
-        memoryData[0] = operands[0];
-        memoryData[1] = operands[1];
-        results[0] = operands[2].get<uint64_t>() + metadata.operands[3].imm;
-        break;
-      }
-      case Opcode::AArch64_STPDpre:    // stp dt1, dt2, [xn, #imm]!
-      case Opcode::AArch64_STPQpre:    // stp qt1, qt2, [xn, #imm]!
-      case Opcode::AArch64_STPSpre:    // stp st1, st2, [xn, #imm]!
-      case Opcode::AArch64_STPWpre:    // stp wt1, wt2, [xn, #imm]!
-      case Opcode::AArch64_STPXpre: {  // stp xt1, xt2, [xn, #imm]!
-        memoryData[0] = operands[0];
-        memoryData[1] = operands[1];
-        results[0] =
-            operands[2].get<uint64_t>() + metadata.operands[2].mem.disp;
-        break;
-      }
-      case Opcode::AArch64_STRBBpost: {  // strb wd, [xn], #imm
-        // STORE
-        memoryData[0] = operands[0];
-        results[0] = operands[1].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_STRBBpre: {  // strb wd, [xn, #imm]!
-        // STORE
-        memoryData[0] = operands[0];
-        results[0] =
-            operands[1].get<uint64_t>() + metadata.operands[1].mem.disp;
-        break;
-      }
-      case Opcode::AArch64_STRBBroW: {  // strb wd,
-                                        //  [xn, wm{, extend {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRBBroX: {  // strb wd,
-                                        //  [xn, xm{, extend {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRBBui: {  // strb wd, [xn, #imm]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRBui:    // str bt, [xn, #imm]
-      case Opcode::AArch64_STRDui:    // str dt, [xn, #imm]
-      case Opcode::AArch64_STRHui:    // str ht, [xn, #imm]
-      case Opcode::AArch64_STRQui:    // str qt, [xn, #imm]
-      case Opcode::AArch64_STRSui:    // str st, [xn, #imm]
-      case Opcode::AArch64_STRWui:    // str wt, [xn, #imm]
-      case Opcode::AArch64_STRXui: {  // str xt, [xn, #imm]
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRBpost:    // str bt, [xn], #imm
-      case Opcode::AArch64_STRDpost:    // str dt, [xn], #imm
-      case Opcode::AArch64_STRHpost:    // str ht, [xn], #imm
-      case Opcode::AArch64_STRQpost:    // str qt, [xn], #imm
-      case Opcode::AArch64_STRSpost:    // str st, [xn], #imm
-      case Opcode::AArch64_STRWpost:    // str wt, [xn], #imm
-      case Opcode::AArch64_STRXpost: {  // str xt, [xn], #imm
-        memoryData[0] = operands[0];
-        results[0] = operands[1].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_STRBpre:    // str bt, [xn, #imm]!
-      case Opcode::AArch64_STRDpre:    // str dt, [xn, #imm]!
-      case Opcode::AArch64_STRHpre:    // str ht, [xn, #imm]!
-      case Opcode::AArch64_STRQpre:    // str qt, [xn, #imm]!
-      case Opcode::AArch64_STRSpre:    // str st, [xn, #imm]!
-      case Opcode::AArch64_STRWpre:    // str wt, [xn, #imm]!
-      case Opcode::AArch64_STRXpre: {  // str xt, [xn, #imm]!
-        memoryData[0] = operands[0];
-        results[0] =
-            operands[1].get<uint64_t>() + metadata.operands[1].mem.disp;
-        break;
-      }
-      case Opcode::AArch64_STRDroW: {  // str dt, [xn, wm{, #extend {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRDroX: {  // str dt, [xn, xm{, #extend {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRHHpost: {  // strh wt, [xn], #imm
-        // STORE
-        memoryData[0] = operands[0];
-        results[0] = operands[1].get<uint64_t>() + metadata.operands[2].imm;
-        break;
-      }
-      case Opcode::AArch64_STRHHpre: {  // strh wd, [xn, #imm]!
-        // STORE
-        memoryData[0] = operands[0];
-        results[0] =
-            operands[1].get<uint64_t>() + metadata.operands[1].mem.disp;
-        break;
-      }
-      case Opcode::AArch64_STRHHroW: {  // strh wd,
-                                        //  [xn, wm{, extend {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRHHroX: {  // strh wd,
-                                        //  [xn, xm{, extend {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRHHui: {  // strh wt, [xn, #imm]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRQroX: {  // str qt, [xn, xm{, extend, {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRSroW: {  // str st, [xn, wm{, #extend {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRSroX: {  // str st, [xn, xm{, #extend {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRWroW: {  // str wd, [xn, wm{, extend {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRWroX: {  // str wt, [xn, xm{, extend, {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRXroW: {  // str xd, [xn, wm{, extend {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STRXroX: {  // str xt, [xn, xm{, extend, {#amount}}]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STR_PXI: {  // str pt, [xn{, #imm, mul vl}]
-        // STORE
-        const uint64_t PL_bits = VL_bits / 8;
-        const uint16_t partition_num = PL_bits / 8;
-        const uint8_t* p = operands[0].getAsVector<uint8_t>();
-        for (int i = 0; i < partition_num; i++) {
-          memoryData[i] = p[i];
-        }
-        break;
-      }
-      case Opcode::AArch64_STR_ZXI: {  // str zt, [xn{, #imm, mul vl}]
-        // STORE
-        const uint16_t partition_num = VL_bits / 8;
-        const uint8_t* z = operands[0].getAsVector<uint8_t>();
-        for (int i = 0; i < partition_num; i++) {
-          memoryData[i] = z[i];
-        }
-        break;
-      }
-      case Opcode::AArch64_STURBBi: {  // sturb wd, [xn, #imm]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STURDi:     // stur dt, [xn, #imm]
-      case Opcode::AArch64_STURHHi: {  // sturh wt, [xn, #imm]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STURQi:    // stur qt, [xn, #imm]
-      case Opcode::AArch64_STURSi:    // stur st, [xn, #imm]
-      case Opcode::AArch64_STURWi:    // stur wt, [xn, #imm]
-      case Opcode::AArch64_STURXi: {  // stur xt, [xn, #imm]
-        // STORE
-        memoryData[0] = operands[0];
-        break;
-      }
-      case Opcode::AArch64_STXRW: {  // stxr ws, wt, [xn]
-        // STORE
-        memoryData[0] = operands[0];
-        // TODO: Implement atomic memory access
-        results[0] = static_cast<uint64_t>(0);
-        break;
-      }
-      case Opcode::AArch64_STXRX: {  // stxr ws, xt, [xn]
-        // STORE
-        memoryData[0] = operands[0];
-        // TODO: Implement atomic memory access
-        results[0] = static_cast<uint64_t>(0);
-        break;
-      }
-      case Opcode::AArch64_SUBSWri: {  // subs wd, wn, #imm
-        auto [result, nzcv] =
-            arithmeticHelp::subShift_imm<uint32_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_SUBSWrs: {  // subs wd, wn, wm{, shift #amount}
-        auto [result, nzcv] =
-            arithmeticHelp::subShift_3ops<uint32_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_SUBSWrx: {  // subs wd, wn, wm{, extend #amount}
-        auto [result, nzcv] =
-            arithmeticHelp::subExtend_3ops<uint32_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_SUBSXri: {  // subs xd, xn, #imm
-        auto [result, nzcv] =
-            arithmeticHelp::subShift_imm<uint64_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = result;
-        break;
-      }
-      case Opcode::AArch64_SUBSXrs: {  // subs xd, xn, xm{, shift #amount}
-        auto [result, nzcv] =
-            arithmeticHelp::subShift_3ops<uint64_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = result;
-        break;
-      }
-      case Opcode::AArch64_SUBSXrx:      // subs xd, xn, wm{, extend #amount}
-      case Opcode::AArch64_SUBSXrx64: {  // subs xd, xn, xm{, extend #amount}
-        auto [result, nzcv] =
-            arithmeticHelp::subExtend_3ops<uint64_t>(operands, metadata, true);
-        results[0] = nzcv;
-        results[1] = result;
-        break;
-      }
-      case Opcode::AArch64_SUBWri: {  // sub wd, wn, #imm{, <shift>}
-        auto [result, nzcv] =
-            arithmeticHelp::subShift_imm<uint32_t>(operands, metadata, false);
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_SUBWrs: {  // sub wd, wn, wm{, shift #amount}
-        auto [result, nzcv] =
-            arithmeticHelp::subShift_3ops<uint32_t>(operands, metadata, false);
-        results[0] = {result, 8};
-        break;
-      }
-      case Opcode::AArch64_SUBXri: {  // sub xd, xn, #imm{, <shift>}
-        auto [result, nzcv] =
-            arithmeticHelp::subShift_imm<uint64_t>(operands, metadata, false);
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_SUBXrs: {  // sub xd, xn, xm{, shift #amount}
-        auto [result, nzcv] =
-            arithmeticHelp::subShift_3ops<uint64_t>(operands, metadata, false);
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_SUBXrx:      // sub xd, xn, wm{, extend #amount}
-      case Opcode::AArch64_SUBXrx64: {  // sub xd, xn, xm{, extend #amount}
-        auto [result, nzcv] =
-            arithmeticHelp::subExtend_3ops<uint64_t>(operands, metadata, false);
-        results[0] = result;
-        break;
-      }
-      case Opcode::AArch64_SUB_ZZZ_B: {  // sub zd.b, zn.b, zm.b
-        results[0] = sveHelp::sveSub_3vecs<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SUB_ZZZ_D: {  // sub zd.d, zn.d, zm.d
-        results[0] = sveHelp::sveSub_3vecs<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SUB_ZZZ_H: {  // sub zd.h, zn.h, zm.h
-        results[0] = sveHelp::sveSub_3vecs<uint16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SUB_ZZZ_S: {  // sub zd.s, zn.s, zm.s
-        results[0] = sveHelp::sveSub_3vecs<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SUBv16i8: {  // sub vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 16>(
-            operands, [](uint8_t x, uint8_t y) -> uint8_t { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_SUBv1i64: {  // sub dd, dn, dm
-        results[0] = neonHelp::vecLogicOp_3vecs<uint64_t, 1>(
-            operands, [](uint64_t x, uint64_t y) -> uint64_t { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_SUBv2i32: {  // sub vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecLogicOp_3vecs<uint32_t, 2>(
-            operands, [](uint32_t x, uint32_t y) -> uint32_t { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_SUBv2i64: {  // sub vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecLogicOp_3vecs<uint64_t, 2>(
-            operands, [](uint64_t x, uint64_t y) -> uint64_t { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_SUBv4i16: {  // sub vd.4h, vn.4h, vm.4h
-        results[0] = neonHelp::vecLogicOp_3vecs<uint16_t, 4>(
-            operands, [](uint64_t x, uint16_t y) -> uint16_t { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_SUBv4i32: {  // sub vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecLogicOp_3vecs<uint32_t, 4>(
-            operands, [](uint32_t x, uint32_t y) -> uint32_t { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_SUBv8i16: {  // sub vd.8h, vn.8h, vm.8h
-        results[0] = neonHelp::vecLogicOp_3vecs<uint16_t, 8>(
-            operands, [](uint16_t x, uint16_t y) -> uint16_t { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_SUBv8i8: {  // sub vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 8>(
-            operands, [](uint8_t x, uint8_t y) -> uint8_t { return x - y; });
-        break;
-      }
-      case Opcode::AArch64_SVC: {  // svc #imm
-        exceptionEncountered_ = true;
-        exception_ = InstructionException::SupervisorCall;
-        break;
-      }
-      case Opcode::AArch64_SXTW_ZPmZ_D: {  // sxtw zd.d, pg/m, zn.d
-        results[0] =
-            sveHelp::sveSxtPredicated<int64_t, int32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_SYSxt: {  // sys #<op1>, cn, cm, #<op2>{, xt}
-        // if (metadata.id == ARM64_INS_DC) {
-        //   uint64_t address = operands[0].get<uint64_t>();
-        //   uint8_t dzp = operands[1].get<uint64_t>() & 8;
-        //   uint8_t N = std::pow(2, operands[1].get<uint64_t>() & 7);
-        //   if (metadata.operands[0].sys == ARM64_DC_ZVA) {
-        //     if (dzp) {
-        //       // TODO
-        //     }
-        //   }
-        // }
-        break;
-      }
-      case Opcode::AArch64_TBLv16i8Four: {  // tbl Vd.16b {Vn.16b, Vn+1.16b,
-                                            // Vn+2.16b,Vn+3.16b } Vm.16b
-        results[0] = neonHelp::vecTbl<16>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_TBLv16i8One: {  // tbl Vd.16b {Vn.16b} Vm.16b
-        results[0] = neonHelp::vecTbl<16>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_TBLv16i8Three: {  // tbl Vd.16b {Vn.16b, Vn+1.16b,
-                                             // Vn+2.16b } Vm.16b
-        results[0] = neonHelp::vecTbl<16>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_TBLv16i8Two: {  // tbl Vd.16b {Vn.16b, Vn+1.16b }
-                                           // Vm.16b
-        results[0] = neonHelp::vecTbl<16>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_TBLv8i8Four: {  // tbl Vd.8b {Vn.16b, Vn+1.16b,
-                                           // Vn+2.16b,Vn+3.16b } Vm.8b
-        results[0] = neonHelp::vecTbl<8>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_TBLv8i8One: {  // tbl Vd.8b {Vn.16b} Vm.8b
-        results[0] = neonHelp::vecTbl<8>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_TBLv8i8Three: {  // tbl Vd.8b {Vn.16b, Vn+1.16b,
-                                            // Vn+2.16b } Vm.8b
-        results[0] = neonHelp::vecTbl<8>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_TBLv8i8Two: {  // tbl Vd.8b {Vn.16b, Vn+1.16b } Vm.8b
-        results[0] = neonHelp::vecTbl<8>(operands, metadata);
-        break;
-      }
-      case Opcode::AArch64_TBNZW: {  // tbnz wn, #imm, label
-        auto [taken, addr] = conditionalHelp::tbnz_tbz<uint32_t>(
-            operands, metadata, instructionAddress_, true);
-        branchTaken_ = taken;
-        branchAddress_ = addr;
-        break;
-      }
-      case Opcode::AArch64_TBNZX: {  // tbnz xn, #imm, label
-        auto [taken, addr] = conditionalHelp::tbnz_tbz<uint64_t>(
-            operands, metadata, instructionAddress_, true);
-        branchTaken_ = taken;
-        branchAddress_ = addr;
-        break;
-      }
-      case Opcode::AArch64_TBZW: {  // tbz wn, #imm, label
-        auto [taken, addr] = conditionalHelp::tbnz_tbz<uint32_t>(
-            operands, metadata, instructionAddress_, false);
-        branchTaken_ = taken;
-        branchAddress_ = addr;
-        break;
-      }
-      case Opcode::AArch64_TBZX: {  // tbz xn, #imm, label
-        auto [taken, addr] = conditionalHelp::tbnz_tbz<uint64_t>(
-            operands, metadata, instructionAddress_, false);
-        branchTaken_ = taken;
-        branchAddress_ = addr;
-        break;
-      }
-      case Opcode::AArch64_TRN1_ZZZ_B: {  // trn1 zd.b, zn.b, zm.b
-        results[0] = sveHelp::sveTrn1_3vecs<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_TRN1_ZZZ_D: {  // trn1 zd.d, zn.d, zm.d
-        results[0] = sveHelp::sveTrn1_3vecs<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_TRN1_ZZZ_H: {  // trn1 zd.h, zn.h, zm.h
-        results[0] = sveHelp::sveTrn1_3vecs<uint16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_TRN1_ZZZ_S: {  // trn1 zd.s, zn.s, zm.s
-        results[0] = sveHelp::sveTrn1_3vecs<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_TRN1v16i8: {  // trn1 vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecTrn1<uint8_t, 16>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN1v2i32: {  // trn1 vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecTrn1<uint32_t, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN1v2i64: {  // trn1 vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecTrn1<uint64_t, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN1v4i16: {  // trn1 vd.4h, vn.4h, vm.4h
-        results[0] = neonHelp::vecTrn1<uint16_t, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN1v4i32: {  // trn1 vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecTrn1<uint32_t, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN1v8i16: {  // trn1 vd.8h, vn.8h, vm.8h
-        results[0] = neonHelp::vecTrn1<uint16_t, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN1v8i8: {  // trn1 vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecTrn1<uint8_t, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN2_ZZZ_B: {  // trn2 zd.b, zn.b, zm.b
-        results[0] = sveHelp::sveTrn2_3vecs<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_TRN2_ZZZ_D: {  // trn2 zd.d, zn.d, zm.d
-        results[0] = sveHelp::sveTrn2_3vecs<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_TRN2_ZZZ_H: {  // trn2 zd.h, zn.h, zm.h
-        results[0] = sveHelp::sveTrn2_3vecs<uint16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_TRN2_ZZZ_S: {  // trn2 zd.s, zn.s, zm.s
-        results[0] = sveHelp::sveTrn2_3vecs<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_TRN2v16i8: {  // trn2 vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecTrn2<uint8_t, 16>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN2v2i32: {  // trn2 vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecTrn2<uint32_t, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN2v2i64: {  // trn2 vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecTrn2<uint64_t, 2>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN2v4i16: {  // trn2 vd.4h, vn.4h, vm.4h
-        results[0] = neonHelp::vecTrn2<uint16_t, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN2v4i32: {  // trn2 vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecTrn2<uint32_t, 4>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN2v8i16: {  // trn2 vd.8h, vn.8h, vm.8h
-        results[0] = neonHelp::vecTrn2<uint16_t, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_TRN2v8i8: {  // trn2 vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecTrn2<uint8_t, 8>(operands);
-        break;
-      }
-      case Opcode::AArch64_UADDV_VPZ_B: {  // uaddv dd, pg, zn.b
-        results[0] = sveHelp::sveAddvPredicated<uint8_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_UADDV_VPZ_D: {  // uaddv dd, pg, zn.d
-        results[0] = sveHelp::sveAddvPredicated<uint64_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_UADDV_VPZ_H: {  // uaddv dd, pg, zn.h
-        results[0] = sveHelp::sveAddvPredicated<uint16_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_UADDV_VPZ_S: {  // uaddv dd, pg, zn.s
-        results[0] = sveHelp::sveAddvPredicated<uint32_t>(operands, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_UBFMWri: {  // ubfm wd, wn, #immr, #imms
-        results[0] = {
-            bitmanipHelp::bfm_2imms<uint32_t>(operands, metadata, false, true),
-            8};
-        break;
-      }
-      case Opcode::AArch64_UBFMXri: {  // ubfm xd, xn, #immr, #imms
-        results[0] =
-            bitmanipHelp::bfm_2imms<uint64_t>(operands, metadata, false, true);
-        break;
-      }
-      case Opcode::AArch64_UCVTFUWDri: {  // ucvtf dd, wn
-        results[0] = {static_cast<double>(operands[0].get<uint32_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_UCVTFUWSri: {  // ucvtf sd, wn
-        results[0] = {static_cast<float>(operands[0].get<uint32_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_UCVTFUXDri: {  // ucvtf dd, xn
-        results[0] = {static_cast<double>(operands[0].get<uint64_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_UCVTFUXSri: {  // ucvtf sd, xn
-        results[0] = {static_cast<float>(operands[0].get<uint64_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_UCVTFv1i32: {  // ucvtf sd, sn
-        results[0] = {static_cast<float>(operands[0].get<uint32_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_UCVTFv1i64: {  // ucvtf dd, dn
-        results[0] = {static_cast<double>(operands[0].get<uint64_t>()), 256};
-        break;
-      }
-      case Opcode::AArch64_UDIVWr: {  // udiv wd, wn, wm
-        results[0] = {divideHelp::div_3ops<uint32_t>(operands), 8};
-        break;
-      }
-      case Opcode::AArch64_UDIVXr: {  // udiv xd, xn, xm
-        results[0] = {divideHelp::div_3ops<uint64_t>(operands), 8};
-        break;
-      }
-      case Opcode::AArch64_UMADDLrrr: {  // umaddl xd, wn, wm, xa
-        results[0] = multiplyHelp::maddl_4ops<uint64_t, uint32_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_UMAXPv16i8: {  // umaxp vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecUMaxP<uint8_t, 16>(operands);
-        break;
-      }
-      case Opcode::AArch64_UMINPv16i8: {  // uminp vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecUMinP<uint8_t, 16>(operands);
-        break;
-      }
-      case Opcode::AArch64_UMOVvi32_idx0:  // umov wd, vn.s[0]
-      case Opcode::AArch64_UMOVvi32: {     // umov wd, vn.s[index]
-        const uint32_t* vec = operands[0].getAsVector<uint32_t>();
-        results[0] = {vec[metadata.operands[1].vector_index], 8};
-        break;
-      }
-      case Opcode::AArch64_UMOVvi64_idx0:  // umov xd, vn.d[0]
-      case Opcode::AArch64_UMOVvi64: {     // umov xd, vn.d[index]
-        const uint64_t* vec = operands[0].getAsVector<uint64_t>();
-        results[0] = vec[metadata.operands[1].vector_index];
-        break;
-      }
-      case Opcode::AArch64_UMOVvi8_idx0:  // umov wd, vn.b[0]
-      case Opcode::AArch64_UMOVvi8: {     // umov wd, vn.b[index]
-        const uint8_t* vec = operands[0].getAsVector<uint8_t>();
-        results[0] = {vec[metadata.operands[1].vector_index], 8};
-        break;
-      }
-      case Opcode::AArch64_UMSUBLrrr: {  // umsubl xd, wn, wm, xa
-        results[0] = arithmeticHelp::msubl_4ops<uint64_t, uint32_t>(operands);
-        break;
-      }
-      case Opcode::AArch64_UMULHrr: {  // umulh xd, xn, xm
-        results[0] = AuxFunc::mulhi(operands[0].get<uint64_t>(),
-                                    operands[1].get<uint64_t>());
-        break;
-      }
-      case Opcode::AArch64_UQDECD_WPiI: {  // uqdecd wd{, pattern{, MUL #imm}}
-        results[0] =
-            sveHelp::sveUqdec<uint32_t, 64u>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_UQDECD_XPiI: {  // uqdecd xd{, pattern{, MUL #imm}}
-        results[0] =
-            sveHelp::sveUqdec<uint64_t, 64u>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_UQDECH_XPiI: {  // uqdech xd{, pattern{, MUL #imm}}
-        results[0] =
-            sveHelp::sveUqdec<uint64_t, 16u>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_UQDECW_XPiI: {  // uqdecw xd{, pattern{, MUL #imm}}
-        results[0] =
-            sveHelp::sveUqdec<uint64_t, 32u>(operands, metadata, VL_bits);
-        break;
-      }
-      case Opcode::AArch64_USHLLv16i8_shift: {  // ushll2 vd.8h, vn.16b, #imm
-        results[0] = neonHelp::vecShllShift_vecImm<uint16_t, uint8_t, 8>(
-            operands, metadata, true);
-        break;
-      }
-      case Opcode::AArch64_USHLLv4i16_shift: {  // ushll vd.4s, vn.4h, #imm
-        results[0] = neonHelp::vecShllShift_vecImm<uint32_t, uint16_t, 4>(
-            operands, metadata, false);
-        break;
-      }
-      case Opcode::AArch64_USHLLv8i16_shift: {  // ushll2 vd.4s, vn.8h, #imm
-        results[0] = neonHelp::vecShllShift_vecImm<uint32_t, uint16_t, 4>(
-            operands, metadata, true);
-        break;
-      }
-      case Opcode::AArch64_USHLLv8i8_shift: {  // ushll vd.8h, vn.8b, #imm
-        results[0] = neonHelp::vecShllShift_vecImm<uint16_t, uint8_t, 8>(
-            operands, metadata, false);
-        break;
-      }
-      case Opcode::AArch64_UUNPKHI_ZZ_D: {  // uunpkhi zd.d, zn.s
-        results[0] =
-            sveHelp::sveUnpk_vecs<uint64_t, uint32_t>(operands, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_UUNPKHI_ZZ_H: {  // uunpkhi zd.h, zn.b
-        results[0] =
-            sveHelp::sveUnpk_vecs<uint16_t, uint8_t>(operands, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_UUNPKHI_ZZ_S: {  // uunpkhi zd.s, zn.h
-        results[0] =
-            sveHelp::sveUnpk_vecs<uint32_t, uint16_t>(operands, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_UUNPKLO_ZZ_D: {  // uunpklo zd.d, zn.s
-        results[0] =
-            sveHelp::sveUnpk_vecs<uint64_t, uint32_t>(operands, VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_UUNPKLO_ZZ_H: {  // uunpklo zd.h, zn.b
-        results[0] =
-            sveHelp::sveUnpk_vecs<uint16_t, uint8_t>(operands, VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_UUNPKLO_ZZ_S: {  // uunpklo zd.s, zn.h
-        results[0] =
-            sveHelp::sveUnpk_vecs<uint32_t, uint16_t>(operands, VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_UZP1_ZZZ_S: {  // uzp1 zd.s, zn.s, zm.s
-        results[0] = sveHelp::sveUzp_vecs<uint32_t>(operands, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_UZP1v16i8: {  // uzp1 vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecUzp<int8_t, 16>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_UZP1v2i32: {  // uzp1 vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecUzp<int32_t, 2>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_UZP1v2i64: {  // uzp1 vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecUzp<int64_t, 2>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_UZP1v4i16: {  // uzp1 vd.4h, vn.4h, vm.4h
-        results[0] = neonHelp::vecUzp<int16_t, 4>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_UZP1v4i32: {  // uzp1 vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecUzp<int32_t, 4>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_UZP1v8i16: {  // uzp1 vd.8h, vn.8h, vm.8h
-        results[0] = neonHelp::vecUzp<int16_t, 8>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_UZP1v8i8: {  // uzp1 vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecUzp<int8_t, 8>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_UZP2v16i8: {  // uzp2 vd.16b, vn.16b, vm.16b
-        results[0] = neonHelp::vecUzp<int8_t, 16>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_UZP2v2i32: {  // uzp2 vd.2s, vn.2s, vm.2s
-        results[0] = neonHelp::vecUzp<int32_t, 2>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_UZP2v2i64: {  // uzp2 vd.2d, vn.2d, vm.2d
-        results[0] = neonHelp::vecUzp<int64_t, 2>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_UZP2v4i16: {  // uzp2 vd.4h, vn.4h, vm.4h
-        results[0] = neonHelp::vecUzp<int16_t, 4>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_UZP2v4i32: {  // uzp2 vd.4s, vn.4s, vm.4s
-        results[0] = neonHelp::vecUzp<int32_t, 4>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_UZP2v8i16: {  // uzp2 vd.8h, vn.8h, vm.8h
-        results[0] = neonHelp::vecUzp<int16_t, 8>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_UZP2v8i8: {  // uzp2 vd.8b, vn.8b, vm.8b
-        results[0] = neonHelp::vecUzp<int8_t, 8>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_WHILELO_PWW_B: {  // whilelo pd.b, wn, wm
-        auto [output, nzcv] =
-            sveHelp::sveWhilelo<uint32_t, uint8_t>(operands, VL_bits, true);
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_WHILELO_PWW_D: {  // whilelo pd.d, wn, wm
-        auto [output, nzcv] =
-            sveHelp::sveWhilelo<uint32_t, uint64_t>(operands, VL_bits, true);
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_WHILELO_PWW_H: {  // whilelo pd.h, wn, wm
-        auto [output, nzcv] =
-            sveHelp::sveWhilelo<uint32_t, uint16_t>(operands, VL_bits, true);
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_WHILELO_PWW_S: {  // whilelo pd.s, wn, wm
-        auto [output, nzcv] =
-            sveHelp::sveWhilelo<uint32_t, uint32_t>(operands, VL_bits, true);
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_WHILELO_PXX_B: {  // whilelo pd.b, xn, xm
-        auto [output, nzcv] =
-            sveHelp::sveWhilelo<uint64_t, uint8_t>(operands, VL_bits, true);
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_WHILELO_PXX_D: {  // whilelo pd.d, xn, xm
-        auto [output, nzcv] =
-            sveHelp::sveWhilelo<uint64_t, uint64_t>(operands, VL_bits, true);
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_WHILELO_PXX_H: {  // whilelo pd.h, xn, xm
-        auto [output, nzcv] =
-            sveHelp::sveWhilelo<uint64_t, uint16_t>(operands, VL_bits, true);
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_WHILELO_PXX_S: {  // whilelo pd.s, xn, xm
-        auto [output, nzcv] =
-            sveHelp::sveWhilelo<uint64_t, uint32_t>(operands, VL_bits, true);
-        results[0] = nzcv;
-        results[1] = output;
-        break;
-      }
-      case Opcode::AArch64_XPACLRI: {  // xpaclri
-        // SimEng doesn't support PAC, so do nothing
-        break;
-      }
-      case Opcode::AArch64_XTNv2i32: {  // xtn vd.2s, vn.2d
-        results[0] = neonHelp::vecXtn<uint32_t, uint64_t, 2>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_XTNv4i16: {  // xtn vd.4h, vn.4s
-        results[0] = neonHelp::vecXtn<uint16_t, uint32_t, 4>(operands, false);
-        break;
-      }
-      case Opcode::AArch64_XTNv4i32: {  // xtn2 vd.4s, vn.2d
-        results[0] = neonHelp::vecXtn<uint32_t, uint64_t, 4>(operands, true);
-        break;
-      }
-      case Opcode::AArch64_ZIP1_PPP_B: {  // zip1 pd.b, pn.b, pm.b
-        results[0] = sveHelp::sveZip_preds<uint8_t>(operands, VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_ZIP1_PPP_D: {  // zip1 pd.d, pn.d, pm.d
-        results[0] = sveHelp::sveZip_preds<uint64_t>(operands, VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_ZIP1_PPP_H: {  // zip1 pd.h, pn.h, pm.h
-        results[0] = sveHelp::sveZip_preds<uint16_t>(operands, VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_ZIP1_PPP_S: {  // zip1 pd.s, pn.s, pm.s
-        results[0] = sveHelp::sveZip_preds<uint32_t>(operands, VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_ZIP1_ZZZ_D: {  // zip1 zd.d, zn.d, zm.d
-        results[0] = sveHelp::sveZip_vecs<uint64_t>(operands, VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_ZIP1_ZZZ_S: {  // zip1 zd.s, zn.s, zm.s
-        results[0] = sveHelp::sveZip_vecs<uint32_t>(operands, VL_bits, false);
-        break;
-      }
-      case Opcode::AArch64_ZIP2_PPP_B: {  // zip2 pd.b, pn.b, pm.b
-        results[0] = sveHelp::sveZip_preds<uint8_t>(operands, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_ZIP2_PPP_D: {  // zip2 pd.d, pn.d, pm.d
-        results[0] = sveHelp::sveZip_preds<uint64_t>(operands, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_ZIP2_PPP_H: {  // zip2 pd.h, pn.h, pm.h
-        results[0] = sveHelp::sveZip_preds<uint16_t>(operands, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_ZIP2_PPP_S: {  // zip2 pd.s, pn.s, pm.s
-        results[0] = sveHelp::sveZip_preds<uint32_t>(operands, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_ZIP2_ZZZ_D: {  // zip2 zd.d, zn.d, zm.d
-        results[0] = sveHelp::sveZip_vecs<uint64_t>(operands, VL_bits, true);
-        break;
-      }
-      case Opcode::AArch64_ZIP2_ZZZ_S: {  // zip2 zd.s, zn.s, zm.s
-        results[0] = sveHelp::sveZip_vecs<uint32_t>(operands, VL_bits, true);
-        break;
-      }
-      default:
-        return executionNYI();
+    branchTaken_ = false;
+    branchAddress_ = instructionAddress_ + 4;
+  }
+}
+
+// casal ws, wt, [xn|sp]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CASALW>() {
+  // LOAD / STORE
+  const uint32_t s = operands[0].get<uint32_t>();
+  const uint32_t t = operands[1].get<uint32_t>();
+  const uint32_t n = memoryData[0].get<uint32_t>();
+  if (n == s) memoryData[0] = t;
+}
+
+// casal xs, xt, [xn|sp]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CASALX>() {
+  // LOAD / STORE
+  const uint64_t s = operands[0].get<uint64_t>();
+  const uint64_t t = operands[1].get<uint64_t>();
+  const uint64_t n = memoryData[0].get<uint64_t>();
+  if (n == s) memoryData[0] = t;
+}
+
+// cbnz wn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CBNZW>() {
+  auto [taken, addr] = conditionalHelp::condBranch_cmpToZero<uint32_t>(
+      operands, metadata, instructionAddress_,
+      [](uint32_t x) -> bool { return x != 0; });
+  branchTaken_ = taken;
+  branchAddress_ = addr;
+}
+
+// cbnz xn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CBNZX>() {
+  auto [taken, addr] = conditionalHelp::condBranch_cmpToZero<uint64_t>(
+      operands, metadata, instructionAddress_,
+      [](uint64_t x) -> bool { return x != 0; });
+  branchTaken_ = taken;
+  branchAddress_ = addr;
+}
+
+// cbz wn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CBZW>() {
+  auto [taken, addr] = conditionalHelp::condBranch_cmpToZero<uint32_t>(
+      operands, metadata, instructionAddress_,
+      [](uint32_t x) -> bool { return x == 0; });
+  branchTaken_ = taken;
+  branchAddress_ = addr;
+}
+
+// cbz xn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CBZX>() {
+  auto [taken, addr] = conditionalHelp::condBranch_cmpToZero<uint64_t>(
+      operands, metadata, instructionAddress_,
+      [](uint64_t x) -> bool { return x == 0; });
+  branchTaken_ = taken;
+  branchAddress_ = addr;
+}
+
+// ccmn wn, #imm, #nzcv, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CCMNWi>() {
+  results[0] = conditionalHelp::ccmn_imm<uint32_t>(operands, metadata);
+}
+
+// ccmn xn, #imm, #nzcv, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CCMNXi>() {
+  results[0] = conditionalHelp::ccmn_imm<uint64_t>(operands, metadata);
+}
+
+// ccmp wn, #imm, #nzcv, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CCMPWi>() {
+  results[0] = conditionalHelp::ccmp_imm<uint32_t>(operands, metadata);
+}
+
+// ccmp wn, wm, #nzcv, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CCMPWr>() {
+  results[0] = conditionalHelp::ccmp_reg<uint32_t>(operands, metadata);
+}
+
+// ccmp xn, #imm, #nzcv, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CCMPXi>() {
+  results[0] = conditionalHelp::ccmp_imm<uint64_t>(operands, metadata);
+}
+
+// ccmp xn, xm, #nzcv, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CCMPXr>() {
+  results[0] = conditionalHelp::ccmp_reg<uint64_t>(operands, metadata);
+}
+
+// clz xd, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CLZXr>() {
+  results[0] = arithmeticHelp::clz_reg<int64_t>(operands);
+}
+
+// cmeq vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMEQv16i8>() {
+  results[0] = neonHelp::vecCompare<uint8_t, 16>(
+      operands, false,
+      [](uint8_t x, uint8_t y) -> bool { return (x == y); });
+}
+
+// cmeq vd.16b, vn.16b, #0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMEQv16i8rz>() {
+  results[0] = neonHelp::vecCompare<uint8_t, 16>(
+      operands, true,
+      [](uint8_t x, uint8_t y) -> bool { return (x == y); });
+}
+
+// cmeq vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMEQv4i32>() {
+  results[0] = neonHelp::vecCompare<uint32_t, 4>(
+      operands, false,
+      [](uint32_t x, uint32_t y) -> bool { return (x == y); });
+}
+
+// cmeq vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMEQv8i8>() {
+  results[0] = neonHelp::vecCompare<int8_t, 8>(
+      operands, false,
+      [](int8_t x, int8_t y) -> bool { return (x == y); });
+}
+
+// cmeq vd.8b, vn.8b, #0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMEQv8i8rz>() {
+  results[0] = neonHelp::vecCompare<int8_t, 8>(
+      operands, true,
+      [](int8_t x, int8_t y) -> bool { return (x == y); });
+}
+
+// cmhi vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMHIv4i32>() {
+  results[0] = neonHelp::vecCompare<uint32_t, 4>(
+      operands, false,
+      [](uint32_t x, uint32_t y) -> bool { return (x > y); });
+}
+
+// cmhs vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMHSv16i8>() {
+  results[0] = neonHelp::vecCompare<int8_t, 16>(
+      operands, false,
+      [](int8_t x, int8_t y) -> bool { return (x >= y); });
+}
+
+// cmpeq pd.b, pg/z, zn.b, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZI_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint8_t>(
+      operands, metadata, VL_bits, true,
+      [](uint8_t x, uint8_t y) -> bool { return x == y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpeq pd.d, pg/z, zn.d, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint64_t>(
+      operands, metadata, VL_bits, true,
+      [](uint64_t x, uint64_t y) -> bool { return x == y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpeq pd.h, pg/z, zn.h, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZI_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint16_t>(
+      operands, metadata, VL_bits, true,
+      [](uint16_t x, uint16_t y) -> bool { return x == y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpeq pd.s, pg/z, zn.s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint32_t>(
+      operands, metadata, VL_bits, true,
+      [](uint32_t x, uint32_t y) -> bool { return x == y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpeq pd.b, pg/z, zn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint8_t>(
+      operands, metadata, VL_bits, false,
+      [](uint8_t x, uint8_t y) -> bool { return x == y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpeq pd.d, pg/z, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint64_t>(
+      operands, metadata, VL_bits, false,
+      [](uint64_t x, uint64_t y) -> bool { return x == y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpeq pd.h, pg/z, zn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint16_t>(
+      operands, metadata, VL_bits, false,
+      [](uint16_t x, uint16_t y) -> bool { return x == y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpeq pd.s, pg/z, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint32_t>(
+      operands, metadata, VL_bits, false,
+      [](uint32_t x, uint32_t y) -> bool { return x == y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpgt pd.b, pg/z, zn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPGT_PPzZZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int8_t>(
+      operands, metadata, VL_bits, false,
+      [](int8_t x, int8_t y) -> bool { return x > y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpgt pd.d, pg/z, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPGT_PPzZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int64_t>(
+      operands, metadata, VL_bits, false,
+      [](int64_t x, int64_t y) -> bool { return x > y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpgt pd.h, pg/z, zn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPGT_PPzZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int16_t>(
+      operands, metadata, VL_bits, false,
+      [](int16_t x, int16_t y) -> bool { return x > y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpgt pd.s, pg/z, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPGT_PPzZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int32_t>(
+      operands, metadata, VL_bits, false,
+      [](int32_t x, int32_t y) -> bool { return x > y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmphi pd.b, pg/z, zn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPHI_PPzZZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint8_t>(
+      operands, metadata, VL_bits, false,
+      [](uint8_t x, uint8_t y) -> bool { return x > y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmphi pd.d, pg/z, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPHI_PPzZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint64_t>(
+      operands, metadata, VL_bits, false,
+      [](uint64_t x, uint64_t y) -> bool { return x > y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmphi pd.h, pg/z, zn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPHI_PPzZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint16_t>(
+      operands, metadata, VL_bits, false,
+      [](uint16_t x, uint16_t y) -> bool { return x > y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmphi pd.s, pg/z, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPHI_PPzZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<uint32_t>(
+      operands, metadata, VL_bits, false,
+      [](uint32_t x, uint32_t y) -> bool { return x > y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpne pd.b, pg/z. zn.b, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZI_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int8_t>(
+      operands, metadata, VL_bits, true,
+      [](int8_t x, int8_t y) -> bool { return x != y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpne pd.d, pg/z. zn.d, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int64_t>(
+      operands, metadata, VL_bits, true,
+      [](int64_t x, int64_t y) -> bool { return x != y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpne pd.h, pg/z. zn.h, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZI_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int16_t>(
+      operands, metadata, VL_bits, true,
+      [](int16_t x, int16_t y) -> bool { return x != y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpne pd.s, pg/z. zn.s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int32_t>(
+      operands, metadata, VL_bits, true,
+      [](int32_t x, int32_t y) -> bool { return x != y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpne pd.b, pg/z, zn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int8_t>(
+      operands, metadata, VL_bits, false,
+      [](int8_t x, int8_t y) -> bool { return x != y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpne pd.d, pg/z, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int64_t>(
+      operands, metadata, VL_bits, false,
+      [](int64_t x, int64_t y) -> bool { return x != y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpne pd.h, pg/z, zn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int16_t>(
+      operands, metadata, VL_bits, false,
+      [](int16_t x, int16_t y) -> bool { return x != y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cmpne pd.s, pg/z, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] = sveHelp::sveCmpPredicated_toPred<int32_t>(
+      operands, metadata, VL_bits, false,
+      [](int32_t x, int32_t y) -> bool { return x != y; });
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// cntb xd{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CNTB_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCnt_gpr<uint8_t>(metadata, VL_bits);
+}
+
+// cntd xd{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CNTD_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCnt_gpr<uint64_t>(metadata, VL_bits);
+}
+
+// cnth xd{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CNTH_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCnt_gpr<uint16_t>(metadata, VL_bits);
+}
+
+// cntp xd, pg, pn.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CNTP_XPP_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCntp<uint8_t>(operands, VL_bits);
+}
+
+// cntp xd, pg, pn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CNTP_XPP_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCntp<uint8_t>(operands, VL_bits);
+}
+
+// cntp xd, pg, pn.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CNTP_XPP_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCntp<uint8_t>(operands, VL_bits);
+}
+
+// cntp xd, pg, pn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CNTP_XPP_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCntp<uint8_t>(operands, VL_bits);
+}
+
+// cntw xd{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CNTW_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCnt_gpr<uint32_t>(metadata, VL_bits);
+}
+
+// cnt vd.8b, vn.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CNTv8i8>() {
+  results[0] = neonHelp::vecCountPerByte<uint8_t, 8>(operands);
+}
+
+// cpy zd.b, pg/z, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CPY_ZPzI_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCpy_imm<int8_t>(operands, metadata, VL_bits);
+}
+
+// cpy zd.d, pg/z, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CPY_ZPzI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCpy_imm<int64_t>(operands, metadata, VL_bits);
+}
+
+// cpy zd.h, pg/z, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CPY_ZPzI_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCpy_imm<int16_t>(operands, metadata, VL_bits);
+}
+
+// cpy zd.s, pg/z, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CPY_ZPzI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveCpy_imm<int32_t>(operands, metadata, VL_bits);
+}
+
+// dup vd, vn.s[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPi32>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint32_t, 1>(operands, metadata, false);
+}
+
+// dup vd, vn.d[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPi64>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint64_t, 1>(operands, metadata, false);
+}
+
+// csel wd, wn, wm, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CSELWr>() {
+  results[0] = {
+      conditionalHelp::cs_4ops<uint32_t>(
+          operands, metadata, [](uint32_t x) -> uint32_t { return x; }),
+      8};
+}
+
+// csel xd, xn, xm, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CSELXr>() {
+  results[0] = conditionalHelp::cs_4ops<uint64_t>(
+      operands, metadata, [](uint64_t x) -> uint64_t { return x; });
+}
+
+// csinc wd, wn, wm, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CSINCWr>() {
+  results[0] = {conditionalHelp::cs_4ops<uint32_t>(
+                    operands, metadata,
+                    [](uint32_t x) -> uint32_t { return x + 1; }),
+                8};
+}
+
+// csinc xd, xn, xm, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CSINCXr>() {
+  results[0] = conditionalHelp::cs_4ops<uint64_t>(
+      operands, metadata, [](uint64_t x) -> uint64_t { return x + 1; });
+}
+
+// csinv wd, wn, wm, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CSINVWr>() {
+  results[0] = {
+      conditionalHelp::cs_4ops<uint32_t>(
+          operands, metadata, [](uint32_t x) -> uint32_t { return ~x; }),
+      8};
+}
+
+// csinv xd, xn, xm, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CSINVXr>() {
+  results[0] = conditionalHelp::cs_4ops<uint64_t>(
+      operands, metadata, [](uint64_t x) -> uint64_t { return ~x; });
+}
+
+// csneg wd, wn, wm, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CSNEGWr>() {
+  results[0] = {
+      conditionalHelp::cs_4ops<int32_t>(
+          operands, metadata, [](int32_t x) -> int32_t { return -x; }),
+      8};
+}
+
+// csneg xd, xn, xm, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_CSNEGXr>() {
+  results[0] = conditionalHelp::cs_4ops<uint64_t>(
+      operands, metadata, [](uint64_t x) -> uint64_t { return -x; });
+}
+
+// decb xdn{, pattern{, MUL #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DECB_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveDec_scalar<int8_t>(operands, metadata, VL_bits);
+}
+
+// decd xdn{, pattern{, MUL #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DECD_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveDec_scalar<int64_t>(operands, metadata, VL_bits);
+}
+
+// dmb option|#imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DMB>() {
+  // TODO: Respect memory barriers
+}
+
+// dupm zd.t, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPM_ZI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t imm = static_cast<uint64_t>(metadata.operands[1].imm);
+  uint64_t out[32] = {0};
+  for (int i = 0; i < (VL_bits / 64); i++) {
+    out[i] = imm;
+  }
+  results[0] = {out, 256};
+}
+
+// dup zd.b, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZI_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveDup_immOrScalar<int8_t>(operands, metadata,
+                                                   VL_bits, true);
+}
+
+// dup zd.d, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveDup_immOrScalar<int64_t>(operands, metadata,
+                                                    VL_bits, true);
+}
+
+// dup zd.h, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZI_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveDup_immOrScalar<int16_t>(operands, metadata,
+                                                    VL_bits, true);
+}
+
+// dup zd.s, #imm{, shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveDup_immOrScalar<int32_t>(operands, metadata,
+                                                    VL_bits, true);
+}
+
+// dup zd.b, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZR_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveDup_immOrScalar<int8_t>(operands, metadata,
+                                                   VL_bits, false);
+}
+
+// dup zd.d, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZR_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveDup_immOrScalar<int64_t>(operands, metadata,
+                                                    VL_bits, false);
+}
+
+// dup zd.h, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZR_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveDup_immOrScalar<int16_t>(operands, metadata,
+                                                    VL_bits, false);
+}
+
+// dup zd.s, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZR_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveDup_immOrScalar<int32_t>(operands, metadata,
+                                                    VL_bits, false);
+}
+
+// dup zd.d, zn.d[#imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZZI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveDup_vecIndexed<uint64_t>(operands, metadata, VL_bits);
+}
+
+// dup zd.q, zn.q[#imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZZI_Q>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // No data-type for quadwords, but as data is just being moved around we
+  // can use uint64_t.
+  const uint16_t index =
+      2 * static_cast<uint16_t>(metadata.operands[1].vector_index);
+  const uint64_t* n = operands[0].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 128;
+  uint64_t out[32] = {0};
+
+  if (index < partition_num) {
+    const uint64_t elementHi = n[index];
+    const uint64_t elementLo = n[index + 1];
+    for (int i = 0; i < partition_num; i++) {
+      out[2 * i] = elementHi;      // Copy over top half of quadword
+      out[2 * i + 1] = elementLo;  // Copy over lower half of quadword
+    }
+  }
+  results[0] = out;
+}
+
+// dup zd.s, zn.s[#imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUP_ZZI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveDup_vecIndexed<uint32_t>(operands, metadata, VL_bits);
+}
+
+// dup vd.16b, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPv16i8gpr>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint8_t, 16>(operands, metadata, true);
+}
+
+// dup vd.2s, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPv2i32gpr>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint32_t, 2>(operands, metadata, true);
+}
+
+// dup vd.2s, vn.s[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPv2i32lane>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint32_t, 2>(operands, metadata, false);
+}
+
+// dup vd.2d, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPv2i64gpr>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint64_t, 2>(operands, metadata, true);
+}
+
+// dup vd.2d, vn.d[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPv2i64lane>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint64_t, 2>(operands, metadata, false);
+}
+
+// dup vd.4h, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPv4i16gpr>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint16_t, 4>(operands, metadata, true);
+}
+
+// dup vd.4s, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPv4i32gpr>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint32_t, 4>(operands, metadata, true);
+}
+
+// dup vd.4s, vn.s[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPv4i32lane>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint32_t, 4>(operands, metadata, false);
+}
+
+// dup vd.8h, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_DUPv8i16gpr>() {
+  results[0] =
+      neonHelp::vecDup_gprOrIndex<uint16_t, 8>(operands, metadata, true);
+}
+
+// eor wd, wn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EORWri>() {
+  auto [result, nzcv] = logicalHelp::logicOp_imm<uint32_t>(
+      operands, metadata, false,
+      [](uint32_t x, uint32_t y) -> uint32_t { return x ^ y; });
+  results[0] = {result, 8};
+}
+
+// eor wd, wn, wm{, shift #imm}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EORWrs>() {
+  auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint32_t>(
+      operands, metadata, false,
+      [](uint32_t x, uint32_t y) -> uint32_t { return x ^ y; });
+  results[0] = {result, 8};
+}
+
+// eor xd, xn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EORXri>() {
+  auto [result, nzcv] = logicalHelp::logicOp_imm<uint64_t>(
+      operands, metadata, false,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x ^ y; });
+  results[0] = result;
+}
+
+// eor xd, xn, xm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EORXrs>() {
+  auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint64_t>(
+      operands, metadata, false,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x ^ y; });
+  results[0] = result;
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EOR_PPzPP>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOp_preds<uint8_t>(
+      operands, VL_bits,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x ^ y; });
+}
+
+// eor zdn.b, pg/m, zdn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EOR_ZPmZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint8_t>(
+      operands, VL_bits,
+      [](uint8_t x, uint8_t y) -> uint8_t { return x ^ y; });
+}
+
+// eor zdn.d, pg/m, zdn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EOR_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint64_t>(
+      operands, VL_bits,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x ^ y; });
+}
+
+// eor zdn.h, pg/m, zdn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EOR_ZPmZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint16_t>(
+      operands, VL_bits,
+      [](uint16_t x, uint16_t y) -> uint16_t { return x ^ y; });
+}
+
+// eor zdn.s, pg/m, zdn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EOR_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<uint32_t>(
+      operands, VL_bits,
+      [](uint32_t x, uint32_t y) -> uint32_t { return x ^ y; });
+}
+
+// eor vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EORv16i8>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 16>(
+      operands, [](uint8_t x, uint8_t y) -> uint8_t { return x ^ y; });
+}
+
+// eor vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EORv8i8>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 8>(
+      operands, [](uint8_t x, uint8_t y) -> uint8_t { return x ^ y; });
+}
+
+// extr wd, wn, wm, #lsb
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EXTRWrri>() {
+  results[0] = {
+      bitmanipHelp::extrLSB_registers<uint32_t>(operands, metadata), 8};
+}
+
+// extr xd, xn, xm, #lsb
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EXTRXrri>() {
+  results[0] =
+      bitmanipHelp::extrLSB_registers<uint64_t>(operands, metadata);
+}
+
+// ext vd.16b, vn.16b, vm.16b, #index
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EXTv16i8>() {
+  results[0] =
+      neonHelp::vecExtVecs_index<uint8_t, 16>(operands, metadata);
+}
+
+// ext vd.8b, vn.8b, vm.8b, #index
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_EXTv8i8>() {
+  results[0] = neonHelp::vecExtVecs_index<uint8_t, 8>(operands, metadata);
+}
+
+// fabd sd, sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FABD32>() {
+  results[0] = floatHelp::fabd_3ops<float>(operands);
+}
+
+// fabd dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FABD64>() {
+  results[0] = floatHelp::fabd_3ops<double>(operands);
+}
+
+// fabs dd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FABSDr>() {
+  results[0] = floatHelp::fabs_2ops<double>(operands);
+}
+
+// fabs sd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FABSSr>() {
+  results[0] = floatHelp::fabs_2ops<float>(operands);
+}
+
+// fabs zd.d, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FABS_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFabsPredicated<double>(operands, VL_bits);
+}
+
+// fabs zd.s, pg/m, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FABS_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFabsPredicated<float>(operands, VL_bits);
+}
+
+// fabs vd.2d, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FABSv2f64>() {
+  results[0] = neonHelp::vecFabs_2ops<double, 2>(operands);
+}
+
+// fabs vd.4s, vn.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FABSv4f32>() {
+  results[0] = neonHelp::vecFabs_2ops<float, 4>(operands);
+}
+
+// fadda dd, pg/m, dn, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDA_VPZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFaddaPredicated<double>(operands, VL_bits);
+}
+
+// fadd dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDDrr>() {
+  results[0] = {arithmeticHelp::add_3ops<double>(operands), 256};
+}
+
+// faddp vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDPv2f32>() {
+  results[0] = neonHelp::vecAddp_3ops<float, 2>(operands);
+}
+
+// faddp vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDPv2f64>() {
+  results[0] = neonHelp::vecAddp_3ops<double, 2>(operands);
+}
+
+// faddp dd, vn.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDPv2i32p>() {
+  results[0] = neonHelp::vecSumElems_2ops<float, 2>(operands);
+}
+
+// faddp dd, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDPv2i64p>() {
+  results[0] = neonHelp::vecSumElems_2ops<double, 2>(operands);
+}
+
+// faddp vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDPv4f32>() {
+  results[0] = neonHelp::vecAddp_3ops<float, 4>(operands);
+}
+
+// fadd sd, sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDSrr>() {
+  results[0] = {arithmeticHelp::add_3ops<float>(operands), 256};
+}
+
+// fadd zdn.d, pg/m, zdn.d, const
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADD_ZPmI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAddPredicated_const<double>(operands, metadata,
+                                                       VL_bits);
+}
+
+// fadd zdn.s, pg/m, zdn.s, const
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADD_ZPmI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveAddPredicated_const<float>(operands, metadata, VL_bits);
+}
+
+// fadd zdn.d, pg/m, zdn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADD_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAddPredicated_vecs<double>(operands, VL_bits);
+}
+
+// fadd zdn.s, pg/m, zdn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADD_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAddPredicated_vecs<float>(operands, VL_bits);
+}
+
+// fadd zd.d, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADD_ZZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAdd_3ops<double>(operands, VL_bits);
+}
+
+// fadd zd.s, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADD_ZZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAdd_3ops<float>(operands, VL_bits);
+}
+
+// fadd vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDv2f32>() {
+  results[0] = neonHelp::vecAdd_3ops<float, 2>(operands);
+}
+
+// fadd vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDv2f64>() {
+  results[0] = neonHelp::vecAdd_3ops<double, 2>(operands);
+}
+
+// fadd vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FADDv4f32>() {
+  results[0] = neonHelp::vecAdd_3ops<float, 4>(operands);
+}
+
+// fcadd zdn.d, pg/m, zdn.d, zm.d, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCADD_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcaddPredicated<double>(operands, metadata, VL_bits);
+}
+
+// fccmp sn, sm, #nzcv, cc
+// fccmpe sn, sm, #nzcv, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCCMPEDrr>() {
+  results[0] = floatHelp::fccmp<double>(operands, metadata);
+}
+
+// fccmpe sn, sm, #nzcv, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCCMPESrr>() {
+  results[0] = floatHelp::fccmp<float>(operands, metadata);
+}
+
+// fccmp sn, sm, #nzcv, cc
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCCMPSrr>() {
+  results[0] = floatHelp::fccmp<float>(operands, metadata);
+}
+
+// fcmeq vd.2s, vd.2s, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMEQv2i32rz>() {
+  results[0] = neonHelp::vecFCompare<float, uint32_t, 2>(
+      operands, true, [](float x, float y) -> bool { return x == y; });
+}
+
+// fcmeq vd.4s vn.4s, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMEQv4i32rz>() {
+  results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
+      operands, true, [](float x, float y) -> bool { return x == y; });
+}
+
+// fcmge pd.d, pg/z, zn.d, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGE_PPzZ0_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<double>(
+      operands, metadata, VL_bits, true,
+      [](double x, double y) -> bool { return x >= y; });
+}
+
+// fcmge pd.s, pg/z, zn.s, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGE_PPzZ0_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
+      operands, metadata, VL_bits, true,
+      [](float x, float y) -> bool { return x >= y; });
+}
+
+// fcmge pd.d, pg/z, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGE_PPzZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<double>(
+      operands, metadata, VL_bits, false,
+      [](double x, double y) -> bool { return x >= y; });
+}
+
+// fcmge pd.s, pg/z, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGE_PPzZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
+      operands, metadata, VL_bits, false,
+      [](float x, float y) -> bool { return x >= y; });
+}
+
+// fcmge vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGEv2f32>() {
+  results[0] = neonHelp::vecFCompare<float, uint32_t, 2>(
+      operands, false, [](float x, float y) -> bool { return x >= y; });
+}
+
+// fcmge vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGEv2f64>() {
+  results[0] = neonHelp::vecFCompare<double, uint64_t, 2>(
+      operands, false, [](float x, double y) -> bool { return x >= y; });
+}
+
+// fcmge vd.2d, vn.2d, 0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGEv2i64rz>() {
+  results[0] = neonHelp::vecFCompare<double, uint64_t, 2>(
+      operands, true, [](double x, double y) -> bool { return x >= y; });
+}
+
+// fcmge vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGEv4f32>() {
+  results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
+      operands, false, [](float x, float y) -> bool { return x >= y; });
+}
+
+// fcmge vd.4s, vn.4s, 0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGEv4i32rz>() {
+  results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
+      operands, true, [](float x, float y) -> bool { return x >= y; });
+}
+
+// fcmgt pd.d, pg/z, zn.d, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGT_PPzZ0_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<double>(
+      operands, metadata, VL_bits, true,
+      [](double x, double y) -> bool { return x > y; });
+}
+
+// fcmgt pd.s, pg/z, zn.s, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGT_PPzZ0_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
+      operands, metadata, VL_bits, true,
+      [](float x, float y) -> bool { return x > y; });
+}
+
+// fcmgt pd.d, pg/z, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGT_PPzZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<double>(
+      operands, metadata, VL_bits, false,
+      [](double x, double y) -> bool { return x > y; });
+}
+
+// fcmgt pd.s, pg/z, zn.s, zm.
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGT_PPzZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
+      operands, metadata, VL_bits, false,
+      [](float x, float y) -> bool { return x > y; });
+}
+
+// fcmgt vd.2s, vn.2s, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGTv2i32rz>() {
+  results[0] = neonHelp::vecFCompare<float, uint32_t, 2>(
+      operands, true, [](float x, float y) -> bool { return x > y; });
+}
+
+// fcmgt vd.2d, vn.2d, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGTv2i64rz>() {
+  results[0] = neonHelp::vecFCompare<double, uint64_t, 2>(
+      operands, true, [](double x, double y) -> bool { return x > y; });
+}
+
+// fcmgt vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGTv4f32>() {
+  results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
+      operands, false, [](float x, float y) -> bool { return x > y; });
+}
+
+// fcmgt vd.4s, vn.4s, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMGTv4i32rz>() {
+  results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
+      operands, true, [](float x, float y) -> bool { return x > y; });
+}
+
+// fcmla zda, pg/m, zn, zm, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMLA_ZPmZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcmlaPredicated<double>(operands, metadata, VL_bits);
+}
+
+// fcmle pd.d, pg/z, zn.d, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMLE_PPzZ0_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<double>(
+      operands, metadata, VL_bits, true,
+      [](double x, double y) -> bool { return x <= y; });
+}
+
+// fcmle pd.s, pg/z, zn.s, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMLE_PPzZ0_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
+      operands, metadata, VL_bits, true,
+      [](float x, float y) -> bool { return x <= y; });
+}
+
+// fcmlt pd.s, pg/z, zn.s, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMLT_PPzZ0_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveComparePredicated_vecsToPred<float>(
+      operands, metadata, VL_bits, true,
+      [](float x, float y) -> bool { return x < y; });
+}
+
+// fcmlt vd.2s, vn.2s, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMLTv2i32rz>() {
+  results[0] = neonHelp::vecFCompare<float, uint32_t, 2>(
+      operands, true, [](float x, float y) -> bool { return x < y; });
+}
+
+// fcmlt vd.2d, vn.2d, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMLTv2i64rz>() {
+  results[0] = neonHelp::vecFCompare<double, uint64_t, 2>(
+      operands, true, [](double x, double y) -> bool { return x < y; });
+}
+
+// fcmlt vd.4s, vn.4s, #0.0
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMLTv4i32rz>() {
+  results[0] = neonHelp::vecFCompare<float, uint32_t, 4>(
+      operands, true, [](float x, float y) -> bool { return x < y; });
+}
+
+// fcmp dn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMPDri>() {
+  results[0] = floatHelp::fcmp<double>(operands, true);
+}
+
+// fcmp dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMPDrr>() {
+  results[0] = floatHelp::fcmp<double>(operands, false);
+}
+
+// fcmpe dn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMPEDri>() {
+  results[0] = floatHelp::fcmp<double>(operands, true);
+}
+
+// fcmpe dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMPEDrr>() {
+  results[0] = floatHelp::fcmp<double>(operands, false);
+}
+
+// fcmpe sn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMPESri>() {
+  results[0] = floatHelp::fcmp<float>(operands, true);
+}
+
+// fcmpe sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMPESrr>() {
+  results[0] = floatHelp::fcmp<float>(operands, false);
+}
+
+// fcmp sn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMPSri>() {
+  results[0] = floatHelp::fcmp<float>(operands, true);
+}
+
+// fcmp sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCMPSrr>() {
+  results[0] = floatHelp::fcmp<float>(operands, false);
+}
+
+// fcpy zd.d, pg/m, #const
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCPY_ZPmI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFcpy_imm<double>(operands, metadata, VL_bits);
+}
+
+// fcpy zd.s, pg/m, #const
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCPY_ZPmI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFcpy_imm<float>(operands, metadata, VL_bits);
+}
+
+// fcsel dd, dn, dm, cond
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCSELDrrr>() {
+  results[0] = {
+      conditionalHelp::cs_4ops<double>(
+          operands, metadata, [](double x) -> double { return x; }),
+      256};
+}
+
+// fcsel sd, sn, sm, cond
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCSELSrrr>() {
+  results[0] = {
+      conditionalHelp::cs_4ops<float>(operands, metadata,
+                                      [](float x) -> float { return x; }),
+      256};
+}
+
+// fcvtas wd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTASUWDr>() {
+  results[0] = {static_cast<int32_t>(round(operands[0].get<double>())),
+                8};
+}
+
+// fcvtas xd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTASUXDr>() {
+  results[0] = static_cast<int64_t>(round(operands[0].get<double>()));
+}
+
+// fcvt dd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTDSr>() {
+  // TODO: Handle NaNs, denorms, and saturation?
+  results[0] = neonHelp::vecFcvtl<double, float, 1>(operands, false);
+}
+
+// fcvtl vd.2d, vn.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTLv2i32>() {
+  results[0] = neonHelp::vecFcvtl<double, float, 2>(operands, false);
+}
+
+// fcvtl2 vd.2d, vn.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTLv4i32>() {
+  results[0] = neonHelp::vecFcvtl<double, float, 2>(operands, true);
+}
+
+// fcvtn vd.2s, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTNv2i32>() {
+  results[0] = neonHelp::vecFcvtn<float, double, 2>(operands, false);
+}
+
+// fcvtn2 vd.4s, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTNv4i32>() {
+  results[0] = neonHelp::vecFcvtn<float, double, 4>(operands, true);
+}
+
+// fcvt sd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTSDr>() {
+  // TODO: Handle NaNs, denorms, and saturation?
+  results[0] = neonHelp::vecFcvtl<float, double, 1>(operands, false);
+}
+
+// fcvtzs wd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZSUWDr>() {
+  // TODO: Handle NaNs, denorms, and saturation
+  results[0] = {
+      static_cast<int32_t>(std::trunc(operands[0].get<double>())), 8};
+}
+
+// fcvtzs wd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZSUWSr>() {
+  // TODO: Handle NaNs, denorms, and saturation
+  results[0] = {
+      static_cast<int32_t>(std::trunc(operands[0].get<float>())), 8};
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZSUXDr>() {
+  // TODO: Handle NaNs, denorms, and saturation
+  results[0] = {
+      static_cast<int64_t>(std::trunc(operands[0].get<double>())), 8};
+}
+
+// fcvtzs zd.d, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZS_ZPmZ_DtoD>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcvtzsPredicated<int64_t, double>(operands, VL_bits);
+}
+
+// fcvtzs zd.s, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZS_ZPmZ_DtoS>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcvtzsPredicated<int32_t, double>(operands, VL_bits);
+}
+
+// fcvtzs zd.d, pg/m, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZS_ZPmZ_StoD>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcvtzsPredicated<int64_t, float>(operands, VL_bits);
+}
+
+// fcvtzs zd.s, pg/m, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZS_ZPmZ_StoS>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcvtzsPredicated<int32_t, float>(operands, VL_bits);
+}
+
+// fcvtzs vd.2d, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZSv2f64>() {
+  results[0] = neonHelp::vecFcvtzs<int64_t, double, 2>(operands);
+}
+
+// fcvtzu wd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZUUWDr>() {
+  // TODO: Handle NaNs, denorms, and saturation
+  results[0] = {
+      static_cast<int32_t>(std::trunc(operands[0].get<double>())), 8};
+}
+
+// fcvtzu wd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZUUWSr>() {
+  // TODO: Handle NaNs, denorms, and saturation
+  results[0] = {
+      static_cast<int32_t>(std::trunc(operands[0].get<float>())), 8};
+}
+
+// fcvtzu xd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZUUXDr>() {
+  // TODO: Handle NaNs, denorms, and saturation
+  results[0] =
+      static_cast<int64_t>(std::trunc(operands[0].get<double>()));
+}
+
+// fcvtzu xd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVTZUUXSr>() {
+  // TODO: Handle NaNs, denorms, and saturation
+  results[0] = static_cast<int64_t>(std::trunc(operands[0].get<float>()));
+}
+
+// fcvt zd.s, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVT_ZPmZ_DtoS>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcvtPredicated<float, double>(operands, VL_bits);
+}
+
+// fcvt zd.d, pg/m, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FCVT_ZPmZ_StoD>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcvtPredicated<double, float>(operands, VL_bits);
+}
+
+// fdiv dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FDIVDrr>() {
+  results[0] = {divideHelp::div_3ops<double>(operands), 256};
+}
+
+// fdivr zdn.d, pg/m, zdn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FDIVR_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<double>(
+      operands, VL_bits,
+      [](double x, double y) -> double { return (y / x); });
+}
+
+// fdivr zdn.s, pg/m, zdn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FDIVR_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<float>(
+      operands, VL_bits,
+      [](float x, float y) -> float { return (y / x); });
+}
+
+// fdiv sd, sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FDIVSrr>() {
+  results[0] = {divideHelp::div_3ops<float>(operands), 256};
+}
+
+// fdiv zdn.d, pg/m, zdn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FDIV_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<double>(
+      operands, VL_bits,
+      [](double x, double y) -> double { return (x / y); });
+}
+
+// fdiv vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FDIVv2f64>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<double, 2>(
+      operands, [](double x, double y) -> double { return x / y; });
+}
+
+// fdup zd.d, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FDUP_ZI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveDup_immOrScalar<double>(operands, metadata,
+                                                   VL_bits, true);
+}
+
+// fdup zd.s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FDUP_ZI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveDup_immOrScalar<float>(operands, metadata,
+                                                  VL_bits, true);
+}
+
+// fmadd dn, dm, da
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMADDDrrr>() {
+  results[0] = {multiplyHelp::madd_4ops<double>(operands), 256};
+}
+
+// fmadd sn, sm, sa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMADDSrrr>() {
+  results[0] = {multiplyHelp::madd_4ops<float>(operands), 256};
+}
+
+// fmad zd.d, pg/m, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMAD_ZPmZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFmadPredicated_vecs<double>(operands, VL_bits);
+}
+
+// fmad zd.s, pg/m, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMAD_ZPmZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFmadPredicated_vecs<float>(operands, VL_bits);
+}
+
+// fmaxnm dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMAXNMDrr>() {
+  results[0] = floatHelp::fmaxnm_3ops<double>(operands);
+}
+
+// fmaxnmp dd, vd.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMAXNMPv2i64p>() {
+  results[0] = neonHelp::vecMaxnmp_2ops<double, 2>(operands);
+}
+
+// fmaxnm sd, sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMAXNMSrr>() {
+  results[0] = floatHelp::fmaxnm_3ops<float>(operands);
+}
+
+// fmaxnm vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMAXNMv2f64>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<double, 2>(
+      operands,
+      [](double x, double y) -> double { return std::fmax(x, y); });
+}
+
+// fminnm dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMINNMDrr>() {
+  results[0] = floatHelp::fminnm_3ops<double>(operands);
+}
+
+// fminnmp dd, vd.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMINNMPv2i64p>() {
+  results[0] = neonHelp::vecMinv_2ops<double, 2>(operands);
+}
+
+// fminnm sd, sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMINNMSrr>() {
+  results[0] = floatHelp::fminnm_3ops<float>(operands);
+}
+
+// fminnm vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMINNMv2f64>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<double, 2>(
+      operands,
+      [](double x, double y) -> double { return std::fmin(x, y); });
+}
+
+// fmla zd.d, pg/m, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLA_ZPmZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMlaPredicated_vecs<double>(operands, VL_bits);
+}
+
+// fmla zd.s, pg/m, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLA_ZPmZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMlaPredicated_vecs<float>(operands, VL_bits);
+}
+
+// fmla vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLAv2f32>() {
+  results[0] = neonHelp::vecFmla_3vecs<float, 2>(operands);
+}
+
+// fmla vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLAv2f64>() {
+  results[0] = neonHelp::vecFmla_3vecs<double, 2>(operands);
+}
+
+// fmla vd.2s, vn.2s, vm.2s[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLAv2i32_indexed>() {
+  results[0] =
+      neonHelp::vecFmlaIndexed_3vecs<float, 2>(operands, metadata);
+}
+
+// fmla vd.2d, vn.2d, vm.d[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLAv2i64_indexed>() {
+  results[0] =
+      neonHelp::vecFmlaIndexed_3vecs<double, 2>(operands, metadata);
+}
+
+// fmla vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLAv4f32>() {
+  results[0] = neonHelp::vecFmla_3vecs<float, 4>(operands);
+}
+
+// fmla vd.4s, vn.4s, vm.s[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLAv4i32_indexed>() {
+  results[0] =
+      neonHelp::vecFmlaIndexed_3vecs<float, 4>(operands, metadata);
+}
+
+// fmls zd.d, pg/m, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLS_ZPmZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFmlsPredicated_vecs<double>(operands, VL_bits);
+}
+
+// fmls zd.s, pg/m, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLS_ZPmZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFmlsPredicated_vecs<float>(operands, VL_bits);
+}
+
+// fmls vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLSv2f64>() {
+  results[0] = neonHelp::vecFmls_3vecs<double, 2>(operands);
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLSv2i64_indexed>() {
+  results[0] =
+      neonHelp::vecFmlsIndexed_3vecs<double, 2>(operands, metadata);
+}
+
+// fmls vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLSv4f32>() {
+  results[0] = neonHelp::vecFmls_3vecs<float, 4>(operands);
+}
+
+// fmls vd.4s, vn.4s, vm.s[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMLSv4i32_indexed>() {
+  results[0] =
+      neonHelp::vecFmlsIndexed_3vecs<float, 4>(operands, metadata);
+}
+
+// fmov xd, vn.d[1]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVDXHighr>() {
+  results[0] = operands[0].getAsVector<double>()[1];
+}
+
+// fmov xd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVDXr>() {
+  results[0] = operands[0].get<double>();
+}
+
+// fmov dn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVDi>() {
+  results[0] = {metadata.operands[1].fp, 256};
+}
+
+// fmov dd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVDr>() {
+  results[0] = {operands[0].get<double>(), 256};
+}
+
+// fmov wd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVSWr>() {
+  results[0] = {operands[0].get<float>(), 8};
+}
+
+// fmov sn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVSi>() {
+  results[0] = {static_cast<float>(metadata.operands[1].fp), 256};
+}
+
+// fmov sd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVSr>() {
+  results[0] = {operands[0].get<float>(), 256};
+}
+
+// fmov sd, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVWSr>() {
+  results[0] = {operands[0].get<float>(), 256};
+}
+
+// fmov vd.d[1], xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVXDHighr>() {
+  double out[2] = {operands[0].get<double>(), operands[1].get<double>()};
+  results[0] = {out, 256};
+}
+
+// fmov dd, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVXDr>() {
+  results[0] = {operands[0].get<double>(), 256};
+}
+
+// fmov vd.2s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVv2f32_ns>() {
+  results[0] = neonHelp::vecMovi_imm<float, 2>(metadata);
+}
+
+// fmov vd.2d, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVv2f64_ns>() {
+  results[0] = neonHelp::vecMovi_imm<double, 2>(metadata);
+}
+
+// fmov vd.4s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMOVv4f32_ns>() {
+  results[0] = neonHelp::vecMovi_imm<float, 4>(metadata);
+}
+
+// fmsb zd.d, pg/m, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMSB_ZPmZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFmsbPredicated_vecs<double>(operands, VL_bits);
+}
+
+// fmsb zd.s, pg/m, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMSB_ZPmZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFmsbPredicated_vecs<float>(operands, VL_bits);
+}
+
+// fmsub dn, dm, da
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMSUBDrrr>() {
+  results[0] = {multiplyHelp::msub_4ops<double>(operands), 256};
+}
+
+// fmsub sn, sm, sa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMSUBSrrr>() {
+  results[0] = {multiplyHelp::msub_4ops<float>(operands), 256};
+}
+
+// fmul dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMULDrr>() {
+  results[0] = {multiplyHelp::mul_3ops<double>(operands), 256};
+}
+
+// fmul sd, sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMULSrr>() {
+  results[0] = {multiplyHelp::mul_3ops<float>(operands), 256};
+}
+
+// fmul zd.d, pg/m, zn.d, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMUL_ZPmI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMulPredicated<double>(operands, metadata,
+                                                 VL_bits, true);
+}
+
+// fmul zd.s, pg/m, zn.s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMUL_ZPmI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveMulPredicated<float>(operands, metadata, VL_bits, true);
+}
+
+// fmul zdn.d, pg/m, zdn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMUL_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMulPredicated<double>(operands, metadata,
+                                                 VL_bits, false);
+}
+
+// fmul zdn.s, pg/m, zdn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMUL_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMulPredicated<float>(operands, metadata,
+                                                VL_bits, false);
+}
+
+// fmul zd.d, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMUL_ZZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFmul_3ops<double>(operands, VL_bits);
+}
+
+// fmul zd.s, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMUL_ZZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFmul_3ops<float>(operands, VL_bits);
+}
+
+// fmul sd, sn, vm.s[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMULv1i32_indexed>() {
+  results[0] =
+      neonHelp::vecFmulIndexed_vecs<float, 1>(operands, metadata);
+}
+
+// fmul dd, dn, vm.d[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMULv1i64_indexed>() {
+  results[0] =
+      neonHelp::vecFmulIndexed_vecs<double, 1>(operands, metadata);
+}
+
+// fmul vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMULv2f32>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<float, 2>(
+      operands, [](float x, float y) -> float { return x * y; });
+}
+
+// fmul vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMULv2f64>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<double, 2>(
+      operands, [](double x, double y) -> double { return x * y; });
+}
+
+// fmul vd.2s, vn.2s, vm.s[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMULv2i32_indexed>() {
+  results[0] =
+      neonHelp::vecFmulIndexed_vecs<float, 2>(operands, metadata);
+}
+
+// fmul vd.2d, vn.2d, vm.d[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMULv2i64_indexed>() {
+  results[0] =
+      neonHelp::vecFmulIndexed_vecs<double, 2>(operands, metadata);
+}
+
+// fmul vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMULv4f32>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<float, 4>(
+      operands, [](float x, float y) -> float { return x * y; });
+}
+
+// fmul vd.4s, vn.4s, vm.s[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FMULv4i32_indexed>() {
+  results[0] =
+      neonHelp::vecFmulIndexed_vecs<float, 4>(operands, metadata);
+}
+
+// fneg dd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNEGDr>() {
+  results[0] = {-operands[0].get<double>(), 256};
+}
+
+// fneg sd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNEGSr>() {
+  results[0] = {-operands[0].get<float>(), 256};
+}
+
+// fneg zd.d, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNEG_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFnegPredicated<double>(operands, VL_bits);
+}
+
+// fneg zd.s, pg/m, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNEG_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFnegPredicated<float>(operands, VL_bits);
+}
+
+// fneg vd.2d, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNEGv2f64>() {
+  results[0] = neonHelp::vecFneg_2ops<double, 2>(operands);
+}
+
+// fneg vd.4s, vn.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNEGv4f32>() {
+  results[0] = neonHelp::vecFneg_2ops<float, 4>(operands);
+}
+
+// fnmadd dd, dn, dm, da
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNMADDDrrr>() {
+  results[0] = floatHelp::fnmadd_4ops<double>(operands);
+}
+
+// fnmadd sd, sn, sm, sa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNMADDSrrr>() {
+  results[0] = floatHelp::fnmadd_4ops<float>(operands);
+}
+
+// fnmls zd.d, pg/m, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNMLS_ZPmZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFnmlsPredicated<double>(operands, VL_bits);
+}
+
+// fnmls zd.s, pg/m, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNMLS_ZPmZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFnmlsPredicated<float>(operands, VL_bits);
+}
+
+// fnmsb zdn.d, pg/m, zm.d, za.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNMSB_ZPmZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFnmsbPredicated<double>(operands, VL_bits);
+}
+
+// fnmsb zdn.s, pg/m, zm.s, za.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNMSB_ZPmZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveFnmsbPredicated<float>(operands, VL_bits);
+}
+
+// fnmsub dd, dn, dm, da
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNMSUBDrrr>() {
+  results[0] = floatHelp::fnmsub_4ops<double>(operands);
+}
+
+// fnmsub sd, sn, sm, sa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNMSUBSrrr>() {
+  results[0] = floatHelp::fnmsub_4ops<float>(operands);
+}
+
+// fnmul dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNMULDrr>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<double, 1>(
+      operands, [](double x, double y) -> double { return -(x * y); });
+}
+
+// fnmul sd, sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FNMULSrr>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<float, 1>(
+      operands, [](float x, float y) -> float { return -(x * y); });
+}
+
+// frinta dd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRINTADr>() {
+  results[0] = {round(operands[0].get<double>()), 256};
+}
+
+// frintn zd.d, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRINTN_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFrintnPredicated<int64_t, double>(operands, VL_bits);
+}
+
+// frintn zd.s, pg/m, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRINTN_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFrintnPredicated<int32_t, float>(operands, VL_bits);
+}
+
+// frsqrte sd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRSQRTEv1i32>() {
+  results[0] = neonHelp::vecFrsqrte_2ops<float, 1>(operands);
+}
+
+// frsqrte dd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRSQRTEv1i64>() {
+  results[0] = neonHelp::vecFrsqrte_2ops<double, 1>(operands);
+}
+
+// frsqrte vd.2s, vn.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRSQRTEv2f32>() {
+  results[0] = neonHelp::vecFrsqrte_2ops<float, 2>(operands);
+}
+
+// frsqrte vd.2d, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRSQRTEv2f64>() {
+  results[0] = neonHelp::vecFrsqrte_2ops<double, 2>(operands);
+}
+
+// frsqrte vd.4s, vn.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRSQRTEv4f32>() {
+  results[0] = neonHelp::vecFrsqrte_2ops<float, 4>(operands);
+}
+
+// frsqrts sd, sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRSQRTS32>() {
+  results[0] = neonHelp::vecFrsqrts_3ops<float, 1>(operands);
+}
+
+// frsqrts dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRSQRTS64>() {
+  results[0] = neonHelp::vecFrsqrts_3ops<double, 1>(operands);
+}
+
+// frsqrts vd.2s, vn.2s, vn.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRSQRTSv2f32>() {
+  results[0] = neonHelp::vecFrsqrts_3ops<float, 2>(operands);
+}
+
+// frsqrts vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRSQRTSv2f64>() {
+  results[0] = neonHelp::vecFrsqrts_3ops<double, 2>(operands);
+}
+
+// frsqrts vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FRSQRTSv4f32>() {
+  results[0] = neonHelp::vecFrsqrts_3ops<float, 4>(operands);
+}
+
+// fsqrt dd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSQRTDr>() {
+  results[0] = {::sqrt(operands[0].get<double>()), 256};
+}
+
+// fsqrt sd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSQRTSr>() {
+  results[0] = {::sqrtf(operands[0].get<float>()), 256};
+}
+
+// fsqrt zd.d, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSQRT_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFsqrtPredicated_2vecs<double>(operands, VL_bits);
+}
+
+// fsqrt zd.s, pg/m, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSQRT_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFsqrtPredicated_2vecs<float>(operands, VL_bits);
+}
+
+// fsqrt vd.2d, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSQRTv2f64>() {
+  results[0] = neonHelp::vecFsqrt_2ops<double, 2>(operands);
+}
+
+// fsqrt vd.4s, vn.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSQRTv4f32>() {
+  results[0] = neonHelp::vecFsqrt_2ops<float, 4>(operands);
+}
+
+// fsub dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUBDrr>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<double, 1>(
+      operands, [](double x, double y) -> double { return x - y; });
+}
+
+// fsubr zdn.d, pg/m, zdn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUBR_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveSubrPredicated_3vecs<double>(operands, VL_bits);
+}
+
+// fsubr zdn.s, pg/m, zdn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUBR_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveSubrPredicated_3vecs<float>(operands, VL_bits);
+}
+
+// fsub ss, sn, sm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUBSrr>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<float, 1>(
+      operands, [](double x, double y) -> double { return x - y; });
+}
+
+// fsub zdn.d, pg/m, zdn.d, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUB_ZPmI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveSubPredicated_imm<double>(operands, metadata, VL_bits);
+}
+
+// fsub zdn.s, pg/m, zdn.s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUB_ZPmI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveSubPredicated_imm<float>(operands, metadata, VL_bits);
+}
+
+// fsub zdn.d, pg/m, zdn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUB_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<double>(
+      operands, VL_bits,
+      [](double x, double y) -> double { return x - y; });
+}
+
+// fsub zdn.s, pg/m, zdn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUB_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<float>(
+      operands, VL_bits, [](float x, float y) -> float { return x - y; });
+}
+
+// fsub zd.d, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUB_ZZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveSub_3vecs<double>(operands, VL_bits);
+}
+
+// fsub zd.s, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUB_ZZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveSub_3vecs<float>(operands, VL_bits);
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUBv2f32>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<float, 2>(
+      operands, [](float x, float y) -> float { return x - y; });
+}
+
+// fsub vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUBv2f64>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<double, 2>(
+      operands, [](double x, double y) -> double { return x - y; });
+}
+
+// fsub vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_FSUBv4f32>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<float, 4>(
+      operands, [](float x, float y) -> float { return x - y; });
+}
+
+// ld1d {zd.d}, pg/z, [zn.d{, #imm}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_GLD1D_IMM_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint64_t out[32] = {0};
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      out[i] = memoryData[index].get<uint64_t>();
+      index++;
+    }
+  }
+  results[0] = {out, 256};
+}
+
+// ld1d {zt.d}, pg/z, [xn, zm.d]
+// ld1d {zt.d}, pg/z, [xn, zm.d, LSL #3]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_GLD1D_SCALED_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  uint64_t out[32] = {0};
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      out[i] = memoryData[index].get<uint64_t>();
+      index++;
+    }
+  }
+
+  results[0] = {out, 256};
+}
+
+// ld1sw {zd.d}, pg/z, [zn.d{, #imm}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_GLD1SW_D_IMM_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  int64_t out[32] = {0};
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      out[i] = static_cast<int64_t>(memoryData[index].get<int32_t>());
+      index++;
+    }
+  }
+  results[0] = {out, 256};
+}
+
+// nop|yield|wfe|wfi|etc...
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_HINT>() {
+  // TODO: Observe hints
+}
+
+// incb xdn{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCB_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveInc_gprImm<int8_t>(operands, metadata, VL_bits);
+}
+
+// incd xdn{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCD_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveInc_gprImm<int64_t>(operands, metadata, VL_bits);
+}
+
+// incd zdn.d{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCD_ZPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveInc_imm<int64_t>(operands, metadata, VL_bits);
+}
+
+// inch xdn{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCH_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveInc_gprImm<int16_t>(operands, metadata, VL_bits);
+}
+
+// inch zdn.h{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCH_ZPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveInc_imm<int16_t>(operands, metadata, VL_bits);
+}
+
+// incp xdn, pm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCP_XP_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIncp_gpr<uint8_t>(operands, VL_bits);
+}
+
+// incp xdn, pm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCP_XP_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIncp_gpr<uint64_t>(operands, VL_bits);
+}
+
+// incp xdn, pm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCP_XP_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIncp_gpr<uint16_t>(operands, VL_bits);
+}
+
+// incp xdn, pm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCP_XP_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIncp_gpr<uint32_t>(operands, VL_bits);
+}
+
+// incw xdn{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCW_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveInc_gprImm<int32_t>(operands, metadata, VL_bits);
+}
+
+// incw zdn.s{, pattern{, #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INCW_ZPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveInc_imm<int32_t>(operands, metadata, VL_bits);
+}
+
+// index zd.b, #imm, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_II_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveIndex<int8_t>(operands, metadata, VL_bits, true, true);
+}
+
+// index zd.d, #imm, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_II_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveIndex<int64_t>(operands, metadata, VL_bits, true, true);
+}
+
+// index zd.h, #imm, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_II_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveIndex<int16_t>(operands, metadata, VL_bits, true, true);
+}
+
+// index zd.s, #imm, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_II_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveIndex<int32_t>(operands, metadata, VL_bits, true, true);
+}
+
+// index zd.b, #imm, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_IR_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int8_t, int32_t>(operands, metadata,
+                                                  VL_bits, true, false);
+}
+
+// index zd.d, #imm, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_IR_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int64_t, int64_t>(operands, metadata,
+                                                   VL_bits, true, false);
+}
+
+// index zd.h, #imm, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_IR_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int16_t, int32_t>(operands, metadata,
+                                                   VL_bits, true, false);
+}
+
+// index zd.s, #imm, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_IR_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int32_t, int32_t>(operands, metadata,
+                                                   VL_bits, true, false);
+}
+
+// index zd.b, wn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_RI_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int8_t, int32_t>(operands, metadata,
+                                                  VL_bits, false, true);
+}
+
+// index zd.d, xn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_RI_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int64_t, int64_t>(operands, metadata,
+                                                   VL_bits, false, true);
+}
+
+// index zd.h, wn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_RI_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int16_t, int32_t>(operands, metadata,
+                                                   VL_bits, false, true);
+}
+
+// index zd.s, wn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_RI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int32_t, int32_t>(operands, metadata,
+                                                   VL_bits, false, true);
+}
+
+// index zd.b, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_RR_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int8_t, int32_t>(operands, metadata,
+                                                  VL_bits, false, false);
+}
+
+// index zd.d, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_RR_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int64_t, int64_t>(operands, metadata,
+                                                   VL_bits, false, false);
+}
+
+// index zd.h, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_RR_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int16_t, int32_t>(operands, metadata,
+                                                   VL_bits, false, false);
+}
+
+// index zd.s, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INDEX_RR_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveIndex<int32_t, int32_t>(operands, metadata,
+                                                   VL_bits, false, false);
+}
+
+// ins vd.h[index], wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INSvi16gpr>() {
+  results[0] = neonHelp::vecInsIndex_gpr<uint16_t, uint32_t, 8>(operands,
+                                                                metadata);
+}
+
+// ins vd.s[index], wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INSvi32gpr>() {
+  results[0] = neonHelp::vecInsIndex_gpr<uint32_t, uint32_t, 4>(operands,
+                                                                metadata);
+}
+
+// ins vd.s[index1], vn.s[index2]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INSvi32lane>() {
+  results[0] = neonHelp::vecIns_2Index<uint32_t, 4>(operands, metadata);
+}
+
+// ins vd.d[index], xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INSvi64gpr>() {
+  results[0] = neonHelp::vecInsIndex_gpr<uint64_t, uint64_t, 2>(operands,
+                                                                metadata);
+}
+
+// ins vd.d[index1], vn.d[index2]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INSvi64lane>() {
+  results[0] = neonHelp::vecIns_2Index<uint64_t, 2>(operands, metadata);
+}
+
+// ins vd.b[index], wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_INSvi8gpr>() {
+  results[0] = neonHelp::vecInsIndex_gpr<uint8_t, uint32_t, 16>(operands,
+                                                                metadata);
+}
+
+// ld1b  {zt.b}, pg/z, [xn, xm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 8;
+  uint16_t index = 0;
+  uint8_t out[256] = {0};
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << (i % 64);
+    if (p[i / 64] & shifted_active) {
+      out[i] = memoryData[index].get<uint8_t>();
+      index++;
+    } else {
+      out[i] = 0;
+    }
+  }
+  results[0] = {out, 256};
+}
+
+// ld1d  {zt.d}, pg/z, [xn, xm, lsl #3]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  uint64_t out[32] = {0};
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      out[i] = memoryData[index].get<uint64_t>();
+      index++;
+    } else {
+      out[i] = 0;
+    }
+  }
+  results[0] = {out, 256};
+}
+
+// ld1d  {zt.d}, pg/z, [xn{, #imm, mul vl}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1D_IMM_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  uint64_t out[32] = {0};
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      out[i] = memoryData[index].get<uint64_t>();
+      index++;
+    } else {
+      out[i] = 0;
+    }
+  }
+  results[0] = {out, 256};
+}
+
+// ld1h  {zt.h}, pg/z, [xn, xm, lsl #1]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 16;
+  uint16_t index = 0;
+  uint16_t out[128] = {0};
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 32) * 2);
+    if (p[i / 32] & shifted_active) {
+      out[i] = memoryData[index].get<uint16_t>();
+      index++;
+    } else {
+      out[i] = 0;
+    }
+  }
+  results[0] = {out, 256};
+}
+
+// ld1 {vt.16b} [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Onev16b>() {
+  results[0] = memoryData[0].zeroExtend(memoryData[0].size(), 256);
+}
+
+// ld1 {vt.16b}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Onev16b_POST>() {
+  results[0] = memoryData[0].zeroExtend(memoryData[0].size(), 256);
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ld1rd {zt.d}, pg/z, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1RD_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint16_t partition_num = VL_bits / 64;
+  uint64_t out[32] = {0};
+  uint16_t index = 0;
+  // Check if any lanes are active, otherwise set all to 0 and break early
+  bool active = false;
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  for (int i = 0; i < 4; i++) {
+    if (p[i] != 0) {
+      active = true;
+      break;
+    }
+  }
+
+  if (active) {
+    uint64_t data = memoryData[0].get<uint64_t>();
+    for (int i = 0; i < partition_num; i++) {
+      uint64_t shifted_active = p[index / 8] & 1ull << ((index % 8) * 8);
+      out[i] = shifted_active ? data : 0;
+      index++;
+    }
+  }
+
+  results[0] = {out, 256};
+}
+
+// ld1rqd {zd.d}, pg/z, [xn{, #imm}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1RQ_D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+  uint64_t out[32] = {0};
+  uint16_t index = 0;
+
+  // Get mini-vector (quadword)
+  uint64_t mini[2] = {0};
+  for (int i = 0; i < 2; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      mini[i] = memoryData[index].get<uint64_t>();
+      index++;
+    }
+  }
+
+  // Duplicate mini-vector into output vector
+  for (int i = 0; i < (partition_num / 2); i++) {
+    out[2 * i] = mini[0];
+    out[(2 * i) + 1] = mini[1];
+  }
+  results[0] = {out, 256};
+}
+
+// ld1rw {zt.s}, pg/z, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1RW_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint16_t partition_num = VL_bits / 32;
+  uint32_t out[64] = {0};
+  uint16_t index = 0;
+  // Check if any lanes are active, otherwise set all to 0 and break early
+  bool active = false;
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  for (int i = 0; i < 4; i++) {
+    if (p[i] != 0) {
+      active = true;
+      break;
+    }
+  }
+  if (active) {
+    uint32_t data = memoryData[0].get<uint32_t>();
+    for (int i = 0; i < partition_num; i++) {
+      uint64_t shifted_active = p[index / 16] & 1ull
+                                                    << ((index % 16) * 4);
+      out[i] = shifted_active ? data : 0;
+      index++;
+    }
+  }
+  results[0] = {out, 256};
+}
+
+// ld1r {vt.16b}, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv16b>() {
+  // LOAD
+  uint8_t val = memoryData[0].get<uint8_t>();
+  uint8_t out[16] = {val, val, val, val, val, val, val, val,
+                     val, val, val, val, val, val, val, val};
+  results[0] = {out, 256};
+}
+
+// ld1r {vt.16b}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv16b_POST>() {
+  // LOAD
+  uint8_t val = memoryData[0].get<uint8_t>();
+  uint8_t out[16] = {val, val, val, val, val, val, val, val,
+                     val, val, val, val, val, val, val, val};
+  results[0] = {out, 256};
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ld1r {vt.1d}, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv1d>() {
+  // LOAD
+  uint64_t val = memoryData[0].get<uint64_t>();
+  uint64_t out[2] = {val, 0};
+  results[0] = {out, 256};
+}
+
+// ld1r {vt.1d}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv1d_POST>() {
+  // LOAD
+  uint64_t val = memoryData[0].get<uint64_t>();
+  uint64_t out[2] = {val, 0};
+  results[0] = {out, 256};
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ld1r {vt.2d}, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv2d>() {
+  // LOAD
+  uint64_t val = memoryData[0].get<uint64_t>();
+  uint64_t out[2] = {val, val};
+  results[0] = {out, 256};
+}
+
+// ld1r {vt.2d}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv2d_POST>() {
+  // LOAD
+  uint64_t val = memoryData[0].get<uint64_t>();
+  uint64_t out[2] = {val, val};
+  results[0] = {out, 256};
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ld1r {vt.2s}, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv2s>() {
+  // LOAD
+  uint32_t val = memoryData[0].get<uint32_t>();
+  uint32_t out[4] = {val, val, 0, 0};
+  results[0] = {out, 256};
+}
+
+// ld1r {vt.2s}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv2s_POST>() {
+  // LOAD
+  uint32_t val = memoryData[0].get<uint32_t>();
+  uint32_t out[4] = {val, val, 0, 0};
+  results[0] = {out, 256};
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ld1r {vt.4h}, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv4h>() {
+  // LOAD
+  uint16_t val = memoryData[0].get<uint16_t>();
+  uint16_t out[8] = {val, val, val, val, 0, 0, 0, 0};
+  results[0] = {out, 256};
+}
+
+// ld1r {vt.4h}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv4h_POST>() {
+  // LOAD
+  uint16_t val = memoryData[0].get<uint16_t>();
+  uint16_t out[8] = {val, val, val, val, 0, 0, 0, 0};
+  results[0] = {out, 256};
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ld1r {vt.4s}, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv4s>() {
+  // LOAD
+  uint32_t val = memoryData[0].get<uint32_t>();
+  uint32_t out[4] = {val, val, val, val};
+  results[0] = {out, 256};
+}
+
+// ld1r {vt.4s}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv4s_POST>() {
+  // LOAD
+  uint32_t val = memoryData[0].get<uint32_t>();
+  uint32_t out[4] = {val, val, val, val};
+  results[0] = {out, 256};
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ld1r {vt.8b}, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv8b>() {
+  // LOAD
+  uint8_t val = memoryData[0].get<uint8_t>();
+  uint8_t out[16] = {val, val, val, val, val, val, val, val,
+                     0,   0,   0,   0,   0,   0,   0,   0};
+  results[0] = {out, 256};
+}
+
+// ld1r {vt.8b}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv8b_POST>() {
+  // LOAD
+  uint8_t val = memoryData[0].get<uint8_t>();
+  uint8_t out[16] = {val, val, val, val, val, val, val, val,
+                     0,   0,   0,   0,   0,   0,   0,   0};
+  results[0] = {out, 256};
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ld1r {vt.8h}, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv8h>() {
+  // LOAD
+  uint16_t val = memoryData[0].get<uint16_t>();
+  uint16_t out[8] = {val, val, val, val, val, val, val, val};
+  results[0] = {out, 256};
+}
+
+// ld1r {vt.8h}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Rv8h_POST>() {
+  // LOAD
+  uint16_t val = memoryData[0].get<uint16_t>();
+  uint16_t out[8] = {val, val, val, val, val, val, val, val};
+  results[0] = {out, 256};
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ld1 {vt1.16b, vt2.16b}, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Twov16b>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(memoryData[0].size(), 256);
+  results[1] = memoryData[1].zeroExtend(memoryData[1].size(), 256);
+}
+
+// ld1 {vt1.16b, vt2.16b}, [xn],   #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1Twov16b_POST>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(memoryData[0].size(), 256);
+  results[1] = memoryData[1].zeroExtend(memoryData[1].size(), 256);
+  results[2] = operands[0].get<uint64_t>() + metadata.operands[3].imm;
+}
+
+// ld1w  {zt.s}, pg/z, [xn, xm, lsl #2]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1W>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 32;
+  uint16_t index = 0;
+  uint32_t out[64] = {0};
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 16) * 4);
+    if (p[i / 16] & shifted_active) {
+      out[i] = memoryData[index].get<uint32_t>();
+      index++;
+    } else {
+      out[i] = 0;
+    }
+  }
+  results[0] = {out, 256};
+}
+
+// ld1w  {zt.s}, pg/z, [xn{, #imm, mul vl}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1W_IMM_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 32;
+  uint16_t index = 0;
+  uint32_t out[64] = {0};
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 16) * 4);
+    if (p[i / 16] & shifted_active) {
+      out[i] = memoryData[index].get<uint32_t>();
+      index++;
+    } else {
+      out[i] = 0;
+    }
+  }
+  results[0] = {out, 256};
+}
+
+// ld1 {vt.s}[index], [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1i32>() {
+  // LOAD
+  const int index = metadata.operands[0].vector_index;
+  const uint32_t* vt = operands[0].getAsVector<uint32_t>();
+  uint32_t out[4];
+  for (int i = 0; i < 4; i++) {
+    out[i] = (i == index) ? memoryData[0].get<uint32_t>() : vt[i];
+  }
+  results[0] = {out, 256};
+}
+
+// ld1 {vt.d}[index], [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1i64>() {
+  // LOAD
+  const int index = metadata.operands[0].vector_index;
+  const uint64_t* vt = operands[0].getAsVector<uint64_t>();
+  uint64_t out[2];
+  for (int i = 0; i < 2; i++) {
+    out[i] = (i == index) ? memoryData[0].get<uint64_t>() : vt[i];
+  }
+  results[0] = {out, 256};
+}
+
+// ld1 {vt.d}[index], [xn], #8
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD1i64_POST>() {
+  // LOAD
+  const int index = metadata.operands[0].vector_index;
+  const uint64_t* vt = operands[0].getAsVector<uint64_t>();
+  uint64_t out[2];
+  for (int i = 0; i < 2; i++) {
+    out[i] = (i == index) ? memoryData[0].get<uint64_t>() : vt[i];
+  }
+  results[0] = {out, 256};
+  results[1] = operands[1].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ld2d {zt1.d, zt2.d}, pg/z, [<xn|sp>, xm, lsl #3]
+// ld2d {zt1.d, zt2.d}, pg/z, [<xn|sp>{, #imm, mul vl}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD2D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  uint64_t out1[32] = {0};
+  uint64_t out2[32] = {0};
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      out1[i] = memoryData[index].get<uint64_t>();
+      index++;
+      out2[i] = memoryData[index].get<uint64_t>();
+      index++;
+    } else {
+      out1[i] = 0;
+      out2[i] = 0;
+    }
+  }
+  results[0] = {out1, 256};
+  results[1] = {out2, 256};
+}
+
+// ld2 {vt1.4s, vt2.4s} [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD2Twov4s>() {
+  const float* region1 = memoryData[0].getAsVector<float>();
+  const float* region2 = memoryData[1].getAsVector<float>();
+
+  // LD2 multistruct uses de-interleaving
+  float t1[4] = {region1[0], region1[2], region2[0], region2[2]};
+  float t2[4] = {region1[1], region1[3], region2[1], region2[3]};
+  results[0] = {t1, 256};
+  results[1] = {t2, 256};
+}
+
+// ld2 {vt1.4s, vt2.4s}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD2Twov4s_POST>() {
+  // LOAD
+  const float* region1 = memoryData[0].getAsVector<float>();
+  const float* region2 = memoryData[1].getAsVector<float>();
+  float t1[4] = {region1[0], region1[2], region2[0], region2[2]};
+  float t2[4] = {region1[1], region1[3], region2[1], region2[3]};
+  results[0] = {t1, 256};
+  results[1] = {t2, 256};
+  uint64_t offset = 32;
+  if (metadata.operandCount == 4) {
+    offset = operands[3].get<uint64_t>();
+  }
+  results[2] = operands[2].get<uint64_t>() + offset;
+}
+
+// ld3d {zt1.d, zt2.d, zt3.d}, pg/z, [xn|sp{, #imm, MUL VL}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD3D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  uint64_t out1[32] = {0};
+  uint64_t out2[32] = {0};
+  uint64_t out3[32] = {0};
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      out1[i] = memoryData[index].get<uint64_t>();
+      index++;
+      out2[i] = memoryData[index].get<uint64_t>();
+      index++;
+      out3[i] = memoryData[index].get<uint64_t>();
+      index++;
+    } else {
+      out1[i] = 0;
+      out2[i] = 0;
+      out3[i] = 0;
+    }
+  }
+  results[0] = {out1, 256};
+  results[1] = {out2, 256};
+  results[2] = {out3, 256};
+}
+
+// ld4d {zt1.d, zt2.d, zt3.d, zt4.d}, pg/z, [xn|sp{, #imm, MUL VL}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LD4D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t* p = operands[0].getAsVector<uint64_t>();
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  uint64_t out1[32] = {0};
+  uint64_t out2[32] = {0};
+  uint64_t out3[32] = {0};
+  uint64_t out4[32] = {0};
+
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      out1[i] = memoryData[index].get<uint64_t>();
+      index++;
+      out2[i] = memoryData[index].get<uint64_t>();
+      index++;
+      out3[i] = memoryData[index].get<uint64_t>();
+      index++;
+      out4[i] = memoryData[index].get<uint64_t>();
+      index++;
+    } else {
+      out1[i] = 0;
+      out2[i] = 0;
+      out3[i] = 0;
+      out4[i] = 0;
+    }
+  }
+
+  results[0] = {out1, 256};
+  results[1] = {out2, 256};
+  results[2] = {out3, 256};
+  results[3] = {out4, 256};
+}
+
+// ldaddl ws, wt, [xn]
+// ldadd ws, wt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDADDW>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 8);
+  memoryData[0] = RegisterValue(
+      memoryData[0].get<uint32_t>() + operands[0].get<uint32_t>(), 4);
+}
+
+// ldarb wt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDARB>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(1, 8);
+}
+
+// ldar wt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDARW>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 8);
+}
+
+// ldar xt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDARX>() {
+  // LOAD
+  results[0] = memoryData[0];
+}
+
+// ldaxr wd, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDAXRW>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 8);
+}
+
+// ldaxr xd, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDAXRX>() {
+  // LOAD
+  results[0] = memoryData[0];
+}
+
+// ldnp st1, st2, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDNPSi>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 256);
+  results[1] = memoryData[1].zeroExtend(4, 256);
+}
+
+// ldp dt1, dt2, [xn, #imm]
+// ldp qt1, qt2, [xn, #imm]
+// ldp st1, st2, [xn, #imm]
+// ldp wt1, wt2, [xn, #imm]
+// ldp xt1, xt2, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDPXi>() {
+  uint16_t regSize =
+      (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
+  results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
+  results[1] = memoryData[1].zeroExtend(dataSize_, regSize);
+}
+
+// ldp dt1, dt2, [xn], #imm
+// ldp qt1, qt2, [xn], #imm
+// ldp st1, st2, [xn], #imm
+// ldp wt1, wt2, [xn], #imm
+// ldp xt1, xt2, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDPXpost>() {
+  uint16_t regSize =
+      (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
+  results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
+  results[1] = memoryData[1].zeroExtend(dataSize_, regSize);
+  results[2] = operands[0].get<uint64_t>() + metadata.operands[3].imm;
+}
+
+// ldp dt1, dt2, [xn, #imm]!
+// ldp qt1, qt2, [xn, #imm]!
+// ldp st1, st2, [xn, #imm]!
+// ldp wt1, wt2, [xn, #imm]!
+// ldp xt1, xt2, [xn, #imm]!
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDPXpre>() {
+  uint16_t regSize =
+      (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
+  results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
+  results[1] = memoryData[1].zeroExtend(dataSize_, regSize);
+  results[2] =
+      operands[0].get<uint64_t>() + metadata.operands[2].mem.disp;
+}
+
+// ldpsw xt1, xt2, [xn {, #imm}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDPSWi>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 8);
+  results[1] = memoryData[1].zeroExtend(4, 8);
+}
+
+// ldrb wt, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRBBpost>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(1, 8);
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ldrb wt, [xn, #imm]!
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRBBpre>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(1, 8);
+  results[1] =
+      operands[0].get<uint64_t>() + metadata.operands[1].mem.disp;
+}
+
+// ldrb wt,  [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRBBroW>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(1, 8);
+}
+
+// ldrb wt,  [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRBBroX>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(1, 8);
+}
+
+// ldrb wt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRBBui>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(1, 8);
+}
+
+// ldr bt, [xn, #imm]
+// ldr dt, [xn, #imm]
+// ldr ht, [xn, #imm]
+// ldr qt, [xn, #imm]
+// ldr st, [xn, #imm]
+// ldr wt, [xn, #imm]
+// ldr xt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRXui>() {
+  uint16_t regSize =
+      (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
+  results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
+}
+
+// ldr bt, [xn], #imm
+// ldr dt, [xn], #imm
+// ldr ht, [xn], #imm
+// ldr qt, [xn], #imm
+// ldr st, [xn], #imm
+// ldr wt, [xn], #imm
+// ldr xt, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRXpost>() {
+  uint16_t regSize =
+      (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
+  results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ldr bt, [xn, #imm]!
+// ldr dt, [xn, #imm]!
+// ldr ht, [xn, #imm]!
+// ldr qt, [xn, #imm]!
+// ldr st, [xn, #imm]!
+// ldr wt, [xn, #imm]!
+// ldr xt, [xn, #imm]!
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRXpre>() {
+  uint16_t regSize =
+      (isScalarData_ || isVectorData_ || isSVEData_) ? 256 : 8;
+  results[0] = memoryData[0].zeroExtend(dataSize_, regSize);
+  results[1] =
+      operands[0].get<uint64_t>() + metadata.operands[1].mem.disp;
+}
+
+// ldr dt, [xn, wm, {extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRDroW>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(memoryAddresses[0].size, 256);
+}
+
+// ldr dt, [xn, xm, {extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRDroX>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(memoryAddresses[0].size, 256);
+}
+
+// ldrh wt, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRHHpost>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(2, 8);
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ldrh wt, [xn, #imm]!
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRHHpre>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(2, 8);
+  results[1] =
+      operands[0].get<uint64_t>() + metadata.operands[1].mem.disp;
+}
+
+// ldrh wt, [xn, wm, {extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRHHroW>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(2, 8);
+}
+
+// ldrh wt, [xn, xm, {extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRHHroX>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(2, 8);
+}
+
+// ldrh wt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRHHui>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(2, 8);
+}
+
+// ldr qt, [xn, xm, {extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRQroX>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(16, 256);
+}
+
+// ldrsb wt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSBWroX>() {
+  // LOAD
+  results[0] =
+      RegisterValue(static_cast<int32_t>(memoryData[0].get<int8_t>()), 4)
+          .zeroExtend(4, 8);
+}
+
+// ldrsb wt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSBWui>() {
+  // LOAD
+  results[0] =
+      RegisterValue(static_cast<int32_t>(memoryData[0].get<int8_t>()))
+          .zeroExtend(4, 8);
+}
+
+// ldrsb xt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSBXui>() {
+  // LOAD
+  results[0] = static_cast<int64_t>(memoryData[0].get<int8_t>());
+}
+
+// ldrsh wt, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSHWroW>() {
+  // LOAD
+  results[0] =
+      RegisterValue(static_cast<int32_t>(memoryData[0].get<int16_t>()), 4)
+          .zeroExtend(4, 8);
+}
+
+// ldrsh wt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSHWroX>() {
+  // LOAD
+  results[0] =
+      RegisterValue(static_cast<int32_t>(memoryData[0].get<int16_t>()), 4)
+          .zeroExtend(4, 8);
+}
+
+// ldrsh wt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSHWui>() {
+  // LOAD
+  results[0] =
+      RegisterValue(static_cast<int32_t>(memoryData[0].get<int16_t>()), 4)
+          .zeroExtend(4, 8);
+}
+
+// ldrsh xt, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSHXroW>() {
+  // LOAD
+  results[0] = static_cast<int64_t>(memoryData[0].get<int16_t>());
+}
+
+// ldrsh xt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSHXroX>() {
+  // LOAD
+  results[0] = static_cast<int64_t>(memoryData[0].get<int16_t>());
+}
+
+// ldrsh xt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSHXui>() {
+  // LOAD
+  results[0] = static_cast<int64_t>(memoryData[0].get<int16_t>());
+}
+
+// ldrsw xt, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSWl>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 8);
+}
+
+// ldrsw xt, [xn], #simm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSWpost>() {
+  // LOAD
+  results[0] = static_cast<int64_t>(memoryData[0].get<int32_t>());
+  results[1] = operands[0].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// ldrsw xt, [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSWroX>() {
+  // LOAD
+  results[0] = static_cast<int64_t>(memoryData[0].get<int32_t>());
+}
+
+// ldrsw xt, [xn{, #pimm}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSWui>() {
+  // LOAD
+  results[0] = static_cast<int64_t>(memoryData[0].get<int32_t>());
+}
+
+// ldr st, [xn, wm, {extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSroW>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 256);
+}
+
+// ldr st, [xn, xm, {extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRSroX>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 256);
+}
+
+// ldr wt, [xn, wm, {extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRWroW>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 8);
+}
+
+// ldr wt, [xn, xm, {extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRWroX>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 8);
+}
+
+// ldr xt, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRXl>() {
+  // LOAD
+  results[0] = memoryData[0];
+}
+
+// ldr xt, [xn, wn{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRXroW>() {
+  // LOAD
+  results[0] = memoryData[0];
+}
+
+// ldr xt, [xn, xn{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDRXroX>() {
+  // LOAD
+  results[0] = memoryData[0];
+}
+
+// ldr pt, [xn{, #imm, mul vl}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDR_PXI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint64_t PL_bits = VL_bits / 8;
+  const uint16_t partition_num = PL_bits / 8;
+
+  uint64_t out[4] = {0};
+  for (int i = 0; i < partition_num; i++) {
+    uint8_t data = memoryData[i].get<uint8_t>();
+    for (int j = 0; j < 8; j++) {
+      out[i / 8] |= (data & (1 << j)) ? 1ull << ((j + (i * 8)) % 64) : 0;
+    }
+  }
+  results[0] = out;
+}
+
+// ldr zt, [xn{, #imm, mul vl}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDR_ZXI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // LOAD
+  const uint16_t partition_num = VL_bits / 8;
+  uint8_t out[256] = {0};
+
+  for (int i = 0; i < partition_num; i++) {
+    out[i] = memoryData[i].get<uint8_t>();
+  }
+  results[0] = {out, 256};
+}
+
+// ldtrsb xt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDTRSBXi>() {
+  // LOAD
+  // TODO: implement
+  results[0] = RegisterValue(0, 8);
+}
+
+// ldurb wt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDURBBi>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(1, 8);
+}
+
+// ldur dt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDURDi>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(8, 256);
+}
+
+// ldurh wt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDURHHi>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(2, 8);
+}
+
+// ldur qt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDURQi>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(16, 256);
+}
+
+// ldursw xt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDURSWi>() {
+  // LOAD
+  results[0] = static_cast<int64_t>(memoryData[0].get<int32_t>());
+}
+
+// ldur sd, [<xn|sp>{, #imm}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDURSi>() {
+  // LOAD
+  results[0] = {memoryData[0].get<float>(), 256};
+}
+
+// ldur wt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDURWi>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 8);
+}
+
+// ldur xt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDURXi>() {
+  // LOAD
+  results[0] = memoryData[0];
+}
+
+// ldxr wt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDXRW>() {
+  // LOAD
+  results[0] = memoryData[0].zeroExtend(4, 8);
+}
+
+// ldxr xt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LDXRX>() {
+  // LOAD
+  results[0] = memoryData[0];
+}
+
+// lslv wd, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LSLVWr>() {
+  results[0] = {
+      logicalHelp::logicalShiftLR_3ops<uint32_t>(operands, true), 8};
+}
+
+// lslv xd, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LSLVXr>() {
+  results[0] = logicalHelp::logicalShiftLR_3ops<uint64_t>(operands, true);
+}
+
+// lsl zd.s, zn.s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LSL_ZZI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLsl_imm<uint32_t>(operands, metadata, VL_bits);
+}
+
+// lsrv wd, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LSRVWr>() {
+  results[0] = {
+      logicalHelp::logicalShiftLR_3ops<uint32_t>(operands, false), 8};
+}
+
+// lsrv xd, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_LSRVXr>() {
+  results[0] =
+      logicalHelp::logicalShiftLR_3ops<uint64_t>(operands, false);
+}
+
+// madd wd, wn, wm, wa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MADDWrrr>() {
+  results[0] = {multiplyHelp::madd_4ops<uint32_t>(operands), 8};
+}
+
+// madd xd, xn, xm, xa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MADDXrrr>() {
+  results[0] = multiplyHelp::madd_4ops<uint64_t>(operands);
+}
+
+// mla zda.b, pg/m, zn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MLA_ZPmZZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMlaPredicated_vecs<uint8_t>(operands, VL_bits);
+}
+
+// mla zda.d, pg/m, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MLA_ZPmZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveMlaPredicated_vecs<uint64_t>(operands, VL_bits);
+}
+
+// mla zda.h, pg/m, zn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MLA_ZPmZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveMlaPredicated_vecs<uint16_t>(operands, VL_bits);
+}
+
+// mla zda.s, pg/m, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MLA_ZPmZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveMlaPredicated_vecs<uint32_t>(operands, VL_bits);
+}
+
+// movi dd, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVID>() {
+  results[0] = {static_cast<uint64_t>(metadata.operands[1].imm), 256};
+}
+
+// movi vd.16b, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVIv16b_ns>() {
+  results[0] = neonHelp::vecMovi_imm<uint8_t, 16>(metadata);
+}
+
+// movi vd.2d, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVIv2d_ns>() {
+  results[0] = neonHelp::vecMovi_imm<uint64_t, 2>(metadata);
+}
+
+// movi vd.2s, #imm{, lsl #shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVIv2i32>() {
+  results[0] = neonHelp::vecMoviShift_imm<uint32_t, 2>(metadata, false);
+}
+
+// movi vd.4s, #imm{, LSL #shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVIv4i32>() {
+  results[0] = neonHelp::vecMoviShift_imm<uint32_t, 4>(metadata, false);
+}
+
+// movi vd.8b, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVIv8b_ns>() {
+  results[0] = neonHelp::vecMovi_imm<uint8_t, 8>(metadata);
+}
+
+// movk wd, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVKWi>() {
+  results[0] = {
+      arithmeticHelp::movkShift_imm<uint32_t>(operands, metadata), 8};
+}
+
+// movk xd, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVKXi>() {
+  results[0] =
+      arithmeticHelp::movkShift_imm<uint64_t>(operands, metadata);
+}
+
+// movn wd, #imm{, LSL #shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVNWi>() {
+  results[0] = {arithmeticHelp::movnShift_imm<uint32_t>(
+                    metadata, [](uint64_t x) -> uint32_t { return ~x; }),
+                8};
+}
+
+// movn xd, #imm{, LSL #shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVNXi>() {
+  results[0] = arithmeticHelp::movnShift_imm<uint64_t>(
+      metadata, [](uint64_t x) -> uint64_t { return ~x; });
+}
+
+// movprfx zd.d, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVPRFX_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMovprfxPredicated_destUnchanged<uint64_t>(
+      operands, VL_bits);
+}
+
+// movprfx zd.d, pg/z, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVPRFX_ZPzZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMovprfxPredicated_destToZero<uint64_t>(
+      operands, VL_bits);
+}
+
+// movprfx zd.s, pg/z, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVPRFX_ZPzZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMovprfxPredicated_destToZero<uint32_t>(
+      operands, VL_bits);
+}
+
+// movprfx zd, zn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVPRFX_ZZ>() {
+  // TODO: Adopt hint logic of the MOVPRFX instruction
+  results[0] = operands[0];
+}
+
+// movz wd, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVZWi>() {
+  results[0] = {arithmeticHelp::movnShift_imm<uint32_t>(
+                    metadata, [](uint64_t x) -> uint32_t { return x; }),
+                8};
+}
+
+// movz xd, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MOVZXi>() {
+  results[0] = arithmeticHelp::movnShift_imm<uint64_t>(
+      metadata, [](uint64_t x) -> uint64_t { return x; });
+}
+
+// mrs xt, (systemreg|Sop0_op1_Cn_Cm_op2)
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MRS>() {
+  results[0] = operands[0];
+}
+
+// mrs (systemreg|Sop0_op1_Cn_Cm_op2), xt
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MSR>() {
+  results[0] = operands[0];
+}
+
+// msub wd, wn, wm, wa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MSUBWrrr>() {
+  results[0] = {multiplyHelp::msub_4ops<uint32_t>(operands), 8};
+}
+
+// msub xd, xn, xm, xa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MSUBXrrr>() {
+  results[0] = multiplyHelp::msub_4ops<uint64_t>(operands);
+}
+
+// mul zdn.b, pg/m, zdn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MUL_ZPmZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMulPredicated<uint8_t>(operands, metadata,
+                                                  VL_bits, false);
+}
+
+// mul zdn.d, pg/m, zdn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MUL_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMulPredicated<uint64_t>(operands, metadata,
+                                                   VL_bits, false);
+}
+
+// mul zdn.h, pg/m, zdn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MUL_ZPmZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMulPredicated<uint16_t>(operands, metadata,
+                                                   VL_bits, false);
+}
+
+// mul zdn.s, pg/m, zdn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MUL_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMulPredicated<uint32_t>(operands, metadata,
+                                                   VL_bits, false);
+}
+
+// mvni vd.2s, #imm{, lsl #shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MVNIv2i32>() {
+  results[0] = neonHelp::vecMoviShift_imm<uint32_t, 2>(metadata, true);
+}
+
+// mvni vd.2s, #imm, msl #amount
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MVNIv2s_msl>() {
+  results[0] = neonHelp::vecMoviShift_imm<uint32_t, 2>(metadata, true);
+}
+
+// mvni vd.4h, #imm{, lsl #shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MVNIv4i16>() {
+  results[0] = neonHelp::vecMoviShift_imm<uint16_t, 4>(metadata, true);
+}
+
+// mvni vd.4s, #imm{, lsl #shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MVNIv4i32>() {
+  results[0] = neonHelp::vecMoviShift_imm<uint32_t, 4>(metadata, true);
+}
+
+// mvni vd.4s #imm, msl #amount
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MVNIv4s_msl>() {
+  results[0] = neonHelp::vecMoviShift_imm<uint32_t, 4>(metadata, true);
+}
+
+// mvni vd.8h, #imm{, lsl #shift}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_MVNIv8i16>() {
+  results[0] = neonHelp::vecMoviShift_imm<uint16_t, 8>(metadata, true);
+}
+
+// neg vd.2d, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_NEGv2i64>() {
+  results[0] = neonHelp::vecFneg_2ops<int64_t, 2>(operands);
+}
+
+// not vd.16b, vn.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_NOTv16i8>() {
+  results[0] = neonHelp::vecLogicOp_2vecs<uint8_t, 16>(
+      operands, [](uint8_t x) -> uint8_t { return ~x; });
+}
+
+// not vd.8b, vn.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_NOTv8i8>() {
+  results[0] = neonHelp::vecLogicOp_2vecs<uint8_t, 8>(
+      operands, [](uint8_t x) -> uint8_t { return ~x; });
+}
+
+// orn wd, wn, wm{, shift{ #amount}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ORNWrs>() {
+  auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint32_t>(
+      operands, metadata, false,
+      [](uint32_t x, uint32_t y) -> uint32_t { return x | (~y); });
+  results[0] = {result, 8};
+}
+
+// orn xd, xn, xm{, shift{ #amount}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ORNXrs>() {
+  auto [result, nzcv] = logicalHelp::logicOpShift_3ops<uint64_t>(
+      operands, metadata, false,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x | (~y); });
+  results[0] = result;
+}
+
+// orr wd, wn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ORRWri>() {
+  auto [result, nzcv] = logicalHelp::logicOp_imm<uint32_t>(
+      operands, metadata, false,
+      [](uint32_t x, uint32_t y) -> uint32_t { return x | y; });
+  results[0] = {result, 8};
+}
+
+// orr wd, wn, wm{, shift{ #amount}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ORRWrs>() {
+  results[0] = {
+      comparisonHelp::orrShift_3ops<uint32_t>(operands, metadata), 8};
+}
+
+// orr xd, xn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ORRXri>() {
+  auto [result, nzcv] = logicalHelp::logicOp_imm<uint64_t>(
+      operands, metadata, false,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x | y; });
+  results[0] = {result, 8};
+}
+
+// orr xd, xn, xm{, shift{ #amount}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ORRXrs>() {
+  results[0] =
+      comparisonHelp::orrShift_3ops<uint64_t>(operands, metadata);
+}
+
+// orr pd.b, pg/z, pn.b, pm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ORR_PPzPP>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOp_preds<uint8_t>(
+      operands, VL_bits,
+      [](uint64_t x, uint64_t y) -> uint64_t { return x | y; });
+}
+
+// orr zd.d, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ORR_ZZZ>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveOrr_3vecs<uint64_t>(operands, VL_bits);
+}
+
+// orr vd.16b, Vn.16b, Vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ORRv16i8>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 16>(
+      operands, [](uint8_t x, uint8_t y) -> uint8_t { return x | y; });
+}
+
+// orr vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ORRv8i8>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 8>(
+      operands, [](uint8_t x, uint8_t y) -> uint8_t { return x | y; });
+}
+
+// pfalse pd.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_PFALSE>() {
+  uint64_t out[4] = {0, 0, 0, 0};
+  results[0] = out;
+}
+
+// prfm op, [xn, xm{, extend{, #amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_PRFMui>() {}
+
+// ptest pg, pn.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_PTEST_PP>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  const uint64_t* g = operands[0].getAsVector<uint64_t>();
+  const uint64_t* s = operands[1].getAsVector<uint64_t>();
+  std::array<uint64_t, 4> masked_n = {(g[0] & s[0]), (g[1] & s[1]),
+                                      (g[2] & s[2]), (g[3] & s[3])};
+  // Byte count = 1 as destination predicate is regarding single bytes.
+  results[0] = AuxFunc::getNZCVfromPred(masked_n, VL_bits, 1);
+}
+
+// ptrue pd.b{, pattern}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_PTRUE_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::svePtrue<uint8_t>(metadata, VL_bits);
+}
+
+// ptrue pd.d{, pattern}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_PTRUE_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::svePtrue<uint64_t>(metadata, VL_bits);
+}
+
+// ptrue pd.h{, pattern}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_PTRUE_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::svePtrue<uint16_t>(metadata, VL_bits);
+}
+
+// ptrue pd.s{, pattern}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_PTRUE_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::svePtrue<uint32_t>(metadata, VL_bits);
+}
+
+// punpkhi pd.h, pn.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_PUNPKHI_PP>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::svePunpk(operands, VL_bits, true);
+}
+
+// punpklo pd.h, pn.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_PUNPKLO_PP>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::svePunpk(operands, VL_bits, false);
+}
+
+// rbit wd, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_RBITWr>() {
+  results[0] = {bitmanipHelp::rbit<uint32_t>(operands, metadata), 8};
+}
+
+// rbit xd, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_RBITXr>() {
+  results[0] = bitmanipHelp::rbit<uint64_t>(operands, metadata);
+}
+
+// rdvl xd, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_RDVLI_XI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  int8_t imm = static_cast<int8_t>(metadata.operands[1].imm);
+  results[0] = (uint64_t)(imm * (VL_bits / 8));
+}
+
+// ret {xr}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_RET>() {
+  branchTaken_ = true;
+  branchAddress_ = operands[0].get<uint64_t>();
+}
+
+// rev16 Vd.16b, Vn.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV16v16i8>() {
+  results[0] = neonHelp::vecRev<int8_t, 16, 16>(operands);
+}
+
+// rev16 Vd.8b, Vn.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV16v8i8>() {
+  results[0] = neonHelp::vecRev<int8_t, 16, 8>(operands);
+}
+
+// rev32 Vd.16b, Vn.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV32v16i8>() {
+  results[0] = neonHelp::vecRev<int8_t, 32, 16>(operands);
+}
+
+// rev32 Vd.4h, Vn.4h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV32v4i16>() {
+  results[0] = neonHelp::vecRev<int16_t, 32, 4>(operands);
+}
+
+// rev32 Vd.8h, Vn.8h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV32v8i16>() {
+  results[0] = neonHelp::vecRev<int16_t, 32, 8>(operands);
+}
+
+// rev32 Vd.8b, Vn.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV32v8i8>() {
+  results[0] = neonHelp::vecRev<int8_t, 32, 8>(operands);
+}
+
+// rev64 Vd.16b, Vn.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV64v16i8>() {
+  results[0] = neonHelp::vecRev<int8_t, 64, 16>(operands);
+}
+
+// rev64 Vd.2s, Vn.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV64v2i32>() {
+  results[0] = neonHelp::vecRev<int32_t, 64, 2>(operands);
+}
+
+// rev64 Vd.4h, Vn.4h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV64v4i16>() {
+  results[0] = neonHelp::vecRev<int16_t, 64, 4>(operands);
+}
+
+// rev64 Vd.4s, Vn.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV64v4i32>() {
+  results[0] = neonHelp::vecRev<int32_t, 64, 4>(operands);
+}
+
+// rev64 Vd.8h, Vn.8h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV64v8i16>() {
+  results[0] = neonHelp::vecRev<int16_t, 64, 8>(operands);
+}
+
+// rev64 Vd.8b Vn.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV64v8i8>() {
+  results[0] = neonHelp::vecRev<int8_t, 64, 8>(operands);
+}
+
+// rev xd, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REVXr>() {
+  results[0] = bitmanipHelp::rev<uint64_t>(operands);
+}
+
+// rev pd.b, pn.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV_PP_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveRev_predicates<uint8_t>(operands, VL_bits);
+}
+
+// rev pd.d, pn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV_PP_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveRev_predicates<uint64_t>(operands, VL_bits);
+}
+
+// rev pd.h, pn.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV_PP_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveRev_predicates<uint16_t>(operands, VL_bits);
+}
+
+// rev pd.s, pn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV_PP_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveRev_predicates<uint32_t>(operands, VL_bits);
+}
+
+// rev zd.b, zn.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV_ZZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveRev_vecs<uint8_t>(operands, VL_bits);
+}
+
+// rev zd.d, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV_ZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveRev_vecs<uint64_t>(operands, VL_bits);
+}
+
+// rev zd.h, zn.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV_ZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveRev_vecs<uint16_t>(operands, VL_bits);
+}
+
+// rev zd.s, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_REV_ZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveRev_vecs<uint32_t>(operands, VL_bits);
+}
+
+// rorv wd, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_RORVWr>() {
+  results[0] = {logicalHelp::rorv_3ops<uint32_t>(operands), 8};
+}
+
+// rorv xd, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_RORVXr>() {
+  results[0] = logicalHelp::rorv_3ops<uint64_t>(operands);
+}
+
+// sbc wd, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SBCWr>() {
+  results[0] = {arithmeticHelp::sbc<uint32_t>(operands), 8};
+}
+
+// sbc xd, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SBCXr>() {
+  results[0] = arithmeticHelp::sbc<uint64_t>(operands);
+}
+
+// sbfm wd, wn, #immr, #imms
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SBFMWri>() {
+  results[0] = {
+      bitmanipHelp::bfm_2imms<uint32_t>(operands, metadata, true, true),
+      8};
+}
+
+// sbfm xd, xn, #immr, #imms
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SBFMXri>() {
+  results[0] =
+      bitmanipHelp::bfm_2imms<uint64_t>(operands, metadata, true, true);
+}
+
+// scvtf dd, xn, #fbits
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFSXDri>() {
+  results[0] =
+      floatHelp::scvtf_FixedPoint<double, int64_t>(operands, metadata);
+}
+
+// scvtf sd, xn, #fbits
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFSXSri>() {
+  results[0] =
+      floatHelp::scvtf_FixedPoint<float, int64_t>(operands, metadata);
+}
+
+// scvtf dd, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFUWDri>() {
+  results[0] = {static_cast<double>(operands[0].get<int32_t>()), 256};
+}
+
+// scvtf sd, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFUWSri>() {
+  results[0] = {static_cast<float>(operands[0].get<int32_t>()), 256};
+}
+
+// scvtf dd, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFUXDri>() {
+  results[0] = {static_cast<double>(operands[0].get<int64_t>()), 256};
+}
+
+// scvtf sd, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFUXSri>() {
+  results[0] = {static_cast<float>(operands[0].get<int64_t>()), 256};
+}
+
+// scvtf zd.d, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTF_ZPmZ_DtoD>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcvtPredicated<double, int64_t>(operands, VL_bits);
+}
+
+// scvtf zd.s, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTF_ZPmZ_DtoS>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcvtPredicated<float, int64_t>(operands, VL_bits);
+}
+
+// scvtf zd.d, pg/m, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTF_ZPmZ_StoD>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcvtPredicated<double, int32_t>(operands, VL_bits);
+}
+
+// scvtf zd.s, pg/m, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTF_ZPmZ_StoS>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveFcvtPredicated<float, int32_t>(operands, VL_bits);
+}
+
+// scvtf sd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFv1i32>() {
+  results[0] = {static_cast<float>(operands[0].get<int32_t>()), 256};
+}
+
+// scvtf dd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFv1i64>() {
+  results[0] = {static_cast<double>(operands[0].get<int64_t>()), 256};
+}
+
+// scvtf vd.2s, vn.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFv2f32>() {
+  results[0] = neonHelp::vecScvtf_2vecs<float, int32_t, 2>(
+      operands, [](int32_t x) -> float { return static_cast<float>(x); });
+}
+
+// scvtf vd.2d, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFv2f64>() {
+  results[0] = neonHelp::vecScvtf_2vecs<double, int64_t, 2>(
+      operands,
+      [](int64_t x) -> double { return static_cast<double>(x); });
+}
+
+// scvtf vd.4s, vn.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SCVTFv4f32>() {
+  results[0] = neonHelp::vecScvtf_2vecs<float, int32_t, 4>(
+      operands, [](int32_t x) -> float { return static_cast<float>(x); });
+}
+
+// sdiv wd, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SDIVWr>() {
+  results[0] = {divideHelp::div_3ops<int32_t>(operands), 8};
+}
+
+// sdiv xd, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SDIVXr>() {
+  results[0] = {divideHelp::div_3ops<int64_t>(operands), 8};
+}
+
+// sel zd.d, pg, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SEL_ZPZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveSel_zpzz<uint64_t>(operands, VL_bits);
+}
+
+// sel zd.s, pg, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SEL_ZPZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveSel_zpzz<uint32_t>(operands, VL_bits);
+}
+
+// shl dd, dn #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SHLd>() {
+  results[0] =
+      neonHelp::vecShlShift_vecImm<uint64_t, 1>(operands, metadata);
+}
+
+// shl vd.4s, vn.4s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SHLv4i32_shift>() {
+  results[0] =
+      neonHelp::vecShlShift_vecImm<uint32_t, 4>(operands, metadata);
+}
+
+// smaddl xd, wn, wm, xa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMADDLrrr>() {
+  results[0] = multiplyHelp::maddl_4ops<int64_t, int32_t>(operands);
+}
+
+// smax zdn.s, zdn.s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMAX_ZI_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveMax_vecImm<int32_t>(operands, metadata, VL_bits);
+}
+
+// smax zd.s, pg/m, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMAX_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveMaxPredicated_vecs<int32_t>(operands, VL_bits);
+}
+
+// smax vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMAXv4i32>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<int32_t, 4>(
+      operands,
+      [](int32_t x, int32_t y) -> int32_t { return std::max(x, y); });
+}
+
+// sminv sd, pg, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMINV_VPZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveSminv<int32_t>(operands, VL_bits);
+}
+
+// sminv sd, vn.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMINVv4i32v>() {
+  results[0] = neonHelp::vecMinv_2ops<int32_t, 4>(operands);
+}
+
+// smin zd.s, pg/m, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMIN_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveLogicOpPredicated_3vecs<int32_t>(
+      operands, VL_bits,
+      [](int32_t x, int32_t y) -> int32_t { return std::min(x, y); });
+}
+
+// smin vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMINv4i32>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<int32_t, 4>(
+      operands,
+      [](int32_t x, int32_t y) -> int32_t { return std::min(x, y); });
+}
+
+// smsubl xd, wn, wm, xa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMSUBLrrr>() {
+  results[0] = arithmeticHelp::msubl_4ops<int64_t, int32_t>(operands);
+}
+
+// smulh zdn.b, pg/m, zdn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMULH_ZPmZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveMulhPredicated<int8_t, int16_t>(operands, VL_bits);
+}
+
+// smulh zdn.h, pg/m, zdn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMULH_ZPmZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveMulhPredicated<int16_t, int32_t>(operands, VL_bits);
+}
+
+// smulh zdn.s, pg/m, zdn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMULH_ZPmZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveMulhPredicated<int32_t, int64_t>(operands, VL_bits);
+}
+
+// smulh xd, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SMULHrr>() {
+  // TODO: signed
+  results[0] = AuxFunc::mulhi(operands[0].get<uint64_t>(),
+                              operands[1].get<uint64_t>());
+}
+
+// sshll vd.2d, vn.2s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SSHLLv2i32_shift>() {
+  results[0] = neonHelp::vecShllShift_vecImm<int64_t, int32_t, 2>(
+      operands, metadata, false);
+}
+
+// sshll2 vd.2d, vn.4s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SSHLLv4i32_shift>() {
+  results[0] = neonHelp::vecShllShift_vecImm<int64_t, int32_t, 2>(
+      operands, metadata, true);
+}
+
+// sshr vd.4s, vn.4s, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SSHRv4i32_shift>() {
+  results[0] = neonHelp::vecSshrShift_imm<int32_t, 4>(operands, metadata);
+}
+
+// st1b {zd.d}, pg, [xn, zm.d]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SST1B_D_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint64_t* d = operands[0].getAsVector<uint64_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      memoryData[index] = static_cast<uint8_t>(d[i]);
+      index++;
+    }
+  }
+}
+
+// st1d {zt.d}, pg, [xn, zm.d]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SST1D_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint64_t* d = operands[0].getAsVector<uint64_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      memoryData[index] = d[i];
+      index++;
+    }
+  }
+}
+
+// st1d {zd.d}, pg, [zn.d{, #imm}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SST1D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint64_t* t = operands[0].getAsVector<uint64_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      memoryData[index] = t[i];
+      index++;
+    }
+  }
+}
+
+// st1d {zt.d}, pg, [xn, zm.d, lsl # 3]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SST1D_SCALED_SCALED_REAL>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint64_t* d = operands[0].getAsVector<uint64_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      memoryData[index] = d[i];
+      index++;
+    }
+  }
+}
+
+// st1w {zt.d}, pg, [zn.d{, #imm}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SST1W_D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint64_t* t = operands[0].getAsVector<uint64_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      memoryData[index] = t[i];
+      index++;
+    }
+  }
+}
+
+// st1w {zt.s}, pg, [zn.s{, #imm}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SST1W_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint32_t* t = operands[0].getAsVector<uint32_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 32;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 16) * 4);
+    if (p[i / 16] & shifted_active) {
+      memoryData[index] = t[i];
+      index++;
+    }
+  }
+}
+
+// st1b {zt.b}, pg, [xn, xm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint8_t* d = operands[0].getAsVector<uint8_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 8;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << (i % 64);
+    if (p[i / 64] & shifted_active) {
+      memoryData[index] = d[i];
+      index++;
+    }
+  }
+}
+
+// st1d {zt.d}, pg, [xn, xm, lsl #3]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint64_t* d = operands[0].getAsVector<uint64_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      memoryData[index] = d[i];
+      index++;
+    }
+  }
+}
+
+// st1d {zt.d}, pg, [xn{, #imm, mul vl}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint64_t* d = operands[0].getAsVector<uint64_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      memoryData[index] = d[i];
+      index++;
+    }
+  }
+}
+
+// st1v {vt.16b, vt2.16b}, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1Twov16b>() {
+  // STORE
+  const uint8_t* t = operands[0].getAsVector<uint8_t>();
+  const uint8_t* t2 = operands[1].getAsVector<uint8_t>();
+  for (int i = 0; i < 16; i++) {
+    memoryData[i] = t[i];
+  }
+  for (int i = 0; i < 16; i++) {
+    memoryData[i + 16] = t2[i];
+  }
+}
+
+// st1w {zt.s}, pg, [xn, xm, lsl #2]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1W>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint32_t* d = operands[0].getAsVector<uint32_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 32;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 16) * 4);
+    if (p[i / 16] & shifted_active) {
+      memoryData[index] = d[i];
+      index++;
     }
   }
+}
+
+// st1w {zt.d}, pg, [xn, xm, lsl #2]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1W_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint64_t* d = operands[0].getAsVector<uint64_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      memoryData[index] = static_cast<uint32_t>(d[i]);
+      index++;
+    }
+  }
+}
+
+// st1w {zt.s}, pg, [xn{, #imm, mul vl}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1W_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint32_t* d = operands[0].getAsVector<uint32_t>();
+  const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 32;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 16) * 4);
+    if (p[i / 16] & shifted_active) {
+      memoryData[index] = d[i];
+      index++;
+    }
+  }
+}
+
+// st1 {vt.h}[index], [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1i16>() {
+  // STORE
+  const uint16_t* t = operands[0].getAsVector<uint16_t>();
+  memoryData[0] = t[metadata.operands[0].vector_index];
+}
+
+// st1 {vt.h}[index], [xn], xm st1 {vt.h}[index], [xn], #2
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1i16_POST>() {
+  // STORE
+  const uint16_t* t = operands[0].getAsVector<uint16_t>();
+  memoryData[0] = t[metadata.operands[0].vector_index];
+  uint64_t offset = 2;
+  if (metadata.operandCount == 3) {
+    offset = operands[2].get<uint64_t>();
+  }
+  results[0] = operands[1].get<uint64_t>() + offset;
+}
+
+// st1 {vt.s}[index], [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1i32>() {
+  // STORE
+  const uint32_t* t = operands[0].getAsVector<uint32_t>();
+  memoryData[0] = t[metadata.operands[0].vector_index];
+}
+
+// st1 {vt.s}[index], [xn], xm st1 {vt.s}[index], [xn], #4
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1i32_POST>() {
+  // STORE
+  const uint32_t* t = operands[0].getAsVector<uint32_t>();
+  memoryData[0] = t[metadata.operands[0].vector_index];
+  uint64_t offset = 4;
+  if (metadata.operandCount == 3) {
+    offset = operands[2].get<uint64_t>();
+  }
+  results[0] = operands[1].get<uint64_t>() + offset;
+}
+
+// st1 {vt.d}[index], [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1i64>() {
+  // STORE
+  const uint64_t* t = operands[0].getAsVector<uint64_t>();
+  memoryData[0] = t[metadata.operands[0].vector_index];
+}
+
+// st1 {vt.d}[index], [xn], xm st1 {vt.d}[index], [xn], #8
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1i64_POST>() {
+  // STORE
+  const uint64_t* t = operands[0].getAsVector<uint64_t>();
+  memoryData[0] = t[metadata.operands[0].vector_index];
+  uint64_t offset = 8;
+  if (metadata.operandCount == 3) {
+    offset = operands[2].get<uint64_t>();
+  }
+  results[0] = operands[1].get<uint64_t>() + offset;
+}
+
+// st1 {vt.b}[index], [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1i8>() {
+  // STORE
+  const uint8_t* t = operands[0].getAsVector<uint8_t>();
+  memoryData[0] = t[metadata.operands[0].vector_index];
+}
+
+// st1 {vt.b}[index], [xn], xm st1 {vt.b}[index], [xn], #1
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST1i8_POST>() {
+  // STORE
+  const uint8_t* t = operands[0].getAsVector<uint8_t>();
+  memoryData[0] = t[metadata.operands[0].vector_index];
+  uint64_t offset = 1;
+  if (metadata.operandCount == 3) {
+    offset = operands[2].get<uint64_t>();
+  }
+  results[0] = RegisterValue(operands[1].get<uint64_t>() + offset, 8);
+}
+
+// st2d {zt1.d, zt2.d}, pg, [<xn|sp>{, #imm, mul vl}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST2D_IMM>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint64_t* d1 = operands[0].getAsVector<uint64_t>();
+  const uint64_t* d2 = operands[1].getAsVector<uint64_t>();
+  const uint64_t* p = operands[2].getAsVector<uint64_t>();
+
+  const uint16_t partition_num = VL_bits / 64;
+  uint16_t index = 0;
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % 8) * 8);
+    if (p[i / 8] & shifted_active) {
+      memoryData[index] = d1[i];
+      index++;
+      memoryData[index] = d2[i];
+      index++;
+    }
+  }
+}
+
+// st2 {vt1.4s, vt2.4s}, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ST2Twov4s_POST>() {
+  // STORE
+  const float* t1 = operands[0].getAsVector<float>();
+  const float* t2 = operands[1].getAsVector<float>();
+  for (int i = 0; i < 4; i++) {
+    memoryData[2 * i] = t1[i];
+    memoryData[2 * i + 1] = t2[i];
+  }
+  uint64_t offset = 32;
+  if (metadata.operandCount == 4) {
+    offset = operands[3].get<uint64_t>();
+  }
+  results[0] = operands[2].get<uint64_t>() + offset;
+}
+
+// stlrb wt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STLRB>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// stlr wt, [xn]
+// stlr xt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STLRX>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// stlxr ws, wt, [xn]
+// stlxr ws, xt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STLXRX>() {
+  // STORE
+  memoryData[0] = operands[0];
+  // TODO: Implement atomic memory access
+  results[0] = static_cast<uint64_t>(0);
+}
+
+// stp dt1, dt2, [xn, #imm]
+// stp qt1, qt2, [xn, #imm]
+// stp st1, st2, [xn, #imm]
+// stp wt1, wt2, [xn, #imm]
+// stp xt1, xt2, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STPXi>() {
+  memoryData[0] = operands[0];
+  memoryData[1] = operands[1];
+}
+
+// stp dt1, dt2, [xn], #imm
+// stp qt1, qt2, [xn], #imm
+// stp st1, st2, [xn], #imm
+// stp wt1, wt2, [xn], #imm
+// stp xt1, xt2, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STPXpost>() {
+  memoryData[0] = operands[0];
+  memoryData[1] = operands[1];
+  results[0] = operands[2].get<uint64_t>() + metadata.operands[3].imm;
+}
+
+// stp dt1, dt2, [xn, #imm]!
+// stp qt1, qt2, [xn, #imm]!
+// stp st1, st2, [xn, #imm]!
+// stp wt1, wt2, [xn, #imm]!
+// stp xt1, xt2, [xn, #imm]!
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STPXpre>() {
+  memoryData[0] = operands[0];
+  memoryData[1] = operands[1];
+  results[0] =
+      operands[2].get<uint64_t>() + metadata.operands[2].mem.disp;
+}
+
+// strb wd, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRBBpost>() {
+  // STORE
+  memoryData[0] = operands[0];
+  results[0] = operands[1].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// strb wd, [xn, #imm]!
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRBBpre>() {
+  // STORE
+  memoryData[0] = operands[0];
+  results[0] =
+      operands[1].get<uint64_t>() + metadata.operands[1].mem.disp;
+}
+
+// strb wd,  [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRBBroW>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// strb wd,  [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRBBroX>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// strb wd, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRBBui>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// str bt, [xn, #imm]
+// str dt, [xn, #imm]
+// str ht, [xn, #imm]
+// str qt, [xn, #imm]
+// str st, [xn, #imm]
+// str wt, [xn, #imm]
+// str xt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRXui>() {
+  memoryData[0] = operands[0];
+}
+
+// str bt, [xn], #imm
+// str dt, [xn], #imm
+// str ht, [xn], #imm
+// str qt, [xn], #imm
+// str st, [xn], #imm
+// str wt, [xn], #imm
+// str xt, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRXpost>() {
+  memoryData[0] = operands[0];
+  results[0] = operands[1].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// str bt, [xn, #imm]!
+// str dt, [xn, #imm]!
+// str ht, [xn, #imm]!
+// str qt, [xn, #imm]!
+// str st, [xn, #imm]!
+// str wt, [xn, #imm]!
+// str xt, [xn, #imm]!
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRXpre>() {
+  memoryData[0] = operands[0];
+  results[0] =
+      operands[1].get<uint64_t>() + metadata.operands[1].mem.disp;
+}
+
+// str dt, [xn, wm{, #extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRDroW>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// str dt, [xn, xm{, #extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRDroX>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// strh wt, [xn], #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRHHpost>() {
+  // STORE
+  memoryData[0] = operands[0];
+  results[0] = operands[1].get<uint64_t>() + metadata.operands[2].imm;
+}
+
+// strh wd, [xn, #imm]!
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRHHpre>() {
+  // STORE
+  memoryData[0] = operands[0];
+  results[0] =
+      operands[1].get<uint64_t>() + metadata.operands[1].mem.disp;
+}
+
+// strh wd,  [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRHHroW>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// strh wd,  [xn, xm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRHHroX>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// strh wt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRHHui>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// str qt, [xn, xm{, extend, {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRQroX>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// str st, [xn, wm{, #extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRSroW>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// str st, [xn, xm{, #extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRSroX>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// str wd, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRWroW>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// str wt, [xn, xm{, extend, {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRWroX>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// str xd, [xn, wm{, extend {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRXroW>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// str xt, [xn, xm{, extend, {#amount}}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STRXroX>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// str pt, [xn{, #imm, mul vl}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STR_PXI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint64_t PL_bits = VL_bits / 8;
+  const uint16_t partition_num = PL_bits / 8;
+  const uint8_t* p = operands[0].getAsVector<uint8_t>();
+  for (int i = 0; i < partition_num; i++) {
+    memoryData[i] = p[i];
+  }
+}
+
+// str zt, [xn{, #imm, mul vl}]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STR_ZXI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  // STORE
+  const uint16_t partition_num = VL_bits / 8;
+  const uint8_t* z = operands[0].getAsVector<uint8_t>();
+  for (int i = 0; i < partition_num; i++) {
+    memoryData[i] = z[i];
+  }
+}
+
+// sturb wd, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STURBBi>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// stur dt, [xn, #imm]
+// sturh wt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STURHHi>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// stur qt, [xn, #imm]
+// stur st, [xn, #imm]
+// stur wt, [xn, #imm]
+// stur xt, [xn, #imm]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STURXi>() {
+  // STORE
+  memoryData[0] = operands[0];
+}
+
+// stxr ws, wt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STXRW>() {
+  // STORE
+  memoryData[0] = operands[0];
+  // TODO: Implement atomic memory access
+  results[0] = static_cast<uint64_t>(0);
+}
+
+// stxr ws, xt, [xn]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_STXRX>() {
+  // STORE
+  memoryData[0] = operands[0];
+  // TODO: Implement atomic memory access
+  results[0] = static_cast<uint64_t>(0);
+}
+
+// subs wd, wn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBSWri>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subShift_imm<uint32_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = {result, 8};
+}
+
+// subs wd, wn, wm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBSWrs>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subShift_3ops<uint32_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = {result, 8};
+}
+
+// subs wd, wn, wm{, extend #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBSWrx>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subExtend_3ops<uint32_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = {result, 8};
+}
+
+// subs xd, xn, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBSXri>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subShift_imm<uint64_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = result;
+}
+
+// subs xd, xn, xm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBSXrs>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subShift_3ops<uint64_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = result;
+}
+
+// subs xd, xn, wm{, extend #amount}
+// subs xd, xn, xm{, extend #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBSXrx64>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subExtend_3ops<uint64_t>(operands, metadata, true);
+  results[0] = nzcv;
+  results[1] = result;
+}
+
+// sub wd, wn, #imm{, <shift>}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBWri>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subShift_imm<uint32_t>(operands, metadata, false);
+  results[0] = {result, 8};
+}
+
+// sub wd, wn, wm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBWrs>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subShift_3ops<uint32_t>(operands, metadata, false);
+  results[0] = {result, 8};
+}
+
+// sub xd, xn, #imm{, <shift>}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBXri>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subShift_imm<uint64_t>(operands, metadata, false);
+  results[0] = result;
+}
+
+// sub xd, xn, xm{, shift #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBXrs>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subShift_3ops<uint64_t>(operands, metadata, false);
+  results[0] = result;
+}
+
+// sub xd, xn, wm{, extend #amount}
+// sub xd, xn, xm{, extend #amount}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBXrx64>() {
+  auto [result, nzcv] =
+      arithmeticHelp::subExtend_3ops<uint64_t>(operands, metadata, false);
+  results[0] = result;
+}
+
+// sub zd.b, zn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUB_ZZZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveSub_3vecs<uint8_t>(operands, VL_bits);
+}
+
+// sub zd.d, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUB_ZZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveSub_3vecs<uint64_t>(operands, VL_bits);
+}
+
+// sub zd.h, zn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUB_ZZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveSub_3vecs<uint16_t>(operands, VL_bits);
+}
+
+// sub zd.s, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUB_ZZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveSub_3vecs<uint32_t>(operands, VL_bits);
+}
+
+// sub vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBv16i8>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 16>(
+      operands, [](uint8_t x, uint8_t y) -> uint8_t { return x - y; });
+}
+
+// sub dd, dn, dm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBv1i64>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint64_t, 1>(
+      operands, [](uint64_t x, uint64_t y) -> uint64_t { return x - y; });
+}
+
+// sub vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBv2i32>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint32_t, 2>(
+      operands, [](uint32_t x, uint32_t y) -> uint32_t { return x - y; });
+}
+
+// sub vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBv2i64>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint64_t, 2>(
+      operands, [](uint64_t x, uint64_t y) -> uint64_t { return x - y; });
+}
+
+// sub vd.4h, vn.4h, vm.4h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBv4i16>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint16_t, 4>(
+      operands, [](uint64_t x, uint16_t y) -> uint16_t { return x - y; });
+}
+
+// sub vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBv4i32>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint32_t, 4>(
+      operands, [](uint32_t x, uint32_t y) -> uint32_t { return x - y; });
+}
+
+// sub vd.8h, vn.8h, vm.8h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBv8i16>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint16_t, 8>(
+      operands, [](uint16_t x, uint16_t y) -> uint16_t { return x - y; });
+}
+
+// sub vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SUBv8i8>() {
+  results[0] = neonHelp::vecLogicOp_3vecs<uint8_t, 8>(
+      operands, [](uint8_t x, uint8_t y) -> uint8_t { return x - y; });
+}
+
+// svc #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SVC>() {
+  exceptionEncountered_ = true;
+  exception_ = InstructionException::SupervisorCall;
+}
+
+// sxtw zd.d, pg/m, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SXTW_ZPmZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveSxtPredicated<int64_t, int32_t>(operands, VL_bits);
+}
+
+// sys #<op1>, cn, cm, #<op2>{, xt}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_SYSxt>() {
+  // if (metadata.id == ARM64_INS_DC) {
+  //   uint64_t address = operands[0].get<uint64_t>();
+  //   uint8_t dzp = operands[1].get<uint64_t>() & 8;
+  //   uint8_t N = std::pow(2, operands[1].get<uint64_t>() & 7);
+  //   if (metadata.operands[0].sys == ARM64_DC_ZVA) {
+  //     if (dzp) {
+  //       // TODO
+  //     }
+  //   }
+  // }
+}
+
+// tbl Vd.16b {Vn.16b, Vn+1.16b, Vn+2.16b,Vn+3.16b } Vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBLv16i8Four>() {
+  results[0] = neonHelp::vecTbl<16>(operands, metadata);
+}
+
+// tbl Vd.16b {Vn.16b} Vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBLv16i8One>() {
+  results[0] = neonHelp::vecTbl<16>(operands, metadata);
+}
+
+// tbl Vd.16b {Vn.16b, Vn+1.16b, Vn+2.16b } Vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBLv16i8Three>() {
+  results[0] = neonHelp::vecTbl<16>(operands, metadata);
+}
+
+// tbl Vd.16b {Vn.16b, Vn+1.16b } Vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBLv16i8Two>() {
+  results[0] = neonHelp::vecTbl<16>(operands, metadata);
+}
+
+// tbl Vd.8b {Vn.16b, Vn+1.16b, Vn+2.16b,Vn+3.16b } Vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBLv8i8Four>() {
+  results[0] = neonHelp::vecTbl<8>(operands, metadata);
+}
+
+// tbl Vd.8b {Vn.16b} Vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBLv8i8One>() {
+  results[0] = neonHelp::vecTbl<8>(operands, metadata);
+}
+
+// tbl Vd.8b {Vn.16b, Vn+1.16b, Vn+2.16b } Vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBLv8i8Three>() {
+  results[0] = neonHelp::vecTbl<8>(operands, metadata);
+}
+
+// tbl Vd.8b {Vn.16b, Vn+1.16b } Vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBLv8i8Two>() {
+  results[0] = neonHelp::vecTbl<8>(operands, metadata);
+}
+
+// tbnz wn, #imm, label
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBNZW>() {
+  auto [taken, addr] = conditionalHelp::tbnz_tbz<uint32_t>(
+      operands, metadata, instructionAddress_, true);
+  branchTaken_ = taken;
+  branchAddress_ = addr;
+}
 
-#ifndef NDEBUG
-  // Check if upper bits of vector registers are zeroed because Z
-  // configuration extend to 256 bytes whilst V configurations only extend
-  // to 16 bytes. Thus upper 240 bytes must be ignored by being set to 0.
-  for (int i = 0; i < destinationRegisterCount; i++) {
-    if ((destinationRegisters[i].type == RegisterType::VECTOR) && !isSVEData_) {
-      if (results[i].size() != 256)
-        std::cerr << "[SimEng:Instruction_execute] " << metadata.mnemonic
-                  << " opcode: " << metadata.opcode
-                  << " has not been zero extended correctly\n";
-    }
+// tbnz xn, #imm, label
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBNZX>() {
+  auto [taken, addr] = conditionalHelp::tbnz_tbz<uint64_t>(
+      operands, metadata, instructionAddress_, true);
+  branchTaken_ = taken;
+  branchAddress_ = addr;
+}
+
+// tbz wn, #imm, label
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBZW>() {
+  auto [taken, addr] = conditionalHelp::tbnz_tbz<uint32_t>(
+      operands, metadata, instructionAddress_, false);
+  branchTaken_ = taken;
+  branchAddress_ = addr;
+}
+
+// tbz xn, #imm, label
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TBZX>() {
+  auto [taken, addr] = conditionalHelp::tbnz_tbz<uint64_t>(
+      operands, metadata, instructionAddress_, false);
+  branchTaken_ = taken;
+  branchAddress_ = addr;
+}
+
+// trn1 zd.b, zn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1_ZZZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveTrn1_3vecs<uint8_t>(operands, VL_bits);
+}
+
+// trn1 zd.d, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1_ZZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveTrn1_3vecs<uint64_t>(operands, VL_bits);
+}
+
+// trn1 zd.h, zn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1_ZZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveTrn1_3vecs<uint16_t>(operands, VL_bits);
+}
+
+// trn1 zd.s, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1_ZZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveTrn1_3vecs<uint32_t>(operands, VL_bits);
+}
+
+// trn1 vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1v16i8>() {
+  results[0] = neonHelp::vecTrn1<uint8_t, 16>(operands);
+}
+
+// trn1 vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1v2i32>() {
+  results[0] = neonHelp::vecTrn1<uint32_t, 2>(operands);
+}
+
+// trn1 vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1v2i64>() {
+  results[0] = neonHelp::vecTrn1<uint64_t, 2>(operands);
+}
+
+// trn1 vd.4h, vn.4h, vm.4h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1v4i16>() {
+  results[0] = neonHelp::vecTrn1<uint16_t, 4>(operands);
+}
+
+// trn1 vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1v4i32>() {
+  results[0] = neonHelp::vecTrn1<uint32_t, 4>(operands);
+}
+
+// trn1 vd.8h, vn.8h, vm.8h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1v8i16>() {
+  results[0] = neonHelp::vecTrn1<uint16_t, 8>(operands);
+}
+
+// trn1 vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN1v8i8>() {
+  results[0] = neonHelp::vecTrn1<uint8_t, 8>(operands);
+}
+
+// trn2 zd.b, zn.b, zm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2_ZZZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveTrn2_3vecs<uint8_t>(operands, VL_bits);
+}
+
+// trn2 zd.d, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2_ZZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveTrn2_3vecs<uint64_t>(operands, VL_bits);
+}
+
+// trn2 zd.h, zn.h, zm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2_ZZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveTrn2_3vecs<uint16_t>(operands, VL_bits);
+}
+
+// trn2 zd.s, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2_ZZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveTrn2_3vecs<uint32_t>(operands, VL_bits);
+}
+
+// trn2 vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2v16i8>() {
+  results[0] = neonHelp::vecTrn2<uint8_t, 16>(operands);
+}
+
+// trn2 vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2v2i32>() {
+  results[0] = neonHelp::vecTrn2<uint32_t, 2>(operands);
+}
+
+// trn2 vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2v2i64>() {
+  results[0] = neonHelp::vecTrn2<uint64_t, 2>(operands);
+}
+
+// trn2 vd.4h, vn.4h, vm.4h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2v4i16>() {
+  results[0] = neonHelp::vecTrn2<uint16_t, 4>(operands);
+}
+
+// trn2 vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2v4i32>() {
+  results[0] = neonHelp::vecTrn2<uint32_t, 4>(operands);
+}
+
+// trn2 vd.8h, vn.8h, vm.8h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2v8i16>() {
+  results[0] = neonHelp::vecTrn2<uint16_t, 8>(operands);
+}
+
+// trn2 vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_TRN2v8i8>() {
+  results[0] = neonHelp::vecTrn2<uint8_t, 8>(operands);
+}
+
+// uaddv dd, pg, zn.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UADDV_VPZ_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAddvPredicated<uint8_t>(operands, VL_bits);
+}
+
+// uaddv dd, pg, zn.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UADDV_VPZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAddvPredicated<uint64_t>(operands, VL_bits);
+}
+
+// uaddv dd, pg, zn.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UADDV_VPZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAddvPredicated<uint16_t>(operands, VL_bits);
+}
+
+// uaddv dd, pg, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UADDV_VPZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveAddvPredicated<uint32_t>(operands, VL_bits);
+}
+
+// ubfm wd, wn, #immr, #imms
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UBFMWri>() {
+  results[0] = {
+      bitmanipHelp::bfm_2imms<uint32_t>(operands, metadata, false, true),
+      8};
+}
+
+// ubfm xd, xn, #immr, #imms
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UBFMXri>() {
+  results[0] =
+      bitmanipHelp::bfm_2imms<uint64_t>(operands, metadata, false, true);
+}
+
+// ucvtf dd, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UCVTFUWDri>() {
+  results[0] = {static_cast<double>(operands[0].get<uint32_t>()), 256};
+}
+
+// ucvtf sd, wn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UCVTFUWSri>() {
+  results[0] = {static_cast<float>(operands[0].get<uint32_t>()), 256};
+}
+
+// ucvtf dd, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UCVTFUXDri>() {
+  results[0] = {static_cast<double>(operands[0].get<uint64_t>()), 256};
+}
+
+// ucvtf sd, xn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UCVTFUXSri>() {
+  results[0] = {static_cast<float>(operands[0].get<uint64_t>()), 256};
+}
+
+// ucvtf sd, sn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UCVTFv1i32>() {
+  results[0] = {static_cast<float>(operands[0].get<uint32_t>()), 256};
+}
+
+// ucvtf dd, dn
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UCVTFv1i64>() {
+  results[0] = {static_cast<double>(operands[0].get<uint64_t>()), 256};
+}
+
+// udiv wd, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UDIVWr>() {
+  results[0] = {divideHelp::div_3ops<uint32_t>(operands), 8};
+}
+
+// udiv xd, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UDIVXr>() {
+  results[0] = {divideHelp::div_3ops<uint64_t>(operands), 8};
+}
+
+// umaddl xd, wn, wm, xa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UMADDLrrr>() {
+  results[0] = multiplyHelp::maddl_4ops<uint64_t, uint32_t>(operands);
+}
+
+// umaxp vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UMAXPv16i8>() {
+  results[0] = neonHelp::vecUMaxP<uint8_t, 16>(operands);
+}
+
+// uminp vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UMINPv16i8>() {
+  results[0] = neonHelp::vecUMinP<uint8_t, 16>(operands);
+}
+
+// umov wd, vn.s[0]
+// umov wd, vn.s[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UMOVvi32>() {
+  const uint32_t* vec = operands[0].getAsVector<uint32_t>();
+  results[0] = {vec[metadata.operands[1].vector_index], 8};
+}
+
+// umov xd, vn.d[0]
+// umov xd, vn.d[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UMOVvi64>() {
+  const uint64_t* vec = operands[0].getAsVector<uint64_t>();
+  results[0] = vec[metadata.operands[1].vector_index];
+}
+
+// umov wd, vn.b[0]
+// umov wd, vn.b[index]
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UMOVvi8>() {
+  const uint8_t* vec = operands[0].getAsVector<uint8_t>();
+  results[0] = {vec[metadata.operands[1].vector_index], 8};
+}
+
+// umsubl xd, wn, wm, xa
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UMSUBLrrr>() {
+  results[0] = arithmeticHelp::msubl_4ops<uint64_t, uint32_t>(operands);
+}
+
+// umulh xd, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UMULHrr>() {
+  results[0] = AuxFunc::mulhi(operands[0].get<uint64_t>(),
+                              operands[1].get<uint64_t>());
+}
+
+// uqdecd wd{, pattern{, MUL #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UQDECD_WPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveUqdec<uint32_t, 64u>(operands, metadata, VL_bits);
+}
+
+// uqdecd xd{, pattern{, MUL #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UQDECD_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveUqdec<uint64_t, 64u>(operands, metadata, VL_bits);
+}
+
+// uqdech xd{, pattern{, MUL #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UQDECH_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveUqdec<uint64_t, 16u>(operands, metadata, VL_bits);
+}
+
+// uqdecw xd{, pattern{, MUL #imm}}
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UQDECW_XPiI>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveUqdec<uint64_t, 32u>(operands, metadata, VL_bits);
+}
+
+// ushll2 vd.8h, vn.16b, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_USHLLv16i8_shift>() {
+  results[0] = neonHelp::vecShllShift_vecImm<uint16_t, uint8_t, 8>(
+      operands, metadata, true);
+}
+
+// ushll vd.4s, vn.4h, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_USHLLv4i16_shift>() {
+  results[0] = neonHelp::vecShllShift_vecImm<uint32_t, uint16_t, 4>(
+      operands, metadata, false);
+}
+
+// ushll2 vd.4s, vn.8h, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_USHLLv8i16_shift>() {
+  results[0] = neonHelp::vecShllShift_vecImm<uint32_t, uint16_t, 4>(
+      operands, metadata, true);
+}
+
+// ushll vd.8h, vn.8b, #imm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_USHLLv8i8_shift>() {
+  results[0] = neonHelp::vecShllShift_vecImm<uint16_t, uint8_t, 8>(
+      operands, metadata, false);
+}
+
+// uunpkhi zd.d, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UUNPKHI_ZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveUnpk_vecs<uint64_t, uint32_t>(operands, VL_bits, true);
+}
+
+// uunpkhi zd.h, zn.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UUNPKHI_ZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveUnpk_vecs<uint16_t, uint8_t>(operands, VL_bits, true);
+}
+
+// uunpkhi zd.s, zn.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UUNPKHI_ZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveUnpk_vecs<uint32_t, uint16_t>(operands, VL_bits, true);
+}
+
+// uunpklo zd.d, zn.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UUNPKLO_ZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveUnpk_vecs<uint64_t, uint32_t>(operands, VL_bits, false);
+}
+
+// uunpklo zd.h, zn.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UUNPKLO_ZZ_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveUnpk_vecs<uint16_t, uint8_t>(operands, VL_bits, false);
+}
+
+// uunpklo zd.s, zn.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UUNPKLO_ZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] =
+      sveHelp::sveUnpk_vecs<uint32_t, uint16_t>(operands, VL_bits, false);
+}
+
+// uzp1 zd.s, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP1_ZZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveUzp_vecs<uint32_t>(operands, VL_bits, true);
+}
+
+// uzp1 vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP1v16i8>() {
+  results[0] = neonHelp::vecUzp<int8_t, 16>(operands, true);
+}
+
+// uzp1 vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP1v2i32>() {
+  results[0] = neonHelp::vecUzp<int32_t, 2>(operands, true);
+}
+
+// uzp1 vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP1v2i64>() {
+  results[0] = neonHelp::vecUzp<int64_t, 2>(operands, true);
+}
+
+// uzp1 vd.4h, vn.4h, vm.4h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP1v4i16>() {
+  results[0] = neonHelp::vecUzp<int16_t, 4>(operands, true);
+}
+
+// uzp1 vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP1v4i32>() {
+  results[0] = neonHelp::vecUzp<int32_t, 4>(operands, true);
+}
+
+// uzp1 vd.8h, vn.8h, vm.8h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP1v8i16>() {
+  results[0] = neonHelp::vecUzp<int16_t, 8>(operands, true);
+}
+
+// uzp1 vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP1v8i8>() {
+  results[0] = neonHelp::vecUzp<int8_t, 8>(operands, true);
+}
+
+// uzp2 vd.16b, vn.16b, vm.16b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP2v16i8>() {
+  results[0] = neonHelp::vecUzp<int8_t, 16>(operands, false);
+}
+
+// uzp2 vd.2s, vn.2s, vm.2s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP2v2i32>() {
+  results[0] = neonHelp::vecUzp<int32_t, 2>(operands, false);
+}
+
+// uzp2 vd.2d, vn.2d, vm.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP2v2i64>() {
+  results[0] = neonHelp::vecUzp<int64_t, 2>(operands, false);
+}
+
+// uzp2 vd.4h, vn.4h, vm.4h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP2v4i16>() {
+  results[0] = neonHelp::vecUzp<int16_t, 4>(operands, false);
+}
+
+// uzp2 vd.4s, vn.4s, vm.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP2v4i32>() {
+  results[0] = neonHelp::vecUzp<int32_t, 4>(operands, false);
+}
+
+// uzp2 vd.8h, vn.8h, vm.8h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP2v8i16>() {
+  results[0] = neonHelp::vecUzp<int16_t, 8>(operands, false);
+}
+
+// uzp2 vd.8b, vn.8b, vm.8b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_UZP2v8i8>() {
+  results[0] = neonHelp::vecUzp<int8_t, 8>(operands, false);
+}
+
+// whilelo pd.b, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_WHILELO_PWW_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] =
+      sveHelp::sveWhilelo<uint32_t, uint8_t>(operands, VL_bits, true);
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// whilelo pd.d, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_WHILELO_PWW_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] =
+      sveHelp::sveWhilelo<uint32_t, uint64_t>(operands, VL_bits, true);
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// whilelo pd.h, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_WHILELO_PWW_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] =
+      sveHelp::sveWhilelo<uint32_t, uint16_t>(operands, VL_bits, true);
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// whilelo pd.s, wn, wm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_WHILELO_PWW_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] =
+      sveHelp::sveWhilelo<uint32_t, uint32_t>(operands, VL_bits, true);
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// whilelo pd.b, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_WHILELO_PXX_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] =
+      sveHelp::sveWhilelo<uint64_t, uint8_t>(operands, VL_bits, true);
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// whilelo pd.d, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_WHILELO_PXX_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] =
+      sveHelp::sveWhilelo<uint64_t, uint64_t>(operands, VL_bits, true);
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// whilelo pd.h, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_WHILELO_PXX_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] =
+      sveHelp::sveWhilelo<uint64_t, uint16_t>(operands, VL_bits, true);
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// whilelo pd.s, xn, xm
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_WHILELO_PXX_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  auto [output, nzcv] =
+      sveHelp::sveWhilelo<uint64_t, uint32_t>(operands, VL_bits, true);
+  results[0] = nzcv;
+  results[1] = output;
+}
+
+// xpaclri
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_XPACLRI>() {
+  // SimEng doesn't support PAC, so do nothing
+}
+
+// xtn vd.2s, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_XTNv2i32>() {
+  results[0] = neonHelp::vecXtn<uint32_t, uint64_t, 2>(operands, false);
+}
+
+// xtn vd.4h, vn.4s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_XTNv4i16>() {
+  results[0] = neonHelp::vecXtn<uint16_t, uint32_t, 4>(operands, false);
+}
+
+// xtn2 vd.4s, vn.2d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_XTNv4i32>() {
+  results[0] = neonHelp::vecXtn<uint32_t, uint64_t, 4>(operands, true);
+}
+
+// zip1 pd.b, pn.b, pm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP1_PPP_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_preds<uint8_t>(operands, VL_bits, false);
+}
+
+// zip1 pd.d, pn.d, pm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP1_PPP_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_preds<uint64_t>(operands, VL_bits, false);
+}
+
+// zip1 pd.h, pn.h, pm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP1_PPP_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_preds<uint16_t>(operands, VL_bits, false);
+}
+
+// zip1 pd.s, pn.s, pm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP1_PPP_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_preds<uint32_t>(operands, VL_bits, false);
+}
+
+// zip1 zd.d, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP1_ZZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_vecs<uint64_t>(operands, VL_bits, false);
+}
+
+// zip1 zd.s, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP1_ZZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_vecs<uint32_t>(operands, VL_bits, false);
+}
+
+// zip2 pd.b, pn.b, pm.b
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP2_PPP_B>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_preds<uint8_t>(operands, VL_bits, true);
+}
+
+// zip2 pd.d, pn.d, pm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP2_PPP_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_preds<uint64_t>(operands, VL_bits, true);
+}
+
+// zip2 pd.h, pn.h, pm.h
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP2_PPP_H>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_preds<uint16_t>(operands, VL_bits, true);
+}
+
+// zip2 pd.s, pn.s, pm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP2_PPP_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_preds<uint32_t>(operands, VL_bits, true);
+}
+
+// zip2 zd.d, zn.d, zm.d
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP2_ZZZ_D>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_vecs<uint64_t>(operands, VL_bits, true);
+}
+
+// zip2 zd.s, zn.s, zm.s
+template <>
+void Instruction::executeOpcode<Opcode::AArch64_ZIP2_ZZZ_S>() {
+  const uint16_t VL_bits = architecture_.getVectorLength();
+  results[0] = sveHelp::sveZip_vecs<uint32_t>(operands, VL_bits, true);
+}
+
+Instruction::Handler Instruction::resolveExecuteHandler() const {
+  if (isMicroOp_) return &Instruction::executeMicroOp;
+  switch (metadata.opcode) {
+    case Opcode::AArch64_ADCXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADCXr>;
+    case Opcode::AArch64_ADDPL_XXI:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDPL_XXI>;
+    case Opcode::AArch64_ADDPv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDPv16i8>;
+    case Opcode::AArch64_ADDPv2i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDPv2i64>;
+    case Opcode::AArch64_ADDPv2i64p:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDPv2i64p>;
+    case Opcode::AArch64_ADDPv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDPv4i32>;
+    case Opcode::AArch64_ADDPv8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDPv8i16>;
+    case Opcode::AArch64_ADDSWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDSWri>;
+    case Opcode::AArch64_ADDSWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDSWrs>;
+    case Opcode::AArch64_ADDSWrx:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDSWrx>;
+    case Opcode::AArch64_ADDSXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDSXri>;
+    case Opcode::AArch64_ADDSXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDSXrs>;
+    case Opcode::AArch64_ADDSXrx:
+    case Opcode::AArch64_ADDSXrx64:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDSXrx64>;
+    case Opcode::AArch64_ADDVL_XXI:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDVL_XXI>;
+    case Opcode::AArch64_ADDVv8i8v:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDVv8i8v>;
+    case Opcode::AArch64_ADDWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDWri>;
+    case Opcode::AArch64_ADDWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDWrs>;
+    case Opcode::AArch64_ADDWrx:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDWrx>;
+    case Opcode::AArch64_ADDXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDXri>;
+    case Opcode::AArch64_ADDXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDXrs>;
+    case Opcode::AArch64_ADDXrx:
+    case Opcode::AArch64_ADDXrx64:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDXrx64>;
+    case Opcode::AArch64_ADD_ZPmZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADD_ZPmZ_B>;
+    case Opcode::AArch64_ADD_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADD_ZPmZ_D>;
+    case Opcode::AArch64_ADD_ZPmZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADD_ZPmZ_H>;
+    case Opcode::AArch64_ADD_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADD_ZPmZ_S>;
+    case Opcode::AArch64_ADD_ZZZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADD_ZZZ_B>;
+    case Opcode::AArch64_ADD_ZZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADD_ZZZ_D>;
+    case Opcode::AArch64_ADD_ZZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADD_ZZZ_H>;
+    case Opcode::AArch64_ADD_ZZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADD_ZZZ_S>;
+    case Opcode::AArch64_ADDv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDv16i8>;
+    case Opcode::AArch64_ADDv1i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDv1i64>;
+    case Opcode::AArch64_ADDv2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDv2i32>;
+    case Opcode::AArch64_ADDv2i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDv2i64>;
+    case Opcode::AArch64_ADDv4i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDv4i16>;
+    case Opcode::AArch64_ADDv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDv4i32>;
+    case Opcode::AArch64_ADDv8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDv8i16>;
+    case Opcode::AArch64_ADDv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADDv8i8>;
+    case Opcode::AArch64_ADR:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADR>;
+    case Opcode::AArch64_ADRP:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADRP>;
+    case Opcode::AArch64_ADR_LSL_ZZZ_D_0:
+    case Opcode::AArch64_ADR_LSL_ZZZ_D_1:
+    case Opcode::AArch64_ADR_LSL_ZZZ_D_2:
+    case Opcode::AArch64_ADR_LSL_ZZZ_D_3:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADR_LSL_ZZZ_D_3>;
+    case Opcode::AArch64_ADR_LSL_ZZZ_S_0:
+    case Opcode::AArch64_ADR_LSL_ZZZ_S_1:
+    case Opcode::AArch64_ADR_LSL_ZZZ_S_2:
+    case Opcode::AArch64_ADR_LSL_ZZZ_S_3:
+      return &Instruction::executeOpcode<Opcode::AArch64_ADR_LSL_ZZZ_S_3>;
+    case Opcode::AArch64_ANDSWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_ANDSWri>;
+    case Opcode::AArch64_ANDSWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ANDSWrs>;
+    case Opcode::AArch64_ANDSXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_ANDSXri>;
+    case Opcode::AArch64_ANDSXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ANDSXrs>;
+    case Opcode::AArch64_ANDWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_ANDWri>;
+    case Opcode::AArch64_ANDWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ANDWrs>;
+    case Opcode::AArch64_ANDXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_ANDXri>;
+    case Opcode::AArch64_ANDXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ANDXrs>;
+    case Opcode::AArch64_AND_PPzPP:
+      return &Instruction::executeOpcode<Opcode::AArch64_AND_PPzPP>;
+    case Opcode::AArch64_AND_ZI:
+      return &Instruction::executeOpcode<Opcode::AArch64_AND_ZI>;
+    case Opcode::AArch64_AND_ZPmZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_AND_ZPmZ_B>;
+    case Opcode::AArch64_AND_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_AND_ZPmZ_D>;
+    case Opcode::AArch64_AND_ZPmZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_AND_ZPmZ_H>;
+    case Opcode::AArch64_AND_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_AND_ZPmZ_S>;
+    case Opcode::AArch64_ANDv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_ANDv16i8>;
+    case Opcode::AArch64_ANDv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_ANDv8i8>;
+    case Opcode::AArch64_ASRVWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_ASRVWr>;
+    case Opcode::AArch64_ASRVXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_ASRVXr>;
+    case Opcode::AArch64_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_B>;
+    case Opcode::AArch64_BFMWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_BFMWri>;
+    case Opcode::AArch64_BFMXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_BFMXri>;
+    case Opcode::AArch64_BICSWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_BICSWrs>;
+    case Opcode::AArch64_BICSXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_BICSXrs>;
+    case Opcode::AArch64_BICWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_BICWrs>;
+    case Opcode::AArch64_BICXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_BICXrs>;
+    case Opcode::AArch64_BICv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_BICv16i8>;
+    case Opcode::AArch64_BICv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_BICv4i32>;
+    case Opcode::AArch64_BICv8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_BICv8i16>;
+    case Opcode::AArch64_BICv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_BICv8i8>;
+    case Opcode::AArch64_BIFv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_BIFv16i8>;
+    case Opcode::AArch64_BITv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_BITv16i8>;
+    case Opcode::AArch64_BITv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_BITv8i8>;
+    case Opcode::AArch64_BL:
+      return &Instruction::executeOpcode<Opcode::AArch64_BL>;
+    case Opcode::AArch64_BLR:
+      return &Instruction::executeOpcode<Opcode::AArch64_BLR>;
+    case Opcode::AArch64_BR:
+      return &Instruction::executeOpcode<Opcode::AArch64_BR>;
+    case Opcode::AArch64_BRK:
+      return &Instruction::executeOpcode<Opcode::AArch64_BRK>;
+    case Opcode::AArch64_BSLv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_BSLv16i8>;
+    case Opcode::AArch64_Bcc:
+      return &Instruction::executeOpcode<Opcode::AArch64_Bcc>;
+    case Opcode::AArch64_CASALW:
+      return &Instruction::executeOpcode<Opcode::AArch64_CASALW>;
+    case Opcode::AArch64_CASALX:
+      return &Instruction::executeOpcode<Opcode::AArch64_CASALX>;
+    case Opcode::AArch64_CBNZW:
+      return &Instruction::executeOpcode<Opcode::AArch64_CBNZW>;
+    case Opcode::AArch64_CBNZX:
+      return &Instruction::executeOpcode<Opcode::AArch64_CBNZX>;
+    case Opcode::AArch64_CBZW:
+      return &Instruction::executeOpcode<Opcode::AArch64_CBZW>;
+    case Opcode::AArch64_CBZX:
+      return &Instruction::executeOpcode<Opcode::AArch64_CBZX>;
+    case Opcode::AArch64_CCMNWi:
+      return &Instruction::executeOpcode<Opcode::AArch64_CCMNWi>;
+    case Opcode::AArch64_CCMNXi:
+      return &Instruction::executeOpcode<Opcode::AArch64_CCMNXi>;
+    case Opcode::AArch64_CCMPWi:
+      return &Instruction::executeOpcode<Opcode::AArch64_CCMPWi>;
+    case Opcode::AArch64_CCMPWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CCMPWr>;
+    case Opcode::AArch64_CCMPXi:
+      return &Instruction::executeOpcode<Opcode::AArch64_CCMPXi>;
+    case Opcode::AArch64_CCMPXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CCMPXr>;
+    case Opcode::AArch64_CLZXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CLZXr>;
+    case Opcode::AArch64_CMEQv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMEQv16i8>;
+    case Opcode::AArch64_CMEQv16i8rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMEQv16i8rz>;
+    case Opcode::AArch64_CMEQv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMEQv4i32>;
+    case Opcode::AArch64_CMEQv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMEQv8i8>;
+    case Opcode::AArch64_CMEQv8i8rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMEQv8i8rz>;
+    case Opcode::AArch64_CMHIv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMHIv4i32>;
+    case Opcode::AArch64_CMHSv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMHSv16i8>;
+    case Opcode::AArch64_CMPEQ_PPzZI_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZI_B>;
+    case Opcode::AArch64_CMPEQ_PPzZI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZI_D>;
+    case Opcode::AArch64_CMPEQ_PPzZI_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZI_H>;
+    case Opcode::AArch64_CMPEQ_PPzZI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZI_S>;
+    case Opcode::AArch64_CMPEQ_PPzZZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZZ_B>;
+    case Opcode::AArch64_CMPEQ_PPzZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZZ_D>;
+    case Opcode::AArch64_CMPEQ_PPzZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZZ_H>;
+    case Opcode::AArch64_CMPEQ_PPzZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPEQ_PPzZZ_S>;
+    case Opcode::AArch64_CMPGT_PPzZZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPGT_PPzZZ_B>;
+    case Opcode::AArch64_CMPGT_PPzZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPGT_PPzZZ_D>;
+    case Opcode::AArch64_CMPGT_PPzZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPGT_PPzZZ_H>;
+    case Opcode::AArch64_CMPGT_PPzZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPGT_PPzZZ_S>;
+    case Opcode::AArch64_CMPHI_PPzZZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPHI_PPzZZ_B>;
+    case Opcode::AArch64_CMPHI_PPzZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPHI_PPzZZ_D>;
+    case Opcode::AArch64_CMPHI_PPzZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPHI_PPzZZ_H>;
+    case Opcode::AArch64_CMPHI_PPzZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPHI_PPzZZ_S>;
+    case Opcode::AArch64_CMPNE_PPzZI_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZI_B>;
+    case Opcode::AArch64_CMPNE_PPzZI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZI_D>;
+    case Opcode::AArch64_CMPNE_PPzZI_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZI_H>;
+    case Opcode::AArch64_CMPNE_PPzZI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZI_S>;
+    case Opcode::AArch64_CMPNE_PPzZZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZZ_B>;
+    case Opcode::AArch64_CMPNE_PPzZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZZ_D>;
+    case Opcode::AArch64_CMPNE_PPzZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZZ_H>;
+    case Opcode::AArch64_CMPNE_PPzZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_CMPNE_PPzZZ_S>;
+    case Opcode::AArch64_CNTB_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_CNTB_XPiI>;
+    case Opcode::AArch64_CNTD_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_CNTD_XPiI>;
+    case Opcode::AArch64_CNTH_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_CNTH_XPiI>;
+    case Opcode::AArch64_CNTP_XPP_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_CNTP_XPP_B>;
+    case Opcode::AArch64_CNTP_XPP_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_CNTP_XPP_D>;
+    case Opcode::AArch64_CNTP_XPP_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_CNTP_XPP_H>;
+    case Opcode::AArch64_CNTP_XPP_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_CNTP_XPP_S>;
+    case Opcode::AArch64_CNTW_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_CNTW_XPiI>;
+    case Opcode::AArch64_CNTv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_CNTv8i8>;
+    case Opcode::AArch64_CPY_ZPzI_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_CPY_ZPzI_B>;
+    case Opcode::AArch64_CPY_ZPzI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_CPY_ZPzI_D>;
+    case Opcode::AArch64_CPY_ZPzI_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_CPY_ZPzI_H>;
+    case Opcode::AArch64_CPY_ZPzI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_CPY_ZPzI_S>;
+    case Opcode::AArch64_DUPi32:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPi32>;
+    case Opcode::AArch64_DUPi64:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPi64>;
+    case Opcode::AArch64_CSELWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CSELWr>;
+    case Opcode::AArch64_CSELXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CSELXr>;
+    case Opcode::AArch64_CSINCWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CSINCWr>;
+    case Opcode::AArch64_CSINCXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CSINCXr>;
+    case Opcode::AArch64_CSINVWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CSINVWr>;
+    case Opcode::AArch64_CSINVXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CSINVXr>;
+    case Opcode::AArch64_CSNEGWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CSNEGWr>;
+    case Opcode::AArch64_CSNEGXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_CSNEGXr>;
+    case Opcode::AArch64_DECB_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_DECB_XPiI>;
+    case Opcode::AArch64_DECD_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_DECD_XPiI>;
+    case Opcode::AArch64_DMB:
+      return &Instruction::executeOpcode<Opcode::AArch64_DMB>;
+    case Opcode::AArch64_DUPM_ZI:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPM_ZI>;
+    case Opcode::AArch64_DUP_ZI_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZI_B>;
+    case Opcode::AArch64_DUP_ZI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZI_D>;
+    case Opcode::AArch64_DUP_ZI_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZI_H>;
+    case Opcode::AArch64_DUP_ZI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZI_S>;
+    case Opcode::AArch64_DUP_ZR_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZR_B>;
+    case Opcode::AArch64_DUP_ZR_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZR_D>;
+    case Opcode::AArch64_DUP_ZR_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZR_H>;
+    case Opcode::AArch64_DUP_ZR_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZR_S>;
+    case Opcode::AArch64_DUP_ZZI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZZI_D>;
+    case Opcode::AArch64_DUP_ZZI_Q:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZZI_Q>;
+    case Opcode::AArch64_DUP_ZZI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUP_ZZI_S>;
+    case Opcode::AArch64_DUPv16i8gpr:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPv16i8gpr>;
+    case Opcode::AArch64_DUPv2i32gpr:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPv2i32gpr>;
+    case Opcode::AArch64_DUPv2i32lane:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPv2i32lane>;
+    case Opcode::AArch64_DUPv2i64gpr:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPv2i64gpr>;
+    case Opcode::AArch64_DUPv2i64lane:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPv2i64lane>;
+    case Opcode::AArch64_DUPv4i16gpr:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPv4i16gpr>;
+    case Opcode::AArch64_DUPv4i32gpr:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPv4i32gpr>;
+    case Opcode::AArch64_DUPv4i32lane:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPv4i32lane>;
+    case Opcode::AArch64_DUPv8i16gpr:
+      return &Instruction::executeOpcode<Opcode::AArch64_DUPv8i16gpr>;
+    case Opcode::AArch64_EORWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_EORWri>;
+    case Opcode::AArch64_EORWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_EORWrs>;
+    case Opcode::AArch64_EORXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_EORXri>;
+    case Opcode::AArch64_EORXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_EORXrs>;
+    case Opcode::AArch64_EOR_PPzPP:
+      return &Instruction::executeOpcode<Opcode::AArch64_EOR_PPzPP>;
+    case Opcode::AArch64_EOR_ZPmZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_EOR_ZPmZ_B>;
+    case Opcode::AArch64_EOR_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_EOR_ZPmZ_D>;
+    case Opcode::AArch64_EOR_ZPmZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_EOR_ZPmZ_H>;
+    case Opcode::AArch64_EOR_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_EOR_ZPmZ_S>;
+    case Opcode::AArch64_EORv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_EORv16i8>;
+    case Opcode::AArch64_EORv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_EORv8i8>;
+    case Opcode::AArch64_EXTRWrri:
+      return &Instruction::executeOpcode<Opcode::AArch64_EXTRWrri>;
+    case Opcode::AArch64_EXTRXrri:
+      return &Instruction::executeOpcode<Opcode::AArch64_EXTRXrri>;
+    case Opcode::AArch64_EXTv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_EXTv16i8>;
+    case Opcode::AArch64_EXTv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_EXTv8i8>;
+    case Opcode::AArch64_FABD32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FABD32>;
+    case Opcode::AArch64_FABD64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FABD64>;
+    case Opcode::AArch64_FABSDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FABSDr>;
+    case Opcode::AArch64_FABSSr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FABSSr>;
+    case Opcode::AArch64_FABS_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FABS_ZPmZ_D>;
+    case Opcode::AArch64_FABS_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FABS_ZPmZ_S>;
+    case Opcode::AArch64_FABSv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FABSv2f64>;
+    case Opcode::AArch64_FABSv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FABSv4f32>;
+    case Opcode::AArch64_FADDA_VPZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDA_VPZ_D>;
+    case Opcode::AArch64_FADDDrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDDrr>;
+    case Opcode::AArch64_FADDPv2f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDPv2f32>;
+    case Opcode::AArch64_FADDPv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDPv2f64>;
+    case Opcode::AArch64_FADDPv2i32p:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDPv2i32p>;
+    case Opcode::AArch64_FADDPv2i64p:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDPv2i64p>;
+    case Opcode::AArch64_FADDPv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDPv4f32>;
+    case Opcode::AArch64_FADDSrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDSrr>;
+    case Opcode::AArch64_FADD_ZPmI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADD_ZPmI_D>;
+    case Opcode::AArch64_FADD_ZPmI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADD_ZPmI_S>;
+    case Opcode::AArch64_FADD_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADD_ZPmZ_D>;
+    case Opcode::AArch64_FADD_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADD_ZPmZ_S>;
+    case Opcode::AArch64_FADD_ZZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADD_ZZZ_D>;
+    case Opcode::AArch64_FADD_ZZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADD_ZZZ_S>;
+    case Opcode::AArch64_FADDv2f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDv2f32>;
+    case Opcode::AArch64_FADDv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDv2f64>;
+    case Opcode::AArch64_FADDv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FADDv4f32>;
+    case Opcode::AArch64_FCADD_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCADD_ZPmZ_D>;
+    case Opcode::AArch64_FCCMPDrr:
+    case Opcode::AArch64_FCCMPEDrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCCMPEDrr>;
+    case Opcode::AArch64_FCCMPESrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCCMPESrr>;
+    case Opcode::AArch64_FCCMPSrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCCMPSrr>;
+    case Opcode::AArch64_FCMEQv2i32rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMEQv2i32rz>;
+    case Opcode::AArch64_FCMEQv4i32rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMEQv4i32rz>;
+    case Opcode::AArch64_FCMGE_PPzZ0_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGE_PPzZ0_D>;
+    case Opcode::AArch64_FCMGE_PPzZ0_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGE_PPzZ0_S>;
+    case Opcode::AArch64_FCMGE_PPzZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGE_PPzZZ_D>;
+    case Opcode::AArch64_FCMGE_PPzZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGE_PPzZZ_S>;
+    case Opcode::AArch64_FCMGEv2f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGEv2f32>;
+    case Opcode::AArch64_FCMGEv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGEv2f64>;
+    case Opcode::AArch64_FCMGEv2i64rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGEv2i64rz>;
+    case Opcode::AArch64_FCMGEv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGEv4f32>;
+    case Opcode::AArch64_FCMGEv4i32rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGEv4i32rz>;
+    case Opcode::AArch64_FCMGT_PPzZ0_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGT_PPzZ0_D>;
+    case Opcode::AArch64_FCMGT_PPzZ0_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGT_PPzZ0_S>;
+    case Opcode::AArch64_FCMGT_PPzZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGT_PPzZZ_D>;
+    case Opcode::AArch64_FCMGT_PPzZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGT_PPzZZ_S>;
+    case Opcode::AArch64_FCMGTv2i32rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGTv2i32rz>;
+    case Opcode::AArch64_FCMGTv2i64rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGTv2i64rz>;
+    case Opcode::AArch64_FCMGTv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGTv4f32>;
+    case Opcode::AArch64_FCMGTv4i32rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMGTv4i32rz>;
+    case Opcode::AArch64_FCMLA_ZPmZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMLA_ZPmZZ_D>;
+    case Opcode::AArch64_FCMLE_PPzZ0_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMLE_PPzZ0_D>;
+    case Opcode::AArch64_FCMLE_PPzZ0_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMLE_PPzZ0_S>;
+    case Opcode::AArch64_FCMLT_PPzZ0_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMLT_PPzZ0_S>;
+    case Opcode::AArch64_FCMLTv2i32rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMLTv2i32rz>;
+    case Opcode::AArch64_FCMLTv2i64rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMLTv2i64rz>;
+    case Opcode::AArch64_FCMLTv4i32rz:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMLTv4i32rz>;
+    case Opcode::AArch64_FCMPDri:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMPDri>;
+    case Opcode::AArch64_FCMPDrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMPDrr>;
+    case Opcode::AArch64_FCMPEDri:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMPEDri>;
+    case Opcode::AArch64_FCMPEDrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMPEDrr>;
+    case Opcode::AArch64_FCMPESri:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMPESri>;
+    case Opcode::AArch64_FCMPESrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMPESrr>;
+    case Opcode::AArch64_FCMPSri:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMPSri>;
+    case Opcode::AArch64_FCMPSrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCMPSrr>;
+    case Opcode::AArch64_FCPY_ZPmI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCPY_ZPmI_D>;
+    case Opcode::AArch64_FCPY_ZPmI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCPY_ZPmI_S>;
+    case Opcode::AArch64_FCSELDrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCSELDrrr>;
+    case Opcode::AArch64_FCSELSrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCSELSrrr>;
+    case Opcode::AArch64_FCVTASUWDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTASUWDr>;
+    case Opcode::AArch64_FCVTASUXDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTASUXDr>;
+    case Opcode::AArch64_FCVTDSr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTDSr>;
+    case Opcode::AArch64_FCVTLv2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTLv2i32>;
+    case Opcode::AArch64_FCVTLv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTLv4i32>;
+    case Opcode::AArch64_FCVTNv2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTNv2i32>;
+    case Opcode::AArch64_FCVTNv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTNv4i32>;
+    case Opcode::AArch64_FCVTSDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTSDr>;
+    case Opcode::AArch64_FCVTZSUWDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZSUWDr>;
+    case Opcode::AArch64_FCVTZSUWSr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZSUWSr>;
+    case Opcode::AArch64_FCVTZSUXDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZSUXDr>;
+    case Opcode::AArch64_FCVTZS_ZPmZ_DtoD:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZS_ZPmZ_DtoD>;
+    case Opcode::AArch64_FCVTZS_ZPmZ_DtoS:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZS_ZPmZ_DtoS>;
+    case Opcode::AArch64_FCVTZS_ZPmZ_StoD:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZS_ZPmZ_StoD>;
+    case Opcode::AArch64_FCVTZS_ZPmZ_StoS:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZS_ZPmZ_StoS>;
+    case Opcode::AArch64_FCVTZSv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZSv2f64>;
+    case Opcode::AArch64_FCVTZUUWDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZUUWDr>;
+    case Opcode::AArch64_FCVTZUUWSr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZUUWSr>;
+    case Opcode::AArch64_FCVTZUUXDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZUUXDr>;
+    case Opcode::AArch64_FCVTZUUXSr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVTZUUXSr>;
+    case Opcode::AArch64_FCVT_ZPmZ_DtoS:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVT_ZPmZ_DtoS>;
+    case Opcode::AArch64_FCVT_ZPmZ_StoD:
+      return &Instruction::executeOpcode<Opcode::AArch64_FCVT_ZPmZ_StoD>;
+    case Opcode::AArch64_FDIVDrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FDIVDrr>;
+    case Opcode::AArch64_FDIVR_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FDIVR_ZPmZ_D>;
+    case Opcode::AArch64_FDIVR_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FDIVR_ZPmZ_S>;
+    case Opcode::AArch64_FDIVSrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FDIVSrr>;
+    case Opcode::AArch64_FDIV_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FDIV_ZPmZ_D>;
+    case Opcode::AArch64_FDIVv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FDIVv2f64>;
+    case Opcode::AArch64_FDUP_ZI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FDUP_ZI_D>;
+    case Opcode::AArch64_FDUP_ZI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FDUP_ZI_S>;
+    case Opcode::AArch64_FMADDDrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMADDDrrr>;
+    case Opcode::AArch64_FMADDSrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMADDSrrr>;
+    case Opcode::AArch64_FMAD_ZPmZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMAD_ZPmZZ_D>;
+    case Opcode::AArch64_FMAD_ZPmZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMAD_ZPmZZ_S>;
+    case Opcode::AArch64_FMAXNMDrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMAXNMDrr>;
+    case Opcode::AArch64_FMAXNMPv2i64p:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMAXNMPv2i64p>;
+    case Opcode::AArch64_FMAXNMSrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMAXNMSrr>;
+    case Opcode::AArch64_FMAXNMv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMAXNMv2f64>;
+    case Opcode::AArch64_FMINNMDrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMINNMDrr>;
+    case Opcode::AArch64_FMINNMPv2i64p:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMINNMPv2i64p>;
+    case Opcode::AArch64_FMINNMSrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMINNMSrr>;
+    case Opcode::AArch64_FMINNMv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMINNMv2f64>;
+    case Opcode::AArch64_FMLA_ZPmZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLA_ZPmZZ_D>;
+    case Opcode::AArch64_FMLA_ZPmZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLA_ZPmZZ_S>;
+    case Opcode::AArch64_FMLAv2f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLAv2f32>;
+    case Opcode::AArch64_FMLAv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLAv2f64>;
+    case Opcode::AArch64_FMLAv2i32_indexed:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLAv2i32_indexed>;
+    case Opcode::AArch64_FMLAv2i64_indexed:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLAv2i64_indexed>;
+    case Opcode::AArch64_FMLAv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLAv4f32>;
+    case Opcode::AArch64_FMLAv4i32_indexed:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLAv4i32_indexed>;
+    case Opcode::AArch64_FMLS_ZPmZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLS_ZPmZZ_D>;
+    case Opcode::AArch64_FMLS_ZPmZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLS_ZPmZZ_S>;
+    case Opcode::AArch64_FMLSv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLSv2f64>;
+    case Opcode::AArch64_FMLSv2i64_indexed:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLSv2i64_indexed>;
+    case Opcode::AArch64_FMLSv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLSv4f32>;
+    case Opcode::AArch64_FMLSv4i32_indexed:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMLSv4i32_indexed>;
+    case Opcode::AArch64_FMOVDXHighr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVDXHighr>;
+    case Opcode::AArch64_FMOVDXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVDXr>;
+    case Opcode::AArch64_FMOVDi:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVDi>;
+    case Opcode::AArch64_FMOVDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVDr>;
+    case Opcode::AArch64_FMOVSWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVSWr>;
+    case Opcode::AArch64_FMOVSi:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVSi>;
+    case Opcode::AArch64_FMOVSr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVSr>;
+    case Opcode::AArch64_FMOVWSr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVWSr>;
+    case Opcode::AArch64_FMOVXDHighr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVXDHighr>;
+    case Opcode::AArch64_FMOVXDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVXDr>;
+    case Opcode::AArch64_FMOVv2f32_ns:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVv2f32_ns>;
+    case Opcode::AArch64_FMOVv2f64_ns:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVv2f64_ns>;
+    case Opcode::AArch64_FMOVv4f32_ns:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMOVv4f32_ns>;
+    case Opcode::AArch64_FMSB_ZPmZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMSB_ZPmZZ_D>;
+    case Opcode::AArch64_FMSB_ZPmZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMSB_ZPmZZ_S>;
+    case Opcode::AArch64_FMSUBDrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMSUBDrrr>;
+    case Opcode::AArch64_FMSUBSrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMSUBSrrr>;
+    case Opcode::AArch64_FMULDrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMULDrr>;
+    case Opcode::AArch64_FMULSrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMULSrr>;
+    case Opcode::AArch64_FMUL_ZPmI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMUL_ZPmI_D>;
+    case Opcode::AArch64_FMUL_ZPmI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMUL_ZPmI_S>;
+    case Opcode::AArch64_FMUL_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMUL_ZPmZ_D>;
+    case Opcode::AArch64_FMUL_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMUL_ZPmZ_S>;
+    case Opcode::AArch64_FMUL_ZZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMUL_ZZZ_D>;
+    case Opcode::AArch64_FMUL_ZZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMUL_ZZZ_S>;
+    case Opcode::AArch64_FMULv1i32_indexed:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMULv1i32_indexed>;
+    case Opcode::AArch64_FMULv1i64_indexed:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMULv1i64_indexed>;
+    case Opcode::AArch64_FMULv2f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMULv2f32>;
+    case Opcode::AArch64_FMULv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMULv2f64>;
+    case Opcode::AArch64_FMULv2i32_indexed:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMULv2i32_indexed>;
+    case Opcode::AArch64_FMULv2i64_indexed:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMULv2i64_indexed>;
+    case Opcode::AArch64_FMULv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMULv4f32>;
+    case Opcode::AArch64_FMULv4i32_indexed:
+      return &Instruction::executeOpcode<Opcode::AArch64_FMULv4i32_indexed>;
+    case Opcode::AArch64_FNEGDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNEGDr>;
+    case Opcode::AArch64_FNEGSr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNEGSr>;
+    case Opcode::AArch64_FNEG_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNEG_ZPmZ_D>;
+    case Opcode::AArch64_FNEG_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNEG_ZPmZ_S>;
+    case Opcode::AArch64_FNEGv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNEGv2f64>;
+    case Opcode::AArch64_FNEGv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNEGv4f32>;
+    case Opcode::AArch64_FNMADDDrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNMADDDrrr>;
+    case Opcode::AArch64_FNMADDSrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNMADDSrrr>;
+    case Opcode::AArch64_FNMLS_ZPmZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNMLS_ZPmZZ_D>;
+    case Opcode::AArch64_FNMLS_ZPmZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNMLS_ZPmZZ_S>;
+    case Opcode::AArch64_FNMSB_ZPmZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNMSB_ZPmZZ_D>;
+    case Opcode::AArch64_FNMSB_ZPmZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNMSB_ZPmZZ_S>;
+    case Opcode::AArch64_FNMSUBDrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNMSUBDrrr>;
+    case Opcode::AArch64_FNMSUBSrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNMSUBSrrr>;
+    case Opcode::AArch64_FNMULDrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNMULDrr>;
+    case Opcode::AArch64_FNMULSrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FNMULSrr>;
+    case Opcode::AArch64_FRINTADr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRINTADr>;
+    case Opcode::AArch64_FRINTN_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRINTN_ZPmZ_D>;
+    case Opcode::AArch64_FRINTN_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRINTN_ZPmZ_S>;
+    case Opcode::AArch64_FRSQRTEv1i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRSQRTEv1i32>;
+    case Opcode::AArch64_FRSQRTEv1i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRSQRTEv1i64>;
+    case Opcode::AArch64_FRSQRTEv2f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRSQRTEv2f32>;
+    case Opcode::AArch64_FRSQRTEv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRSQRTEv2f64>;
+    case Opcode::AArch64_FRSQRTEv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRSQRTEv4f32>;
+    case Opcode::AArch64_FRSQRTS32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRSQRTS32>;
+    case Opcode::AArch64_FRSQRTS64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRSQRTS64>;
+    case Opcode::AArch64_FRSQRTSv2f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRSQRTSv2f32>;
+    case Opcode::AArch64_FRSQRTSv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRSQRTSv2f64>;
+    case Opcode::AArch64_FRSQRTSv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FRSQRTSv4f32>;
+    case Opcode::AArch64_FSQRTDr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSQRTDr>;
+    case Opcode::AArch64_FSQRTSr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSQRTSr>;
+    case Opcode::AArch64_FSQRT_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSQRT_ZPmZ_D>;
+    case Opcode::AArch64_FSQRT_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSQRT_ZPmZ_S>;
+    case Opcode::AArch64_FSQRTv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSQRTv2f64>;
+    case Opcode::AArch64_FSQRTv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSQRTv4f32>;
+    case Opcode::AArch64_FSUBDrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUBDrr>;
+    case Opcode::AArch64_FSUBR_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUBR_ZPmZ_D>;
+    case Opcode::AArch64_FSUBR_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUBR_ZPmZ_S>;
+    case Opcode::AArch64_FSUBSrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUBSrr>;
+    case Opcode::AArch64_FSUB_ZPmI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUB_ZPmI_D>;
+    case Opcode::AArch64_FSUB_ZPmI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUB_ZPmI_S>;
+    case Opcode::AArch64_FSUB_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUB_ZPmZ_D>;
+    case Opcode::AArch64_FSUB_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUB_ZPmZ_S>;
+    case Opcode::AArch64_FSUB_ZZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUB_ZZZ_D>;
+    case Opcode::AArch64_FSUB_ZZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUB_ZZZ_S>;
+    case Opcode::AArch64_FSUBv2f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUBv2f32>;
+    case Opcode::AArch64_FSUBv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUBv2f64>;
+    case Opcode::AArch64_FSUBv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_FSUBv4f32>;
+    case Opcode::AArch64_GLD1D_IMM_REAL:
+      return &Instruction::executeOpcode<Opcode::AArch64_GLD1D_IMM_REAL>;
+    case Opcode::AArch64_GLD1D_REAL:
+    case Opcode::AArch64_GLD1D_SCALED_REAL:
+      return &Instruction::executeOpcode<Opcode::AArch64_GLD1D_SCALED_REAL>;
+    case Opcode::AArch64_GLD1SW_D_IMM_REAL:
+      return &Instruction::executeOpcode<Opcode::AArch64_GLD1SW_D_IMM_REAL>;
+    case Opcode::AArch64_HINT:
+      return &Instruction::executeOpcode<Opcode::AArch64_HINT>;
+    case Opcode::AArch64_INCB_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCB_XPiI>;
+    case Opcode::AArch64_INCD_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCD_XPiI>;
+    case Opcode::AArch64_INCD_ZPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCD_ZPiI>;
+    case Opcode::AArch64_INCH_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCH_XPiI>;
+    case Opcode::AArch64_INCH_ZPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCH_ZPiI>;
+    case Opcode::AArch64_INCP_XP_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCP_XP_B>;
+    case Opcode::AArch64_INCP_XP_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCP_XP_D>;
+    case Opcode::AArch64_INCP_XP_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCP_XP_H>;
+    case Opcode::AArch64_INCP_XP_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCP_XP_S>;
+    case Opcode::AArch64_INCW_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCW_XPiI>;
+    case Opcode::AArch64_INCW_ZPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_INCW_ZPiI>;
+    case Opcode::AArch64_INDEX_II_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_II_B>;
+    case Opcode::AArch64_INDEX_II_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_II_D>;
+    case Opcode::AArch64_INDEX_II_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_II_H>;
+    case Opcode::AArch64_INDEX_II_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_II_S>;
+    case Opcode::AArch64_INDEX_IR_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_IR_B>;
+    case Opcode::AArch64_INDEX_IR_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_IR_D>;
+    case Opcode::AArch64_INDEX_IR_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_IR_H>;
+    case Opcode::AArch64_INDEX_IR_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_IR_S>;
+    case Opcode::AArch64_INDEX_RI_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_RI_B>;
+    case Opcode::AArch64_INDEX_RI_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_RI_D>;
+    case Opcode::AArch64_INDEX_RI_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_RI_H>;
+    case Opcode::AArch64_INDEX_RI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_RI_S>;
+    case Opcode::AArch64_INDEX_RR_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_RR_B>;
+    case Opcode::AArch64_INDEX_RR_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_RR_D>;
+    case Opcode::AArch64_INDEX_RR_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_RR_H>;
+    case Opcode::AArch64_INDEX_RR_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_INDEX_RR_S>;
+    case Opcode::AArch64_INSvi16gpr:
+      return &Instruction::executeOpcode<Opcode::AArch64_INSvi16gpr>;
+    case Opcode::AArch64_INSvi32gpr:
+      return &Instruction::executeOpcode<Opcode::AArch64_INSvi32gpr>;
+    case Opcode::AArch64_INSvi32lane:
+      return &Instruction::executeOpcode<Opcode::AArch64_INSvi32lane>;
+    case Opcode::AArch64_INSvi64gpr:
+      return &Instruction::executeOpcode<Opcode::AArch64_INSvi64gpr>;
+    case Opcode::AArch64_INSvi64lane:
+      return &Instruction::executeOpcode<Opcode::AArch64_INSvi64lane>;
+    case Opcode::AArch64_INSvi8gpr:
+      return &Instruction::executeOpcode<Opcode::AArch64_INSvi8gpr>;
+    case Opcode::AArch64_LD1B:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1B>;
+    case Opcode::AArch64_LD1D:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1D>;
+    case Opcode::AArch64_LD1D_IMM_REAL:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1D_IMM_REAL>;
+    case Opcode::AArch64_LD1H:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1H>;
+    case Opcode::AArch64_LD1Onev16b:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Onev16b>;
+    case Opcode::AArch64_LD1Onev16b_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Onev16b_POST>;
+    case Opcode::AArch64_LD1RD_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1RD_IMM>;
+    case Opcode::AArch64_LD1RQ_D_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1RQ_D_IMM>;
+    case Opcode::AArch64_LD1RW_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1RW_IMM>;
+    case Opcode::AArch64_LD1Rv16b:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv16b>;
+    case Opcode::AArch64_LD1Rv16b_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv16b_POST>;
+    case Opcode::AArch64_LD1Rv1d:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv1d>;
+    case Opcode::AArch64_LD1Rv1d_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv1d_POST>;
+    case Opcode::AArch64_LD1Rv2d:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv2d>;
+    case Opcode::AArch64_LD1Rv2d_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv2d_POST>;
+    case Opcode::AArch64_LD1Rv2s:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv2s>;
+    case Opcode::AArch64_LD1Rv2s_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv2s_POST>;
+    case Opcode::AArch64_LD1Rv4h:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv4h>;
+    case Opcode::AArch64_LD1Rv4h_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv4h_POST>;
+    case Opcode::AArch64_LD1Rv4s:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv4s>;
+    case Opcode::AArch64_LD1Rv4s_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv4s_POST>;
+    case Opcode::AArch64_LD1Rv8b:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv8b>;
+    case Opcode::AArch64_LD1Rv8b_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv8b_POST>;
+    case Opcode::AArch64_LD1Rv8h:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv8h>;
+    case Opcode::AArch64_LD1Rv8h_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Rv8h_POST>;
+    case Opcode::AArch64_LD1Twov16b:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Twov16b>;
+    case Opcode::AArch64_LD1Twov16b_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1Twov16b_POST>;
+    case Opcode::AArch64_LD1W:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1W>;
+    case Opcode::AArch64_LD1W_IMM_REAL:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1W_IMM_REAL>;
+    case Opcode::AArch64_LD1i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1i32>;
+    case Opcode::AArch64_LD1i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1i64>;
+    case Opcode::AArch64_LD1i64_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD1i64_POST>;
+    case Opcode::AArch64_LD2D:
+    case Opcode::AArch64_LD2D_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD2D_IMM>;
+    case Opcode::AArch64_LD2Twov4s:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD2Twov4s>;
+    case Opcode::AArch64_LD2Twov4s_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD2Twov4s_POST>;
+    case Opcode::AArch64_LD3D_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD3D_IMM>;
+    case Opcode::AArch64_LD4D_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_LD4D_IMM>;
+    case Opcode::AArch64_LDADDLW:
+    case Opcode::AArch64_LDADDW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDADDW>;
+    case Opcode::AArch64_LDARB:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDARB>;
+    case Opcode::AArch64_LDARW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDARW>;
+    case Opcode::AArch64_LDARX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDARX>;
+    case Opcode::AArch64_LDAXRW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDAXRW>;
+    case Opcode::AArch64_LDAXRX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDAXRX>;
+    case Opcode::AArch64_LDNPSi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDNPSi>;
+    case Opcode::AArch64_LDPDi:
+    case Opcode::AArch64_LDPQi:
+    case Opcode::AArch64_LDPSi:
+    case Opcode::AArch64_LDPWi:
+    case Opcode::AArch64_LDPXi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDPXi>;
+    case Opcode::AArch64_LDPDpost:
+    case Opcode::AArch64_LDPQpost:
+    case Opcode::AArch64_LDPSpost:
+    case Opcode::AArch64_LDPWpost:
+    case Opcode::AArch64_LDPXpost:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDPXpost>;
+    case Opcode::AArch64_LDPDpre:
+    case Opcode::AArch64_LDPQpre:
+    case Opcode::AArch64_LDPSpre:
+    case Opcode::AArch64_LDPWpre:
+    case Opcode::AArch64_LDPXpre:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDPXpre>;
+    case Opcode::AArch64_LDPSWi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDPSWi>;
+    case Opcode::AArch64_LDRBBpost:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRBBpost>;
+    case Opcode::AArch64_LDRBBpre:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRBBpre>;
+    case Opcode::AArch64_LDRBBroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRBBroW>;
+    case Opcode::AArch64_LDRBBroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRBBroX>;
+    case Opcode::AArch64_LDRBBui:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRBBui>;
+    case Opcode::AArch64_LDRBui:
+    case Opcode::AArch64_LDRDui:
+    case Opcode::AArch64_LDRHui:
+    case Opcode::AArch64_LDRQui:
+    case Opcode::AArch64_LDRSui:
+    case Opcode::AArch64_LDRWui:
+    case Opcode::AArch64_LDRXui:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRXui>;
+    case Opcode::AArch64_LDRBpost:
+    case Opcode::AArch64_LDRDpost:
+    case Opcode::AArch64_LDRHpost:
+    case Opcode::AArch64_LDRQpost:
+    case Opcode::AArch64_LDRSpost:
+    case Opcode::AArch64_LDRWpost:
+    case Opcode::AArch64_LDRXpost:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRXpost>;
+    case Opcode::AArch64_LDRBpre:
+    case Opcode::AArch64_LDRDpre:
+    case Opcode::AArch64_LDRHpre:
+    case Opcode::AArch64_LDRQpre:
+    case Opcode::AArch64_LDRSpre:
+    case Opcode::AArch64_LDRWpre:
+    case Opcode::AArch64_LDRXpre:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRXpre>;
+    case Opcode::AArch64_LDRDroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRDroW>;
+    case Opcode::AArch64_LDRDroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRDroX>;
+    case Opcode::AArch64_LDRHHpost:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRHHpost>;
+    case Opcode::AArch64_LDRHHpre:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRHHpre>;
+    case Opcode::AArch64_LDRHHroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRHHroW>;
+    case Opcode::AArch64_LDRHHroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRHHroX>;
+    case Opcode::AArch64_LDRHHui:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRHHui>;
+    case Opcode::AArch64_LDRQroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRQroX>;
+    case Opcode::AArch64_LDRSBWroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSBWroX>;
+    case Opcode::AArch64_LDRSBWui:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSBWui>;
+    case Opcode::AArch64_LDRSBXui:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSBXui>;
+    case Opcode::AArch64_LDRSHWroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSHWroW>;
+    case Opcode::AArch64_LDRSHWroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSHWroX>;
+    case Opcode::AArch64_LDRSHWui:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSHWui>;
+    case Opcode::AArch64_LDRSHXroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSHXroW>;
+    case Opcode::AArch64_LDRSHXroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSHXroX>;
+    case Opcode::AArch64_LDRSHXui:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSHXui>;
+    case Opcode::AArch64_LDRSWl:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSWl>;
+    case Opcode::AArch64_LDRSWpost:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSWpost>;
+    case Opcode::AArch64_LDRSWroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSWroX>;
+    case Opcode::AArch64_LDRSWui:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSWui>;
+    case Opcode::AArch64_LDRSroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSroW>;
+    case Opcode::AArch64_LDRSroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRSroX>;
+    case Opcode::AArch64_LDRWroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRWroW>;
+    case Opcode::AArch64_LDRWroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRWroX>;
+    case Opcode::AArch64_LDRXl:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRXl>;
+    case Opcode::AArch64_LDRXroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRXroW>;
+    case Opcode::AArch64_LDRXroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDRXroX>;
+    case Opcode::AArch64_LDR_PXI:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDR_PXI>;
+    case Opcode::AArch64_LDR_ZXI:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDR_ZXI>;
+    case Opcode::AArch64_LDTRSBXi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDTRSBXi>;
+    case Opcode::AArch64_LDURBBi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDURBBi>;
+    case Opcode::AArch64_LDURDi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDURDi>;
+    case Opcode::AArch64_LDURHHi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDURHHi>;
+    case Opcode::AArch64_LDURQi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDURQi>;
+    case Opcode::AArch64_LDURSWi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDURSWi>;
+    case Opcode::AArch64_LDURSi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDURSi>;
+    case Opcode::AArch64_LDURWi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDURWi>;
+    case Opcode::AArch64_LDURXi:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDURXi>;
+    case Opcode::AArch64_LDXRW:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDXRW>;
+    case Opcode::AArch64_LDXRX:
+      return &Instruction::executeOpcode<Opcode::AArch64_LDXRX>;
+    case Opcode::AArch64_LSLVWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_LSLVWr>;
+    case Opcode::AArch64_LSLVXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_LSLVXr>;
+    case Opcode::AArch64_LSL_ZZI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_LSL_ZZI_S>;
+    case Opcode::AArch64_LSRVWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_LSRVWr>;
+    case Opcode::AArch64_LSRVXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_LSRVXr>;
+    case Opcode::AArch64_MADDWrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_MADDWrrr>;
+    case Opcode::AArch64_MADDXrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_MADDXrrr>;
+    case Opcode::AArch64_MLA_ZPmZZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_MLA_ZPmZZ_B>;
+    case Opcode::AArch64_MLA_ZPmZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_MLA_ZPmZZ_D>;
+    case Opcode::AArch64_MLA_ZPmZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_MLA_ZPmZZ_H>;
+    case Opcode::AArch64_MLA_ZPmZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_MLA_ZPmZZ_S>;
+    case Opcode::AArch64_MOVID:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVID>;
+    case Opcode::AArch64_MOVIv16b_ns:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVIv16b_ns>;
+    case Opcode::AArch64_MOVIv2d_ns:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVIv2d_ns>;
+    case Opcode::AArch64_MOVIv2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVIv2i32>;
+    case Opcode::AArch64_MOVIv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVIv4i32>;
+    case Opcode::AArch64_MOVIv8b_ns:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVIv8b_ns>;
+    case Opcode::AArch64_MOVKWi:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVKWi>;
+    case Opcode::AArch64_MOVKXi:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVKXi>;
+    case Opcode::AArch64_MOVNWi:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVNWi>;
+    case Opcode::AArch64_MOVNXi:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVNXi>;
+    case Opcode::AArch64_MOVPRFX_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVPRFX_ZPmZ_D>;
+    case Opcode::AArch64_MOVPRFX_ZPzZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVPRFX_ZPzZ_D>;
+    case Opcode::AArch64_MOVPRFX_ZPzZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVPRFX_ZPzZ_S>;
+    case Opcode::AArch64_MOVPRFX_ZZ:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVPRFX_ZZ>;
+    case Opcode::AArch64_MOVZWi:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVZWi>;
+    case Opcode::AArch64_MOVZXi:
+      return &Instruction::executeOpcode<Opcode::AArch64_MOVZXi>;
+    case Opcode::AArch64_MRS:
+      return &Instruction::executeOpcode<Opcode::AArch64_MRS>;
+    case Opcode::AArch64_MSR:
+      return &Instruction::executeOpcode<Opcode::AArch64_MSR>;
+    case Opcode::AArch64_MSUBWrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_MSUBWrrr>;
+    case Opcode::AArch64_MSUBXrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_MSUBXrrr>;
+    case Opcode::AArch64_MUL_ZPmZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_MUL_ZPmZ_B>;
+    case Opcode::AArch64_MUL_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_MUL_ZPmZ_D>;
+    case Opcode::AArch64_MUL_ZPmZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_MUL_ZPmZ_H>;
+    case Opcode::AArch64_MUL_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_MUL_ZPmZ_S>;
+    case Opcode::AArch64_MVNIv2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_MVNIv2i32>;
+    case Opcode::AArch64_MVNIv2s_msl:
+      return &Instruction::executeOpcode<Opcode::AArch64_MVNIv2s_msl>;
+    case Opcode::AArch64_MVNIv4i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_MVNIv4i16>;
+    case Opcode::AArch64_MVNIv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_MVNIv4i32>;
+    case Opcode::AArch64_MVNIv4s_msl:
+      return &Instruction::executeOpcode<Opcode::AArch64_MVNIv4s_msl>;
+    case Opcode::AArch64_MVNIv8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_MVNIv8i16>;
+    case Opcode::AArch64_NEGv2i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_NEGv2i64>;
+    case Opcode::AArch64_NOTv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_NOTv16i8>;
+    case Opcode::AArch64_NOTv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_NOTv8i8>;
+    case Opcode::AArch64_ORNWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ORNWrs>;
+    case Opcode::AArch64_ORNXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ORNXrs>;
+    case Opcode::AArch64_ORRWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_ORRWri>;
+    case Opcode::AArch64_ORRWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ORRWrs>;
+    case Opcode::AArch64_ORRXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_ORRXri>;
+    case Opcode::AArch64_ORRXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_ORRXrs>;
+    case Opcode::AArch64_ORR_PPzPP:
+      return &Instruction::executeOpcode<Opcode::AArch64_ORR_PPzPP>;
+    case Opcode::AArch64_ORR_ZZZ:
+      return &Instruction::executeOpcode<Opcode::AArch64_ORR_ZZZ>;
+    case Opcode::AArch64_ORRv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_ORRv16i8>;
+    case Opcode::AArch64_ORRv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_ORRv8i8>;
+    case Opcode::AArch64_PFALSE:
+      return &Instruction::executeOpcode<Opcode::AArch64_PFALSE>;
+    case Opcode::AArch64_PRFMui:
+      return &Instruction::executeOpcode<Opcode::AArch64_PRFMui>;
+    case Opcode::AArch64_PTEST_PP:
+      return &Instruction::executeOpcode<Opcode::AArch64_PTEST_PP>;
+    case Opcode::AArch64_PTRUE_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_PTRUE_B>;
+    case Opcode::AArch64_PTRUE_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_PTRUE_D>;
+    case Opcode::AArch64_PTRUE_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_PTRUE_H>;
+    case Opcode::AArch64_PTRUE_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_PTRUE_S>;
+    case Opcode::AArch64_PUNPKHI_PP:
+      return &Instruction::executeOpcode<Opcode::AArch64_PUNPKHI_PP>;
+    case Opcode::AArch64_PUNPKLO_PP:
+      return &Instruction::executeOpcode<Opcode::AArch64_PUNPKLO_PP>;
+    case Opcode::AArch64_RBITWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_RBITWr>;
+    case Opcode::AArch64_RBITXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_RBITXr>;
+    case Opcode::AArch64_RDVLI_XI:
+      return &Instruction::executeOpcode<Opcode::AArch64_RDVLI_XI>;
+    case Opcode::AArch64_RET:
+      return &Instruction::executeOpcode<Opcode::AArch64_RET>;
+    case Opcode::AArch64_REV16v16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV16v16i8>;
+    case Opcode::AArch64_REV16v8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV16v8i8>;
+    case Opcode::AArch64_REV32v16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV32v16i8>;
+    case Opcode::AArch64_REV32v4i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV32v4i16>;
+    case Opcode::AArch64_REV32v8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV32v8i16>;
+    case Opcode::AArch64_REV32v8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV32v8i8>;
+    case Opcode::AArch64_REV64v16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV64v16i8>;
+    case Opcode::AArch64_REV64v2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV64v2i32>;
+    case Opcode::AArch64_REV64v4i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV64v4i16>;
+    case Opcode::AArch64_REV64v4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV64v4i32>;
+    case Opcode::AArch64_REV64v8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV64v8i16>;
+    case Opcode::AArch64_REV64v8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV64v8i8>;
+    case Opcode::AArch64_REVXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_REVXr>;
+    case Opcode::AArch64_REV_PP_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV_PP_B>;
+    case Opcode::AArch64_REV_PP_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV_PP_D>;
+    case Opcode::AArch64_REV_PP_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV_PP_H>;
+    case Opcode::AArch64_REV_PP_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV_PP_S>;
+    case Opcode::AArch64_REV_ZZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV_ZZ_B>;
+    case Opcode::AArch64_REV_ZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV_ZZ_D>;
+    case Opcode::AArch64_REV_ZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV_ZZ_H>;
+    case Opcode::AArch64_REV_ZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_REV_ZZ_S>;
+    case Opcode::AArch64_RORVWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_RORVWr>;
+    case Opcode::AArch64_RORVXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_RORVXr>;
+    case Opcode::AArch64_SBCWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_SBCWr>;
+    case Opcode::AArch64_SBCXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_SBCXr>;
+    case Opcode::AArch64_SBFMWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SBFMWri>;
+    case Opcode::AArch64_SBFMXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SBFMXri>;
+    case Opcode::AArch64_SCVTFSXDri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFSXDri>;
+    case Opcode::AArch64_SCVTFSXSri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFSXSri>;
+    case Opcode::AArch64_SCVTFUWDri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFUWDri>;
+    case Opcode::AArch64_SCVTFUWSri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFUWSri>;
+    case Opcode::AArch64_SCVTFUXDri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFUXDri>;
+    case Opcode::AArch64_SCVTFUXSri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFUXSri>;
+    case Opcode::AArch64_SCVTF_ZPmZ_DtoD:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTF_ZPmZ_DtoD>;
+    case Opcode::AArch64_SCVTF_ZPmZ_DtoS:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTF_ZPmZ_DtoS>;
+    case Opcode::AArch64_SCVTF_ZPmZ_StoD:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTF_ZPmZ_StoD>;
+    case Opcode::AArch64_SCVTF_ZPmZ_StoS:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTF_ZPmZ_StoS>;
+    case Opcode::AArch64_SCVTFv1i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFv1i32>;
+    case Opcode::AArch64_SCVTFv1i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFv1i64>;
+    case Opcode::AArch64_SCVTFv2f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFv2f32>;
+    case Opcode::AArch64_SCVTFv2f64:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFv2f64>;
+    case Opcode::AArch64_SCVTFv4f32:
+      return &Instruction::executeOpcode<Opcode::AArch64_SCVTFv4f32>;
+    case Opcode::AArch64_SDIVWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_SDIVWr>;
+    case Opcode::AArch64_SDIVXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_SDIVXr>;
+    case Opcode::AArch64_SEL_ZPZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_SEL_ZPZZ_D>;
+    case Opcode::AArch64_SEL_ZPZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_SEL_ZPZZ_S>;
+    case Opcode::AArch64_SHLd:
+      return &Instruction::executeOpcode<Opcode::AArch64_SHLd>;
+    case Opcode::AArch64_SHLv4i32_shift:
+      return &Instruction::executeOpcode<Opcode::AArch64_SHLv4i32_shift>;
+    case Opcode::AArch64_SMADDLrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMADDLrrr>;
+    case Opcode::AArch64_SMAX_ZI_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMAX_ZI_S>;
+    case Opcode::AArch64_SMAX_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMAX_ZPmZ_S>;
+    case Opcode::AArch64_SMAXv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMAXv4i32>;
+    case Opcode::AArch64_SMINV_VPZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMINV_VPZ_S>;
+    case Opcode::AArch64_SMINVv4i32v:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMINVv4i32v>;
+    case Opcode::AArch64_SMIN_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMIN_ZPmZ_S>;
+    case Opcode::AArch64_SMINv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMINv4i32>;
+    case Opcode::AArch64_SMSUBLrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMSUBLrrr>;
+    case Opcode::AArch64_SMULH_ZPmZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMULH_ZPmZ_B>;
+    case Opcode::AArch64_SMULH_ZPmZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMULH_ZPmZ_H>;
+    case Opcode::AArch64_SMULH_ZPmZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMULH_ZPmZ_S>;
+    case Opcode::AArch64_SMULHrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_SMULHrr>;
+    case Opcode::AArch64_SSHLLv2i32_shift:
+      return &Instruction::executeOpcode<Opcode::AArch64_SSHLLv2i32_shift>;
+    case Opcode::AArch64_SSHLLv4i32_shift:
+      return &Instruction::executeOpcode<Opcode::AArch64_SSHLLv4i32_shift>;
+    case Opcode::AArch64_SSHRv4i32_shift:
+      return &Instruction::executeOpcode<Opcode::AArch64_SSHRv4i32_shift>;
+    case Opcode::AArch64_SST1B_D_REAL:
+      return &Instruction::executeOpcode<Opcode::AArch64_SST1B_D_REAL>;
+    case Opcode::AArch64_SST1D_REAL:
+      return &Instruction::executeOpcode<Opcode::AArch64_SST1D_REAL>;
+    case Opcode::AArch64_SST1D_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_SST1D_IMM>;
+    case Opcode::AArch64_SST1D_SCALED_SCALED_REAL:
+      return &Instruction::executeOpcode<
+          Opcode::AArch64_SST1D_SCALED_SCALED_REAL>;
+    case Opcode::AArch64_SST1W_D_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_SST1W_D_IMM>;
+    case Opcode::AArch64_SST1W_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_SST1W_IMM>;
+    case Opcode::AArch64_ST1B:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1B>;
+    case Opcode::AArch64_ST1D:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1D>;
+    case Opcode::AArch64_ST1D_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1D_IMM>;
+    case Opcode::AArch64_ST1Twov16b:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1Twov16b>;
+    case Opcode::AArch64_ST1W:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1W>;
+    case Opcode::AArch64_ST1W_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1W_D>;
+    case Opcode::AArch64_ST1W_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1W_IMM>;
+    case Opcode::AArch64_ST1i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1i16>;
+    case Opcode::AArch64_ST1i16_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1i16_POST>;
+    case Opcode::AArch64_ST1i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1i32>;
+    case Opcode::AArch64_ST1i32_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1i32_POST>;
+    case Opcode::AArch64_ST1i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1i64>;
+    case Opcode::AArch64_ST1i64_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1i64_POST>;
+    case Opcode::AArch64_ST1i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1i8>;
+    case Opcode::AArch64_ST1i8_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST1i8_POST>;
+    case Opcode::AArch64_ST2D_IMM:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST2D_IMM>;
+    case Opcode::AArch64_ST2Twov4s_POST:
+      return &Instruction::executeOpcode<Opcode::AArch64_ST2Twov4s_POST>;
+    case Opcode::AArch64_STLRB:
+      return &Instruction::executeOpcode<Opcode::AArch64_STLRB>;
+    case Opcode::AArch64_STLRW:
+    case Opcode::AArch64_STLRX:
+      return &Instruction::executeOpcode<Opcode::AArch64_STLRX>;
+    case Opcode::AArch64_STLXRW:
+    case Opcode::AArch64_STLXRX:
+      return &Instruction::executeOpcode<Opcode::AArch64_STLXRX>;
+    case Opcode::AArch64_STPDi:
+    case Opcode::AArch64_STPQi:
+    case Opcode::AArch64_STPSi:
+    case Opcode::AArch64_STPWi:
+    case Opcode::AArch64_STPXi:
+      return &Instruction::executeOpcode<Opcode::AArch64_STPXi>;
+    case Opcode::AArch64_STPDpost:
+    case Opcode::AArch64_STPQpost:
+    case Opcode::AArch64_STPSpost:
+    case Opcode::AArch64_STPWpost:
+    case Opcode::AArch64_STPXpost:
+      return &Instruction::executeOpcode<Opcode::AArch64_STPXpost>;
+    case Opcode::AArch64_STPDpre:
+    case Opcode::AArch64_STPQpre:
+    case Opcode::AArch64_STPSpre:
+    case Opcode::AArch64_STPWpre:
+    case Opcode::AArch64_STPXpre:
+      return &Instruction::executeOpcode<Opcode::AArch64_STPXpre>;
+    case Opcode::AArch64_STRBBpost:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRBBpost>;
+    case Opcode::AArch64_STRBBpre:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRBBpre>;
+    case Opcode::AArch64_STRBBroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRBBroW>;
+    case Opcode::AArch64_STRBBroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRBBroX>;
+    case Opcode::AArch64_STRBBui:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRBBui>;
+    case Opcode::AArch64_STRBui:
+    case Opcode::AArch64_STRDui:
+    case Opcode::AArch64_STRHui:
+    case Opcode::AArch64_STRQui:
+    case Opcode::AArch64_STRSui:
+    case Opcode::AArch64_STRWui:
+    case Opcode::AArch64_STRXui:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRXui>;
+    case Opcode::AArch64_STRBpost:
+    case Opcode::AArch64_STRDpost:
+    case Opcode::AArch64_STRHpost:
+    case Opcode::AArch64_STRQpost:
+    case Opcode::AArch64_STRSpost:
+    case Opcode::AArch64_STRWpost:
+    case Opcode::AArch64_STRXpost:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRXpost>;
+    case Opcode::AArch64_STRBpre:
+    case Opcode::AArch64_STRDpre:
+    case Opcode::AArch64_STRHpre:
+    case Opcode::AArch64_STRQpre:
+    case Opcode::AArch64_STRSpre:
+    case Opcode::AArch64_STRWpre:
+    case Opcode::AArch64_STRXpre:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRXpre>;
+    case Opcode::AArch64_STRDroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRDroW>;
+    case Opcode::AArch64_STRDroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRDroX>;
+    case Opcode::AArch64_STRHHpost:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRHHpost>;
+    case Opcode::AArch64_STRHHpre:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRHHpre>;
+    case Opcode::AArch64_STRHHroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRHHroW>;
+    case Opcode::AArch64_STRHHroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRHHroX>;
+    case Opcode::AArch64_STRHHui:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRHHui>;
+    case Opcode::AArch64_STRQroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRQroX>;
+    case Opcode::AArch64_STRSroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRSroW>;
+    case Opcode::AArch64_STRSroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRSroX>;
+    case Opcode::AArch64_STRWroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRWroW>;
+    case Opcode::AArch64_STRWroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRWroX>;
+    case Opcode::AArch64_STRXroW:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRXroW>;
+    case Opcode::AArch64_STRXroX:
+      return &Instruction::executeOpcode<Opcode::AArch64_STRXroX>;
+    case Opcode::AArch64_STR_PXI:
+      return &Instruction::executeOpcode<Opcode::AArch64_STR_PXI>;
+    case Opcode::AArch64_STR_ZXI:
+      return &Instruction::executeOpcode<Opcode::AArch64_STR_ZXI>;
+    case Opcode::AArch64_STURBBi:
+      return &Instruction::executeOpcode<Opcode::AArch64_STURBBi>;
+    case Opcode::AArch64_STURDi:
+    case Opcode::AArch64_STURHHi:
+      return &Instruction::executeOpcode<Opcode::AArch64_STURHHi>;
+    case Opcode::AArch64_STURQi:
+    case Opcode::AArch64_STURSi:
+    case Opcode::AArch64_STURWi:
+    case Opcode::AArch64_STURXi:
+      return &Instruction::executeOpcode<Opcode::AArch64_STURXi>;
+    case Opcode::AArch64_STXRW:
+      return &Instruction::executeOpcode<Opcode::AArch64_STXRW>;
+    case Opcode::AArch64_STXRX:
+      return &Instruction::executeOpcode<Opcode::AArch64_STXRX>;
+    case Opcode::AArch64_SUBSWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBSWri>;
+    case Opcode::AArch64_SUBSWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBSWrs>;
+    case Opcode::AArch64_SUBSWrx:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBSWrx>;
+    case Opcode::AArch64_SUBSXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBSXri>;
+    case Opcode::AArch64_SUBSXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBSXrs>;
+    case Opcode::AArch64_SUBSXrx:
+    case Opcode::AArch64_SUBSXrx64:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBSXrx64>;
+    case Opcode::AArch64_SUBWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBWri>;
+    case Opcode::AArch64_SUBWrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBWrs>;
+    case Opcode::AArch64_SUBXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBXri>;
+    case Opcode::AArch64_SUBXrs:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBXrs>;
+    case Opcode::AArch64_SUBXrx:
+    case Opcode::AArch64_SUBXrx64:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBXrx64>;
+    case Opcode::AArch64_SUB_ZZZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUB_ZZZ_B>;
+    case Opcode::AArch64_SUB_ZZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUB_ZZZ_D>;
+    case Opcode::AArch64_SUB_ZZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUB_ZZZ_H>;
+    case Opcode::AArch64_SUB_ZZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUB_ZZZ_S>;
+    case Opcode::AArch64_SUBv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBv16i8>;
+    case Opcode::AArch64_SUBv1i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBv1i64>;
+    case Opcode::AArch64_SUBv2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBv2i32>;
+    case Opcode::AArch64_SUBv2i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBv2i64>;
+    case Opcode::AArch64_SUBv4i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBv4i16>;
+    case Opcode::AArch64_SUBv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBv4i32>;
+    case Opcode::AArch64_SUBv8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBv8i16>;
+    case Opcode::AArch64_SUBv8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_SUBv8i8>;
+    case Opcode::AArch64_SVC:
+      return &Instruction::executeOpcode<Opcode::AArch64_SVC>;
+    case Opcode::AArch64_SXTW_ZPmZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_SXTW_ZPmZ_D>;
+    case Opcode::AArch64_SYSxt:
+      return &Instruction::executeOpcode<Opcode::AArch64_SYSxt>;
+    case Opcode::AArch64_TBLv16i8Four:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBLv16i8Four>;
+    case Opcode::AArch64_TBLv16i8One:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBLv16i8One>;
+    case Opcode::AArch64_TBLv16i8Three:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBLv16i8Three>;
+    case Opcode::AArch64_TBLv16i8Two:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBLv16i8Two>;
+    case Opcode::AArch64_TBLv8i8Four:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBLv8i8Four>;
+    case Opcode::AArch64_TBLv8i8One:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBLv8i8One>;
+    case Opcode::AArch64_TBLv8i8Three:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBLv8i8Three>;
+    case Opcode::AArch64_TBLv8i8Two:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBLv8i8Two>;
+    case Opcode::AArch64_TBNZW:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBNZW>;
+    case Opcode::AArch64_TBNZX:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBNZX>;
+    case Opcode::AArch64_TBZW:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBZW>;
+    case Opcode::AArch64_TBZX:
+      return &Instruction::executeOpcode<Opcode::AArch64_TBZX>;
+    case Opcode::AArch64_TRN1_ZZZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1_ZZZ_B>;
+    case Opcode::AArch64_TRN1_ZZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1_ZZZ_D>;
+    case Opcode::AArch64_TRN1_ZZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1_ZZZ_H>;
+    case Opcode::AArch64_TRN1_ZZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1_ZZZ_S>;
+    case Opcode::AArch64_TRN1v16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1v16i8>;
+    case Opcode::AArch64_TRN1v2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1v2i32>;
+    case Opcode::AArch64_TRN1v2i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1v2i64>;
+    case Opcode::AArch64_TRN1v4i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1v4i16>;
+    case Opcode::AArch64_TRN1v4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1v4i32>;
+    case Opcode::AArch64_TRN1v8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1v8i16>;
+    case Opcode::AArch64_TRN1v8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN1v8i8>;
+    case Opcode::AArch64_TRN2_ZZZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2_ZZZ_B>;
+    case Opcode::AArch64_TRN2_ZZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2_ZZZ_D>;
+    case Opcode::AArch64_TRN2_ZZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2_ZZZ_H>;
+    case Opcode::AArch64_TRN2_ZZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2_ZZZ_S>;
+    case Opcode::AArch64_TRN2v16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2v16i8>;
+    case Opcode::AArch64_TRN2v2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2v2i32>;
+    case Opcode::AArch64_TRN2v2i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2v2i64>;
+    case Opcode::AArch64_TRN2v4i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2v4i16>;
+    case Opcode::AArch64_TRN2v4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2v4i32>;
+    case Opcode::AArch64_TRN2v8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2v8i16>;
+    case Opcode::AArch64_TRN2v8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_TRN2v8i8>;
+    case Opcode::AArch64_UADDV_VPZ_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_UADDV_VPZ_B>;
+    case Opcode::AArch64_UADDV_VPZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_UADDV_VPZ_D>;
+    case Opcode::AArch64_UADDV_VPZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_UADDV_VPZ_H>;
+    case Opcode::AArch64_UADDV_VPZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_UADDV_VPZ_S>;
+    case Opcode::AArch64_UBFMWri:
+      return &Instruction::executeOpcode<Opcode::AArch64_UBFMWri>;
+    case Opcode::AArch64_UBFMXri:
+      return &Instruction::executeOpcode<Opcode::AArch64_UBFMXri>;
+    case Opcode::AArch64_UCVTFUWDri:
+      return &Instruction::executeOpcode<Opcode::AArch64_UCVTFUWDri>;
+    case Opcode::AArch64_UCVTFUWSri:
+      return &Instruction::executeOpcode<Opcode::AArch64_UCVTFUWSri>;
+    case Opcode::AArch64_UCVTFUXDri:
+      return &Instruction::executeOpcode<Opcode::AArch64_UCVTFUXDri>;
+    case Opcode::AArch64_UCVTFUXSri:
+      return &Instruction::executeOpcode<Opcode::AArch64_UCVTFUXSri>;
+    case Opcode::AArch64_UCVTFv1i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_UCVTFv1i32>;
+    case Opcode::AArch64_UCVTFv1i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_UCVTFv1i64>;
+    case Opcode::AArch64_UDIVWr:
+      return &Instruction::executeOpcode<Opcode::AArch64_UDIVWr>;
+    case Opcode::AArch64_UDIVXr:
+      return &Instruction::executeOpcode<Opcode::AArch64_UDIVXr>;
+    case Opcode::AArch64_UMADDLrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_UMADDLrrr>;
+    case Opcode::AArch64_UMAXPv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_UMAXPv16i8>;
+    case Opcode::AArch64_UMINPv16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_UMINPv16i8>;
+    case Opcode::AArch64_UMOVvi32_idx0:
+    case Opcode::AArch64_UMOVvi32:
+      return &Instruction::executeOpcode<Opcode::AArch64_UMOVvi32>;
+    case Opcode::AArch64_UMOVvi64_idx0:
+    case Opcode::AArch64_UMOVvi64:
+      return &Instruction::executeOpcode<Opcode::AArch64_UMOVvi64>;
+    case Opcode::AArch64_UMOVvi8_idx0:
+    case Opcode::AArch64_UMOVvi8:
+      return &Instruction::executeOpcode<Opcode::AArch64_UMOVvi8>;
+    case Opcode::AArch64_UMSUBLrrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_UMSUBLrrr>;
+    case Opcode::AArch64_UMULHrr:
+      return &Instruction::executeOpcode<Opcode::AArch64_UMULHrr>;
+    case Opcode::AArch64_UQDECD_WPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_UQDECD_WPiI>;
+    case Opcode::AArch64_UQDECD_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_UQDECD_XPiI>;
+    case Opcode::AArch64_UQDECH_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_UQDECH_XPiI>;
+    case Opcode::AArch64_UQDECW_XPiI:
+      return &Instruction::executeOpcode<Opcode::AArch64_UQDECW_XPiI>;
+    case Opcode::AArch64_USHLLv16i8_shift:
+      return &Instruction::executeOpcode<Opcode::AArch64_USHLLv16i8_shift>;
+    case Opcode::AArch64_USHLLv4i16_shift:
+      return &Instruction::executeOpcode<Opcode::AArch64_USHLLv4i16_shift>;
+    case Opcode::AArch64_USHLLv8i16_shift:
+      return &Instruction::executeOpcode<Opcode::AArch64_USHLLv8i16_shift>;
+    case Opcode::AArch64_USHLLv8i8_shift:
+      return &Instruction::executeOpcode<Opcode::AArch64_USHLLv8i8_shift>;
+    case Opcode::AArch64_UUNPKHI_ZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_UUNPKHI_ZZ_D>;
+    case Opcode::AArch64_UUNPKHI_ZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_UUNPKHI_ZZ_H>;
+    case Opcode::AArch64_UUNPKHI_ZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_UUNPKHI_ZZ_S>;
+    case Opcode::AArch64_UUNPKLO_ZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_UUNPKLO_ZZ_D>;
+    case Opcode::AArch64_UUNPKLO_ZZ_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_UUNPKLO_ZZ_H>;
+    case Opcode::AArch64_UUNPKLO_ZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_UUNPKLO_ZZ_S>;
+    case Opcode::AArch64_UZP1_ZZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP1_ZZZ_S>;
+    case Opcode::AArch64_UZP1v16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP1v16i8>;
+    case Opcode::AArch64_UZP1v2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP1v2i32>;
+    case Opcode::AArch64_UZP1v2i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP1v2i64>;
+    case Opcode::AArch64_UZP1v4i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP1v4i16>;
+    case Opcode::AArch64_UZP1v4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP1v4i32>;
+    case Opcode::AArch64_UZP1v8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP1v8i16>;
+    case Opcode::AArch64_UZP1v8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP1v8i8>;
+    case Opcode::AArch64_UZP2v16i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP2v16i8>;
+    case Opcode::AArch64_UZP2v2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP2v2i32>;
+    case Opcode::AArch64_UZP2v2i64:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP2v2i64>;
+    case Opcode::AArch64_UZP2v4i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP2v4i16>;
+    case Opcode::AArch64_UZP2v4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP2v4i32>;
+    case Opcode::AArch64_UZP2v8i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP2v8i16>;
+    case Opcode::AArch64_UZP2v8i8:
+      return &Instruction::executeOpcode<Opcode::AArch64_UZP2v8i8>;
+    case Opcode::AArch64_WHILELO_PWW_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_WHILELO_PWW_B>;
+    case Opcode::AArch64_WHILELO_PWW_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_WHILELO_PWW_D>;
+    case Opcode::AArch64_WHILELO_PWW_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_WHILELO_PWW_H>;
+    case Opcode::AArch64_WHILELO_PWW_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_WHILELO_PWW_S>;
+    case Opcode::AArch64_WHILELO_PXX_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_WHILELO_PXX_B>;
+    case Opcode::AArch64_WHILELO_PXX_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_WHILELO_PXX_D>;
+    case Opcode::AArch64_WHILELO_PXX_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_WHILELO_PXX_H>;
+    case Opcode::AArch64_WHILELO_PXX_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_WHILELO_PXX_S>;
+    case Opcode::AArch64_XPACLRI:
+      return &Instruction::executeOpcode<Opcode::AArch64_XPACLRI>;
+    case Opcode::AArch64_XTNv2i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_XTNv2i32>;
+    case Opcode::AArch64_XTNv4i16:
+      return &Instruction::executeOpcode<Opcode::AArch64_XTNv4i16>;
+    case Opcode::AArch64_XTNv4i32:
+      return &Instruction::executeOpcode<Opcode::AArch64_XTNv4i32>;
+    case Opcode::AArch64_ZIP1_PPP_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP1_PPP_B>;
+    case Opcode::AArch64_ZIP1_PPP_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP1_PPP_D>;
+    case Opcode::AArch64_ZIP1_PPP_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP1_PPP_H>;
+    case Opcode::AArch64_ZIP1_PPP_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP1_PPP_S>;
+    case Opcode::AArch64_ZIP1_ZZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP1_ZZZ_D>;
+    case Opcode::AArch64_ZIP1_ZZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP1_ZZZ_S>;
+    case Opcode::AArch64_ZIP2_PPP_B:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP2_PPP_B>;
+    case Opcode::AArch64_ZIP2_PPP_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP2_PPP_D>;
+    case Opcode::AArch64_ZIP2_PPP_H:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP2_PPP_H>;
+    case Opcode::AArch64_ZIP2_PPP_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP2_PPP_S>;
+    case Opcode::AArch64_ZIP2_ZZZ_D:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP2_ZZZ_D>;
+    case Opcode::AArch64_ZIP2_ZZZ_S:
+      return &Instruction::executeOpcode<Opcode::AArch64_ZIP2_ZZZ_S>;
+    default:
+      return &Instruction::executionNYI;
   }
-#endif
 }
 
 }  // namespace aarch64
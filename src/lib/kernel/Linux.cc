@@ -90,6 +90,13 @@ uint64_t Linux::getInitialStackPointer() const {
   return processStates_[0].initialStackPointer;
 }
 
+std::string Linux::getProcessPath() const {
+  assert(processStates_.size() > 0 &&
+         "Attempted to retrieve a process path before creating a process");
+
+  return processStates_[0].path;
+}
+
 int64_t Linux::brk(uint64_t address) {
   assert(processStates_.size() > 0 &&
          "Attempted to move the program break before creating a process");
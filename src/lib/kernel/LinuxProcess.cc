@@ -31,6 +31,7 @@ LinuxProcess::LinuxProcess(const std::vector<std::string>& commandLine,
   isValid_ = true;
 
   entryPoint_ = elf.getEntryPoint();
+  executableRegions_ = elf.getExecutableRegions();
 
   // Align heap start to a 32-byte boundary
   heapStart_ = alignToBoundary(elf.getProcessImageSize(), 32);
@@ -65,6 +66,7 @@ LinuxProcess::LinuxProcess(span<char> instructions, YAML::Node config)
   commandLine_.push_back("\0");
 
   isValid_ = true;
+  executableRegions_ = {{0, instructions.size()}};
 
   // Align heap start to a 32-byte boundary
   heapStart_ = alignToBoundary(instructions.size(), 32);
@@ -104,6 +106,11 @@ uint64_t LinuxProcess::getProcessImageSize() const { return size_; }
 
 uint64_t LinuxProcess::getEntryPoint() const { return entryPoint_; }
 
+const std::vector<std::pair<uint64_t, uint64_t>>&
+LinuxProcess::getExecutableRegions() const {
+  return executableRegions_;
+}
+
 uint64_t LinuxProcess::getStackPointer() const { return stackPointer_; }
 
 void LinuxProcess::createStack(char** processImage) {
@@ -13,14 +13,15 @@ const unsigned int clockFrequency = 2.5 * 1e9;
 
 Core::Core(MemoryInterface& instructionMemory, MemoryInterface& dataMemory,
            uint64_t entryPoint, uint64_t programByteLength,
-           const arch::Architecture& isa)
+           const arch::Architecture& isa, BranchTraceWriter* branchTrace)
     : instructionMemory_(instructionMemory),
       dataMemory_(dataMemory),
       programByteLength_(programByteLength),
       isa_(isa),
       pc_(entryPoint),
       registerFileSet_(isa.getRegisterFileStructures()),
-      architecturalRegisterFileSet_(registerFileSet_) {
+      architecturalRegisterFileSet_(registerFileSet_),
+      branchTrace_(branchTrace) {
   // Pre-load the first instruction
   instructionMemory_.requestRead({pc_, FETCH_SIZE});
 
@@ -48,16 +49,18 @@ void Core::tick() {
     // Handle pending reads to a uop
     auto& uop = microOps_.front();
 
+    // Place each response by the index of the access it was requested for
     const auto& completedReads = dataMemory_.getCompletedReads();
     for (const auto& response : completedReads) {
       assert(pendingReads_ > 0);
-      uop->supplyData(response.target.address, response.data);
+      pendingData_[response.requestId] = response.data;
       pendingReads_--;
     }
     dataMemory_.clearCompletedReads();
 
     if (pendingReads_ == 0) {
-      // Load complete: resume execution
+      // Load complete: supply all data at once and resume execution
+      uop->supplyDataBlock(0, {pendingData_.data(), pendingData_.size()});
       execute(uop);
     }
 
@@ -124,10 +127,12 @@ void Core::tick() {
     if (addresses.size() > 0) {
       // Memory reads are required; request them, set `pendingReads_`
       // accordingly, and end the cycle early
-      for (auto const& target : addresses) {
-        dataMemory_.requestRead(target);
+      pendingData_.clear();
+      pendingData_.resize(addresses.size());
+      for (size_t i = 0; i < addresses.size(); i++) {
+        dataMemory_.requestRead(addresses[i], i);
         // Store addresses for use by next store data operation
-        previousAddresses_.push_back(target);
+        previousAddresses_.push_back(addresses[i]);
       }
       pendingReads_ = addresses.size();
       return;
@@ -180,6 +185,12 @@ void Core::execute(std::shared_ptr<Instruction>& uop) {
   } else if (uop->isBranch()) {
     pc_ = uop->getBranchAddress();
     branchesExecuted_++;
+    if (branchTrace_ != nullptr) {
+      branchTrace_->record({instructionsExecuted_ + 1,
+                            uop->getInstructionAddress(), uop->getBranchType(),
+                            uop->wasBranchTaken(), pc_,
+                            uop->getKnownTarget()});
+    }
   }
 
   // Writeback
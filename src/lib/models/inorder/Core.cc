@@ -28,7 +28,7 @@ Core::Core(MemoryInterface& instructionMemory, MemoryInterface& dataMemory,
       decodeUnit_(fetchToDecodeBuffer_, decodeToExecuteBuffer_,
                   branchPredictor),
       executeUnit_(
-          decodeToExecuteBuffer_, completionSlots_[0],
+          decodeToExecuteBuffer_, {completionSlots_.data(), 1},
           [this](auto regs, auto values) { forwardOperands(regs, values); },
           [this](auto instruction) { handleLoad(instruction); },
           [this](auto instruction) { storeData(instruction); },
@@ -155,6 +155,13 @@ std::map<std::string, std::string> Core::getStats() const {
                         static_cast<float>(totalBranchesExecuted);
   std::ostringstream branchMissRateStr;
   branchMissRateStr << std::setprecision(3) << branchMissRate << "%";
+  auto indirectExecuted = executeUnit_.getIndirectBranchExecutedCount();
+  auto indirectMispredicts = executeUnit_.getIndirectBranchMispredictedCount();
+  // Indirect branch mispredictions per thousand retired instructions
+  auto indirectMpki = 1000.0f * static_cast<float>(indirectMispredicts) /
+                      static_cast<float>(retired);
+  std::ostringstream indirectMpkiStr;
+  indirectMpkiStr << std::setprecision(3) << indirectMpki;
 
   return {{"cycles", std::to_string(ticks_)},
           {"retired", std::to_string(retired)},
@@ -162,7 +169,10 @@ std::map<std::string, std::string> Core::getStats() const {
           {"flushes", std::to_string(flushes_)},
           {"branch.executed", std::to_string(totalBranchesExecuted)},
           {"branch.mispredict", std::to_string(totalBranchMispredicts)},
-          {"branch.missrate", branchMissRateStr.str()}};
+          {"branch.missrate", branchMissRateStr.str()},
+          {"branch.indirect.executed", std::to_string(indirectExecuted)},
+          {"branch.indirect.mispredict", std::to_string(indirectMispredicts)},
+          {"branch.indirect.mpki", indirectMpkiStr.str()}};
 }
 
 void Core::raiseException(const std::shared_ptr<Instruction>& instruction) {
@@ -216,18 +226,21 @@ void Core::processExceptionHandler() {
 
 void Core::loadData(const std::shared_ptr<Instruction>& instruction) {
   const auto& addresses = instruction->getGeneratedAddresses();
-  for (const auto& target : addresses) {
-    dataMemory_.requestRead(target);
+  for (size_t i = 0; i < addresses.size(); i++) {
+    dataMemory_.requestRead(addresses[i], i);
   }
 
   // NOTE: This model only supports zero-cycle data memory models, and will not
   // work unless data requests are handled synchronously.
-  for (const auto& response : dataMemory_.getCompletedReads()) {
-    instruction->supplyData(response.target.address, response.data);
-  }
-
-  assert(instruction->hasAllData() &&
+  loadedData_.clear();
+  loadedData_.resize(addresses.size());
+  const auto& completedReads = dataMemory_.getCompletedReads();
+  assert(completedReads.size() == addresses.size() &&
          "Load instruction failed to obtain all data this cycle");
+  for (const auto& response : completedReads) {
+    loadedData_[response.requestId] = response.data;
+  }
+  instruction->supplyDataBlock(0, {loadedData_.data(), loadedData_.size()});
 
   instruction->execute();
 
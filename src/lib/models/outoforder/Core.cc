@@ -17,7 +17,8 @@ namespace outoforder {
 Core::Core(MemoryInterface& instructionMemory, MemoryInterface& dataMemory,
            uint64_t processMemorySize, uint64_t entryPoint,
            const arch::Architecture& isa, BranchPredictor& branchPredictor,
-           pipeline::PortAllocator& portAllocator, YAML::Node config)
+           pipeline::PortAllocator& portAllocator, YAML::Node config,
+           BranchTraceWriter* branchTrace)
     : isa_(isa),
       physicalRegisterStructures_(
           {{8, config["Register-Set"]["GeneralPurpose-Count"].as<uint16_t>()},
@@ -33,8 +34,13 @@ Core::Core(MemoryInterface& instructionMemory, MemoryInterface& dataMemory,
            config["Register-Set"]["Conditional-Count"].as<uint16_t>(),
            isa.getNumSystemRegisters()}),
       registerFileSet_(physicalRegisterStructures_),
-      registerAliasTable_(isa.getRegisterFileStructures(),
-                          physicalRegisterQuantities_),
+      registerAliasTable_(
+          isa.getRegisterFileStructures(), physicalRegisterQuantities_,
+          config["Rename"]["Checkpoints"].IsDefined()
+              ? config["Rename"]["Checkpoints"].as<uint16_t>()
+              : 0,
+          config["Rename"]["Move-Elimination"].IsDefined() &&
+              config["Rename"]["Move-Elimination"].as<bool>()),
       mappedRegisterFileSet_(registerFileSet_, registerAliasTable_),
       dataMemory_(dataMemory),
       fetchToDecodeBuffer_(
@@ -67,7 +73,36 @@ Core::Core(MemoryInterface& instructionMemory, MemoryInterface& dataMemory,
               .as<uint16_t>()),
       fetchUnit_(fetchToDecodeBuffer_, instructionMemory, processMemorySize,
                  entryPoint, config["Fetch"]["Fetch-Block-Size"].as<uint16_t>(),
-                 isa, branchPredictor),
+                 isa, branchPredictor,
+                 config["Fetch"]["Fetch-Target-Queue-Size"].IsDefined()
+                     ? config["Fetch"]["Fetch-Target-Queue-Size"].as<uint16_t>()
+                     : 0,
+                 config["Fetch"]["Fetch-Target-Buffer-Entries"].IsDefined()
+                     ? config["Fetch"]["Fetch-Target-Buffer-Entries"]
+                           .as<uint16_t>()
+                     : 1024,
+                 config["Fetch"]["Fetch-Target-Buffer-Ways"].IsDefined()
+                     ? config["Fetch"]["Fetch-Target-Buffer-Ways"]
+                           .as<uint16_t>()
+                     : 4,
+                 config["Fetch"]["Micro-Op-Cache-Sets"].IsDefined()
+                     ? config["Fetch"]["Micro-Op-Cache-Sets"].as<uint16_t>()
+                     : 0,
+                 config["Fetch"]["Micro-Op-Cache-Ways"].IsDefined()
+                     ? config["Fetch"]["Micro-Op-Cache-Ways"].as<uint16_t>()
+                     : 8,
+                 config["Fetch"]["Micro-Op-Cache-Line-Uops"].IsDefined()
+                     ? config["Fetch"]["Micro-Op-Cache-Line-Uops"]
+                           .as<uint16_t>()
+                     : 6,
+                 config["Fetch"]["Micro-Op-Cache-Hit-Latency"].IsDefined()
+                     ? config["Fetch"]["Micro-Op-Cache-Hit-Latency"]
+                           .as<uint16_t>()
+                     : 1,
+                 config["Fetch"]["Micro-Op-Cache-Switch-Penalty"].IsDefined()
+                     ? config["Fetch"]["Micro-Op-Cache-Switch-Penalty"]
+                           .as<uint16_t>()
+                     : 1),
       reorderBuffer_(
           config["Queue-Sizes"]["ROB"].as<unsigned int>(), registerAliasTable_,
           loadStoreQueue_,
@@ -76,8 +111,11 @@ Core::Core(MemoryInterface& instructionMemory, MemoryInterface& dataMemory,
             fetchUnit_.registerLoopBoundary(branchAddress);
           },
           branchPredictor, config["Fetch"]["Loop-Buffer-Size"].as<uint16_t>(),
-          config["Fetch"]["Loop-Detection-Threshold"].as<uint16_t>()),
-      decodeUnit_(fetchToDecodeBuffer_, decodeToRenameBuffer_, branchPredictor),
+          config["Fetch"]["Loop-Detection-Threshold"].as<uint16_t>(),
+          branchTrace),
+      decodeUnit_(fetchToDecodeBuffer_, decodeToRenameBuffer_, branchPredictor,
+                  config["Macro-Op-Fusion"].IsDefined() &&
+                      config["Macro-Op-Fusion"].size() > 0),
       renameUnit_(decodeToRenameBuffer_, renameToDispatchBuffer_,
                   reorderBuffer_, registerAliasTable_, loadStoreQueue_,
                   physicalRegisterStructures_.size()),
@@ -89,6 +127,12 @@ Core::Core(MemoryInterface& instructionMemory, MemoryInterface& dataMemory,
       portAllocator_(portAllocator),
       clockFrequency_(config["Core"]["Clock-Frequency"].as<float>() * 1e9),
       commitWidth_(config["Pipeline-Widths"]["Commit"].as<unsigned int>()) {
+  // Size the execution unit pipelines to hold the longest configured latency
+  uint16_t maxLatency = 1;
+  for (size_t i = 0; i < config["Latencies"].size(); i++) {
+    maxLatency = std::max(
+        maxLatency, config["Latencies"][i]["Execution-Latency"].as<uint16_t>());
+  }
   for (size_t i = 0; i < config["Execution-Units"].size(); i++) {
     // Create vector of blocking groups
     std::vector<uint16_t> blockingGroups = {};
@@ -98,14 +142,17 @@ Core::Core(MemoryInterface& instructionMemory, MemoryInterface& dataMemory,
       }
     }
     executionUnits_.emplace_back(
-        issuePorts_[i], completionSlots_[i],
+        issuePorts_[i],
+        span<pipeline::PipelineBuffer<std::shared_ptr<Instruction>, 1>>(
+            &completionSlots_[i], 1),
         [this](auto regs, auto values) {
           dispatchIssueUnit_.forwardOperands(regs, values);
         },
         [this](auto uop) { loadStoreQueue_.startLoad(uop); },
         [this](auto uop) { loadStoreQueue_.supplyStoreData(uop); },
         [](auto uop) { uop->setCommitReady(); }, branchPredictor,
-        config["Execution-Units"][i]["Pipelined"].as<bool>(), blockingGroups);
+        config["Execution-Units"][i]["Pipelined"].as<bool>(), blockingGroups,
+        maxLatency);
   }
   // Provide reservation size getter to A64FX port allocator
   portAllocator.setRSSizeGetter([this](std::vector<uint64_t>& sizeVec) {
@@ -333,6 +380,19 @@ void Core::processExceptionHandler() {
 }
 
 void Core::applyStateChange(const arch::ProcessStateChange& change) {
+  // Registers may share a physical register following move elimination; give
+  // each modified register its own before updating it. The pipeline is empty,
+  // so the new allocation is committed immediately.
+  for (const auto& reg : change.modifiedRegisters) {
+    if (!registerAliasTable_.canEliminate(reg.type)) continue;
+    auto physical = registerAliasTable_.getMapping(reg);
+    if (!registerAliasTable_.isShared(physical)) continue;
+    RegisterValue value = registerFileSet_.get(physical);
+    auto allocated = registerAliasTable_.allocate(reg);
+    registerAliasTable_.commit(allocated);
+    registerFileSet_.set(allocated, value);
+  }
+
   // Update registers in accoradance with the ProcessStateChange type
   switch (change.type) {
     case arch::ChangeType::INCREMENT: {
@@ -395,13 +455,29 @@ std::map<std::string, std::string> Core::getStats() const {
   ipcStr << std::setprecision(2) << ipc;
 
   auto branchStalls = fetchUnit_.getBranchStalls();
+  auto targetQueueResteers = fetchUnit_.getTargetQueueResteers();
+  auto microOpCacheHits = fetchUnit_.getMicroOpCacheHits();
+  auto microOpCacheMisses = fetchUnit_.getMicroOpCacheMisses();
+  auto microOpCacheSwitches = fetchUnit_.getMicroOpCacheSwitches();
+  auto microOpCacheLookups = microOpCacheHits + microOpCacheMisses;
+  std::ostringstream microOpCacheHitRateStr;
+  microOpCacheHitRateStr << std::setprecision(3)
+                         << (microOpCacheLookups > 0
+                                 ? 100.0f * microOpCacheHits /
+                                       static_cast<float>(microOpCacheLookups)
+                                 : 0.0f)
+                         << "%";
 
   auto earlyFlushes = decodeUnit_.getEarlyFlushes();
+  auto fusedPairs = decodeUnit_.getFusedPairs();
 
   auto allocationStalls = renameUnit_.getAllocationStalls();
   auto robStalls = renameUnit_.getROBStalls();
   auto lqStalls = renameUnit_.getLoadQueueStalls();
   auto sqStalls = renameUnit_.getStoreQueueStalls();
+  auto checkpointStalls = renameUnit_.getCheckpointStalls();
+  auto movesEliminated = renameUnit_.getMovesEliminated();
+  auto zeroIdioms = renameUnit_.getZeroIdioms();
 
   auto rsStalls = dispatchIssueUnit_.getRSStalls();
   auto frontendStalls = dispatchIssueUnit_.getFrontendStalls();
@@ -410,27 +486,45 @@ std::map<std::string, std::string> Core::getStats() const {
 
   uint64_t totalBranchesExecuted = 0;
   uint64_t totalBranchMispredicts = 0;
+  uint64_t totalIndirectExecuted = 0;
+  uint64_t totalIndirectMispredicts = 0;
 
   // Sum up the branch stats reported across the execution units.
   for (auto& eu : executionUnits_) {
     totalBranchesExecuted += eu.getBranchExecutedCount();
     totalBranchMispredicts += eu.getBranchMispredictedCount();
+    totalIndirectExecuted += eu.getIndirectBranchExecutedCount();
+    totalIndirectMispredicts += eu.getIndirectBranchMispredictedCount();
   }
   auto branchMissRate = 100.0f * static_cast<float>(totalBranchMispredicts) /
                         static_cast<float>(totalBranchesExecuted);
   std::ostringstream branchMissRateStr;
   branchMissRateStr << std::setprecision(3) << branchMissRate << "%";
+  // Indirect branch mispredictions per thousand retired instructions
+  auto indirectMpki = 1000.0f * static_cast<float>(totalIndirectMispredicts) /
+                      static_cast<float>(retired);
+  std::ostringstream indirectMpkiStr;
+  indirectMpkiStr << std::setprecision(3) << indirectMpki;
 
   return {{"cycles", std::to_string(ticks_)},
           {"retired", std::to_string(retired)},
           {"ipc", ipcStr.str()},
           {"flushes", std::to_string(flushes_)},
           {"fetch.branchStalls", std::to_string(branchStalls)},
+          {"fetch.targetQueueResteers", std::to_string(targetQueueResteers)},
+          {"fetch.microOpCacheHits", std::to_string(microOpCacheHits)},
+          {"fetch.microOpCacheMisses", std::to_string(microOpCacheMisses)},
+          {"fetch.microOpCacheHitRate", microOpCacheHitRateStr.str()},
+          {"fetch.microOpCacheSwitches", std::to_string(microOpCacheSwitches)},
           {"decode.earlyFlushes", std::to_string(earlyFlushes)},
+          {"decode.fusedPairs", std::to_string(fusedPairs)},
           {"rename.allocationStalls", std::to_string(allocationStalls)},
           {"rename.robStalls", std::to_string(robStalls)},
           {"rename.lqStalls", std::to_string(lqStalls)},
           {"rename.sqStalls", std::to_string(sqStalls)},
+          {"rename.checkpointStalls", std::to_string(checkpointStalls)},
+          {"rename.movesEliminated", std::to_string(movesEliminated)},
+          {"rename.zeroIdioms", std::to_string(zeroIdioms)},
           {"dispatch.rsStalls", std::to_string(rsStalls)},
           {"issue.frontendStalls", std::to_string(frontendStalls)},
           {"issue.backendStalls", std::to_string(backendStalls)},
@@ -438,6 +532,10 @@ std::map<std::string, std::string> Core::getStats() const {
           {"branch.executed", std::to_string(totalBranchesExecuted)},
           {"branch.mispredict", std::to_string(totalBranchMispredicts)},
           {"branch.missrate", branchMissRateStr.str()},
+          {"branch.indirect.executed", std::to_string(totalIndirectExecuted)},
+          {"branch.indirect.mispredict",
+           std::to_string(totalIndirectMispredicts)},
+          {"branch.indirect.mpki", indirectMpkiStr.str()},
           {"lsq.loadViolations",
            std::to_string(reorderBuffer_.getViolatingLoadsCount())}};
 }
@@ -1,16 +1,23 @@
 #include "simeng/pipeline/DecodeUnit.hh"
 
+#include <algorithm>
 #include <cassert>
 
 namespace simeng {
 namespace pipeline {
 
-DecodeUnit::DecodeUnit(PipelineBuffer<MacroOp>& input,
-                       PipelineBuffer<std::shared_ptr<Instruction>>& output,
-                       BranchPredictor& predictor)
-    : input_(input), output_(output), predictor_(predictor){};
-
-void DecodeUnit::tick() {
+template <unsigned short OutputWidth>
+DecodeUnit<OutputWidth>::DecodeUnit(
+    PipelineBuffer<MacroOp>& input,
+    PipelineBuffer<std::shared_ptr<Instruction>, OutputWidth>& output,
+    BranchPredictor& predictor, bool fuseMacroOps)
+    : input_(input),
+      output_(output),
+      predictor_(predictor),
+      fuseMacroOps_(fuseMacroOps){};
+
+template <unsigned short OutputWidth>
+void DecodeUnit<OutputWidth>::tick() {
   // Stall if output buffer is stalled
   if (output_.isStalled()) {
     input_.stall(true);
@@ -64,7 +71,18 @@ void DecodeUnit::tick() {
       if (!uop->isBranch()) {
         // Non-branch incorrectly predicted as a branch; let the predictor know
         predictor_.update(uop->getInstructionAddress(), false, pc_,
-                          uop->getBranchType());
+                          uop->getBranchType(), uop->getBranchPrediction());
+      } else {
+        // Branch redirected to its known target; the predictions made since
+        // were down the wrong path, so repair the predictor's speculative
+        // state with the corrected outcome. The corrected prediction is
+        // recorded so the branch isn't found mispredicted again on execution.
+        BranchPrediction prediction = uop->getBranchPrediction();
+        predictor_.repair(uop->getInstructionAddress(), true, pc_,
+                          uop->getBranchType(), prediction);
+        prediction.taken = true;
+        prediction.target = pc_;
+        uop->setBranchPrediction(prediction);
       }
       // Remove macro-operations in microOps_ buffer after macro-operation
       // decoded in this cycle
@@ -86,14 +104,77 @@ void DecodeUnit::tick() {
       // Skip processing remaining uops, as they need to be flushed
       break;
     }
+
+    // Fuse the following uop onto this one, if permitted
+    if (fuseMacroOps_ && microOps_.size() &&
+        canFuse(*uop, *microOps_.front())) {
+      uop->setFusedTail(microOps_.front());
+      microOps_.pop_front();
+      fusedPairs_++;
+    }
+  }
+}
+
+template <unsigned short OutputWidth>
+bool DecodeUnit<OutputWidth>::canFuse(const Instruction& head,
+                                      const Instruction& tail) const {
+  // Only whole, non-memory instructions may be fused, and only the second of
+  // the pair may be a branch
+  for (const auto* insn : {&head, &tail}) {
+    if (insn->isMicroOp() || insn->exceptionEncountered() || insn->isLoad() ||
+        insn->isStoreAddress() || insn->isStoreData()) {
+      return false;
+    }
+  }
+  if (head.isBranch() || !head.canFuseWith(tail)) return false;
+
+  // The tail must not require an early flush, as it will not be checked once
+  // fused
+  if (std::get<0>(tail.checkEarlyBranchMisprediction())) return false;
+
+  // The tail is executed with the head's results, so may only read registers
+  // the head writes
+  const auto& destinations = head.getDestinationRegisters();
+  const auto& sources = tail.getOperandRegisters();
+  for (size_t i = 0; i < sources.size(); i++) {
+    if (tail.isOperandReady(i)) continue;
+    if (std::find(destinations.begin(), destinations.end(), sources[i]) ==
+        destinations.end()) {
+      return false;
+    }
   }
+  return true;
 }
 
-bool DecodeUnit::shouldFlush() const { return shouldFlush_; }
-uint64_t DecodeUnit::getFlushAddress() const { return pc_; }
-uint64_t DecodeUnit::getEarlyFlushes() const { return earlyFlushes_; };
+template <unsigned short OutputWidth>
+bool DecodeUnit<OutputWidth>::shouldFlush() const {
+  return shouldFlush_;
+}
+
+template <unsigned short OutputWidth>
+uint64_t DecodeUnit<OutputWidth>::getFlushAddress() const {
+  return pc_;
+}
+
+template <unsigned short OutputWidth>
+uint64_t DecodeUnit<OutputWidth>::getEarlyFlushes() const {
+  return earlyFlushes_;
+}
+
+template <unsigned short OutputWidth>
+uint64_t DecodeUnit<OutputWidth>::getFusedPairs() const {
+  return fusedPairs_;
+}
+
+template <unsigned short OutputWidth>
+void DecodeUnit<OutputWidth>::purgeFlushed() {
+  microOps_.clear();
+}
 
-void DecodeUnit::purgeFlushed() { microOps_.clear(); }
+// The out-of-order core's config-sized output, and the in-order core's
+// single-width output to execute
+template class DecodeUnit<0>;
+template class DecodeUnit<1>;
 
 }  // namespace pipeline
 }  // namespace simeng
@@ -8,7 +8,7 @@ namespace pipeline {
 
 DispatchIssueUnit::DispatchIssueUnit(
     PipelineBuffer<std::shared_ptr<Instruction>>& fromRename,
-    std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>& issuePorts,
+    std::vector<PipelineBuffer<std::shared_ptr<Instruction>, 1>>& issuePorts,
     const RegisterFileSet& registerFileSet, PortAllocator& portAllocator,
     const std::vector<uint16_t>& physicalRegisterStructure, YAML::Node config)
     : input_(fromRename),
@@ -113,10 +113,14 @@ void DispatchIssueUnit::tick() {
       }
     }
 
-    // Set scoreboard for all destination registers as not ready
-    auto& destinationRegisters = uop->getDestinationRegisters();
-    for (const auto& reg : destinationRegisters) {
-      scoreboard_[reg.type][reg.tag] = false;
+    // Set scoreboard for all destination registers as not ready. A fused tail
+    // is executed with this uop, reading only this uop's results, so occupies
+    // no reservation station entry of its own
+    for (const auto* insn : {uop.get(), uop->getFusedTail().get()}) {
+      if (insn == nullptr) continue;
+      for (const auto& reg : insn->getDestinationRegisters()) {
+        scoreboard_[reg.type][reg.tag] = false;
+      }
     }
 
     // Increment dispatches made and RS occupied entries size
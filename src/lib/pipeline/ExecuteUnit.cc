@@ -7,14 +7,14 @@ namespace simeng {
 namespace pipeline {
 
 ExecuteUnit::ExecuteUnit(
-    PipelineBuffer<std::shared_ptr<Instruction>>& input,
-    PipelineBuffer<std::shared_ptr<Instruction>>& output,
+    PipelineBuffer<std::shared_ptr<Instruction>, 1>& input,
+    span<PipelineBuffer<std::shared_ptr<Instruction>, 1>> output,
     std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
     std::function<void(const std::shared_ptr<Instruction>&)> handleLoad,
     std::function<void(const std::shared_ptr<Instruction>&)> handleStore,
     std::function<void(const std::shared_ptr<Instruction>&)> raiseException,
     BranchPredictor& predictor, bool pipelined,
-    const std::vector<uint16_t>& blockingGroups)
+    const std::vector<uint16_t>& blockingGroups, uint16_t maxLatency)
     : input_(input),
       output_(output),
       forwardOperands_(forwardOperands),
@@ -23,11 +23,23 @@ ExecuteUnit::ExecuteUnit(
       raiseException_(raiseException),
       predictor_(predictor),
       pipelined_(pipelined),
-      blockingGroups_(blockingGroups) {}
+      pipeline_(maxLatency),
+      operationsStalled_(maxLatency) {
+  // Compile the blocking groups into a bitset for constant-time lookup
+  for (uint16_t group : blockingGroups) {
+    size_t word = group / 64;
+    if (word >= blockingGroupMask_.size()) {
+      blockingGroupMask_.resize(word + 1, 0);
+    }
+    blockingGroupMask_[word] |= (1ull << (group % 64));
+  }
+}
 
 void ExecuteUnit::tick() {
   tickCounter_++;
   shouldFlush_ = false;
+  outputSlot_ = 0;
+  completed_ = 0;
 
   if (stallUntil_ <= tickCounter_) {
     input_.stall(false);
@@ -40,17 +52,14 @@ void ExecuteUnit::tick() {
         auto latency = uop->getLatency();
         cycles_++;
         // Block uop execution if appropriate
-        if (std::find(blockingGroups_.begin(), blockingGroups_.end(),
-                      uop->getGroup()) != blockingGroups_.end()) {
+        if (isBlocking(uop->getGroup())) {
           if (operationsStalled_.size() == 0) {
             // Add uop to pipeline
-            pipeline_.push_back({nullptr, tickCounter_ + latency - 1});
-            pipeline_.back().insn = std::move(uop);
-            operationsStalled_.push_back(pipeline_.back().insn);
+            operationsStalled_.push_back(uop);
+            pipeline_.push_back({std::move(uop), tickCounter_ + latency - 1});
           } else {
             // Stall execution start cycle
-            operationsStalled_.push_back(nullptr);
-            operationsStalled_.back() = std::move(uop);
+            operationsStalled_.push_back(std::move(uop));
           }
         } else if (latency == 1 && pipeline_.size() == 0) {
           // Pipeline is empty and insn will execute this cycle; bypass
@@ -67,41 +76,40 @@ void ExecuteUnit::tick() {
           }
 
           // Add insn to pipeline
-          pipeline_.push_back({nullptr, tickCounter_ + latency - 1});
-          pipeline_.back().insn = std::move(uop);
+          pipeline_.push_back({std::move(uop), tickCounter_ + latency - 1});
         }
       }
       input_.getHeadSlots()[0] = nullptr;
     }
   }
 
-  if (pipeline_.size() == 0) {
-    return;
-  }
+  // Complete instructions in order from the head of the pipeline, for as long
+  // as they are ready and completion slots remain. Loads and exceptions are
+  // counted against the slots too, as their handlers may write to them.
+  while (pipeline_.size() > 0 && completed_ < output_.size()) {
+    if (pipeline_.front().readyAt > tickCounter_) break;
+
+    auto insn = std::move(pipeline_.front().insn);
+    pipeline_.pop_front();
 
-  auto& head = pipeline_.front();
-  if (head.readyAt <= tickCounter_) {
     // Check if the completion of an operation would unblock
     // another stalled operation.
-    if (std::find(blockingGroups_.begin(), blockingGroups_.end(),
-                  head.insn->getGroup()) != blockingGroups_.end()) {
+    if (isBlocking(insn->getGroup())) {
       operationsStalled_.pop_front();
       if (operationsStalled_.size() > 0) {
         // Add uop to pipeline
-        auto& uop = operationsStalled_.front();
-        pipeline_.push_back({nullptr, tickCounter_ + uop->getLatency() - 1});
-        pipeline_.back().insn = std::move(uop);
-        operationsStalled_.front() = pipeline_.back().insn;
+        const auto& uop = operationsStalled_.front();
+        pipeline_.push_back({uop, tickCounter_ + uop->getLatency() - 1});
       }
     }
-    execute(head.insn);
-    pipeline_.pop_front();
+    execute(insn);
   }
 }
 
 void ExecuteUnit::execute(std::shared_ptr<Instruction>& uop) {
   assert(uop->canExecute() &&
          "Attempted to execute an instruction before it was ready");
+  completed_++;
 
   if (uop->exceptionEncountered()) {
     // Exception encountered prior to execution
@@ -138,29 +146,68 @@ void ExecuteUnit::execute(std::shared_ptr<Instruction>& uop) {
     return;
   }
 
-  if (uop->isBranch()) {
-    pc_ = uop->getBranchAddress();
+  if (uop->isBranch()) resolveBranch(uop);
+
+  // Operand forwarding; allows a dependent uop to execute next cycle
+  forwardOperands_(uop->getDestinationRegisters(), uop->getResults());
 
-    // Update branch predictor with branch results
-    predictor_.update(uop->getInstructionAddress(), uop->wasBranchTaken(), pc_,
-                      uop->getBranchType());
+  if (uop->getFusedTail() != nullptr) {
+    executeFusedTail(*uop, uop->getFusedTail());
+  }
 
-    // Update the branch instruction counter
-    branchesExecuted_++;
+  output_[outputSlot_].getTailSlots()[0] = std::move(uop);
+  outputSlot_++;
+}
 
-    if (uop->wasBranchMispredicted()) {
-      // Misprediction; flush the pipeline
-      shouldFlush_ = true;
-      flushAfter_ = uop->getInstructionId();
-      // Update the branch misprediction counter
-      branchMispredicts_++;
+void ExecuteUnit::executeFusedTail(const Instruction& head,
+                                   const std::shared_ptr<Instruction>& tail) {
+  // Supply the tail's operands from the head's results; the tail reads no
+  // other registers
+  const auto& sources = tail->getOperandRegisters();
+  const auto& destinations = head.getDestinationRegisters();
+  const auto& results = head.getResults();
+  for (size_t i = 0; i < sources.size(); i++) {
+    if (tail->isOperandReady(i)) continue;
+    for (size_t j = 0; j < destinations.size(); j++) {
+      if (destinations[j] == sources[i]) {
+        tail->supplyOperand(i, results[j]);
+        break;
+      }
     }
   }
 
-  // Operand forwarding; allows a dependent uop to execute next cycle
-  forwardOperands_(uop->getDestinationRegisters(), uop->getResults());
+  tail->execute();
+  if (tail->exceptionEncountered()) {
+    raiseException_(tail);
+    return;
+  }
+
+  if (tail->isBranch()) resolveBranch(tail);
+
+  forwardOperands_(tail->getDestinationRegisters(), tail->getResults());
+}
+
+void ExecuteUnit::resolveBranch(const std::shared_ptr<Instruction>& uop) {
+  pc_ = uop->getBranchAddress();
+
+  // Update branch predictor with branch results
+  BranchType type = uop->getBranchType();
+  predictor_.update(uop->getInstructionAddress(), uop->wasBranchTaken(), pc_,
+                    type, uop->getBranchPrediction());
 
-  output_.getTailSlots()[0] = std::move(uop);
+  // Update the branch instruction counter
+  branchesExecuted_++;
+  bool indirect = isIndirectBranch(type, uop->getKnownTarget());
+  if (indirect) indirectBranchesExecuted_++;
+
+  if (uop->wasBranchMispredicted()) {
+    // Misprediction; flush the pipeline
+    shouldFlush_ = true;
+    flushAfter_ = uop->getInstructionId();
+    // Update the branch misprediction counter
+    branchMispredicts_++;
+    if (indirect) indirectBranchMispredicts_++;
+  }
 }
 
 bool ExecuteUnit::shouldFlush() const { return shouldFlush_; }
@@ -177,16 +224,10 @@ void ExecuteUnit::purgeFlushed() {
     stallUntil_ = tickCounter_;
   }
 
-  // Iterate over the pipeline and remove flushed instructions
-  auto it = pipeline_.begin();
-  while (it != pipeline_.end()) {
-    auto& entry = *it;
-    if (entry.insn->isFlushed()) {
-      it = pipeline_.erase(it);
-    } else {
-      it++;
-    }
-  }
+  // Remove flushed instructions from the pipeline
+  pipeline_.remove_if([](const ExecutionUnitPipelineEntry& entry) {
+    return entry.insn->isFlushed();
+  });
 
   // If first blocking in-flight instruction is flushed, ensure another
   // non-flushed stalled instruction takes it place in the pipeline if
@@ -196,22 +237,13 @@ void ExecuteUnit::purgeFlushed() {
       operationsStalled_.front()->isFlushed()) {
     replace = true;
   }
-  auto itStall = operationsStalled_.begin();
-  while (itStall != operationsStalled_.end()) {
-    auto& entry = *itStall;
-    if (entry->isFlushed()) {
-      itStall = operationsStalled_.erase(itStall);
-    } else {
-      itStall++;
-    }
-  }
+  operationsStalled_.remove_if(
+      [](const std::shared_ptr<Instruction>& uop) { return uop->isFlushed(); });
 
   if (replace && operationsStalled_.size() > 0) {
     // Add uop to pipeline
-    auto& uop = operationsStalled_.front();
-    pipeline_.push_back({nullptr, tickCounter_ + uop->getLatency() - 1});
-    pipeline_.back().insn = std::move(uop);
-    operationsStalled_.front() = pipeline_.back().insn;
+    const auto& uop = operationsStalled_.front();
+    pipeline_.push_back({uop, tickCounter_ + uop->getLatency() - 1});
   }
 }
 
@@ -221,6 +253,12 @@ uint64_t ExecuteUnit::getBranchExecutedCount() const {
 uint64_t ExecuteUnit::getBranchMispredictedCount() const {
   return branchMispredicts_;
 }
+uint64_t ExecuteUnit::getIndirectBranchExecutedCount() const {
+  return indirectBranchesExecuted_;
+}
+uint64_t ExecuteUnit::getIndirectBranchMispredictedCount() const {
+  return indirectBranchMispredicts_;
+}
 
 uint64_t ExecuteUnit::getCycles() const { return cycles_; }
 
@@ -7,7 +7,12 @@ FetchUnit::FetchUnit(PipelineBuffer<MacroOp>& output,
                      MemoryInterface& instructionMemory,
                      uint64_t programByteLength, uint64_t entryPoint,
                      uint8_t blockSize, const arch::Architecture& isa,
-                     BranchPredictor& branchPredictor)
+                     BranchPredictor& branchPredictor,
+                     uint16_t targetQueueSize, uint16_t targetBufferEntries,
+                     uint16_t targetBufferWays, uint16_t microOpCacheSets,
+                     uint16_t microOpCacheWays, uint16_t microOpCacheLineUops,
+                     uint16_t microOpCacheHitLatency,
+                     uint16_t microOpCacheSwitchPenalty)
     : output_(output),
       pc_(entryPoint),
       instructionMemory_(instructionMemory),
@@ -15,9 +20,27 @@ FetchUnit::FetchUnit(PipelineBuffer<MacroOp>& output,
       isa_(isa),
       branchPredictor_(branchPredictor),
       blockSize_(blockSize),
-      blockMask_(~(blockSize_ - 1)) {
+      blockMask_(~(blockSize_ - 1)),
+      targetQueueSize_(targetQueueSize),
+      targetPc_(entryPoint),
+      targetBufferWays_(targetBufferWays),
+      targetBuffer_(targetQueueSize > 0 ? targetBufferEntries : 0),
+      microOpCacheSets_(microOpCacheSets),
+      microOpCacheWays_(microOpCacheWays),
+      microOpCacheLineUops_(microOpCacheLineUops),
+      microOpCacheHitLatency_(microOpCacheHitLatency),
+      microOpCacheSwitchPenalty_(microOpCacheSwitchPenalty),
+      microOpCache_(microOpCacheSets * microOpCacheWays) {
   assert(blockSize_ >= isa_.getMaxInstructionSize() &&
          "fetch block size must be larger than the largest instruction");
+  assert((targetQueueSize_ == 0 ||
+          (targetBufferWays_ > 0 &&
+           targetBufferEntries % targetBufferWays_ == 0)) &&
+         "fetch target buffer entries must be a multiple of its ways");
+  assert((microOpCacheSets_ == 0 ||
+          (microOpCacheWays_ > 0 && microOpCacheLineUops_ > 0 &&
+           microOpCacheHitLatency_ > 0)) &&
+         "invalid micro-op cache parameters");
   fetchBuffer_ = new uint8_t[2 * blockSize_];
   requestFromPC();
 }
@@ -25,6 +48,9 @@ FetchUnit::FetchUnit(PipelineBuffer<MacroOp>& output,
 FetchUnit::~FetchUnit() { delete[] fetchBuffer_; }
 
 void FetchUnit::tick() {
+  ticks_++;
+  if (targetQueueSize_ > 0) supplyTargets();
+
   if (output_.isStalled()) {
     return;
   }
@@ -38,24 +64,24 @@ void FetchUnit::tick() {
     auto outputSlots = output_.getTailSlots();
     for (size_t slot = 0; slot < output_.getWidth(); slot++) {
       auto& macroOp = outputSlots[slot];
-      auto bytesRead = isa_.predecode(&(loopBuffer_.front().encoding),
-                                      loopBuffer_.front().instructionSize,
-                                      loopBuffer_.front().address, macroOp);
-
-      assert(bytesRead != 0 && "predecode failure for loop buffer entry");
+      const auto& entry = loopBuffer_[loopBufferCursor_];
 
-      // Set prediction to recorded value during loop buffer filling
-      if (macroOp[0]->isBranch()) {
-        macroOp[0]->setBranchPrediction(loopBuffer_.front().prediction);
+      // Create fresh instances of the recorded macro-op; its address and
+      // branch prediction were set before it was recorded
+      macroOp.resize(entry.size());
+      for (size_t uop = 0; uop < entry.size(); uop++) {
+        macroOp[uop] = entry[uop]->clone();
       }
 
-      // Cycle queue by moving front entry to back
-      loopBuffer_.push_back(loopBuffer_.front());
-      loopBuffer_.pop_front();
+      // Wrap around to the start of the loop body
+      loopBufferCursor_++;
+      if (loopBufferCursor_ == loopBuffer_.size()) loopBufferCursor_ = 0;
     }
     return;
   }
 
+  if (microOpCacheSets_ > 0 && supplyFromMicroOpCache()) return;
+
   // Pointer to the instruction data to decode from
   const uint8_t* buffer;
   uint8_t bufferOffset;
@@ -75,27 +101,53 @@ void FetchUnit::tick() {
       bufferOffset = pc_ - blockAddress;
     }
 
-    // Find fetched memory that matches the desired block
-    const auto& fetched = instructionMemory_.getCompletedReads();
+    const uint8_t* fetchData;
+    if (targetQueueSize_ > 0) {
+      // The desired block must be at the head of the fetch target queue
+      if (targetQueue_.empty() ||
+          (targetQueue_.front().address & blockMask_) != blockAddress) {
+        if (!targetQueue_.empty() ||
+            (targetPc_ & blockMask_) != blockAddress) {
+          // Fetch has left the predicted path; resteer the queue to follow
+          // fetch
+          targetQueue_.clear();
+          targetPc_ = (bufferedBytes_ > 0) ? blockAddress : pc_;
+          targetQueueResteers_++;
+        }
+        return;
+      }
+      if (!targetQueue_.front().ready) {
+        // Need to wait for fetched instructions
+        return;
+      }
 
-    size_t fetchIndex;
-    for (fetchIndex = 0; fetchIndex < fetched.size(); fetchIndex++) {
-      if (fetched[fetchIndex].target.address == blockAddress) {
-        break;
+      // TODO: Handle memory faults
+      assert(targetQueue_.front().data && "Memory read failed");
+      fetchData = targetQueue_.front().data.getAsVector<uint8_t>();
+    } else {
+      // Find fetched memory that matches the desired block
+      const auto& fetched = instructionMemory_.getCompletedReads();
+
+      size_t fetchIndex;
+      for (fetchIndex = 0; fetchIndex < fetched.size(); fetchIndex++) {
+        if (fetched[fetchIndex].target.address == blockAddress) {
+          break;
+        }
+      }
+      if (fetchIndex == fetched.size()) {
+        // Need to wait for fetched instructions
+        return;
       }
-    }
-    if (fetchIndex == fetched.size()) {
-      // Need to wait for fetched instructions
-      return;
-    }
 
-    // TODO: Handle memory faults
-    assert(fetched[fetchIndex].data && "Memory read failed");
-    const uint8_t* fetchData = fetched[fetchIndex].data.getAsVector<uint8_t>();
+      // TODO: Handle memory faults
+      assert(fetched[fetchIndex].data && "Memory read failed");
+      fetchData = fetched[fetchIndex].data.getAsVector<uint8_t>();
+    }
 
     // Copy fetched data to fetch buffer after existing data
     std::memcpy(fetchBuffer_ + bufferedBytes_, fetchData + bufferOffset,
                 blockSize_ - bufferOffset);
+    if (targetQueueSize_ > 0) targetQueue_.pop_front();
 
     bufferedBytes_ += blockSize_ - bufferOffset;
     buffer = fetchBuffer_;
@@ -131,27 +183,19 @@ void FetchUnit::tick() {
       prediction = branchPredictor_.predict(pc_, macroOp[0]->getBranchType(),
                                             macroOp[0]->getKnownTarget());
       macroOp[0]->setBranchPrediction(prediction);
+      if (targetQueueSize_ > 0) {
+        trainTarget(pc_, prediction.taken, prediction.target);
+      }
     }
 
-    if (loopBufferState_ == LoopBufferState::FILLING) {
-      // Record instruction fetch information in loop body
-      uint32_t encoding;
-      memcpy(&encoding, buffer + bufferOffset, sizeof(uint32_t));
-      loopBuffer_.push_back(
-          {encoding, bytesRead, pc_, macroOp[0]->getBranchPrediction()});
+    if (microOpCacheSets_ > 0) {
+      fillMicroOpCache(macroOp, bytesRead, prediction.taken);
+    }
 
-      if (pc_ == loopBoundaryAddress_) {
-        // loopBoundaryAddress_ has been fetched whilst filling the loop buffer.
-        // Stop filling as loop body has been recorded and begin to supply
-        // decode unit with instructions from the loop buffer
-        loopBufferState_ = LoopBufferState::SUPPLYING;
-        bufferedBytes_ = 0;
-        break;
-      }
-    } else if (loopBufferState_ == LoopBufferState::WAITING &&
-               pc_ == loopBoundaryAddress_) {
-      // Once set loopBoundaryAddress_ is fetched, start to fill loop buffer
-      loopBufferState_ = LoopBufferState::FILLING;
+    if (trackLoopBuffer(macroOp)) {
+      // Stop fetching, as the loop buffer will supply the loop body
+      bufferedBytes_ = 0;
+      break;
     }
 
     assert(bytesRead <= bufferedBytes_ &&
@@ -210,9 +254,50 @@ void FetchUnit::updatePC(uint64_t address) {
   pc_ = address;
   bufferedBytes_ = 0;
   hasHalted_ = (pc_ >= programByteLength_);
+
+  // Discard the predicted path and predict onwards from the new PC
+  targetQueue_.clear();
+  targetPc_ = address;
+
+  if (microOpCacheSets_ > 0) {
+    // The line being filled ends at the redirect
+    insertMicroOpCacheLine();
+    microOpCacheRedirected_ = true;
+    microOpCacheStall_ = 0;
+  }
 }
 
 void FetchUnit::requestFromPC() {
+  if (targetQueueSize_ > 0) {
+    // Predict the block following the last queued, unless the predicted path
+    // has left the instruction memory region
+    if (targetQueue_.size() < targetQueueSize_ &&
+        targetPc_ < programByteLength_) {
+      uint64_t block = targetPc_ & blockMask_;
+      targetQueue_.push_back({targetPc_});
+
+      // Follow a taken branch recorded at or after the entry point, otherwise
+      // continue to the next sequential block
+      auto entry = findTarget(block);
+      if (entry != nullptr && entry->branchOffset >= targetPc_ - block) {
+        entry->lastUsed = ticks_;
+        targetPc_ = entry->target;
+      } else {
+        targetPc_ = block + blockSize_;
+      }
+    }
+
+    // Request all queued blocks not yet requested
+    for (auto& target : targetQueue_) {
+      if (!target.requested) {
+        instructionMemory_.requestRead(
+            {target.address & blockMask_, blockSize_});
+        target.requested = true;
+      }
+    }
+    return;
+  }
+
   // Do nothing if buffer already contains enough data
   if (bufferedBytes_ >= isa_.getMaxInstructionSize()) return;
 
@@ -220,6 +305,12 @@ void FetchUnit::requestFromPC() {
   // beyond the programByteLength_
   if (hasHalted_) return;
 
+  // Do nothing if the micro-op cache will supply the instructions at the PC
+  size_t index;
+  if (microOpCacheSets_ > 0 && findMicroOpCacheLine(pc_, index) != nullptr) {
+    return;
+  }
+
   uint64_t blockAddress;
   if (bufferedBytes_ > 0) {
     // There's already some data in the buffer, so fetch the next block
@@ -235,11 +326,264 @@ void FetchUnit::requestFromPC() {
 
 uint64_t FetchUnit::getBranchStalls() const { return branchStalls_; }
 
+uint64_t FetchUnit::getTargetQueueResteers() const {
+  return targetQueueResteers_;
+}
+
+uint64_t FetchUnit::getMicroOpCacheHits() const { return microOpCacheHits_; }
+
+uint64_t FetchUnit::getMicroOpCacheMisses() const {
+  return microOpCacheMisses_;
+}
+
+uint64_t FetchUnit::getMicroOpCacheSwitches() const {
+  return microOpCacheSwitches_;
+}
+
 void FetchUnit::flushLoopBuffer() {
   loopBuffer_.clear();
+  loopBufferCursor_ = 0;
   loopBufferState_ = LoopBufferState::IDLE;
   loopBoundaryAddress_ = 0;
 }
 
+void FetchUnit::supplyTargets() {
+  const auto& fetched = instructionMemory_.getCompletedReads();
+  for (const auto& read : fetched) {
+    for (auto& target : targetQueue_) {
+      if (target.requested && !target.ready &&
+          (target.address & blockMask_) == read.target.address) {
+        target.data = read.data;
+        target.ready = true;
+      }
+    }
+  }
+  // Reads not matching a queued block belong to a discarded path
+  instructionMemory_.clearCompletedReads();
+}
+
+FetchTargetBufferEntry* FetchUnit::findTarget(uint64_t block) {
+  size_t sets = targetBuffer_.size() / targetBufferWays_;
+  size_t set = (block / blockSize_) % sets;
+  for (size_t way = 0; way < targetBufferWays_; way++) {
+    auto& entry = targetBuffer_[set * targetBufferWays_ + way];
+    if (entry.valid && entry.block == block) return &entry;
+  }
+  return nullptr;
+}
+
+void FetchUnit::trainTarget(uint64_t address, bool taken, uint64_t target) {
+  uint64_t block = address & blockMask_;
+  uint16_t offset = address - block;
+  auto entry = findTarget(block);
+
+  if (!taken) {
+    // Forget a branch which is no longer predicted taken
+    if (entry != nullptr && entry->branchOffset == offset) entry->valid = false;
+    return;
+  }
+
+  if (entry == nullptr) {
+    // Replace the least recently used entry in the block's set
+    size_t sets = targetBuffer_.size() / targetBufferWays_;
+    size_t set = (block / blockSize_) % sets;
+    entry = &targetBuffer_[set * targetBufferWays_];
+    for (size_t way = 0; way < targetBufferWays_; way++) {
+      auto& candidate = targetBuffer_[set * targetBufferWays_ + way];
+      if (!candidate.valid) {
+        entry = &candidate;
+        break;
+      }
+      if (candidate.lastUsed < entry->lastUsed) entry = &candidate;
+    }
+  }
+  *entry = {true, block, offset, target, ticks_};
+}
+
+bool FetchUnit::trackLoopBuffer(const MacroOp& macroOp) {
+  if (loopBufferState_ == LoopBufferState::FILLING) {
+    // Record the pre-decoded macro-op in the loop body, before it is modified
+    // by later pipeline stages
+    loopBuffer_.emplace_back(macroOp.size());
+    for (size_t uop = 0; uop < macroOp.size(); uop++) {
+      loopBuffer_.back()[uop] = macroOp[uop]->clone();
+    }
+
+    if (pc_ == loopBoundaryAddress_) {
+      // loopBoundaryAddress_ has been fetched whilst filling the loop buffer.
+      // Stop filling as loop body has been recorded and begin to supply
+      // decode unit with instructions from the loop buffer
+      loopBufferState_ = LoopBufferState::SUPPLYING;
+      loopBufferCursor_ = 0;
+      return true;
+    }
+  } else if (loopBufferState_ == LoopBufferState::WAITING &&
+             pc_ == loopBoundaryAddress_) {
+    // Once set loopBoundaryAddress_ is fetched, start to fill loop buffer
+    loopBufferState_ = LoopBufferState::FILLING;
+  }
+  return false;
+}
+
+bool FetchUnit::supplyFromMicroOpCache() {
+  if (microOpCacheStall_ > 0) {
+    microOpCacheStall_--;
+    return true;
+  }
+
+  size_t index;
+  MicroOpCacheLine* line = findMicroOpCacheLine(pc_, index);
+  bool hit = (line != nullptr);
+  if (hit != supplyingFromMicroOpCache_) {
+    supplyingFromMicroOpCache_ = hit;
+    microOpCacheSwitches_++;
+    if (microOpCacheSwitchPenalty_ > 0) {
+      // The penalty is charged in place of any hit latency
+      microOpCacheStall_ = microOpCacheSwitchPenalty_ - 1;
+      microOpCacheRedirected_ = false;
+      return true;
+    }
+  }
+  if (!hit) return false;
+
+  if (microOpCacheRedirected_) {
+    microOpCacheRedirected_ = false;
+    if (microOpCacheHitLatency_ > 1) {
+      microOpCacheStall_ = microOpCacheHitLatency_ - 2;
+      return true;
+    }
+  }
+
+  auto outputSlots = output_.getTailSlots();
+  for (size_t slot = 0; slot < output_.getWidth() && line != nullptr;
+       slot++) {
+    line->lastUsed = ticks_;
+    const auto& entry = line->entries[index];
+
+    // Create fresh instances of the cached macro-op
+    auto& macroOp = outputSlots[slot];
+    macroOp.resize(entry.macroOp.size());
+    for (size_t uop = 0; uop < entry.macroOp.size(); uop++) {
+      macroOp[uop] = entry.macroOp[uop]->clone();
+    }
+    microOpCacheHits_++;
+
+    BranchPrediction prediction = {false, 0};
+    if (macroOp[0]->isBranch()) {
+      prediction = branchPredictor_.predict(pc_, macroOp[0]->getBranchType(),
+                                            macroOp[0]->getKnownTarget());
+      macroOp[0]->setBranchPrediction(prediction);
+      if (targetQueueSize_ > 0) {
+        trainTarget(pc_, prediction.taken, prediction.target);
+      }
+    }
+
+    if (trackLoopBuffer(macroOp)) break;
+
+    uint64_t block = pc_ & blockMask_;
+    pc_ = prediction.taken ? prediction.target : pc_ + entry.size;
+
+    // Consume the queued fetch block once fetch leaves it
+    if (targetQueueSize_ > 0 && !targetQueue_.empty() &&
+        (targetQueue_.front().address & blockMask_) == block &&
+        (prediction.taken || (pc_ & blockMask_) != block)) {
+      targetQueue_.pop_front();
+    }
+
+    if (pc_ >= programByteLength_) {
+      hasHalted_ = true;
+      break;
+    }
+
+    if (prediction.taken) {
+      if (slot + 1 < output_.getWidth()) {
+        branchStalls_++;
+      }
+      microOpCacheRedirected_ = true;
+      break;
+    }
+
+    // Continue from the following macro-op, which may be held in another line
+    line = findMicroOpCacheLine(pc_, index);
+  }
+
+  // Any fetched instruction data is no longer required
+  bufferedBytes_ = 0;
+  if (targetQueueSize_ == 0) instructionMemory_.clearCompletedReads();
+  return true;
+}
+
+MicroOpCacheLine* FetchUnit::findMicroOpCacheLine(uint64_t address,
+                                                  size_t& index) {
+  uint64_t block = address & blockMask_;
+  size_t set = (block / blockSize_) % microOpCacheSets_;
+  for (size_t way = 0; way < microOpCacheWays_; way++) {
+    auto& line = microOpCache_[set * microOpCacheWays_ + way];
+    if (!line.valid || line.block != block) continue;
+    for (index = 0; index < line.entries.size(); index++) {
+      if (line.entries[index].address == address) return &line;
+    }
+  }
+  return nullptr;
+}
+
+void FetchUnit::fillMicroOpCache(const MacroOp& macroOp, uint8_t size,
+                                 bool taken) {
+  microOpCacheMisses_++;
+  uint64_t block = pc_ & blockMask_;
+
+  // End the line being filled if this macro-op cannot extend it
+  if (microOpCacheFill_.valid) {
+    const auto& last = microOpCacheFill_.entries.back();
+    if (microOpCacheFill_.block != block || last.address + last.size != pc_ ||
+        microOpCacheFill_.uops + macroOp.size() > microOpCacheLineUops_) {
+      insertMicroOpCacheLine();
+    }
+  }
+  if (macroOp.size() > microOpCacheLineUops_) return;
+
+  if (!microOpCacheFill_.valid) {
+    microOpCacheFill_.valid = true;
+    microOpCacheFill_.block = block;
+  }
+
+  // Record the pre-decoded macro-op, before it is modified by later pipeline
+  // stages
+  MicroOpCacheEntry entry = {pc_, size, MacroOp(macroOp.size())};
+  for (size_t uop = 0; uop < macroOp.size(); uop++) {
+    entry.macroOp[uop] = macroOp[uop]->clone();
+  }
+  microOpCacheFill_.entries.push_back(std::move(entry));
+  microOpCacheFill_.uops += macroOp.size();
+
+  // A line ends at a predicted taken branch
+  if (taken) insertMicroOpCacheLine();
+}
+
+void FetchUnit::insertMicroOpCacheLine() {
+  if (!microOpCacheFill_.valid) return;
+
+  uint64_t start = microOpCacheFill_.entries.front().address;
+  size_t set = (microOpCacheFill_.block / blockSize_) % microOpCacheSets_;
+  MicroOpCacheLine* line = nullptr;
+  for (size_t way = 0; way < microOpCacheWays_; way++) {
+    auto& candidate = microOpCache_[set * microOpCacheWays_ + way];
+    if (candidate.valid && candidate.block == microOpCacheFill_.block &&
+        candidate.entries.front().address == start) {
+      // Replace the line starting at the same address
+      line = &candidate;
+      break;
+    }
+    if (line == nullptr || !candidate.valid ||
+        (line->valid && candidate.lastUsed < line->lastUsed)) {
+      line = &candidate;
+    }
+  }
+
+  *line = std::move(microOpCacheFill_);
+  line->lastUsed = ticks_;
+  microOpCacheFill_ = {};
+}
+
 }  // namespace pipeline
 }  // namespace simeng
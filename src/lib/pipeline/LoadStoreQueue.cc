@@ -15,9 +15,38 @@ bool requestsOverlap(MemoryAccessTarget a, MemoryAccessTarget b) {
   return !(a.address + a.size <= b.address || b.address + b.size <= a.address);
 }
 
+namespace {
+
+/** The number of low-order bits of a load's read request ID which hold the
+ * index of the access within the load's generated addresses; the remaining
+ * bits hold the load's sequence ID. Reads still in flight while an exception
+ * is handled belong to flushed loads younger than the excepting instruction,
+ * so their request IDs always exceed the sequence ID identifying the
+ * exception handler's own reads. */
+constexpr unsigned int REQUEST_INDEX_BITS = 16;
+
+/** Build the read request ID of the access at `index` of the load with
+ * sequence ID `sequenceId`. */
+uint64_t getRequestId(uint64_t sequenceId, uint16_t index) {
+  return (sequenceId << REQUEST_INDEX_BITS) | index;
+}
+
+/** Retrieve the sequence ID of the load which made the read `requestId`. */
+uint64_t getRequestSequenceId(uint64_t requestId) {
+  return requestId >> REQUEST_INDEX_BITS;
+}
+
+/** Retrieve the index of the access read by `requestId` within the load's
+ * generated addresses. */
+uint16_t getRequestIndex(uint64_t requestId) {
+  return static_cast<uint16_t>(requestId);
+}
+
+}  // namespace
+
 LoadStoreQueue::LoadStoreQueue(
     unsigned int maxCombinedSpace, MemoryInterface& memory,
-    span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots,
+    span<PipelineBuffer<std::shared_ptr<Instruction>, 1>> completionSlots,
     std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
     bool exclusive, uint16_t loadBandwidth, uint16_t storeBandwidth,
     uint16_t permittedRequests, uint16_t permittedLoads,
@@ -37,7 +66,7 @@ LoadStoreQueue::LoadStoreQueue(
 LoadStoreQueue::LoadStoreQueue(
     unsigned int maxLoadQueueSpace, unsigned int maxStoreQueueSpace,
     MemoryInterface& memory,
-    span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots,
+    span<PipelineBuffer<std::shared_ptr<Instruction>, 1>> completionSlots,
     std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
     bool exclusive, uint16_t loadBandwidth, uint16_t storeBandwidth,
     uint16_t permittedRequests, uint16_t permittedLoads,
@@ -104,11 +133,14 @@ void LoadStoreQueue::startLoad(const std::shared_ptr<Instruction>& insn) {
     // Create a speculative entry for the load
     requestLoadQueue_[tickCounter_ + insn->getLSQLatency()].push_back(
         {{}, insn});
-    // Store load addresses in vector temporarily so that conflictions are
-    // only regsitered once on most recent (program order) store
-    std::vector<simeng::MemoryAccessTarget> temp_load_addr;
-    for (const auto& ld : ld_addresses) {
-      temp_load_addr.push_back(ld);
+    // Store the indices of load addresses in vector temporarily so that
+    // conflictions are only regsitered once on most recent (program order)
+    // store
+    assert(ld_addresses.size() <= (1 << REQUEST_INDEX_BITS) &&
+           "Load accesses more addresses than its request IDs can index");
+    std::vector<uint16_t> temp_load_addr(ld_addresses.size());
+    for (size_t i = 0; i < ld_addresses.size(); i++) {
+      temp_load_addr[i] = i;
     }
     // Detect reordering conflicts
     if (storeQueue_.size() > 0) {
@@ -125,18 +157,19 @@ void LoadStoreQueue::startLoad(const std::shared_ptr<Instruction>& insn) {
             while (itLd != temp_load_addr.end()) {
               // If conflict exists, register in conflictionMap_ and delay
               // load request(s) until conflicting store retires
-              if (itLd->address == str.address) {
+              const auto& ld = ld_addresses[*itLd];
+              if (ld.address == str.address) {
                 // Load access size must be no larger than the store access size
                 // to ensure all data is encapsulated in the later forwarding
-                if (itLd->size <= str.size) {
+                if (ld.size <= str.size) {
                   conflictionMap_[store->getSequenceId()][str.address]
-                      .push_back({insn, itLd->size});
+                      .push_back({insn, *itLd, ld.size});
                 } else {
                   // To ensure load doesn't match on an earlier store, generate
                   // load request for address
                   requestLoadQueue_[tickCounter_ + insn->getLSQLatency()]
                       .back()
-                      .reqAddresses.push(*itLd);
+                      .reqAddresses.push({ld, *itLd});
                 }
                 // Remove from temporary vector so the confliction can't be
                 // registered again
@@ -155,7 +188,8 @@ void LoadStoreQueue::startLoad(const std::shared_ptr<Instruction>& insn) {
       for (size_t i = 0; i < temp_load_addr.size(); i++) {
         requestLoadQueue_[tickCounter_ + insn->getLSQLatency()]
             .back()
-            .reqAddresses.push(temp_load_addr[i]);
+            .reqAddresses.push(
+                {ld_addresses[temp_load_addr[i]], temp_load_addr[i]});
       }
     }
     // Register active load
@@ -214,7 +248,7 @@ bool LoadStoreQueue::commitStore(const std::shared_ptr<Instruction>& uop) {
     // correctly simulated
     requestStoreQueue_[tickCounter_ + uop->getLSQLatency()]
         .back()
-        .reqAddresses.push(addresses[i]);
+        .reqAddresses.push({addresses[i], i});
   }
 
   // Check all loads that have requested memory
@@ -247,12 +281,12 @@ bool LoadStoreQueue::commitStore(const std::shared_ptr<Instruction>& uop) {
     for (size_t i = 0; i < addresses.size(); i++) {
       const auto& itAddr = itSt->second.find(addresses[i].address);
       if (itAddr != itSt->second.end()) {
-        for (const auto& pair : itAddr->second) {
-          const auto& load = pair.first;
-          load->supplyData(addresses[i].address,
-                           data[i].zeroExtend(
-                               std::min(pair.second, (uint16_t)data[i].size()),
-                               pair.second));
+        for (const auto& entry : itAddr->second) {
+          const auto& load = entry.load;
+          load->supplyData(
+              entry.index,
+              data[i].zeroExtend(std::min(entry.size, (uint16_t)data[i].size()),
+                                 entry.size));
           if (load->hasAllData()) {
             // This load has completed
             load->execute();
@@ -325,12 +359,12 @@ void LoadStoreQueue::purgeFlushed() {
     for (auto itAddr = itCnflct->second.begin();
          itAddr != itCnflct->second.end(); itAddr++) {
       // Iterate over vector of instructions conflicting with store address
-      auto pair = itAddr->second.begin();
-      while (pair != itAddr->second.end()) {
-        if (pair->first->isFlushed()) {
-          pair = itAddr->second.erase(pair);
+      auto entry = itAddr->second.begin();
+      while (entry != itAddr->second.end()) {
+        if (entry->load->isFlushed()) {
+          entry = itAddr->second.erase(entry);
         } else {
-          pair++;
+          entry++;
         }
       }
     }
@@ -446,7 +480,7 @@ void LoadStoreQueue::tick() {
           // request[Load|Store]Queue_ entry
           auto& addressQueue = itInsn->reqAddresses;
           while (addressQueue.size()) {
-            const simeng::MemoryAccessTarget req = addressQueue.front();
+            const simeng::MemoryAccessTarget req = addressQueue.front().first;
 
             // Ensure the limit on the data transfered per cycle is adhered to
             assert(req.size <= bandwidth &&
@@ -463,7 +497,9 @@ void LoadStoreQueue::tick() {
             // Request a read from the memory interface if the requestQueue_
             // entry represents a read
             if (!isStore) {
-              memory_.requestRead(req, itInsn->insn->getSequenceId());
+              memory_.requestRead(
+                  req, getRequestId(itInsn->insn->getSequenceId(),
+                                    addressQueue.front().second));
             }
 
             // Remove processed address from queue
@@ -492,21 +528,35 @@ void LoadStoreQueue::tick() {
   }
 
   // Process completed read requests
-  for (const auto& response : memory_.getCompletedReads()) {
-    const auto& address = response.target.address;
-    const auto& data = response.data;
+  const auto& completedReads = memory_.getCompletedReads();
+  size_t response = 0;
+  while (response < completedReads.size()) {
+    const uint64_t seqId =
+        getRequestSequenceId(completedReads[response].requestId);
+    const uint16_t firstIndex =
+        getRequestIndex(completedReads[response].requestId);
 
     // TODO: Detect and handle non-fatal faults (e.g. page fault)
 
-    // Find instruction that requested the memory read
-    const auto& itr = requestedLoads_.find(response.requestId);
+    // Gather the data of the run of reads to consecutive accesses of the same
+    // load, so that it can be supplied as one block
+    readData_.clear();
+    while (response < completedReads.size() &&
+           completedReads[response].requestId ==
+               getRequestId(seqId, firstIndex + readData_.size())) {
+      readData_.push_back(completedReads[response].data);
+      response++;
+    }
+
+    // Find instruction that requested the memory reads
+    const auto& itr = requestedLoads_.find(seqId);
     if (itr == requestedLoads_.end()) {
       continue;
     }
 
     // Supply data to the instruction and execute if it is ready
     const auto& load = itr->second;
-    load->supplyData(address, data);
+    load->supplyDataBlock(firstIndex, {readData_.data(), readData_.size()});
     if (load->hasAllData()) {
       // This load has completed
       load->execute();
@@ -1,5 +1,6 @@
 #include "simeng/pipeline/RegisterAliasTable.hh"
 
+#include <algorithm>
 #include <cassert>
 
 namespace simeng {
@@ -7,11 +8,17 @@ namespace pipeline {
 
 RegisterAliasTable::RegisterAliasTable(
     std::vector<RegisterFileStructure> architecturalStructure,
-    std::vector<uint16_t> physicalRegisterCounts)
+    std::vector<uint16_t> physicalRegisterCounts, uint16_t checkpointCount,
+    bool eliminateMoves)
     : mappingTable_(architecturalStructure.size()),
       historyTable_(architecturalStructure.size()),
       destinationTable_(architecturalStructure.size()),
-      freeQueues_(architecturalStructure.size()) {
+      referenceCounts_(architecturalStructure.size()),
+      zeroRegisters_(architecturalStructure.size()),
+      freeLists_(architecturalStructure.size()),
+      freeCounts_(architecturalStructure.size(), 0),
+      freeCursors_(architecturalStructure.size(), 0),
+      checkpoints_(checkpointCount) {
   assert(architecturalStructure.size() == physicalRegisterCounts.size() &&
          "The number of physical register types does not match the number of "
          "architectural register types");
@@ -30,15 +37,40 @@ RegisterAliasTable::RegisterAliasTable(
       mappingTable_[type][tag] = tag;
     }
 
-    // Add remaining physical registers to free queue
-    for (size_t tag = archCount; tag < physCount; tag++) {
-      freeQueues_[type].push(tag);
+    // Each pre-assigned physical register is referenced by its architectural
+    // register
+    referenceCounts_[type].assign(physCount, 0);
+    std::fill_n(referenceCounts_[type].begin(), archCount, 1);
+
+    // Reserve the last physical register to hold zero if eliminating, provided
+    // at least one register remains for renaming. It is never allocated, so
+    // its reference count never falls to zero.
+    zeroRegisters_[type] = physCount;
+    if (eliminateMoves && physCount > archCount + 1) {
+      zeroRegisters_[type] = physCount - 1;
+      referenceCounts_[type][physCount - 1] = 1;
+    }
+
+    // Add remaining physical registers to free list
+    freeLists_[type].resize((physCount + 63) / 64, 0);
+    for (size_t tag = archCount; tag < zeroRegisters_[type]; tag++) {
+      pushFree(type, tag);
     }
+    freeCursors_[type] = (archCount < physCount) ? archCount : 0;
 
     // Set up history/destination tables
     historyTable_[type].resize(physCount);
     destinationTable_[type].resize(physCount);
   }
+
+  // Pre-size checkpoint storage so taking a checkpoint never allocates
+  for (auto& checkpoint : checkpoints_) {
+    checkpoint.mappingTable = mappingTable_;
+    checkpoint.allocatedSince.resize(freeLists_.size());
+    for (size_t type = 0; type < freeLists_.size(); type++) {
+      checkpoint.allocatedSince[type].resize(freeLists_[type].size(), 0);
+    }
+  }
 };
 
 Register RegisterAliasTable::getMapping(Register architectural) const {
@@ -55,7 +87,7 @@ Register RegisterAliasTable::getMapping(Register architectural) const {
 
 bool RegisterAliasTable::canAllocate(uint8_t type,
                                      unsigned int quantity) const {
-  return (freeQueues_[type].size() >= quantity);
+  return (freeCounts_[type] >= quantity);
 }
 
 bool RegisterAliasTable::canRename(uint8_t type) const {
@@ -64,34 +96,55 @@ bool RegisterAliasTable::canRename(uint8_t type) const {
 }
 
 unsigned int RegisterAliasTable::freeRegistersAvailable(uint8_t type) const {
-  return freeQueues_[type].size();
+  return freeCounts_[type];
 }
 
 Register RegisterAliasTable::allocate(Register architectural) {
-  std::queue<uint16_t>& freeQueue = freeQueues_[architectural.type];
-  assert(freeQueue.size() > 0 &&
+  auto type = architectural.type;
+  std::vector<uint64_t>& freeList = freeLists_[type];
+  assert(freeCounts_[type] > 0 &&
          "Attempted to allocate free register when none were available");
 
-  auto tag = freeQueue.front();
-  freeQueue.pop();
+  // Search for the first free register at or after the cursor, wrapping around
+  // to the start of the list
+  size_t words = freeList.size();
+  size_t word = freeCursors_[type] / 64;
+  uint64_t bits = freeList[word] & (~0ull << (freeCursors_[type] % 64));
+  for (size_t i = 0; bits == 0 && i < words; i++) {
+    word = (word + 1) % words;
+    bits = freeList[word];
+  }
+  assert(bits != 0 && "Free register count does not match free list");
+
+  uint16_t tag = word * 64 + __builtin_ctzll(bits);
+  freeList[word] &= ~(1ull << (tag % 64));
+  freeCounts_[type]--;
+  referenceCounts_[type][tag] = 1;
+  freeCursors_[type] = (tag + 1) % destinationTable_[type].size();
+
+  // Record the allocation against every active checkpoint
+  for (size_t i = 0; i < checkpointsActive_; i++) {
+    auto& checkpoint =
+        checkpoints_[(checkpointHead_ + i) % checkpoints_.size()];
+    checkpoint.allocatedSince[type][word] |= (1ull << (tag % 64));
+  }
 
   // Keep the old physical register in the history table
-  historyTable_[architectural.type][tag] =
-      mappingTable_[architectural.type][architectural.tag];
+  historyTable_[type][tag] = mappingTable_[type][architectural.tag];
 
   // Update the mapping table with the new tag, and mark the architectural
   // register it replaces in the destination table
-  mappingTable_[architectural.type][architectural.tag] = tag;
-  destinationTable_[architectural.type][tag] = architectural.tag;
+  mappingTable_[type][architectural.tag] = tag;
+  destinationTable_[type][tag] = architectural.tag;
 
-  return {architectural.type, tag};
+  return {type, tag};
 }
 
 void RegisterAliasTable::commit(Register physical) {
   // Find the register previously mapped to the same architectural register and
   // free it
   auto oldTag = historyTable_[physical.type][physical.tag];
-  freeQueues_[physical.type].push(oldTag);
+  release(physical.type, oldTag);
 }
 void RegisterAliasTable::rewind(Register physical) {
   // Find which architectural tag this referred to
@@ -99,11 +152,147 @@ void RegisterAliasTable::rewind(Register physical) {
   // Rewind the mapping table to the old physical tag
   mappingTable_[physical.type][destinationTag] =
       historyTable_[physical.type][physical.tag];
-  // Add the rewound physical tag back to the free queue
-  freeQueues_[physical.type].push(physical.tag);
+  // Add the rewound physical tag back to the free list
+  release(physical.type, physical.tag);
 }
 void RegisterAliasTable::free(Register physical) {
-  freeQueues_[physical.type].push(physical.tag);
+  referenceCounts_[physical.type][physical.tag] = 0;
+  pushFree(physical.type, physical.tag);
+}
+
+bool RegisterAliasTable::canEliminate(uint8_t type) const {
+  return zeroRegisters_[type] < destinationTable_[type].size();
+}
+
+Register RegisterAliasTable::getZeroRegister(uint8_t type) const {
+  assert(canEliminate(type) && "No zero register reserved for register type");
+  return {type, zeroRegisters_[type]};
+}
+
+void RegisterAliasTable::eliminate(Register architectural, Register physical) {
+  auto type = architectural.type;
+  assert(canEliminate(type) &&
+         "Attempted to eliminate an instruction for an unsupported type");
+  auto& mapping = mappingTable_[type][architectural.tag];
+  eliminated_.push_back({type, architectural.tag, mapping, physical.tag});
+  eliminations_++;
+
+  referenceCounts_[type][physical.tag]++;
+  mapping = physical.tag;
+}
+
+void RegisterAliasTable::commitEliminated() {
+  assert(eliminated_.size() > 0 &&
+         "Attempted to commit an eliminated mapping when none were in flight");
+  const auto& entry = eliminated_.front();
+  release(entry.type, entry.previous);
+  eliminated_.pop_front();
+}
+
+void RegisterAliasTable::rewindEliminated() {
+  assert(eliminated_.size() > 0 &&
+         "Attempted to rewind an eliminated mapping when none were in flight");
+  const auto& entry = eliminated_.back();
+  mappingTable_[entry.type][entry.architectural] = entry.previous;
+  release(entry.type, entry.current);
+  eliminated_.pop_back();
+  eliminations_--;
+}
+
+bool RegisterAliasTable::isShared(Register physical) const {
+  return referenceCounts_[physical.type][physical.tag] > 1 ||
+         physical.tag == zeroRegisters_[physical.type];
+}
+
+bool RegisterAliasTable::checkpointsEnabled() const {
+  return checkpoints_.size() > 0;
+}
+
+bool RegisterAliasTable::canCheckpoint() const {
+  return checkpointsActive_ < checkpoints_.size();
+}
+
+void RegisterAliasTable::checkpoint(uint64_t instructionId) {
+  assert(canCheckpoint() &&
+         "Attempted to take a rename checkpoint when none were available");
+  auto& checkpoint = checkpoints_[(checkpointHead_ + checkpointsActive_) %
+                                  checkpoints_.size()];
+  checkpointsActive_++;
+
+  checkpoint.instructionId = instructionId;
+  checkpoint.eliminations = eliminations_;
+  for (size_t type = 0; type < mappingTable_.size(); type++) {
+    checkpoint.mappingTable[type] = mappingTable_[type];
+    std::fill(checkpoint.allocatedSince[type].begin(),
+              checkpoint.allocatedSince[type].end(), 0);
+  }
+}
+
+bool RegisterAliasTable::restoreCheckpoint(uint64_t instructionId) {
+  // Discard checkpoints younger than the target, youngest first
+  while (checkpointsActive_ > 0) {
+    auto& checkpoint = checkpoints_[(checkpointHead_ + checkpointsActive_ - 1) %
+                                    checkpoints_.size()];
+    if (checkpoint.instructionId < instructionId) return false;
+    checkpointsActive_--;
+    if (checkpoint.instructionId > instructionId) continue;
+
+    // Drop the references held by mappings eliminated since the checkpoint
+    while (eliminations_ > checkpoint.eliminations) {
+      const auto& entry = eliminated_.back();
+      release(entry.type, entry.current);
+      eliminated_.pop_back();
+      eliminations_--;
+    }
+
+    // Any register allocated since the checkpoint was taken belongs to a
+    // flushed instruction; return them all to the free lists. Registers already
+    // freed by an individual rewind are unaffected.
+    for (size_t type = 0; type < mappingTable_.size(); type++) {
+      unsigned int count = 0;
+      for (size_t word = 0; word < freeLists_[type].size(); word++) {
+        uint64_t bits = checkpoint.allocatedSince[type][word];
+        freeLists_[type][word] |= bits;
+        count += __builtin_popcountll(freeLists_[type][word]);
+        for (; bits != 0; bits &= bits - 1) {
+          referenceCounts_[type][word * 64 + __builtin_ctzll(bits)] = 0;
+        }
+      }
+      freeCounts_[type] = count;
+      mappingTable_[type] = checkpoint.mappingTable[type];
+    }
+    return true;
+  }
+  return false;
+}
+
+void RegisterAliasTable::releaseCheckpoints(uint64_t instructionId) {
+  while (checkpointsActive_ > 0 &&
+         checkpoints_[checkpointHead_].instructionId <= instructionId) {
+    checkpointHead_ = (checkpointHead_ + 1) % checkpoints_.size();
+    checkpointsActive_--;
+  }
+}
+
+unsigned int RegisterAliasTable::getCheckpointCount() const {
+  return checkpointsActive_;
+}
+
+void RegisterAliasTable::pushFree(uint8_t type, uint16_t tag) {
+  // Freeing is idempotent
+  uint64_t mask = 1ull << (tag % 64);
+  if (freeLists_[type][tag / 64] & mask) return;
+  freeLists_[type][tag / 64] |= mask;
+  freeCounts_[type]++;
+}
+
+void RegisterAliasTable::release(uint8_t type, uint16_t tag) {
+  // Registers of types which cannot be renamed are still committed, and may be
+  // released more than once
+  auto& count = referenceCounts_[type][tag];
+  if (count == 0) return;
+  count--;
+  if (count == 0) pushFree(type, tag);
 }
 
 }  // namespace pipeline
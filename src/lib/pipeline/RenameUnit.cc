@@ -49,6 +49,27 @@ void RenameUnit::tick() {
       continue;
     }
 
+    // Register moves and zero idioms need not execute; rename their
+    // destination onto an existing physical register and complete them
+    // immediately, without occupying a pipeline slot
+    if (canEliminate(*uop)) {
+      const auto& destination = uop->getDestinationRegisters()[0];
+      if (uop->isZeroIdiom()) {
+        rat_.eliminate(destination, rat_.getZeroRegister(destination.type));
+        zeroIdioms_++;
+      } else {
+        const auto& source =
+            uop->getOperandRegisters()[uop->getMoveSourceIndex()];
+        rat_.eliminate(destination, rat_.getMapping(source));
+        movesEliminated_++;
+      }
+      reorderBuffer_.reserve(uop);
+      uop->setEliminated();
+      uop->setCommitReady();
+      input_.getHeadSlots()[slot] = nullptr;
+      continue;
+    }
+
     // If it's a memory op, make sure there's space in the respective queue
     bool isLoad = uop->isLoad();
     bool isStore = uop->isStoreAddress();
@@ -66,25 +87,41 @@ void RenameUnit::tick() {
       }
     }
 
+    // A fused tail is renamed alongside this uop, and shares its ROB entry
+    auto tail = uop->getFusedTail();
+    const auto& last = (tail != nullptr) ? tail : uop;
+
+    // Branches which may be mispredicted require a rename checkpoint, taken
+    // once all of the instruction's micro-ops have been renamed
+    bool needsCheckpoint = rat_.checkpointsEnabled() && last->isBranch() &&
+                           last->isLastMicroOp();
+    if (needsCheckpoint && !rat_.canCheckpoint()) {
+      checkpointStalls_++;
+      input_.stall(true);
+      return;
+    }
+
     bool serialize = false;
 
-    auto& destinationRegisters = uop->getDestinationRegisters();
     // Count the number of each type of destination registers needed, and ensure
     // enough free registers exist to allocate them.
-    for (const auto& reg : destinationRegisters) {
-      // Check whether renaming is allowed, otherwise we need to serialize
-      if (!rat_.canRename(reg.type)) {
-        serialize = true;
-        continue;
+    for (const auto* insn : {uop.get(), tail.get()}) {
+      if (insn == nullptr) continue;
+      for (const auto& reg : insn->getDestinationRegisters()) {
+        // Check whether renaming is allowed, otherwise we need to serialize
+        if (!rat_.canRename(reg.type)) {
+          serialize = true;
+          continue;
+        }
+
+        if (freeRegistersAvailable_[reg.type] == 0) {
+          // Not enough free registers available for this uop
+          input_.stall(true);
+          allocationStalls_++;
+          return;
+        }
+        freeRegistersAvailable_[reg.type]--;
       }
-
-      if (freeRegistersAvailable_[reg.type] == 0) {
-        // Not enough free registers available for this uop
-        input_.stall(true);
-        allocationStalls_++;
-        return;
-      }
-      freeRegistersAvailable_[reg.type]--;
     }
 
     if (serialize) {
@@ -95,25 +132,37 @@ void RenameUnit::tick() {
       }
     }
 
-    // Allocate source registers
-    auto& sourceRegisters = uop->getOperandRegisters();
-    for (size_t i = 0; i < sourceRegisters.size(); i++) {
-      const auto& reg = sourceRegisters[i];
-      if (!uop->isOperandReady(i)) {
-        uop->renameSource(i, rat_.getMapping(reg));
+    // Rename this uop and then any fused tail, so that the tail reads the
+    // registers allocated to this uop
+    for (auto* insn : {uop.get(), tail.get()}) {
+      if (insn == nullptr) continue;
+
+      // Allocate source registers
+      auto& sourceRegisters = insn->getOperandRegisters();
+      for (size_t i = 0; i < sourceRegisters.size(); i++) {
+        const auto& reg = sourceRegisters[i];
+        if (!insn->isOperandReady(i)) {
+          insn->renameSource(i, rat_.getMapping(reg));
+        }
       }
-    }
 
-    // Allocate destination registers
-    for (size_t i = 0; i < destinationRegisters.size(); i++) {
-      const auto& reg = destinationRegisters[i];
-      if (rat_.canRename(reg.type)) {
-        uop->renameDestination(i, rat_.allocate(reg));
+      // Allocate destination registers
+      auto& destinationRegisters = insn->getDestinationRegisters();
+      for (size_t i = 0; i < destinationRegisters.size(); i++) {
+        const auto& reg = destinationRegisters[i];
+        if (rat_.canRename(reg.type)) {
+          insn->renameDestination(i, rat_.allocate(reg));
+        }
       }
     }
 
     // Reserve a slot in the ROB for this uop
     reorderBuffer_.reserve(uop);
+    if (tail != nullptr) reorderBuffer_.reserve(tail);
+
+    if (needsCheckpoint) {
+      rat_.checkpoint(last->getInstructionId());
+    }
 
     // Add to the load/store queue if appropriate
     if (isLoad) {
@@ -127,11 +176,33 @@ void RenameUnit::tick() {
   }
 }
 
+bool RenameUnit::canEliminate(const Instruction& uop) const {
+  // A uop with a fused tail must execute to supply the tail's operands
+  if (uop.isMicroOp() || uop.getFusedTail() != nullptr ||
+      !(uop.isRegisterMove() || uop.isZeroIdiom())) {
+    return false;
+  }
+  const auto& destinations = uop.getDestinationRegisters();
+  if (destinations.size() != 1 || !rat_.canEliminate(destinations[0].type)) {
+    return false;
+  }
+  if (uop.isZeroIdiom()) return true;
+  // Moves can only share a register between registers of the same type
+  const auto& source = uop.getOperandRegisters()[uop.getMoveSourceIndex()];
+  return !uop.isOperandReady(uop.getMoveSourceIndex()) &&
+         source.type == destinations[0].type;
+}
+
 uint64_t RenameUnit::getAllocationStalls() const { return allocationStalls_; }
 uint64_t RenameUnit::getROBStalls() const { return robStalls_; }
 
 uint64_t RenameUnit::getLoadQueueStalls() const { return lqStalls_; }
 uint64_t RenameUnit::getStoreQueueStalls() const { return sqStalls_; }
 
+uint64_t RenameUnit::getCheckpointStalls() const { return checkpointStalls_; }
+
+uint64_t RenameUnit::getMovesEliminated() const { return movesEliminated_; }
+uint64_t RenameUnit::getZeroIdioms() const { return zeroIdioms_; }
+
 }  // namespace pipeline
 }  // namespace simeng
@@ -12,7 +12,7 @@ ReorderBuffer::ReorderBuffer(
     std::function<void(const std::shared_ptr<Instruction>&)> raiseException,
     std::function<void(uint64_t branchAddress)> sendLoopBoundary,
     BranchPredictor& predictor, uint16_t loopBufSize,
-    uint16_t loopDetectionThreshold)
+    uint16_t loopDetectionThreshold, BranchTraceWriter* branchTrace)
     : rat_(rat),
       lsq_(lsq),
       maxSize_(maxSize),
@@ -20,11 +20,16 @@ ReorderBuffer::ReorderBuffer(
       sendLoopBoundary_(sendLoopBoundary),
       predictor_(predictor),
       loopBufSize_(loopBufSize),
-      loopDetectionThreshold_(loopDetectionThreshold) {}
+      loopDetectionThreshold_(loopDetectionThreshold),
+      branchTrace_(branchTrace) {}
 
 void ReorderBuffer::reserve(const std::shared_ptr<Instruction>& insn) {
-  assert(buffer_.size() < maxSize_ &&
-         "Attempted to reserve entry in reorder buffer when already full");
+  if (insn->isFusedTail()) {
+    fusedTails_++;
+  } else {
+    assert(buffer_.size() - fusedTails_ < maxSize_ &&
+           "Attempted to reserve entry in reorder buffer when already full");
+  }
   insn->setSequenceId(seqId_);
   seqId_++;
   insn->setInstructionId(insnId_);
@@ -81,6 +86,7 @@ unsigned int ReorderBuffer::commit(unsigned int maxCommitSize) {
     if (!uop->canCommit()) {
       break;
     }
+    if (uop->isFusedTail()) fusedTails_--;
 
     if (uop->isLastMicroOp()) instructionsCommitted_++;
 
@@ -90,9 +96,26 @@ unsigned int ReorderBuffer::commit(unsigned int maxCommitSize) {
       return n + 1;
     }
 
-    const auto& destinations = uop->getDestinationRegisters();
-    for (int i = 0; i < destinations.size(); i++) {
-      rat_.commit(destinations[i]);
+    if (uop->isEliminated()) {
+      rat_.commitEliminated();
+    } else {
+      const auto& destinations = uop->getDestinationRegisters();
+      for (int i = 0; i < destinations.size(); i++) {
+        rat_.commit(destinations[i]);
+      }
+    }
+
+    // A committed branch can no longer be mispredicted; release its rename
+    // checkpoint
+    if (uop->isBranch()) {
+      rat_.releaseCheckpoints(uop->getInstructionId());
+      if (branchTrace_ != nullptr) {
+        branchTrace_->record({instructionsCommitted_,
+                              uop->getInstructionAddress(),
+                              uop->getBranchType(), uop->wasBranchTaken(),
+                              uop->getBranchAddress(),
+                              uop->getKnownTarget()});
+      }
     }
 
     // If it's a memory op, commit the entry at the head of the respective queue
@@ -156,6 +179,11 @@ unsigned int ReorderBuffer::commit(unsigned int maxCommitSize) {
 }
 
 void ReorderBuffer::flush(uint64_t afterSeqId) {
+  // If the renaming state following the youngest surviving instruction was
+  // checkpointed, restore it in one step instead of rewinding each flushed
+  // destination register
+  bool restored = rat_.restoreCheckpoint(afterSeqId);
+
   // Iterate backwards from the tail of the queue to find and remove ops newer
   // than `afterSeqId`
   while (!buffer_.empty()) {
@@ -164,17 +192,23 @@ void ReorderBuffer::flush(uint64_t afterSeqId) {
       break;
     }
 
-    // To rewind destination registers in correct history order, rewinding of
-    // register renaming is done backwards
-    auto destinations = uop->getDestinationRegisters();
-    for (int i = destinations.size() - 1; i >= 0; i--) {
-      const auto& reg = destinations[i];
-      rat_.rewind(reg);
+    if (!restored && uop->isEliminated()) {
+      rat_.rewindEliminated();
+    } else if (!restored) {
+      // To rewind destination registers in correct history order, rewinding of
+      // register renaming is done backwards
+      auto destinations = uop->getDestinationRegisters();
+      for (int i = destinations.size() - 1; i >= 0; i--) {
+        const auto& reg = destinations[i];
+        rat_.rewind(reg);
+      }
     }
     uop->setFlushed();
-    // If the instruction is a branch, supply address to branch flushing logic
+    if (uop->isFusedTail()) fusedTails_--;
+    // If the instruction is a branch, supply it to branch flushing logic
     if (uop->isBranch()) {
-      predictor_.flush(uop->getInstructionAddress());
+      predictor_.flush(uop->getInstructionAddress(), uop->getBranchType(),
+                       uop->getBranchPrediction());
     }
     buffer_.pop_back();
   }
@@ -187,7 +221,7 @@ void ReorderBuffer::flush(uint64_t afterSeqId) {
 unsigned int ReorderBuffer::size() const { return buffer_.size(); }
 
 unsigned int ReorderBuffer::getFreeSpace() const {
-  return maxSize_ - buffer_.size();
+  return maxSize_ - (buffer_.size() - fusedTails_);
 }
 
 bool ReorderBuffer::shouldFlush() const { return shouldFlush_; }
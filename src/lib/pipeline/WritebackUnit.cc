@@ -6,7 +6,8 @@ namespace simeng {
 namespace pipeline {
 
 WritebackUnit::WritebackUnit(
-    std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>& completionSlots,
+    std::vector<PipelineBuffer<std::shared_ptr<Instruction>, 1>>&
+        completionSlots,
     RegisterFileSet& registerFileSet,
     std::function<void(uint64_t insnId)> flagMicroOpCommits)
     : completionSlots_(completionSlots),
@@ -36,6 +37,19 @@ void WritebackUnit::tick() {
       instructionsWritten_++;
     }
 
+    // Write back any tail fused onto this uop, unless it raised an exception
+    // during execution
+    const auto& tail = uop->getFusedTail();
+    if (tail != nullptr && !tail->exceptionEncountered()) {
+      auto& tailResults = tail->getResults();
+      auto& tailDestinations = tail->getDestinationRegisters();
+      for (size_t i = 0; i < tailResults.size(); i++) {
+        registerFileSet_.set(tailDestinations[i], tailResults[i]);
+      }
+      tail->setCommitReady();
+      instructionsWritten_++;
+    }
+
     completionSlots_[slot].getHeadSlots()[0] = nullptr;
   }
 }
@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "simeng/BranchTrace.hh"
+#include "simeng/GenericPredictor.hh"
+#include "simeng/ModelConfig.hh"
+#include "simeng/PerceptronPredictor.hh"
+#include "simeng/TagePredictor.hh"
+
+/** The outcomes of a single static branch over a replayed trace. */
+struct StaticBranch {
+  /** The address of the branch. */
+  uint64_t address = 0;
+
+  /** The type of the branch. */
+  simeng::BranchType type = simeng::BranchType::Unknown;
+
+  /** The number of times the branch was executed. */
+  uint64_t executed = 0;
+
+  /** The number of times the branch was mispredicted. */
+  uint64_t mispredicted = 0;
+};
+
+/** Retrieve a printable name for a branch type. */
+std::string branchTypeName(simeng::BranchType type) {
+  switch (type) {
+    case simeng::BranchType::Conditional:
+      return "Conditional";
+    case simeng::BranchType::LoopClosing:
+      return "LoopClosing";
+    case simeng::BranchType::Return:
+      return "Return";
+    case simeng::BranchType::SubroutineCall:
+      return "SubroutineCall";
+    case simeng::BranchType::Unconditional:
+      return "Unconditional";
+    default:
+      return "Unknown";
+  }
+}
+
+/** Construct the branch predictor described by the supplied config. */
+std::unique_ptr<simeng::BranchPredictor> createPredictor(YAML::Node config) {
+  std::string predictorType =
+      config["Branch-Predictor"]["Type"].IsDefined()
+          ? config["Branch-Predictor"]["Type"].as<std::string>()
+          : "Generic";
+  std::cout << "[SimEng:bpsim] Predictor: " << predictorType << std::endl;
+  if (predictorType == "TAGE") {
+    auto tage = std::make_unique<simeng::TagePredictor>(config);
+    std::cout << "[SimEng:bpsim] TAGE predictor storage budget: "
+              << tage->getStorageBits() / 8 << " bytes" << std::endl;
+    return tage;
+  } else if (predictorType == "Perceptron") {
+    auto perceptron = std::make_unique<simeng::PerceptronPredictor>(config);
+    std::cout << "[SimEng:bpsim] Perceptron predictor storage budget: "
+              << perceptron->getStorageBits() / 8 << " bytes" << std::endl;
+    return perceptron;
+  }
+  return std::make_unique<simeng::GenericPredictor>(config);
+}
+
+/** Replay a branch trace through the branch predictor described by a config
+ * file, reporting the overall and per static branch prediction accuracy. */
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    std::cerr << "Usage: " << argv[0]
+              << " <config file> <branch trace> [static branches to report]"
+              << std::endl;
+    return 1;
+  }
+  std::string configFilePath = argv[1];
+  std::string tracePath = argv[2];
+  size_t reportCount = (argc > 3) ? std::stoul(argv[3]) : 20;
+
+  YAML::Node config = simeng::ModelConfig(configFilePath).getConfigFile();
+  std::unique_ptr<simeng::BranchPredictor> predictor = createPredictor(config);
+  simeng::BranchTraceReader trace(tracePath);
+
+  std::cout << "[SimEng:bpsim] Config file: " << configFilePath << std::endl;
+  std::cout << "[SimEng:bpsim] Branch trace: " << tracePath << std::endl;
+  std::cout << "[SimEng:bpsim] Replaying...\n" << std::endl;
+
+  // Replay each branch in retirement order, predicting then immediately
+  // updating it
+  std::unordered_map<uint64_t, StaticBranch> branches;
+  simeng::BranchTraceRecord record;
+  uint64_t executed = 0;
+  uint64_t mispredicted = 0;
+  uint64_t indirectExecuted = 0;
+  uint64_t indirectMispredicted = 0;
+  auto startTime = std::chrono::high_resolution_clock::now();
+  while (trace.next(record)) {
+    simeng::BranchPrediction prediction =
+        predictor->predict(record.address, record.type, record.knownTarget);
+    predictor->update(record.address, record.taken, record.target, record.type,
+                      prediction);
+
+    // Mispredicted if the direction or target was wrong, as determined by
+    // `Instruction::wasBranchMispredicted`
+    bool wrong = (prediction.taken != record.taken ||
+                  prediction.target != record.target);
+    auto& branch = branches[record.address];
+    branch.address = record.address;
+    branch.type = record.type;
+    branch.executed++;
+    executed++;
+    if (wrong) {
+      branch.mispredicted++;
+      mispredicted++;
+    }
+    if (simeng::isIndirectBranch(record.type, record.knownTarget)) {
+      indirectExecuted++;
+      if (wrong) indirectMispredicted++;
+    }
+  }
+  auto endTime = std::chrono::high_resolution_clock::now();
+  auto duration =
+      std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime)
+          .count();
+  uint64_t instructions = record.instruction;
+
+  // Guard against division by zero for short or empty traces
+  double seconds = std::max<double>(duration, 1) / 1000.0;
+  double kiloInstructions = std::max<double>(instructions, 1) / 1000.0;
+
+  std::cout << "[SimEng:bpsim] instructions: " << instructions << std::endl;
+  std::cout << "[SimEng:bpsim] branches: " << executed << std::endl;
+  std::cout << "[SimEng:bpsim] static branches: " << branches.size()
+            << std::endl;
+  std::cout << "[SimEng:bpsim] mispredicts: " << mispredicted << std::endl;
+  std::cout << std::fixed << std::setprecision(3);
+  std::cout << "[SimEng:bpsim] accuracy: "
+            << (executed > 0 ? 100.0 * (executed - mispredicted) / executed
+                             : 100.0)
+            << "%" << std::endl;
+  std::cout << "[SimEng:bpsim] mpki: " << mispredicted / kiloInstructions
+            << std::endl;
+  std::cout << "[SimEng:bpsim] indirect branches: " << indirectExecuted
+            << std::endl;
+  std::cout << "[SimEng:bpsim] indirect mispredicts: " << indirectMispredicted
+            << std::endl;
+  std::cout << "[SimEng:bpsim] indirect mpki: "
+            << indirectMispredicted / kiloInstructions << std::endl;
+
+  // Report the static branches causing the most mispredictions
+  std::vector<StaticBranch> sorted;
+  sorted.reserve(branches.size());
+  for (const auto& [address, branch] : branches) sorted.push_back(branch);
+  std::sort(sorted.begin(), sorted.end(),
+            [](const StaticBranch& a, const StaticBranch& b) {
+              return a.mispredicted > b.mispredicted;
+            });
+  if (sorted.size() > reportCount) sorted.resize(reportCount);
+
+  std::cout << "\n[SimEng:bpsim] Most mispredicted static branches:"
+            << std::endl;
+  std::cout << std::setw(18) << "address" << std::setw(16) << "type"
+            << std::setw(14) << "executed" << std::setw(14) << "mispredicted"
+            << std::setw(10) << "accuracy" << std::setw(10) << "mpki"
+            << std::endl;
+  for (const auto& branch : sorted) {
+    std::cout << std::setw(18) << std::hex << std::showbase << branch.address
+              << std::dec << std::noshowbase << std::setw(16)
+              << branchTypeName(branch.type) << std::setw(14)
+              << branch.executed << std::setw(14) << branch.mispredicted
+              << std::setw(9)
+              << 100.0 * (branch.executed - branch.mispredicted) /
+                     branch.executed
+              << "%" << std::setw(10) << branch.mispredicted / kiloInstructions
+              << std::endl;
+  }
+
+  std::cout << std::setprecision(0) << "\n[SimEng:bpsim] Finished replaying "
+            << executed << " branches in " << duration << "ms ("
+            << instructions / seconds / 1e6 << " MIPS)" << std::endl;
+
+  return 0;
+}
@@ -39,6 +39,11 @@ YAML::Node AArch64RegressionTest::generateConfig() const {
   } else {
     config["Core"]["Micro-Operations"] = false;
   }
+  if (additionalConfig["Decoder-Mode"].IsDefined() &&
+      !(additionalConfig["Decoder-Mode"].IsNull())) {
+    config["Core"]["Decoder-Mode"] =
+        additionalConfig["Decoder-Mode"].as<std::string>();
+  }
   return config;
 }
 
@@ -0,0 +1,183 @@
+#include "AArch64RegressionTest.hh"
+
+namespace {
+
+using FastDecoder = AArch64RegressionTest;
+
+/** Get the number of encodings for which the fast decoder's metadata did not
+ * match Capstone's. */
+uint64_t getMismatches(
+    const std::unique_ptr<simeng::arch::Architecture>& architecture) {
+  return static_cast<simeng::arch::aarch64::Architecture*>(architecture.get())
+      ->getFastDecoderMismatches();
+}
+
+// Test that integer arithmetic and logical encodings, including their aliases,
+// decode identically to Capstone
+TEST_P(FastDecoder, integer) {
+  RUN_AARCH64(R"(
+    mov x0, #7
+    movk x0, #1, lsl #16
+    mov w1, #3
+    add x2, x0, #12
+    add w3, w1, #1, lsl #12
+    sub x4, x2, x0
+    subs w5, w3, w1, lsl #2
+    adds x6, x0, x2, asr #1
+    cmp x6, #5
+    cmn w1, #1
+    cmp x4, x0
+    mov x7, sp
+    and x8, x0, x2, lsl #3
+    orr w9, w1, w5
+    mov x10, x0
+    eor x11, x0, x2, ror #4
+    tst x0, #1
+    ands w12, w1, w3
+    tst w12, w1
+    mul x13, x0, x1
+    madd x14, x0, x1, x2
+    msub w15, w1, w3, w5
+    mneg x16, x0, x1
+    csel x17, x0, x1, eq
+    csel w18, w1, w3, ne
+    adr x19, #8
+    adrp x20, #4096
+  )");
+  EXPECT_EQ(getGeneralRegister<uint64_t>(0), 0x10007u);
+  EXPECT_EQ(getGeneralRegister<uint32_t>(1), 3u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(2), 0x10013u);
+  EXPECT_EQ(getGeneralRegister<uint32_t>(3), 0x1003u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(4), 12u);
+  EXPECT_EQ(getGeneralRegister<uint32_t>(5), 0x1003u - 12u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(6), 0x10007u + (0x10013u >> 1));
+  EXPECT_EQ(getGeneralRegister<uint64_t>(7), process_->getStackPointer());
+  EXPECT_EQ(getGeneralRegister<uint64_t>(8), 0x10007u & (0x10013u << 3));
+  EXPECT_EQ(getGeneralRegister<uint32_t>(9), 3u | (0x1003u - 12u));
+  EXPECT_EQ(getGeneralRegister<uint64_t>(10), 0x10007u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(11),
+            0x10007u ^ ((0x10013u >> 4) | (0x3ull << 60)));
+  EXPECT_EQ(getGeneralRegister<uint32_t>(12), 3u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(13), 0x10007u * 3u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(14), 0x10007u * 3u + 0x10013u);
+  EXPECT_EQ(getGeneralRegister<uint32_t>(15), (0x1003u - 12u) - 3u * 0x1003u);
+  EXPECT_EQ(getGeneralRegister<int64_t>(16), -(0x10007 * 3));
+  EXPECT_EQ(getGeneralRegister<uint64_t>(17), 3u);
+  EXPECT_EQ(getGeneralRegister<uint32_t>(18), 3u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(19), 25 * 4 + 8);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(20), 4096u);
+  EXPECT_EQ(getMismatches(architecture_), 0);
+}
+
+// Test that loads, stores and branches decode identically to Capstone
+TEST_P(FastDecoder, memoryAndBranches) {
+  initialHeapData_.resize(64);
+  uint64_t* heap64 = reinterpret_cast<uint64_t*>(initialHeapData_.data());
+  for (int i = 0; i < 8; i++) {
+    heap64[i] = i + 1;
+  }
+  RUN_AARCH64(R"(
+    # Get heap address
+    mov x0, 0
+    mov x8, 214
+    svc #0
+
+    mov x1, x0
+    ldr x2, [x1, #8]
+    ldr w3, [x1, #16]
+    ldr x4, [x1, #8]!
+    ldr x5, [x1], #8
+    str x2, [x1, #40]
+    str w3, [x1], #4
+    ldp x6, x7, [x0, #32]
+    stp x6, x7, [x0], #16
+    ldp q0, q1, [x0, #-16]
+    ldp d2, d3, [x0, #16]
+    stp w6, w7, [x0, #8]
+
+    mov x9, #0
+    mov x10, #4
+  loop:
+    add x9, x9, #1
+    cmp x9, x10
+    b.lt loop
+    cbz x9, skip
+    cbnz x10, taken
+  skip:
+    mov x9, #99
+  taken:
+    tbz x10, #0, bit
+    mov x10, #99
+  bit:
+    tbnz x10, #2, call
+    mov x10, #98
+  call:
+    bl func
+    b end
+  func:
+    mov x11, #5
+    ret
+  end:
+  )");
+  EXPECT_EQ(getGeneralRegister<uint64_t>(2), 2u);
+  EXPECT_EQ(getGeneralRegister<uint32_t>(3), 3u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(4), 2u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(5), 2u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(6), 5u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(7), 6u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(9), 4u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(10), 4u);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(11), 5u);
+  EXPECT_EQ(getMismatches(architecture_), 0);
+}
+
+// Test that NEON and SVE vector arithmetic decodes identically to Capstone
+TEST_P(FastDecoder, vector) {
+  RUN_AARCH64(R"(
+    fmov v0.4s, #1.5
+    fmov v1.4s, #2.0
+    movi v2.16b, #3
+    movi v3.16b, #5
+    fadd v4.4s, v0.4s, v1.4s
+    fsub v5.4s, v1.4s, v0.4s
+    fmul v6.4s, v0.4s, v1.4s
+    add v7.16b, v2.16b, v3.16b
+    sub v8.8h, v3.8h, v2.8h
+    and v9.16b, v2.16b, v3.16b
+    eor v10.16b, v2.16b, v3.16b
+
+    dup z11.s, #4
+    dup z12.s, #1
+    fdup z13.d, #2.0
+    fdup z14.d, #0.5
+    add z15.s, z11.s, z12.s
+    sub z16.s, z11.s, z12.s
+    fadd z17.d, z13.d, z14.d
+    fsub z18.d, z13.d, z14.d
+    fmul z19.d, z13.d, z14.d
+  )");
+  CHECK_NEON(4, float, {3.5f, 3.5f, 3.5f, 3.5f});
+  CHECK_NEON(5, float, {0.5f, 0.5f, 0.5f, 0.5f});
+  CHECK_NEON(6, float, {3.f, 3.f, 3.f, 3.f});
+  CHECK_NEON(7, uint8_t, {8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8});
+  CHECK_NEON(8, uint16_t,
+             {0x202, 0x202, 0x202, 0x202, 0x202, 0x202, 0x202, 0x202});
+  CHECK_NEON(9, uint8_t, {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+  CHECK_NEON(10, uint8_t, {6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6});
+  EXPECT_EQ((getVectorRegisterElement<uint32_t, 0>(15)), 5u);
+  EXPECT_EQ((getVectorRegisterElement<uint32_t, 3>(16)), 3u);
+  EXPECT_EQ((getVectorRegisterElement<double, 0>(17)), 2.5);
+  EXPECT_EQ((getVectorRegisterElement<double, 1>(18)), 1.5);
+  EXPECT_EQ((getVectorRegisterElement<double, 7>(19)), 1.0);
+  EXPECT_EQ(getMismatches(architecture_), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AArch64, FastDecoder,
+    ::testing::Values(
+        std::make_tuple(EMULATION, YAML::Load("{Decoder-Mode: verify}")),
+        std::make_tuple(INORDER, YAML::Load("{Decoder-Mode: verify}")),
+        std::make_tuple(OUTOFORDER, YAML::Load("{Decoder-Mode: verify}"))),
+    paramToString);
+
+}  // namespace
@@ -57,6 +57,24 @@ TEST_P(SmokeTest, heap) {
   EXPECT_EQ(getMemoryValue<uint32_t>(process_->getHeapStart() + 4), 42u);
 }
 
+// Test that regions of code can be decoded ahead of simulation across several
+// threads, with each distinct instruction word decoded once
+TEST_P(SmokeTest, predecode) {
+  RUN_AARCH64(R"(
+    orr x0, xzr, #7
+  )");
+  // add x1, x2, x3; sub x1, x2, x3; mul x1, x2, x3
+  const uint32_t words[] = {0x8b030041, 0xcb030041, 0x9b037c41,
+                            0x8b030041, 0xcb030041, 0x9b037c41};
+  const char* image = reinterpret_cast<const char*>(words);
+  auto arch = static_cast<simeng::arch::aarch64::Architecture*>(
+      architecture_.get());
+
+  // Regions are (address, size) pairs, which need not be aligned
+  EXPECT_EQ(arch->predecodeRegions(image, {{0, 12}, {14, 10}}, 4), 3u);
+  EXPECT_EQ(arch->predecodeRegions(image, {{0, sizeof(words)}}, 4), 0u);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     AArch64, SmokeTest,
     ::testing::Values(std::make_tuple(EMULATION, YAML::Load("{}")),
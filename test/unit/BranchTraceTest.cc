@@ -0,0 +1,64 @@
+#include <cstdio>
+
+#include "gtest/gtest.h"
+#include "simeng/BranchTrace.hh"
+
+namespace {
+
+/** The file written and read by each test. */
+const char* TRACE_PATH = "branchTraceTest.bin";
+
+// Tests that branches written to a trace are read back unchanged, with
+// negative known target offsets preserved
+TEST(BranchTraceTest, RoundTrip) {
+  std::vector<simeng::BranchTraceRecord> records = {
+      {3, 0x400, simeng::BranchType::Conditional, true, 0x3F0,
+       static_cast<uint64_t>(-16)},
+      {4, 0x3F0, simeng::BranchType::SubroutineCall, true, 0x800, 0x410},
+      {10, 0x818, simeng::BranchType::Return, true, 0x3F4, 0},
+      {25, 0x430, simeng::BranchType::Conditional, false, 0x434, 0x40}};
+  {
+    simeng::BranchTraceWriter writer(TRACE_PATH);
+    for (const auto& record : records) writer.record(record);
+    EXPECT_EQ(writer.getRecordCount(), records.size());
+  }
+
+  simeng::BranchTraceReader reader(TRACE_PATH);
+  simeng::BranchTraceRecord record;
+  for (const auto& expected : records) {
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.instruction, expected.instruction);
+    EXPECT_EQ(record.address, expected.address);
+    EXPECT_EQ(record.type, expected.type);
+    EXPECT_EQ(record.taken, expected.taken);
+    EXPECT_EQ(record.target, expected.target);
+    EXPECT_EQ(record.knownTarget, expected.knownTarget);
+  }
+  EXPECT_FALSE(reader.next(record));
+  std::remove(TRACE_PATH);
+}
+
+// Tests that traces larger than the read buffer are read completely
+TEST(BranchTraceTest, Buffering) {
+  const uint64_t count = simeng::branchTraceFormat::BUFFERED_RECORDS * 2 + 7;
+  {
+    simeng::BranchTraceWriter writer(TRACE_PATH);
+    for (uint64_t i = 0; i < count; i++) {
+      writer.record({i * 2, i * 4, simeng::BranchType::Conditional, i % 3 == 0,
+                     i * 4 + 4, 0});
+    }
+  }
+
+  simeng::BranchTraceReader reader(TRACE_PATH);
+  simeng::BranchTraceRecord record;
+  for (uint64_t i = 0; i < count; i++) {
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.instruction, i * 2);
+    EXPECT_EQ(record.address, i * 4);
+    EXPECT_EQ(record.taken, i % 3 == 0);
+  }
+  EXPECT_FALSE(reader.next(record));
+  std::remove(TRACE_PATH);
+}
+
+}  // namespace
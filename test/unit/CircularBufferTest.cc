@@ -0,0 +1,50 @@
+#include "gtest/gtest.h"
+#include "simeng/CircularBuffer.hh"
+
+namespace {
+
+// Tests that elements are retrieved in the order they were added
+TEST(CircularBufferTest, FirstInFirstOut) {
+  simeng::CircularBuffer<int> buffer(4);
+  for (int i = 0; i < 3; i++) buffer.push_back(i);
+
+  EXPECT_EQ(buffer.size(), 3);
+  EXPECT_EQ(buffer.front(), 0);
+  EXPECT_EQ(buffer.back(), 2);
+
+  buffer.pop_front();
+  buffer.push_back(3);
+  buffer.push_back(4);
+  EXPECT_EQ(buffer.capacity(), 4);
+  for (int i = 0; i < 4; i++) EXPECT_EQ(buffer[i], i + 1);
+}
+
+// Tests that the buffer grows when full, preserving element order
+TEST(CircularBufferTest, Grow) {
+  simeng::CircularBuffer<int> buffer(2);
+  buffer.push_back(0);
+  buffer.push_back(1);
+  buffer.pop_front();
+  buffer.push_back(2);
+  buffer.push_back(3);
+
+  EXPECT_EQ(buffer.capacity(), 4);
+  ASSERT_EQ(buffer.size(), 3);
+  for (int i = 0; i < 3; i++) EXPECT_EQ(buffer[i], i + 1);
+}
+
+// Tests that elements can be removed from the middle of the buffer
+TEST(CircularBufferTest, RemoveIf) {
+  simeng::CircularBuffer<int> buffer(8);
+  for (int i = 0; i < 6; i++) buffer.push_back(i);
+  buffer.pop_front();
+
+  buffer.remove_if([](int value) { return value % 2 == 0; });
+
+  ASSERT_EQ(buffer.size(), 3);
+  EXPECT_EQ(buffer[0], 1);
+  EXPECT_EQ(buffer[1], 3);
+  EXPECT_EQ(buffer[2], 5);
+}
+
+}  // namespace
@@ -0,0 +1,248 @@
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "arch/aarch64/InstructionMetadata.hh"
+#include "gtest/gtest.h"
+#include "simeng/arch/aarch64/DecodeCacheFile.hh"
+
+namespace {
+
+using simeng::arch::aarch64::DecodeCacheFile;
+using simeng::arch::aarch64::DecoderMode;
+using simeng::arch::aarch64::InstructionMetadata;
+
+/** The offsets of header fields within a decode cache file. */
+constexpr size_t METADATA_VERSION_OFFSET = 12;
+constexpr size_t DECODER_MODE_OFFSET = 16;
+constexpr size_t STRINGS_SIZE_OFFSET = 40;
+
+/** The size of a decode cache file's header. */
+constexpr size_t HEADER_SIZE = 48;
+
+// Checks that decodings are saved to and reloaded from a decode cache file,
+// and that files not matching the executable, build or decoder mode are
+// rejected
+class DecodeCacheFileTest : public testing::Test {
+ public:
+  DecodeCacheFileTest()
+      : path(testing::TempDir() + "DecodeCacheFileTest.sedc"),
+        executablePath(testing::TempDir() + "DecodeCacheFileTest.elf") {
+    std::remove(path.c_str());
+    writeExecutable("executable contents");
+  }
+
+  ~DecodeCacheFileTest() {
+    std::remove(path.c_str());
+    std::remove(executablePath.c_str());
+  }
+
+ protected:
+  /** Replace the executable's contents with `contents`. */
+  void writeExecutable(const std::string& contents) {
+    std::ofstream file(executablePath, std::ios::binary | std::ios::trunc);
+    file << contents;
+  }
+
+  /** Read the decode cache file's contents. */
+  std::vector<char> readFile() {
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), {});
+  }
+
+  /** Replace the decode cache file's contents with `contents`. */
+  void writeFile(const std::vector<char>& contents) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), contents.size());
+  }
+
+  /** Build metadata for the word `word`, with every field set to a value
+   * derived from `seed`. */
+  InstructionMetadata makeMetadata(uint32_t word, uint8_t seed) {
+    InstructionMetadata metadata(reinterpret_cast<const uint8_t*>(&word));
+    metadata.id = seed + 1;
+    metadata.opcode = seed + 2;
+    std::memset(metadata.mnemonic, 0, sizeof(metadata.mnemonic));
+    std::snprintf(metadata.mnemonic, sizeof(metadata.mnemonic), "op%u",
+                  static_cast<unsigned>(seed));
+    metadata.operandStr = "x" + std::to_string(seed) + ", [sp, #16]";
+    for (size_t i = 0; i < InstructionMetadata::MAX_IMPLICIT_SOURCES; i++) {
+      metadata.implicitSources[i] = seed + i;
+    }
+    metadata.implicitSourceCount = 2;
+    for (size_t i = 0; i < InstructionMetadata::MAX_IMPLICIT_DESTINATIONS;
+         i++) {
+      metadata.implicitDestinations[i] = seed + 2 * i;
+    }
+    metadata.implicitDestinationCount = 1;
+    for (size_t i = 0; i < InstructionMetadata::MAX_GROUPS; i++) {
+      metadata.groups[i] = seed + 3 * i;
+    }
+    metadata.groupCount = 3;
+    metadata.cc = seed % 15;
+    metadata.setsFlags = seed & 1;
+    metadata.writeback = !(seed & 1);
+    for (size_t i = 0; i < InstructionMetadata::MAX_OPERANDS; i++) {
+      std::memset(&metadata.operands[i], seed + i, sizeof(cs_arm64_op));
+    }
+    metadata.operandCount = 4;
+    return metadata;
+  }
+
+  /** Check that every field of `actual` matches `expected`. */
+  void expectEqual(const InstructionMetadata& actual,
+                   const InstructionMetadata& expected) {
+    EXPECT_EQ(std::memcmp(actual.encoding, expected.encoding,
+                          sizeof(actual.encoding)),
+              0);
+    EXPECT_EQ(actual.id, expected.id);
+    EXPECT_EQ(actual.opcode, expected.opcode);
+    EXPECT_STREQ(actual.mnemonic, expected.mnemonic);
+    EXPECT_EQ(actual.operandStr, expected.operandStr);
+    EXPECT_EQ(std::memcmp(actual.implicitSources, expected.implicitSources,
+                          sizeof(actual.implicitSources)),
+              0);
+    EXPECT_EQ(actual.implicitSourceCount, expected.implicitSourceCount);
+    EXPECT_EQ(std::memcmp(actual.implicitDestinations,
+                          expected.implicitDestinations,
+                          sizeof(actual.implicitDestinations)),
+              0);
+    EXPECT_EQ(actual.implicitDestinationCount,
+              expected.implicitDestinationCount);
+    EXPECT_EQ(
+        std::memcmp(actual.groups, expected.groups, sizeof(actual.groups)), 0);
+    EXPECT_EQ(actual.groupCount, expected.groupCount);
+    EXPECT_EQ(actual.cc, expected.cc);
+    EXPECT_EQ(actual.setsFlags, expected.setsFlags);
+    EXPECT_EQ(actual.writeback, expected.writeback);
+    EXPECT_EQ(std::memcmp(actual.operands, expected.operands,
+                          sizeof(actual.operands)),
+              0);
+    EXPECT_EQ(actual.operandCount, expected.operandCount);
+  }
+
+  /** Save the decodings of `metadata` to a new decode cache file produced in
+   * decoder mode `mode`. */
+  void save(const std::vector<InstructionMetadata>& metadata,
+            DecoderMode mode = DecoderMode::Capstone) {
+    DecodeCacheFile cache(path, executablePath, mode);
+    DecodeCacheFile::Decodings decodings;
+    for (const auto& decoding : metadata) {
+      uint32_t word;
+      std::memcpy(&word, decoding.encoding, sizeof(word));
+      decodings.push_back({word, &decoding});
+    }
+    cache.save(decodings);
+  }
+
+  std::string path;
+  std::string executablePath;
+};
+
+// Tests that every field of saved decodings is restored on reload
+TEST_F(DecodeCacheFileTest, RoundTrip) {
+  std::vector<InstructionMetadata> metadata = {
+      makeMetadata(0x91000421, 1), makeMetadata(0xd65f03c0, 2),
+      makeMetadata(0x8b020020, 3)};
+  save(metadata);
+
+  DecodeCacheFile cache(path, executablePath, DecoderMode::Capstone);
+  for (const auto& expected : metadata) {
+    uint32_t word;
+    std::memcpy(&word, expected.encoding, sizeof(word));
+    auto actual = cache.find(word);
+    ASSERT_TRUE(actual.has_value());
+    expectEqual(*actual, expected);
+  }
+  EXPECT_FALSE(cache.find(0x12345678).has_value());
+  EXPECT_EQ(cache.getHitCount(), metadata.size());
+}
+
+// Tests that saving merges new decodings with those already in the file
+TEST_F(DecodeCacheFileTest, Merge) {
+  std::vector<InstructionMetadata> first = {makeMetadata(0x91000421, 1)};
+  std::vector<InstructionMetadata> second = {makeMetadata(0x8b020020, 2)};
+  save(first);
+  {
+    DecodeCacheFile cache(path, executablePath, DecoderMode::Capstone);
+    DecodeCacheFile::Decodings decodings = {{0x8b020020, &second[0]}};
+    cache.save(decodings);
+  }
+
+  DecodeCacheFile cache(path, executablePath, DecoderMode::Capstone);
+  auto actual = cache.find(0x91000421);
+  ASSERT_TRUE(actual.has_value());
+  expectEqual(*actual, first[0]);
+  actual = cache.find(0x8b020020);
+  ASSERT_TRUE(actual.has_value());
+  expectEqual(*actual, second[0]);
+}
+
+// Tests that a file belonging to a different executable is rejected
+TEST_F(DecodeCacheFileTest, RejectsDifferentExecutable) {
+  save({makeMetadata(0x91000421, 1)});
+  writeExecutable("other executable contents");
+
+  DecodeCacheFile cache(path, executablePath, DecoderMode::Capstone);
+  EXPECT_FALSE(cache.find(0x91000421).has_value());
+}
+
+// Tests that a file produced in a different decoder mode is rejected
+TEST_F(DecodeCacheFileTest, RejectsDifferentDecoderMode) {
+  save({makeMetadata(0x91000421, 1)}, DecoderMode::Fast);
+
+  DecodeCacheFile cache(path, executablePath, DecoderMode::Capstone);
+  EXPECT_FALSE(cache.find(0x91000421).has_value());
+  DecodeCacheFile fastCache(path, executablePath, DecoderMode::Fast);
+  EXPECT_TRUE(fastCache.find(0x91000421).has_value());
+}
+
+// Tests that files with a mismatched header are rejected
+TEST_F(DecodeCacheFileTest, RejectsMismatchedHeader) {
+  save({makeMetadata(0x91000421, 1)});
+  auto contents = readFile();
+  ASSERT_GT(contents.size(), HEADER_SIZE);
+
+  for (size_t offset : {size_t(0), METADATA_VERSION_OFFSET,
+                        DECODER_MODE_OFFSET}) {
+    auto modified = contents;
+    modified[offset]++;
+    writeFile(modified);
+    DecodeCacheFile cache(path, executablePath, DecoderMode::Capstone);
+    EXPECT_FALSE(cache.find(0x91000421).has_value()) << "offset " << offset;
+  }
+}
+
+// Tests that truncated files are rejected
+TEST_F(DecodeCacheFileTest, RejectsTruncatedFile) {
+  save({makeMetadata(0x91000421, 1)});
+  auto contents = readFile();
+
+  for (size_t size : {contents.size() - 1, HEADER_SIZE, HEADER_SIZE - 1}) {
+    writeFile({contents.begin(), contents.begin() + size});
+    DecodeCacheFile cache(path, executablePath, DecoderMode::Capstone);
+    EXPECT_FALSE(cache.find(0x91000421).has_value()) << "size " << size;
+  }
+}
+
+// Tests that a file whose string table size disagrees with its length is
+// rejected
+TEST_F(DecodeCacheFileTest, RejectsBadStringsSize) {
+  save({makeMetadata(0x91000421, 1)});
+  auto contents = readFile();
+
+  for (int64_t delta : {-1, 1}) {
+    auto modified = contents;
+    uint64_t stringsSize;
+    std::memcpy(&stringsSize, &modified[STRINGS_SIZE_OFFSET],
+                sizeof(stringsSize));
+    stringsSize += delta;
+    std::memcpy(&modified[STRINGS_SIZE_OFFSET], &stringsSize,
+                sizeof(stringsSize));
+    writeFile(modified);
+    DecodeCacheFile cache(path, executablePath, DecoderMode::Capstone);
+    EXPECT_FALSE(cache.find(0x91000421).has_value()) << "delta " << delta;
+  }
+}
+
+}  // namespace
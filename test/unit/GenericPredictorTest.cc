@@ -75,6 +75,30 @@ TEST_F(GenericPredictorTest, RAS) {
   EXPECT_EQ(prediction.target, 12);
 }
 
+// Tests that flushing in-flight instances of the same return instruction
+// restores each of their RAS entries
+TEST_F(GenericPredictorTest, FlushInFlightReturns) {
+  auto predictor = simeng::GenericPredictor(YAML::Load(
+      "{Branch-Predictor: {BTB-Tag-Bits: 11, Saturating-Count-Bits: 2, "
+      "Global-History-Length: 10, RAS-entries: 10, Fallback-Static-Predictor: "
+      "2}}"));
+  predictor.predict(8, BranchType::SubroutineCall, 8);
+  predictor.predict(24, BranchType::SubroutineCall, 8);
+
+  auto first = predictor.predict(40, BranchType::Return, 0);
+  EXPECT_EQ(first.target, 28);
+  auto second = predictor.predict(40, BranchType::Return, 0);
+  EXPECT_EQ(second.target, 12);
+
+  // Flush youngest first, as the reorder buffer does
+  predictor.flush(40, BranchType::Return, second);
+  predictor.flush(40, BranchType::Return, first);
+  auto prediction = predictor.predict(40, BranchType::Return, 0);
+  EXPECT_EQ(prediction.target, 28);
+  prediction = predictor.predict(40, BranchType::Return, 0);
+  EXPECT_EQ(prediction.target, 12);
+}
+
 // Tests that a GenericPredictor will predict a previously encountered branch
 // correctly, when no address aliasing has occurred
 TEST_F(GenericPredictorTest, Hit) {
@@ -82,11 +106,11 @@ TEST_F(GenericPredictorTest, Hit) {
       "{Branch-Predictor: {BTB-Tag-Bits: 11, Saturating-Count-Bits: 2, "
       "Global-History-Length: 1, RAS-entries: 5, Fallback-Static-Predictor: "
       "2}}"));
-  predictor.update(0, true, 16, BranchType::Conditional);
-  predictor.update(0, true, 16, BranchType::Conditional);
-  predictor.update(0, true, 16, BranchType::Conditional);
-  predictor.update(0, true, 16, BranchType::Conditional);
-  predictor.update(0, false, 16, BranchType::Conditional);
+  predictor.update(0, true, 16, BranchType::Conditional, {});
+  predictor.update(0, true, 16, BranchType::Conditional, {});
+  predictor.update(0, true, 16, BranchType::Conditional, {});
+  predictor.update(0, true, 16, BranchType::Conditional, {});
+  predictor.update(0, false, 16, BranchType::Conditional, {});
 
   auto prediction = predictor.predict(0, BranchType::Conditional, 0);
   EXPECT_TRUE(prediction.taken);
@@ -100,56 +124,99 @@ TEST_F(GenericPredictorTest, GlobalIndexing) {
       "{Branch-Predictor: {BTB-Tag-Bits: 11, Saturating-Count-Bits: 2, "
       "Global-History-Length: 5, RAS-entries: 5, Fallback-Static-Predictor: "
       "1}}"));
+  // Spools up a global history pattern through the outcomes of another branch,
+  // repairing the history whenever it was mispredicted
+  auto spool = [&predictor](std::vector<bool> pattern) {
+    for (bool taken : pattern) {
+      auto prediction = predictor.predict(0x100, BranchType::Conditional, 4);
+      predictor.update(0x100, taken, 0x104, BranchType::Conditional,
+                       prediction);
+    }
+  };
+
   // Spool up first global history pattern
-  predictor.update(0, true, 4, BranchType::Unconditional);
-  predictor.update(0, false, 4, BranchType::Unconditional);
-  predictor.update(0, false, 4, BranchType::Unconditional);
-  predictor.update(0, false, 4, BranchType::Unconditional);
-  predictor.update(0, true, 4, BranchType::Unconditional);
+  spool({true, false, false, false, true});
   // Ensure default behaviour for first encounter
   auto prediction = predictor.predict(0x1F, BranchType::Conditional, 0);
   EXPECT_FALSE(prediction.taken);
   EXPECT_EQ(prediction.target, 0x23);
   // Set entry in BTB
-  predictor.update(0x1F, true, 0xAB, BranchType::Conditional);
+  predictor.update(0x1F, true, 0xAB, BranchType::Conditional, prediction);
 
   // Spool up second global history pattern
-  predictor.update(0, false, 4, BranchType::Unconditional);
-  predictor.update(0, true, 4, BranchType::Unconditional);
-  predictor.update(0, true, 4, BranchType::Unconditional);
-  predictor.update(0, true, 4, BranchType::Unconditional);
-  predictor.update(0, false, 4, BranchType::Unconditional);
+  spool({false, true, true, true, false});
   // Ensure default behaviour for re-encounter but with different global history
   prediction = predictor.predict(0x1F, BranchType::Conditional, 0);
   EXPECT_FALSE(prediction.taken);
   EXPECT_EQ(prediction.target, 0x23);
   // Set entry in BTB
-  predictor.update(0x1F, true, 0xBA, BranchType::Conditional);
+  predictor.update(0x1F, true, 0xBA, BranchType::Conditional, prediction);
 
   // Recreate first global history pattern
-  predictor.update(0, true, 4, BranchType::Unconditional);
-  predictor.update(0, false, 4, BranchType::Unconditional);
-  predictor.update(0, false, 4, BranchType::Unconditional);
-  predictor.update(0, false, 4, BranchType::Unconditional);
-  predictor.update(0, true, 4, BranchType::Unconditional);
+  spool({true, false, false, false, true});
   // Get prediction
   prediction = predictor.predict(0x1F, BranchType::Conditional, 0);
   EXPECT_TRUE(prediction.taken);
   EXPECT_EQ(prediction.target, 0xAB);
   // Set entry in BTB
-  predictor.update(0x1F, true, 0xAB, BranchType::Conditional);
+  predictor.update(0x1F, true, 0xAB, BranchType::Conditional, prediction);
 
   // Recreate second global history pattern
-  predictor.update(0, false, 4, BranchType::Unconditional);
-  predictor.update(0, true, 4, BranchType::Unconditional);
-  predictor.update(0, true, 4, BranchType::Unconditional);
-  predictor.update(0, true, 4, BranchType::Unconditional);
-  predictor.update(0, false, 4, BranchType::Unconditional);
+  spool({false, true, true, true, false});
   // Get prediction
   prediction = predictor.predict(0x1F, BranchType::Conditional, 0);
   EXPECT_TRUE(prediction.taken);
   EXPECT_EQ(prediction.target, 0xBA);
-  predictor.update(0x1F, true, 0xBA, BranchType::Conditional);
+  predictor.update(0x1F, true, 0xBA, BranchType::Conditional, prediction);
+}
+
+// Tests that a GenericPredictor indexes consecutive predictions with the
+// speculatively updated global history, before any branch is updated
+TEST_F(GenericPredictorTest, SpeculativeHistory) {
+  auto predictor = simeng::GenericPredictor(YAML::Load(
+      "{Branch-Predictor: {BTB-Tag-Bits: 11, Saturating-Count-Bits: 2, "
+      "Global-History-Length: 5, RAS-entries: 5, Fallback-Static-Predictor: "
+      "2}}"));
+  auto first = predictor.predict(0x40, BranchType::Conditional, 8);
+  EXPECT_TRUE(first.taken);
+  EXPECT_EQ(first.state, 0x40);
+  auto second = predictor.predict(0x40, BranchType::Conditional, 8);
+  EXPECT_EQ(second.state, 0x41);
+  auto third = predictor.predict(0x40, BranchType::Conditional, 8);
+  EXPECT_EQ(third.state, 0x43);
+}
+
+// Tests that a GenericPredictor repairs its global history and RAS when a
+// branch is mispredicted or flushed
+TEST_F(GenericPredictorTest, Repair) {
+  auto predictor = simeng::GenericPredictor(YAML::Load(
+      "{Branch-Predictor: {BTB-Tag-Bits: 11, Saturating-Count-Bits: 2, "
+      "Global-History-Length: 5, RAS-entries: 5, Fallback-Static-Predictor: "
+      "2}}"));
+  predictor.predict(0x10, BranchType::SubroutineCall, 0x100);
+  auto branch = predictor.predict(0x110, BranchType::Conditional, 8);
+  EXPECT_TRUE(branch.taken);
+
+  // Wrong path predictions, including a return consuming the RAS entry
+  predictor.predict(0x118, BranchType::Conditional, 8);
+  auto wrongReturn = predictor.predict(0x120, BranchType::Return, 0);
+  EXPECT_EQ(wrongReturn.target, 0x14);
+  predictor.predict(0x200, BranchType::SubroutineCall, 0x100);
+
+  // Resolving the branch as not taken repairs the history to the call and the
+  // branch's outcome, and restores the RAS
+  predictor.update(0x110, false, 0x114, BranchType::Conditional, branch);
+  auto next = predictor.predict(0x40, BranchType::Conditional, 8);
+  EXPECT_EQ(next.state, 0x40 ^ 0b10);
+  auto ret = predictor.predict(0x130, BranchType::Return, 0);
+  EXPECT_EQ(ret.target, 0x14);
+
+  // Flushing the younger predictions restores the state before them
+  predictor.flush(0x130, BranchType::Return, ret);
+  predictor.flush(0x40, BranchType::Conditional, next);
+  ret = predictor.predict(0x130, BranchType::Return, 0);
+  EXPECT_EQ(ret.target, 0x14);
+  EXPECT_EQ(ret.state, (0x130 & 0x7FF) ^ 0b10);
 }
 
 }  // namespace simeng
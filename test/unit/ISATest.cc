@@ -30,4 +30,28 @@ TEST(ISATest, CreateRegisterFileSet) {
   EXPECT_TRUE(registerFileSet.get(reg));
 }
 
+// Test that register reads are views of the register file storage, which
+// reflect later writes, and that registers are stored independently
+TEST(ISATest, RegisterFileSetViews) {
+  auto registerFileSet = simeng::RegisterFileSet({{8, 32}, {256, 32}});
+  auto vectorReg = simeng::Register{1, 3};
+  auto neighbourReg = simeng::Register{1, 4};
+
+  const auto& value = registerFileSet.get(vectorReg);
+  EXPECT_TRUE(value.isView());
+  EXPECT_EQ(value.size(), 256);
+  EXPECT_EQ(value.getAsVector<uint64_t>()[31], 0);
+
+  uint64_t data[32];
+  for (int i = 0; i < 32; i++) data[i] = i + 1;
+  registerFileSet.set(vectorReg, {data, 256});
+
+  EXPECT_EQ(value.getAsVector<uint64_t>()[0], 1);
+  EXPECT_EQ(value.getAsVector<uint64_t>()[31], 32);
+  EXPECT_EQ(registerFileSet.get(neighbourReg).getAsVector<uint64_t>()[0], 0);
+
+  // Vector registers should be aligned for efficient host access
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(value.getAsVector<char>()) % 64, 0);
+}
+
 }  // namespace
@@ -0,0 +1,99 @@
+#include "gtest/gtest.h"
+#include "simeng/IndirectTargetPredictor.hh"
+
+namespace simeng {
+
+class IndirectTargetPredictorTest : public testing::Test {
+ public:
+  IndirectTargetPredictorTest()
+      : config(YAML::Load(
+            "{Branch-Predictor: {Indirect-Tables: 4, Indirect-Table-Bits: 8, "
+            "Indirect-Tag-Bits: 8, Indirect-Min-History: 2, "
+            "Indirect-Max-History: 32}}")) {}
+
+ protected:
+  /** Predict and update a conditional branch at `address`, supplying its
+   * outcome as the prediction. */
+  void conditional(IndirectTargetPredictor& predictor, uint64_t address,
+                   bool taken) {
+    BranchPrediction prediction = {taken, taken ? address + 0x20 : address + 4};
+    predictor.predict(address, BranchType::Conditional, 0x20, prediction);
+    predictor.update(address, taken, prediction.target, prediction);
+  }
+
+  /** Predict and update an indirect call at `address` to `target`, with the
+   * BTB predicting `btbTarget`. Returns whether the target was mispredicted. */
+  bool indirectCall(IndirectTargetPredictor& predictor, uint64_t address,
+                    uint64_t target, uint64_t btbTarget) {
+    BranchPrediction prediction = {true, btbTarget};
+    predictor.predict(address, BranchType::SubroutineCall, 0, prediction);
+    predictor.update(address, true, target, prediction);
+    return prediction.target != target;
+  }
+
+  YAML::Node config;
+};
+
+// Tests that the targets of direct branches and returns are left unchanged
+TEST_F(IndirectTargetPredictorTest, DirectBranches) {
+  auto predictor = IndirectTargetPredictor(config);
+  BranchPrediction prediction = {true, 0x120};
+  predictor.predict(0x100, BranchType::SubroutineCall, 0x20, prediction);
+  EXPECT_EQ(prediction.target, 0x120);
+  EXPECT_EQ(prediction.indirectState, 0);
+
+  prediction = {true, 0x400};
+  predictor.predict(0x200, BranchType::Return, 0, prediction);
+  EXPECT_EQ(prediction.target, 0x400);
+  EXPECT_EQ(prediction.indirectState, 0);
+
+  prediction = {true, 0x400};
+  predictor.predict(0x300, BranchType::Unconditional, 0, prediction);
+  EXPECT_NE(prediction.indirectState, 0);
+}
+
+// Tests that an indirect call whose target depends on the direction of a
+// preceding branch is learnt, where a BTB holding the last target is not
+TEST_F(IndirectTargetPredictorTest, CorrelatedTarget) {
+  auto predictor = IndirectTargetPredictor(config);
+  auto disabledConfig = YAML::Clone(config);
+  disabledConfig["Branch-Predictor"]["Indirect-Tables"] = 0;
+  auto disabled = IndirectTargetPredictor(disabledConfig);
+
+  int mispredicts = 0;
+  int disabledMispredicts = 0;
+  uint64_t btbTarget = 0;
+  for (int i = 0; i < 1000; i++) {
+    bool taken = ((i * 7) % 3 == 0);
+    uint64_t target = taken ? 0x1000 : 0x2000;
+    conditional(predictor, 0x100, taken);
+    conditional(disabled, 0x100, taken);
+    bool wrong = indirectCall(predictor, 0x200, target, btbTarget);
+    bool disabledWrong = indirectCall(disabled, 0x200, target, btbTarget);
+    if (i >= 900) {
+      mispredicts += wrong;
+      disabledMispredicts += disabledWrong;
+    }
+    btbTarget = target;
+  }
+  EXPECT_EQ(mispredicts, 0);
+  EXPECT_GT(disabledMispredicts, 0);
+}
+
+// Tests that an indirect branch cycling through several targets is learnt from
+// the path history of its own previous targets
+TEST_F(IndirectTargetPredictorTest, RotatingTargets) {
+  auto predictor = IndirectTargetPredictor(config);
+  const uint64_t targets[] = {0x1000, 0x2004, 0x3008};
+  int mispredicts = 0;
+  uint64_t btbTarget = 0;
+  for (int i = 0; i < 1000; i++) {
+    uint64_t target = targets[i % 3];
+    bool wrong = indirectCall(predictor, 0x200, target, btbTarget);
+    if (i >= 900) mispredicts += wrong;
+    btbTarget = target;
+  }
+  EXPECT_EQ(mispredicts, 0);
+}
+
+}  // namespace simeng
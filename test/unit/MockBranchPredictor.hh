@@ -10,9 +10,14 @@ class MockBranchPredictor : public BranchPredictor {
  public:
   MOCK_METHOD3(predict, BranchPrediction(uint64_t address, BranchType type,
                                          uint64_t knownTarget));
-  MOCK_METHOD4(update, void(uint64_t address, bool taken,
-                            uint64_t targetAddress, BranchType type));
-  MOCK_METHOD1(flush, void(uint64_t address));
+  MOCK_METHOD5(update,
+               void(uint64_t address, bool taken, uint64_t targetAddress,
+                    BranchType type, const BranchPrediction& prediction));
+  MOCK_METHOD3(flush, void(uint64_t address, BranchType type,
+                           const BranchPrediction& prediction));
+  MOCK_METHOD5(repair,
+               void(uint64_t address, bool taken, uint64_t targetAddress,
+                    BranchType type, const BranchPrediction& prediction));
 };
 
 }  // namespace simeng
@@ -19,7 +19,9 @@ class MockInstruction : public Instruction {
   MOCK_METHOD0(execute, void());
   MOCK_CONST_METHOD0(getResults, const span<RegisterValue>());
   MOCK_METHOD0(generateAddresses, span<const MemoryAccessTarget>());
-  MOCK_METHOD2(supplyData, void(uint64_t address, const RegisterValue& data));
+  MOCK_METHOD2(supplyData, void(size_t index, const RegisterValue& data));
+  MOCK_METHOD2(supplyDataBlock,
+               void(size_t firstIndex, span<const RegisterValue> data));
   MOCK_CONST_METHOD0(getGeneratedAddresses, span<const MemoryAccessTarget>());
   MOCK_CONST_METHOD0(getData, span<const RegisterValue>());
 
@@ -37,6 +39,8 @@ class MockInstruction : public Instruction {
   MOCK_CONST_METHOD0(getGroup, uint16_t());
 
   MOCK_METHOD0(getSupportedPorts, const std::vector<uint16_t>&());
+  MOCK_CONST_METHOD0(clone, std::shared_ptr<Instruction>());
+  MOCK_CONST_METHOD1(canFuseWith, bool(const Instruction& tail));
 
   void setBranchResults(bool wasTaken, uint64_t targetAddress) {
     branchTaken_ = wasTaken;
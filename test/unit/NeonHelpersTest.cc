@@ -0,0 +1,149 @@
+#include <random>
+
+#include "gtest/gtest.h"
+#include "simeng/arch/aarch64/helpers/neon.hh"
+
+namespace {
+
+using simeng::RegisterValue;
+using simeng::arch::aarch64::Instruction;
+using simeng::arch::aarch64::neonHelp;
+
+using Operands = std::array<RegisterValue, Instruction::MAX_SOURCE_REGISTERS>;
+
+/** The number of random operand sets each helper is checked against. */
+constexpr int ITERATIONS = 64;
+
+// Checks the vectorised NEON helper kernels against per-element reference
+// computations on random operands
+class NeonHelpersTest : public testing::Test {
+ protected:
+  /** Fill the first `count` operands with random 128-bit vectors. */
+  void randomise(int count) {
+    for (int op = 0; op < count; op++) {
+      uint8_t bytes[16];
+      for (int i = 0; i < 16; i++) {
+        bytes[i] = static_cast<uint8_t>(rng());
+      }
+      operands[op] = {bytes, 256};
+    }
+  }
+
+  /** Fill the first `count` operands with random vectors of `float`, with
+   * equal elements across operands sometimes present to exercise equality. */
+  void randomiseFloat(int count) {
+    std::uniform_int_distribution<int> dist(-4, 4);
+    for (int op = 0; op < count; op++) {
+      float elements[4];
+      for (int i = 0; i < 4; i++) {
+        elements[i] = static_cast<float>(dist(rng)) * 0.5f;
+      }
+      operands[op] = {elements, 256};
+    }
+  }
+
+  Operands operands;
+  std::mt19937 rng{42};
+};
+
+// Tests that `addp` sums adjacent pairs of the concatenated sources
+TEST_F(NeonHelpersTest, Addp) {
+  for (int it = 0; it < ITERATIONS; it++) {
+    randomise(2);
+    auto result = neonHelp::vecAddp_3ops<uint16_t, 8>(operands);
+    const uint16_t* n = operands[0].getAsVector<uint16_t>();
+    const uint16_t* m = operands[1].getAsVector<uint16_t>();
+    const uint16_t* out = result.getAsVector<uint16_t>();
+    for (int i = 0; i < 4; i++) {
+      EXPECT_EQ(out[i], static_cast<uint16_t>(n[2 * i] + n[2 * i + 1]));
+      EXPECT_EQ(out[i + 4], static_cast<uint16_t>(m[2 * i] + m[2 * i + 1]));
+    }
+  }
+}
+
+// Tests that integer compares set all bits of matching elements, both against
+// a second vector and against zero, and leave the upper half clear for 64-bit
+// arrangements
+TEST_F(NeonHelpersTest, Compare) {
+  auto gt = [](int8_t x, int8_t y) -> bool { return x > y; };
+  for (int it = 0; it < ITERATIONS; it++) {
+    randomise(2);
+    const int8_t* n = operands[0].getAsVector<int8_t>();
+    const int8_t* m = operands[1].getAsVector<int8_t>();
+
+    auto vecs = neonHelp::vecCompare<int8_t, 8>(operands, false, gt);
+    auto zero = neonHelp::vecCompare<int8_t, 8>(operands, true, gt);
+    const int8_t* vecsOut = vecs.getAsVector<int8_t>();
+    const int8_t* zeroOut = zero.getAsVector<int8_t>();
+    for (int i = 0; i < 16; i++) {
+      EXPECT_EQ(vecsOut[i], (i < 8 && n[i] > m[i]) ? -1 : 0);
+      EXPECT_EQ(zeroOut[i], (i < 8 && n[i] > 0) ? -1 : 0);
+    }
+  }
+}
+
+// Tests that floating-point compares produce integer masks of matching
+// elements
+TEST_F(NeonHelpersTest, FCompare) {
+  auto ge = [](float x, float y) -> bool { return x >= y; };
+  for (int it = 0; it < ITERATIONS; it++) {
+    randomiseFloat(2);
+    const float* n = operands[0].getAsVector<float>();
+    const float* m = operands[1].getAsVector<float>();
+
+    auto vecs = neonHelp::vecFCompare<float, uint32_t, 4>(operands, false, ge);
+    auto zero = neonHelp::vecFCompare<float, uint32_t, 4>(operands, true, ge);
+    const uint32_t* vecsOut = vecs.getAsVector<uint32_t>();
+    const uint32_t* zeroOut = zero.getAsVector<uint32_t>();
+    for (int i = 0; i < 4; i++) {
+      EXPECT_EQ(vecsOut[i], n[i] >= m[i] ? 0xFFFFFFFFu : 0u);
+      EXPECT_EQ(zeroOut[i], n[i] >= 0.0f ? 0xFFFFFFFFu : 0u);
+    }
+  }
+}
+
+// Tests that element-wise logical operations apply to every element
+TEST_F(NeonHelpersTest, LogicOp) {
+  for (int it = 0; it < ITERATIONS; it++) {
+    randomise(2);
+    const uint32_t* n = operands[0].getAsVector<uint32_t>();
+    const uint32_t* m = operands[1].getAsVector<uint32_t>();
+
+    auto notResult = neonHelp::vecLogicOp_2vecs<uint32_t, 4>(
+        operands, [](uint32_t x) -> uint32_t { return ~x; });
+    auto eorResult = neonHelp::vecLogicOp_3vecs<uint32_t, 4>(
+        operands, [](uint32_t x, uint32_t y) -> uint32_t { return x ^ y; });
+    const uint32_t* notOut = notResult.getAsVector<uint32_t>();
+    const uint32_t* eorOut = eorResult.getAsVector<uint32_t>();
+    for (int i = 0; i < 4; i++) {
+      EXPECT_EQ(notOut[i], ~n[i]);
+      EXPECT_EQ(eorOut[i], n[i] ^ m[i]);
+    }
+  }
+}
+
+// Tests that `xtn` narrows into the lower half and `xtn2` into the upper half,
+// retaining the destination's lower half
+TEST_F(NeonHelpersTest, Xtn) {
+  for (int it = 0; it < ITERATIONS; it++) {
+    randomise(2);
+    const uint16_t* d = operands[0].getAsVector<uint16_t>();
+    const uint32_t* n = operands[1].getAsVector<uint32_t>();
+
+    auto xtn2 = neonHelp::vecXtn<uint16_t, uint32_t, 8>(operands, true);
+    const uint16_t* xtn2Out = xtn2.getAsVector<uint16_t>();
+    for (int i = 0; i < 4; i++) {
+      EXPECT_EQ(xtn2Out[i], d[i]);
+      EXPECT_EQ(xtn2Out[i + 4], static_cast<uint16_t>(n[i]));
+    }
+
+    const uint32_t* n0 = operands[0].getAsVector<uint32_t>();
+    auto xtn = neonHelp::vecXtn<uint16_t, uint32_t, 4>(operands, false);
+    const uint16_t* xtnOut = xtn.getAsVector<uint16_t>();
+    for (int i = 0; i < 8; i++) {
+      EXPECT_EQ(xtnOut[i], i < 4 ? static_cast<uint16_t>(n0[i]) : 0);
+    }
+  }
+}
+
+}  // namespace
@@ -0,0 +1,88 @@
+#include "gtest/gtest.h"
+#include "simeng/PerceptronPredictor.hh"
+
+namespace simeng {
+
+class PerceptronPredictorTest : public testing::Test {
+ public:
+  PerceptronPredictorTest()
+      : config(YAML::Load(
+            "{Branch-Predictor: {BTB-Tag-Bits: 11, Saturating-Count-Bits: 2, "
+            "Global-History-Length: 10, RAS-entries: 5, "
+            "Fallback-Static-Predictor: 1, Type: Perceptron, "
+            "Perceptron-Feature-Tables: 6, Perceptron-Table-Bits: 8, "
+            "Perceptron-Max-History: 32, Perceptron-Local-History: 8}}")) {}
+
+ protected:
+  YAML::Node config;
+};
+
+// Tests that an untrained PerceptronPredictor predicts taken, and uses the
+// supplied target
+TEST_F(PerceptronPredictorTest, Untrained) {
+  auto predictor = simeng::PerceptronPredictor(config);
+  auto prediction = predictor.predict(0, BranchType::Conditional, 0x10);
+  EXPECT_TRUE(prediction.taken);
+  EXPECT_EQ(prediction.target, 0x10);
+}
+
+// Tests that a PerceptronPredictor learns a strongly biased branch
+TEST_F(PerceptronPredictorTest, Biased) {
+  auto predictor = simeng::PerceptronPredictor(config);
+  for (int i = 0; i < 50; i++) {
+    auto prediction = predictor.predict(0x40, BranchType::Conditional, 0);
+    predictor.update(0x40, false, 0x80, BranchType::Conditional, prediction);
+  }
+  auto prediction = predictor.predict(0x40, BranchType::Conditional, 0);
+  EXPECT_FALSE(prediction.taken);
+  EXPECT_EQ(prediction.target, 0x44);
+}
+
+// Tests that a PerceptronPredictor learns a branch whose direction depends on
+// the direction of a preceding branch
+TEST_F(PerceptronPredictorTest, CorrelatedBranches) {
+  auto predictor = simeng::PerceptronPredictor(config);
+  int mispredicts = 0;
+  for (int i = 0; i < 2000; i++) {
+    bool first = ((i * 7) % 3 == 0);
+    auto firstPrediction =
+        predictor.predict(0x100, BranchType::Conditional, 0x20);
+    predictor.update(0x100, first, 0x120, BranchType::Conditional,
+                     firstPrediction);
+
+    auto prediction = predictor.predict(0x200, BranchType::Conditional, 0x20);
+    if (i >= 1800 && prediction.taken != first) mispredicts++;
+    predictor.update(0x200, first, 0x220, BranchType::Conditional, prediction);
+  }
+  EXPECT_EQ(mispredicts, 0);
+}
+
+// Tests that a PerceptronPredictor learns a repeating pattern through its local
+// history, despite unrelated branches interleaved in the global history
+TEST_F(PerceptronPredictorTest, LocalPattern) {
+  auto predictor = simeng::PerceptronPredictor(config);
+  int mispredicts = 0;
+  for (int i = 0; i < 3000; i++) {
+    bool noise = ((i * 2654435761u) >> 7) & 1;
+    auto firstPrediction =
+        predictor.predict(0x100, BranchType::Conditional, 0x20);
+    predictor.update(0x100, noise, 0x120, BranchType::Conditional,
+                     firstPrediction);
+
+    bool taken = (i % 3 != 0);
+    auto prediction = predictor.predict(0x200, BranchType::Conditional, 0x20);
+    if (i >= 2700 && prediction.taken != taken) mispredicts++;
+    predictor.update(0x200, taken, 0x220, BranchType::Conditional, prediction);
+  }
+  EXPECT_EQ(mispredicts, 0);
+}
+
+// Tests that a PerceptronPredictor reports the storage held by its tables
+TEST_F(PerceptronPredictorTest, StorageBits) {
+  auto predictor = simeng::PerceptronPredictor(config);
+  // 6 tables of 256 8-bit weights, 32 global history bits and 256 8-bit local
+  // histories
+  EXPECT_EQ(predictor.getStorageBits(), 6 * 256 * 8 + 32 + 256 * 8);
+}
+
+}  // namespace simeng
@@ -1,4 +1,5 @@
 #include <random>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -59,4 +60,102 @@ TEST(FixedPoolTest, GeneralUsage) {
   }
 }
 
+// Tests that usage statistics track live memory and its high-water mark
+TEST(FixedPoolTest, Usage) {
+  auto p = simeng::fixedPool_<32, 4>();
+  void* ptr = p.allocate();
+  void* ptr2 = p.allocate();
+  p.deallocate(ptr);
+
+  simeng::PoolUsage usage = p.getUsage();
+  EXPECT_EQ(usage.chunkSize, 32);
+  EXPECT_EQ(usage.liveBytes, 32);
+  EXPECT_EQ(usage.highWaterBytes, 64);
+  EXPECT_EQ(usage.reservedBytes, 4 * 32);
+
+  // Memory is only released once no chunks are live
+  EXPECT_FALSE(p.release());
+  p.deallocate(ptr2);
+  EXPECT_TRUE(p.release());
+  EXPECT_EQ(p.getUsage().reservedBytes, 0);
+  EXPECT_NE(p.allocate(), nullptr);
+}
+
+// Tests that chunks returned by another thread are reclaimed by the owner
+TEST(FixedPoolTest, RemoteDeallocate) {
+  auto p = simeng::fixedPool_<16, 2>();
+  void* ptr = p.allocate();
+  void* ptr2 = p.allocate();
+
+  std::thread other([&]() {
+    p.deallocateRemote(ptr);
+    p.deallocateRemote(ptr2);
+  });
+  other.join();
+
+  // The remote chunks are reused before the pool grows
+  void* ptr3 = p.allocate();
+  void* ptr4 = p.allocate();
+  EXPECT_TRUE(ptr3 == ptr || ptr3 == ptr2);
+  EXPECT_TRUE(ptr4 == ptr || ptr4 == ptr2);
+  EXPECT_EQ(p.getUsage().reservedBytes, 2 * 16);
+}
+
+// Tests that each thread is given its own pool, and that memory may be freed
+// by a thread other than the one which allocated it
+TEST(PoolTest, ThreadLocal) {
+  simeng::Pool* mainPool = &simeng::Pool::local();
+  EXPECT_EQ(mainPool, &simeng::Pool::local());
+
+  simeng::Pool* otherPool = nullptr;
+  void* ptr = nullptr;
+  std::thread other([&]() {
+    otherPool = &simeng::Pool::local();
+    ptr = otherPool->allocate(64);
+  });
+  other.join();
+  EXPECT_NE(mainPool, otherPool);
+
+  // The exited thread's pool was abandoned, as its allocation is still live
+  otherPool->deallocate(ptr, 64);
+}
+
+// Tests that 256-byte allocations with a small header are served from the size
+// class above 256 bytes, rather than from 512-byte chunks
+TEST(PoolTest, HeaderSizeClass) {
+  simeng::Pool p;
+  void* ptr = p.allocate(256 + simeng::Pool::MAX_HEADER_BYTES);
+  void* larger = p.allocate(256 + simeng::Pool::MAX_HEADER_BYTES + 1);
+  auto usage = p.getUsage();
+  EXPECT_EQ(usage[4].chunkSize, 256 + simeng::Pool::MAX_HEADER_BYTES);
+  EXPECT_EQ(usage[4].liveBytes, 256 + simeng::Pool::MAX_HEADER_BYTES);
+  EXPECT_EQ(usage[5].chunkSize, 512);
+  EXPECT_EQ(usage[5].liveBytes, 512);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) & (alignof(std::max_align_t) - 1),
+            0);
+
+  p.deallocate(ptr, 256 + simeng::Pool::MAX_HEADER_BYTES);
+  p.deallocate(larger, 256 + simeng::Pool::MAX_HEADER_BYTES + 1);
+  EXPECT_TRUE(p.release());
+}
+
+// Tests that memory may be released between uses of a pool
+TEST(PoolTest, Release) {
+  simeng::Pool p;
+  void* small = p.allocate(100);
+  void* large = p.allocate(1000);
+  EXPECT_EQ(p.getUsage()[2].liveBytes, 128);
+  EXPECT_EQ(p.getUsage().back().liveBytes, 1000);
+  EXPECT_FALSE(p.release());
+
+  p.deallocate(small, 100);
+  p.deallocate(large, 1000);
+  EXPECT_TRUE(p.release());
+  for (const auto& usage : p.getUsage()) {
+    EXPECT_EQ(usage.liveBytes, 0);
+    EXPECT_EQ(usage.reservedBytes, 0);
+  }
+  EXPECT_EQ(p.getUsage()[2].highWaterBytes, 128);
+}
+
 }  // namespace
@@ -1,3 +1,5 @@
+#include <memory>
+
 #include "gtest/gtest.h"
 #include "simeng/RegisterValue.hh"
 
@@ -62,4 +64,91 @@ TEST(RegisterValueTest, Array) {
   EXPECT_EQ(ptr[2], 0);
   EXPECT_EQ(ptr[3], 0);
 }
+
+// Tests that a view reflects changes to the storage it references
+TEST(RegisterValueTest, View) {
+  alignas(8) char storage[32] = {};
+  auto view = simeng::RegisterValue::view(storage, 32);
+  EXPECT_TRUE(view.isView());
+  EXPECT_EQ(view.size(), 32);
+
+  storage[0] = 5;
+  EXPECT_EQ(view.get<uint8_t>(), 5);
+}
+
+// Tests that copying a view materialises the viewed data, while a shallow copy
+// remains a view
+TEST(RegisterValueTest, CopyView) {
+  alignas(8) char storage[32] = {};
+  storage[0] = 1;
+  auto view = simeng::RegisterValue::view(storage, 32);
+
+  simeng::RegisterValue copy = view;
+  auto shallow = simeng::RegisterValue::shallowCopy(view);
+  storage[0] = 2;
+
+  EXPECT_FALSE(copy.isView());
+  EXPECT_EQ(copy.get<uint8_t>(), 1);
+  EXPECT_TRUE(shallow.isView());
+  EXPECT_EQ(shallow.get<uint8_t>(), 2);
+}
+
+// Tests that copies of a pooled value remain valid after the original and
+// other copies are destroyed or reassigned
+TEST(RegisterValueTest, SharedCopies) {
+  uint64_t data[32];
+  for (int i = 0; i < 32; i++) data[i] = i;
+
+  auto copy = std::make_unique<simeng::RegisterValue>();
+  simeng::RegisterValue assigned;
+  {
+    simeng::RegisterValue original(data);
+    *copy = original;
+    assigned = original;
+    assigned = assigned;
+  }
+  simeng::RegisterValue second = *copy;
+  copy.reset();
+  EXPECT_EQ(assigned.size(), 256);
+  EXPECT_EQ(second.getAsVector<uint64_t>()[31], 31);
+
+  assigned = simeng::RegisterValue(7, 8);
+  EXPECT_EQ(assigned.get<uint64_t>(), 7);
+  EXPECT_EQ(second.getAsVector<uint64_t>()[17], 17);
+}
+
+// Tests that the largest vector values, along with their buffer header, are
+// not served from the pool's 512-byte chunks
+TEST(RegisterValueTest, VectorSizeClass) {
+  uint64_t data[32] = {};
+  auto usage = [](size_t chunkSize) {
+    for (const auto& classUsage : simeng::Pool::local().getUsage()) {
+      if (classUsage.chunkSize == chunkSize) return classUsage.liveBytes;
+    }
+    return size_t(0);
+  };
+  size_t live512 = usage(512);
+  size_t liveHeader = usage(256 + simeng::Pool::MAX_HEADER_BYTES);
+  {
+    simeng::RegisterValue value(data);
+    EXPECT_EQ(usage(512), live512);
+    EXPECT_EQ(usage(256 + simeng::Pool::MAX_HEADER_BYTES),
+              liveHeader + 256 + simeng::Pool::MAX_HEADER_BYTES);
+  }
+  EXPECT_EQ(usage(256 + simeng::Pool::MAX_HEADER_BYTES), liveHeader);
+}
+
+// Tests that moving a value transfers its data and leaves the source empty
+TEST(RegisterValueTest, Move) {
+  uint64_t data[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  simeng::RegisterValue source(data);
+  simeng::RegisterValue moved = std::move(source);
+  EXPECT_FALSE(source);
+  EXPECT_EQ(moved.getAsVector<uint64_t>()[7], 8);
+
+  simeng::RegisterValue local(3, 8);
+  moved = std::move(local);
+  EXPECT_FALSE(local);
+  EXPECT_EQ(moved.get<uint64_t>(), 3);
+}
 }  // namespace
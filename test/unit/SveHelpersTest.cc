@@ -0,0 +1,314 @@
+#include <cmath>
+#include <cstring>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "simeng/arch/aarch64/helpers/sve.hh"
+
+namespace {
+
+using simeng::RegisterValue;
+using simeng::arch::aarch64::Instruction;
+using simeng::arch::aarch64::sveHelp;
+
+using Operands = std::array<RegisterValue, Instruction::MAX_SOURCE_REGISTERS>;
+
+/** The number of random operand sets each helper is checked against at each
+ * vector length. */
+constexpr int ITERATIONS = 16;
+
+/** The vector lengths checked, including lengths which are not a power of 2
+ * and so end part way through a predicate word. */
+constexpr uint16_t VECTOR_LENGTHS[] = {128, 256, 384, 512, 1152, 2048};
+
+/** Produce the result of a merging predicated operation one lane at a time,
+ * testing the governing predicate bit of each lane with a branch. */
+template <typename T, typename Op>
+RegisterValue referenceMerge(const uint64_t* p, const T* inactive,
+                             uint16_t VL_bits, Op op) {
+  const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
+  T out[256 / sizeof(T)] = {0};
+  for (int i = 0; i < partition_num; i++) {
+    uint64_t shifted_active = 1ull << ((i % (64 / sizeof(T))) * sizeof(T));
+    if (p[i / (64 / sizeof(T))] & shifted_active)
+      out[i] = op(i);
+    else
+      out[i] = inactive[i];
+  }
+  return {out, 256};
+}
+
+/** Produce the result of an unpredicated operation one lane at a time. */
+template <typename T, typename Op>
+RegisterValue referenceMap(uint16_t VL_bits, Op op) {
+  const uint16_t partition_num = VL_bits / (sizeof(T) * 8);
+  T out[256 / sizeof(T)] = {0};
+  for (int i = 0; i < partition_num; i++) {
+    out[i] = op(i);
+  }
+  return {out, 256};
+}
+
+/** Retrieve a predicate word with only the bits governing lanes of elements
+ * of type T set. */
+template <typename T>
+uint64_t governingBits() {
+  uint64_t bits = 0;
+  for (size_t j = 0; j < 64 / sizeof(T); j++) {
+    bits |= 1ull << (j * sizeof(T));
+  }
+  return bits;
+}
+
+// Checks the shared SVE helper kernels bit-for-bit against per-lane reference
+// implementations, on random operands and predicates at several vector lengths
+class SveHelpersTest : public testing::Test {
+ protected:
+  /** Fill the operands at `indices` with random 2048-bit vectors. */
+  void randomise(std::initializer_list<int> indices) {
+    for (int op : indices) {
+      uint8_t bytes[256];
+      for (int i = 0; i < 256; i++) {
+        bytes[i] = static_cast<uint8_t>(rng());
+      }
+      operands[op] = {bytes, 256};
+    }
+  }
+
+  /** Fill the operand at `index` with a random predicate, in which bits which
+   * do not govern a lane are also set at random. */
+  void randomisePredicate(int index) {
+    uint64_t words[4];
+    for (int i = 0; i < 4; i++) {
+      words[i] = (static_cast<uint64_t>(rng()) << 32) | rng();
+    }
+    operands[index] = {words, 32};
+  }
+
+  /** Fill the operand at `index` with a predicate holding `word` in every
+   * predicate word. */
+  void fillPredicate(int index, uint64_t word) {
+    uint64_t words[4] = {word, word, word, word};
+    operands[index] = {words, 32};
+  }
+
+  /** Check that `actual` is bit-for-bit equal to `expected`. */
+  void expectIdentical(const RegisterValue& actual,
+                       const RegisterValue& expected, uint16_t VL_bits) {
+    ASSERT_EQ(actual.size(), expected.size());
+    EXPECT_EQ(std::memcmp(actual.getAsVector<char>(),
+                          expected.getAsVector<char>(), actual.size()),
+              0)
+        << "VL " << VL_bits;
+  }
+
+  /** Check `sveMergePredicated` with a predicate in operand 0 and the
+   * inactive and active values in operands 1 and 2. */
+  template <typename T>
+  void checkMergePredicated(uint16_t VL_bits) {
+    const uint64_t* p = operands[0].getAsVector<uint64_t>();
+    const T* d = operands[1].getAsVector<T>();
+    const T* n = operands[2].getAsVector<T>();
+    auto op = [&](int i) -> T { return n[i]; };
+    expectIdentical(sveHelp::sveMergePredicated<T>(p, d, VL_bits, op),
+                    referenceMerge<T>(p, d, VL_bits, op), VL_bits);
+  }
+
+  /** Check `sveMergePredicated` for elements of type T at every vector length,
+   * with random predicates, and with predicates whose bits either all or none
+   * of which govern a lane. */
+  template <typename T>
+  void checkLaneMasking() {
+    for (uint16_t VL_bits : VECTOR_LENGTHS) {
+      for (int it = 0; it < ITERATIONS; it++) {
+        randomise({1, 2});
+        randomisePredicate(0);
+        checkMergePredicated<T>(VL_bits);
+      }
+      // Bits between those governing each lane are ignored
+      fillPredicate(0, ~governingBits<T>());
+      checkMergePredicated<T>(VL_bits);
+      RegisterValue none = sveHelp::sveMergePredicated<T>(
+          operands[0].getAsVector<uint64_t>(), operands[1].getAsVector<T>(),
+          VL_bits, [](int i) -> T { return 0; });
+      EXPECT_EQ(std::memcmp(none.getAsVector<char>(),
+                            operands[1].getAsVector<char>(), VL_bits / 8),
+                0)
+          << "VL " << VL_bits;
+
+      fillPredicate(0, governingBits<T>());
+      checkMergePredicated<T>(VL_bits);
+    }
+  }
+
+  Operands operands;
+  std::mt19937 rng{42};
+};
+
+// Tests that each element size selects lanes using only its governing
+// predicate bits, across and part way through predicate words
+TEST_F(SveHelpersTest, MergePredicatedLaneMasking) {
+  checkLaneMasking<uint8_t>();
+  checkLaneMasking<uint16_t>();
+  checkLaneMasking<uint32_t>();
+  checkLaneMasking<uint64_t>();
+}
+
+// Tests that the predicated integer helpers match per-lane computations
+TEST_F(SveHelpersTest, IntegerPredicated) {
+  for (uint16_t VL_bits : VECTOR_LENGTHS) {
+    for (int it = 0; it < ITERATIONS; it++) {
+      randomise({1, 2});
+      randomisePredicate(0);
+      const uint64_t* p = operands[0].getAsVector<uint64_t>();
+
+      const uint8_t* d8 = operands[1].getAsVector<uint8_t>();
+      const uint8_t* m8 = operands[2].getAsVector<uint8_t>();
+      expectIdentical(
+          sveHelp::sveAddPredicated_vecs<uint8_t>(operands, VL_bits),
+          referenceMerge<uint8_t>(p, d8, VL_bits,
+                                  [&](int i) -> uint8_t {
+                                    return d8[i] + m8[i];
+                                  }),
+          VL_bits);
+
+      const int16_t* d16 = operands[1].getAsVector<int16_t>();
+      const int16_t* m16 = operands[2].getAsVector<int16_t>();
+      expectIdentical(
+          sveHelp::sveSubrPredicated_3vecs<int16_t>(operands, VL_bits),
+          referenceMerge<int16_t>(p, d16, VL_bits,
+                                  [&](int i) -> int16_t {
+                                    return m16[i] - d16[i];
+                                  }),
+          VL_bits);
+
+      const uint64_t* d64 = operands[1].getAsVector<uint64_t>();
+      const uint64_t* m64 = operands[2].getAsVector<uint64_t>();
+      auto eor = [](uint64_t x, uint64_t y) -> uint64_t { return x ^ y; };
+      expectIdentical(
+          sveHelp::sveLogicOpPredicated_3vecs<uint64_t>(operands, VL_bits, eor),
+          referenceMerge<uint64_t>(p, d64, VL_bits,
+                                   [&](int i) -> uint64_t {
+                                     return d64[i] ^ m64[i];
+                                   }),
+          VL_bits);
+
+      // `smax` takes its predicate second, and two sources besides the
+      // destination
+      randomise({0, 2, 3});
+      randomisePredicate(1);
+      p = operands[1].getAsVector<uint64_t>();
+      const int32_t* d32 = operands[0].getAsVector<int32_t>();
+      const int32_t* n32 = operands[2].getAsVector<int32_t>();
+      const int32_t* m32 = operands[3].getAsVector<int32_t>();
+      expectIdentical(
+          sveHelp::sveMaxPredicated_vecs<int32_t>(operands, VL_bits),
+          referenceMerge<int32_t>(p, d32, VL_bits,
+                                  [&](int i) -> int32_t {
+                                    return std::max(n32[i], m32[i]);
+                                  }),
+          VL_bits);
+    }
+  }
+}
+
+// Tests that the predicated floating-point helpers match per-lane
+// computations, including on NaN and infinite operands
+TEST_F(SveHelpersTest, FloatingPointPredicated) {
+  for (uint16_t VL_bits : VECTOR_LENGTHS) {
+    for (int it = 0; it < ITERATIONS; it++) {
+      randomise({0, 2});
+      randomisePredicate(1);
+      const uint64_t* p = operands[1].getAsVector<uint64_t>();
+
+      const float* df = operands[0].getAsVector<float>();
+      const float* nf = operands[2].getAsVector<float>();
+      expectIdentical(
+          sveHelp::sveFnegPredicated<float>(operands, VL_bits),
+          referenceMerge<float>(p, df, VL_bits,
+                                [&](int i) -> float { return -nf[i]; }),
+          VL_bits);
+
+      const double* dd = operands[0].getAsVector<double>();
+      const double* nd = operands[2].getAsVector<double>();
+      expectIdentical(
+          sveHelp::sveFsqrtPredicated_2vecs<double>(operands, VL_bits),
+          referenceMerge<double>(p, dd, VL_bits,
+                                 [&](int i) -> double {
+                                   return ::sqrt(nd[i]);
+                                 }),
+          VL_bits);
+    }
+  }
+}
+
+// Tests that `sel` takes active lanes from the first source and inactive lanes
+// from the second
+TEST_F(SveHelpersTest, Sel) {
+  for (uint16_t VL_bits : VECTOR_LENGTHS) {
+    for (int it = 0; it < ITERATIONS; it++) {
+      randomise({1, 2});
+      randomisePredicate(0);
+      const uint64_t* p = operands[0].getAsVector<uint64_t>();
+      const uint16_t* n = operands[1].getAsVector<uint16_t>();
+      const uint16_t* m = operands[2].getAsVector<uint16_t>();
+      expectIdentical(
+          sveHelp::sveSel_zpzz<uint16_t>(operands, VL_bits),
+          referenceMerge<uint16_t>(p, m, VL_bits,
+                                   [&](int i) -> uint16_t { return n[i]; }),
+          VL_bits);
+    }
+  }
+}
+
+// Tests that the unpredicated helpers specialised on the vector length match
+// per-lane computations, and zero the lanes beyond the vector length
+TEST_F(SveHelpersTest, Map) {
+  for (uint16_t VL_bits : VECTOR_LENGTHS) {
+    for (int it = 0; it < ITERATIONS; it++) {
+      randomise({0, 1});
+
+      const uint8_t* n8 = operands[0].getAsVector<uint8_t>();
+      const uint8_t* m8 = operands[1].getAsVector<uint8_t>();
+      expectIdentical(sveHelp::sveAdd_3ops<uint8_t>(operands, VL_bits),
+                      referenceMap<uint8_t>(VL_bits,
+                                            [&](int i) -> uint8_t {
+                                              return n8[i] + m8[i];
+                                            }),
+                      VL_bits);
+
+      const uint32_t* n32 = operands[0].getAsVector<uint32_t>();
+      const uint32_t* m32 = operands[1].getAsVector<uint32_t>();
+      expectIdentical(sveHelp::sveSub_3vecs<uint32_t>(operands, VL_bits),
+                      referenceMap<uint32_t>(VL_bits,
+                                             [&](int i) -> uint32_t {
+                                               return n32[i] - m32[i];
+                                             }),
+                      VL_bits);
+
+      const double* nd = operands[0].getAsVector<double>();
+      const double* md = operands[1].getAsVector<double>();
+      expectIdentical(sveHelp::sveFmul_3ops<double>(operands, VL_bits),
+                      referenceMap<double>(VL_bits,
+                                           [&](int i) -> double {
+                                             return nd[i] * md[i];
+                                           }),
+                      VL_bits);
+    }
+  }
+}
+
+// Tests that a vector length without a specialisation is handled at run time
+TEST_F(SveHelpersTest, UnspecialisedVectorLength) {
+  randomise({1, 2});
+  randomisePredicate(0);
+  checkMergePredicated<uint32_t>(192);
+
+  const uint64_t* n = operands[1].getAsVector<uint64_t>();
+  expectIdentical(
+      sveHelp::sveMap<uint64_t>(192, [&](int i) -> uint64_t { return n[i]; }),
+      referenceMap<uint64_t>(192, [&](int i) -> uint64_t { return n[i]; }),
+      192);
+}
+
+}  // namespace
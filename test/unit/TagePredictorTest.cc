@@ -0,0 +1,129 @@
+#include "gtest/gtest.h"
+#include "simeng/TagePredictor.hh"
+
+namespace simeng {
+
+class TagePredictorTest : public testing::Test {
+ public:
+  TagePredictorTest()
+      : config(YAML::Load(
+            "{Branch-Predictor: {BTB-Tag-Bits: 11, Saturating-Count-Bits: 2, "
+            "Global-History-Length: 10, RAS-entries: 5, "
+            "Fallback-Static-Predictor: 1, Type: TAGE, TAGE-Tagged-Tables: 4, "
+            "TAGE-Table-Bits: 8, TAGE-Tag-Bits: 8, TAGE-Min-History: 2, "
+            "TAGE-Max-History: 32}}")) {}
+
+ protected:
+  YAML::Node config;
+};
+
+// Tests that a TagePredictor falls back to the static prediction on a miss
+TEST_F(TagePredictorTest, Miss) {
+  auto predictor = simeng::TagePredictor(config);
+  auto prediction = predictor.predict(0, BranchType::Conditional, 0);
+  EXPECT_FALSE(prediction.taken);
+  EXPECT_EQ(prediction.target, 4);
+
+  config["Branch-Predictor"]["Fallback-Static-Predictor"] = 2;
+  predictor = simeng::TagePredictor(config);
+  prediction = predictor.predict(0, BranchType::Conditional, 0x10);
+  EXPECT_TRUE(prediction.taken);
+  EXPECT_EQ(prediction.target, 0x10);
+  prediction = predictor.predict(8, BranchType::Unconditional, 0);
+  EXPECT_TRUE(prediction.taken);
+}
+
+// Tests that a TagePredictor learns a history-dependent pattern which a
+// bimodal predictor cannot
+TEST_F(TagePredictorTest, AlternatingPattern) {
+  auto predictor = simeng::TagePredictor(config);
+  int mispredicts = 0;
+  for (int i = 0; i < 1000; i++) {
+    bool taken = (i % 2 == 0);
+    auto prediction = predictor.predict(0x40, BranchType::Conditional, 0x20);
+    if (i >= 900 && prediction.taken != taken) mispredicts++;
+    predictor.update(0x40, taken, 0x60, BranchType::Conditional, prediction);
+  }
+  EXPECT_EQ(mispredicts, 0);
+}
+
+// Tests that a TagePredictor distinguishes a branch whose direction depends on
+// the direction of a preceding branch
+TEST_F(TagePredictorTest, CorrelatedBranches) {
+  auto predictor = simeng::TagePredictor(config);
+  int mispredicts = 0;
+  for (int i = 0; i < 2000; i++) {
+    bool first = ((i * 7) % 3 == 0);
+    auto firstPrediction =
+        predictor.predict(0x100, BranchType::Conditional, 0x20);
+    predictor.update(0x100, first, 0x120, BranchType::Conditional,
+                     firstPrediction);
+
+    auto prediction = predictor.predict(0x200, BranchType::Conditional, 0x20);
+    if (i >= 1800 && prediction.taken != first) mispredicts++;
+    predictor.update(0x200, first, 0x220, BranchType::Conditional, prediction);
+  }
+  EXPECT_EQ(mispredicts, 0);
+}
+
+// Tests that a TagePredictor will predict branch-and-link return pairs
+// correctly
+TEST_F(TagePredictorTest, RAS) {
+  auto predictor = simeng::TagePredictor(config);
+  auto prediction = predictor.predict(8, BranchType::SubroutineCall, 8);
+  EXPECT_TRUE(prediction.taken);
+  EXPECT_EQ(prediction.target, 16);
+  prediction = predictor.predict(24, BranchType::SubroutineCall, 8);
+  EXPECT_EQ(prediction.target, 32);
+
+  prediction = predictor.predict(36, BranchType::Return, 0);
+  EXPECT_TRUE(prediction.taken);
+  EXPECT_EQ(prediction.target, 28);
+
+  // Flushing the return restores its RAS entry
+  predictor.flush(36, BranchType::Return, prediction);
+  prediction = predictor.predict(36, BranchType::Return, 0);
+  EXPECT_EQ(prediction.target, 28);
+  prediction = predictor.predict(20, BranchType::Return, 0);
+  EXPECT_EQ(prediction.target, 12);
+}
+
+// Tests that repairing a TagePredictor after a branch is redirected before
+// execution discards the speculative history and RAS updates of later
+// predictions, and that the branch's later update leaves the repaired state
+TEST_F(TagePredictorTest, Repair) {
+  auto predictor = simeng::TagePredictor(config);
+  auto prediction = predictor.predict(0x100, BranchType::Conditional, 0x20);
+  EXPECT_FALSE(prediction.taken);
+
+  // Predictions down the wrong path
+  predictor.predict(0x200, BranchType::SubroutineCall, 0x40);
+  predictor.predict(0x240, BranchType::Conditional, 0x10);
+
+  predictor.repair(0x100, true, 0x120, BranchType::Conditional, prediction);
+
+  // Only the redirected branch's corrected outcome remains in the history, and
+  // the wrong-path return address has been removed from the RAS
+  auto next = predictor.predict(0x120, BranchType::Conditional, 0x10);
+  EXPECT_EQ(next.historyCheckpoint, prediction.historyCheckpoint + 1);
+  auto ret = predictor.predict(0x130, BranchType::Return, 0);
+  EXPECT_NE(ret.target, 0x204);
+
+  // Updating with the corrected prediction does not repair the history again
+  auto corrected = prediction;
+  corrected.taken = true;
+  corrected.target = 0x120;
+  predictor.update(0x100, true, 0x120, BranchType::Conditional, corrected);
+  next = predictor.predict(0x140, BranchType::Conditional, 0x10);
+  EXPECT_EQ(next.historyCheckpoint, prediction.historyCheckpoint + 3);
+}
+
+// Tests that a TagePredictor reports the storage held by its tables
+TEST_F(TagePredictorTest, StorageBits) {
+  auto predictor = simeng::TagePredictor(config);
+  // 2048 2-bit base counters, 4 tables of 256 14-bit entries, 32 history bits
+  // and a 4-bit alternate selector
+  EXPECT_EQ(predictor.getStorageBits(), 2048 * 2 + 4 * 256 * 14 + 32 + 4);
+}
+
+}  // namespace simeng
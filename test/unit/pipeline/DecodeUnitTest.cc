@@ -10,6 +10,7 @@ namespace simeng {
 namespace pipeline {
 
 using ::testing::_;
+using ::testing::Field;
 using ::testing::Property;
 using ::testing::Return;
 
@@ -29,7 +30,7 @@ class PipelineDecodeUnitTest : public testing::Test {
   PipelineBuffer<std::shared_ptr<Instruction>> output;
   RegisterFileSet registerFileSet;
   MockBranchPredictor predictor;
-  DecodeUnit decodeUnit;
+  DecodeUnit<> decodeUnit;
 
   MockInstruction* uop;
   std::shared_ptr<Instruction> uopPtr;
@@ -62,6 +63,22 @@ TEST_F(PipelineDecodeUnitTest, Tick) {
   EXPECT_EQ(decodeUnit.shouldFlush(), false);
 }
 
+// Tests that a decode unit with a fixed-width output buffer processes a uop
+// correctly
+TEST_F(PipelineDecodeUnitTest, TickFixedWidth) {
+  PipelineBuffer<std::shared_ptr<Instruction>, 1> fixedOutput(1, nullptr);
+  DecodeUnit<1> fixedDecodeUnit(input, fixedOutput, predictor);
+  input.getHeadSlots()[0] = {uopPtr};
+
+  EXPECT_CALL(*uop, checkEarlyBranchMisprediction())
+      .WillOnce(Return(std::tuple<bool, uint64_t>(false, 0)));
+
+  fixedDecodeUnit.tick();
+
+  EXPECT_EQ(fixedOutput.getTailSlots()[0].get(), uop);
+  EXPECT_EQ(fixedDecodeUnit.shouldFlush(), false);
+}
+
 // Tests that the decode unit requests a flush when a non-branch is mispredicted
 TEST_F(PipelineDecodeUnitTest, Flush) {
   input.getHeadSlots()[0] = {uopPtr};
@@ -77,7 +94,7 @@ TEST_F(PipelineDecodeUnitTest, Flush) {
   EXPECT_CALL(*uop, isBranch()).WillOnce(Return(false));
 
   // Check the predictor is updated with the correct instruction address and PC
-  EXPECT_CALL(predictor, update(2, false, 1, BranchType::Unconditional));
+  EXPECT_CALL(predictor, update(2, false, 1, BranchType::Unconditional, _));
 
   decodeUnit.tick();
 
@@ -86,5 +103,91 @@ TEST_F(PipelineDecodeUnitTest, Flush) {
   EXPECT_EQ(decodeUnit.getFlushAddress(), 1);
 }
 
+// Tests that the decode unit repairs the predictor's speculative state when a
+// branch is redirected, and corrects the branch's recorded prediction
+TEST_F(PipelineDecodeUnitTest, FlushBranch) {
+  input.getHeadSlots()[0] = {uopPtr};
+
+  uop->setInstructionAddress(2);
+  BranchPrediction prediction = {false, 6};
+  prediction.historyCheckpoint = 5;
+  uop->setBranchPrediction(prediction);
+
+  ON_CALL(*uop, getBranchType())
+      .WillByDefault(Return(BranchType::Unconditional));
+
+  EXPECT_CALL(*uop, checkEarlyBranchMisprediction())
+      .WillOnce(Return(std::tuple<bool, uint64_t>(true, 8)));
+  EXPECT_CALL(*uop, isBranch()).WillOnce(Return(true));
+
+  // Check the predictor is repaired from the branch's own prediction, without
+  // being trained
+  EXPECT_CALL(predictor,
+              repair(2, true, 8, BranchType::Unconditional,
+                     Field(&BranchPrediction::historyCheckpoint, 5)));
+  EXPECT_CALL(predictor, update(_, _, _, _, _)).Times(0);
+
+  decodeUnit.tick();
+
+  EXPECT_EQ(decodeUnit.shouldFlush(), true);
+  EXPECT_EQ(decodeUnit.getFlushAddress(), 8);
+  EXPECT_TRUE(uop->getBranchPrediction().taken);
+  EXPECT_EQ(uop->getBranchPrediction().target, 8);
+  EXPECT_EQ(uop->getBranchPrediction().historyCheckpoint, 5);
+}
+
+// Tests that the decode unit fuses a uop onto the preceding uop when permitted,
+// and the fused uop reads only the preceding uop's destinations
+TEST_F(PipelineDecodeUnitTest, Fusion) {
+  DecodeUnit<> fusingDecodeUnit(input, output, predictor, true);
+  auto tail = std::make_shared<MockInstruction>();
+  input.getHeadSlots()[0] = {uopPtr, tail};
+
+  std::vector<Register> registers = {{0, 1}};
+  ON_CALL(*uop, getDestinationRegisters())
+      .WillByDefault(Return(span<Register>(registers.data(), 1)));
+  ON_CALL(*tail, getOperandRegisters())
+      .WillByDefault(Return(span<Register>(registers.data(), 1)));
+  ON_CALL(*uop, checkEarlyBranchMisprediction())
+      .WillByDefault(Return(std::tuple<bool, uint64_t>(false, 0)));
+  ON_CALL(*tail, checkEarlyBranchMisprediction())
+      .WillByDefault(Return(std::tuple<bool, uint64_t>(false, 0)));
+  EXPECT_CALL(*uop, canFuseWith(_)).WillOnce(Return(true));
+
+  fusingDecodeUnit.tick();
+
+  // Check the tail is attached to the uop rather than output separately
+  EXPECT_EQ(output.getTailSlots()[0].get(), uop);
+  EXPECT_EQ(uop->getFusedTail(), tail);
+  EXPECT_TRUE(tail->isFusedTail());
+  EXPECT_EQ(fusingDecodeUnit.getFusedPairs(), 1);
+}
+
+// Tests that the decode unit does not fuse a uop reading a register not written
+// by the preceding uop
+TEST_F(PipelineDecodeUnitTest, FusionRequiresDependency) {
+  DecodeUnit<> fusingDecodeUnit(input, output, predictor, true);
+  auto tail = std::make_shared<MockInstruction>();
+  input.getHeadSlots()[0] = {uopPtr, tail};
+
+  std::vector<Register> destinations = {{0, 1}};
+  std::vector<Register> sources = {{0, 2}};
+  ON_CALL(*uop, getDestinationRegisters())
+      .WillByDefault(Return(span<Register>(destinations.data(), 1)));
+  ON_CALL(*tail, getOperandRegisters())
+      .WillByDefault(Return(span<Register>(sources.data(), 1)));
+  ON_CALL(*uop, checkEarlyBranchMisprediction())
+      .WillByDefault(Return(std::tuple<bool, uint64_t>(false, 0)));
+  ON_CALL(*tail, checkEarlyBranchMisprediction())
+      .WillByDefault(Return(std::tuple<bool, uint64_t>(false, 0)));
+  ON_CALL(*uop, canFuseWith(_)).WillByDefault(Return(true));
+
+  fusingDecodeUnit.tick();
+
+  EXPECT_EQ(output.getTailSlots()[0].get(), uop);
+  EXPECT_EQ(uop->getFusedTail(), nullptr);
+  EXPECT_EQ(fusingDecodeUnit.getFusedPairs(), 0);
+}
+
 }  // namespace pipeline
 }  // namespace simeng
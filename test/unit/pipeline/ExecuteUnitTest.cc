@@ -7,6 +7,7 @@
 namespace simeng {
 namespace pipeline {
 
+using ::testing::_;
 using ::testing::AtLeast;
 using ::testing::ElementsAre;
 using ::testing::Invoke;
@@ -27,7 +28,7 @@ class PipelineExecuteUnitTest : public testing::Test {
       : input(1, nullptr),
         output(1, nullptr),
         executeUnit(
-            input, output,
+            input, {&output, 1},
             [this](auto regs, auto values) {
               executionHandlers.forwardOperands(regs, values);
             },
@@ -44,8 +45,8 @@ class PipelineExecuteUnitTest : public testing::Test {
         thirdUopPtr(thirdUop) {}
 
  protected:
-  PipelineBuffer<std::shared_ptr<Instruction>> input;
-  PipelineBuffer<std::shared_ptr<Instruction>> output;
+  PipelineBuffer<std::shared_ptr<Instruction>, 1> input;
+  PipelineBuffer<std::shared_ptr<Instruction>, 1> output;
   MockBranchPredictor predictor;
   MockExecutionHandlers executionHandlers;
 
@@ -119,7 +120,7 @@ TEST_F(PipelineExecuteUnitTest, ExecuteBranch) {
 
   // Check that the branch predictor was updated with the results
   EXPECT_CALL(*uop, getBranchType()).Times(1);
-  EXPECT_CALL(predictor, update(2, taken, pc, BranchType::Unconditional))
+  EXPECT_CALL(predictor, update(2, taken, pc, BranchType::Unconditional, _))
       .Times(1);
 
   // Check that empty forwarding call is made
@@ -235,5 +236,131 @@ TEST_F(PipelineExecuteUnitTest, OperationStall) {
   EXPECT_EQ(output.getTailSlots()[0].get(), thirdUop);
 }
 
+// Test that multiple instructions may complete in the same cycle when enough
+// completion slots are available, in the order they entered the pipeline
+TEST_F(PipelineExecuteUnitTest, MultipleCompletions) {
+  std::vector<PipelineBuffer<std::shared_ptr<Instruction>, 1>> wideOutput(
+      2, {1, nullptr});
+  ExecuteUnit wideUnit(
+      input, {wideOutput.data(), wideOutput.size()},
+      [](auto regs, auto values) {}, [](auto uop) {}, [](auto uop) {},
+      [](auto instruction) {}, predictor, true, {}, 4);
+
+  uop->setLatency(2);
+  ON_CALL(*uop, canExecute()).WillByDefault(Return(true));
+  ON_CALL(*secondUop, canExecute()).WillByDefault(Return(true));
+  EXPECT_CALL(*uop, execute()).Times(1);
+  EXPECT_CALL(*secondUop, execute()).Times(1);
+
+  input.getHeadSlots()[0] = uopPtr;
+  wideUnit.tick();
+  EXPECT_EQ(wideOutput[0].getTailSlots()[0], nullptr);
+
+  input.getHeadSlots()[0] = secondUopPtr;
+  wideUnit.tick();
+  EXPECT_EQ(wideOutput[0].getTailSlots()[0].get(), uop);
+  EXPECT_EQ(wideOutput[1].getTailSlots()[0].get(), secondUop);
+}
+
+// Tests that a load passed to the load handler uses up a completion slot, so
+// that an instruction ready in the same cycle does not complete over it
+TEST_F(PipelineExecuteUnitTest, LoadUsesCompletionSlot) {
+  // Mirror the in-order core, whose load handler writes to the completion slot
+  ExecuteUnit loadUnit(
+      input, {&output, 1}, [](auto regs, auto values) {},
+      [this](auto uop) { output.getTailSlots()[0] = uop; }, [](auto uop) {},
+      [](auto instruction) {}, predictor, true, {}, 4);
+
+  uop->setLatency(2);
+  ON_CALL(*uop, canExecute()).WillByDefault(Return(true));
+  ON_CALL(*uop, isLoad()).WillByDefault(Return(true));
+  ON_CALL(*secondUop, canExecute()).WillByDefault(Return(true));
+  EXPECT_CALL(*uop, generateAddresses()).Times(1);
+  EXPECT_CALL(*secondUop, execute()).Times(1);
+
+  input.getHeadSlots()[0] = uopPtr;
+  loadUnit.tick();
+  EXPECT_EQ(output.getTailSlots()[0], nullptr);
+
+  // Both are ready this cycle, but only the load completes
+  input.getHeadSlots()[0] = secondUopPtr;
+  loadUnit.tick();
+  EXPECT_EQ(output.getTailSlots()[0].get(), uop);
+
+  output.getTailSlots()[0] = nullptr;
+  loadUnit.tick();
+  EXPECT_EQ(output.getTailSlots()[0].get(), secondUop);
+}
+
+// Tests that a load and an instruction ready in the same cycle both complete
+// in that cycle when enough completion slots are available
+TEST_F(PipelineExecuteUnitTest, LoadCompletesAlongsideInstruction) {
+  std::vector<PipelineBuffer<std::shared_ptr<Instruction>, 1>> wideOutput(
+      2, {1, nullptr});
+  std::vector<std::shared_ptr<Instruction>> loads;
+  ExecuteUnit wideUnit(
+      input, {wideOutput.data(), wideOutput.size()},
+      [](auto regs, auto values) {},
+      [&loads](auto uop) { loads.push_back(uop); }, [](auto uop) {},
+      [](auto instruction) {}, predictor, true, {}, 4);
+
+  uop->setLatency(2);
+  ON_CALL(*uop, canExecute()).WillByDefault(Return(true));
+  ON_CALL(*uop, isLoad()).WillByDefault(Return(true));
+  ON_CALL(*secondUop, canExecute()).WillByDefault(Return(true));
+  EXPECT_CALL(*secondUop, execute()).Times(1);
+
+  input.getHeadSlots()[0] = uopPtr;
+  wideUnit.tick();
+  input.getHeadSlots()[0] = secondUopPtr;
+  wideUnit.tick();
+
+  ASSERT_EQ(loads.size(), 1);
+  EXPECT_EQ(loads[0].get(), uop);
+  EXPECT_EQ(wideOutput[0].getTailSlots()[0].get(), secondUop);
+}
+
+// Tests that the execution unit executes a fused tail immediately after the
+// uop it is fused onto, supplying it with that uop's results
+TEST_F(PipelineExecuteUnitTest, ExecuteFusedTail) {
+  input.getHeadSlots()[0] = uopPtr;
+  uopPtr->setFusedTail(secondUopPtr);
+
+  std::vector<Register> registers = {{0, 1}};
+  std::vector<RegisterValue> values = {RegisterValue(1, 4)};
+  std::vector<Register> tailRegisters = {{0, 2}};
+  std::vector<RegisterValue> tailValues = {RegisterValue(2, 4)};
+  ON_CALL(*uop, canExecute()).WillByDefault(Return(true));
+  ON_CALL(*uop, getDestinationRegisters())
+      .WillByDefault(Return(span<Register>(registers.data(), 1)));
+  ON_CALL(*uop, getResults())
+      .WillByDefault(Return(span<RegisterValue>(values.data(), 1)));
+  ON_CALL(*secondUop, getOperandRegisters())
+      .WillByDefault(Return(span<Register>(registers.data(), 1)));
+  ON_CALL(*secondUop, getDestinationRegisters())
+      .WillByDefault(Return(span<Register>(tailRegisters.data(), 1)));
+  ON_CALL(*secondUop, getResults())
+      .WillByDefault(Return(span<RegisterValue>(tailValues.data(), 1)));
+
+  // Expect the tail to execute with the uop's result
+  EXPECT_CALL(*uop, execute()).Times(1);
+  EXPECT_CALL(*secondUop,
+              supplyOperand(0, Property(&RegisterValue::get<uint32_t>, 1)))
+      .Times(1);
+  EXPECT_CALL(*secondUop, execute()).Times(1);
+
+  // Check that both instructions' results are forwarded
+  EXPECT_CALL(executionHandlers, forwardOperands(ElementsAre(registers[0]), _))
+      .Times(1);
+  EXPECT_CALL(executionHandlers,
+              forwardOperands(ElementsAre(tailRegisters[0]), _))
+      .Times(1);
+
+  executeUnit.tick();
+
+  // Only the uop occupies the output slot
+  EXPECT_EQ(output.getTailSlots()[0].get(), uop);
+}
+
 }  // namespace pipeline
 }  // namespace simeng
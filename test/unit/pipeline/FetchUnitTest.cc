@@ -107,5 +107,154 @@ TEST_F(PipelineFetchUnitTest, FetchUnaligned) {
   fetchUnit.tick();
 }
 
+// Tests that a decoupled fetch unit requests the blocks queued in its fetch
+// target queue ahead of fetch, and fetches from the head of the queue.
+TEST_F(PipelineFetchUnitTest, DecoupledPrefetch) {
+  MacroOp macroOp = {uopPtr};
+  ON_CALL(isa, getMaxInstructionSize()).WillByDefault(Return(4));
+
+  // Expect the entry block to be requested on construction, and the following
+  // sequential blocks each time more are requested
+  EXPECT_CALL(memory, requestRead(Field(&MemoryAccessTarget::address, 0), _))
+      .Times(1);
+  FetchUnit decoupled(output, memory, 1024, 0, 16, isa, predictor, 4);
+  EXPECT_CALL(memory, requestRead(Field(&MemoryAccessTarget::address, 16), _))
+      .Times(1);
+  decoupled.requestFromPC();
+  EXPECT_CALL(memory, requestRead(Field(&MemoryAccessTarget::address, 32), _))
+      .Times(1);
+  decoupled.requestFromPC();
+
+  // Supply the entry block, expecting decoding to begin
+  EXPECT_CALL(memory, getCompletedReads()).WillOnce(Return(completedReads));
+  EXPECT_CALL(isa, predecode(_, _, 0, _))
+      .WillOnce(DoAll(SetArgReferee<3>(macroOp), Return(4)));
+  decoupled.tick();
+
+  EXPECT_EQ(output.getTailSlots()[0].size(), 1);
+  EXPECT_EQ(decoupled.getTargetQueueResteers(), 0);
+}
+
+// Tests that a decoupled fetch unit resteers its fetch target queue when a
+// predicted taken branch leaves the queued path, and then follows the branch
+// once it is recorded in the fetch target buffer.
+TEST_F(PipelineFetchUnitTest, DecoupledResteer) {
+  MacroOp macroOp = {uopPtr};
+  ON_CALL(isa, getMaxInstructionSize()).WillByDefault(Return(4));
+  ON_CALL(*uop, isBranch()).WillByDefault(Return(true));
+
+  EXPECT_CALL(memory, requestRead(Field(&MemoryAccessTarget::address, 0), _))
+      .Times(1);
+  FetchUnit decoupled(output, memory, 1024, 0, 16, isa, predictor, 4);
+  EXPECT_CALL(memory, requestRead(Field(&MemoryAccessTarget::address, 16), _))
+      .Times(1);
+  decoupled.requestFromPC();
+
+  // Fetch a branch at address 0, predicted taken to address 64
+  EXPECT_CALL(memory, getCompletedReads()).WillOnce(Return(completedReads));
+  EXPECT_CALL(isa, predecode(_, _, 0, _))
+      .WillOnce(DoAll(SetArgReferee<3>(macroOp), Return(4)));
+  EXPECT_CALL(predictor, predict(0, _, _))
+      .WillOnce(Return(BranchPrediction({true, 64})));
+  decoupled.tick();
+
+  // The queued sequential block no longer matches the fetch path
+  output.tick();
+  EXPECT_CALL(memory, getCompletedReads())
+      .WillOnce(Return(span<MemoryReadResult>()));
+  EXPECT_CALL(isa, predecode(_, _, _, _)).Times(0);
+  decoupled.tick();
+  EXPECT_EQ(decoupled.getTargetQueueResteers(), 1);
+
+  // Expect the branch target to be requested next
+  EXPECT_CALL(memory, requestRead(Field(&MemoryAccessTarget::address, 64), _))
+      .Times(1);
+  decoupled.requestFromPC();
+
+  // Returning to the branch, expect its target to be queued after its block
+  // from the fetch target buffer, rather than the sequential block
+  decoupled.updatePC(0);
+  EXPECT_CALL(memory, requestRead(Field(&MemoryAccessTarget::address, 0), _))
+      .Times(1);
+  decoupled.requestFromPC();
+  EXPECT_CALL(memory, requestRead(Field(&MemoryAccessTarget::address, 64), _))
+      .Times(1);
+  decoupled.requestFromPC();
+}
+
+// Tests that a filled loop buffer supplies new instances of the macro-ops it
+// recorded, without pre-decoding them again.
+TEST_F(PipelineFetchUnitTest, LoopBufferSupply) {
+  MacroOp macroOp = {uopPtr};
+  ON_CALL(isa, getMaxInstructionSize()).WillByDefault(Return(4));
+  ON_CALL(memory, getCompletedReads()).WillByDefault(Return(completedReads));
+  ON_CALL(*uop, isBranch()).WillByDefault(Return(true));
+
+  // A single instruction loop; a branch at address 0 predicted taken to itself
+  fetchUnit.registerLoopBoundary(0);
+  EXPECT_CALL(isa, predecode(_, _, 0, _))
+      .Times(2)
+      .WillRepeatedly(DoAll(SetArgReferee<3>(macroOp), Return(4)));
+  EXPECT_CALL(predictor, predict(0, _, _))
+      .Times(2)
+      .WillRepeatedly(Return(BranchPrediction({true, 0})));
+
+  // The first fetch of the branch begins filling, and the second records the
+  // loop body
+  auto recorded = std::make_shared<MockInstruction>();
+  EXPECT_CALL(*uop, clone()).WillOnce(Return(recorded));
+  fetchUnit.tick();
+  fetchUnit.tick();
+
+  // Expect the recorded macro-op to be supplied, rather than pre-decoded
+  auto supplied = std::make_shared<MockInstruction>();
+  EXPECT_CALL(*recorded, clone()).WillOnce(Return(supplied));
+  fetchUnit.tick();
+
+  ASSERT_EQ(output.getTailSlots()[0].size(), 1);
+  EXPECT_EQ(output.getTailSlots()[0][0], supplied);
+}
+
+// Tests that macro-ops pre-decoded from instruction memory are recorded in the
+// micro-op cache, and later supplied from it without pre-decoding after the
+// switch penalty.
+TEST_F(PipelineFetchUnitTest, MicroOpCacheHit) {
+  MacroOp macroOp = {uopPtr};
+  ON_CALL(isa, getMaxInstructionSize()).WillByDefault(Return(4));
+  ON_CALL(memory, getCompletedReads()).WillByDefault(Return(completedReads));
+  ON_CALL(*uop, isBranch()).WillByDefault(Return(true));
+
+  FetchUnit cached(output, memory, 1024, 0, 16, isa, predictor, 0, 1024, 4, 4,
+                   2, 6, 1, 1);
+
+  // A single instruction loop; a branch at address 0 predicted taken to itself
+  EXPECT_CALL(isa, predecode(_, _, 0, _))
+      .WillOnce(DoAll(SetArgReferee<3>(macroOp), Return(4)));
+  EXPECT_CALL(predictor, predict(0, _, _))
+      .Times(2)
+      .WillRepeatedly(Return(BranchPrediction({true, 0})));
+
+  // Pre-decode the branch, expecting it to be recorded
+  auto recorded = std::make_shared<MockInstruction>();
+  EXPECT_CALL(*uop, clone()).WillOnce(Return(recorded));
+  cached.tick();
+  EXPECT_EQ(cached.getMicroOpCacheMisses(), 1);
+
+  // Expect the switch to the micro-op cache to cost a cycle
+  cached.tick();
+  EXPECT_EQ(output.getTailSlots()[0][0], uopPtr);
+  EXPECT_EQ(cached.getMicroOpCacheSwitches(), 1);
+
+  // Expect the recorded macro-op to be supplied, rather than pre-decoded
+  auto supplied = std::make_shared<MockInstruction>();
+  ON_CALL(*supplied, isBranch()).WillByDefault(Return(true));
+  EXPECT_CALL(*recorded, clone()).WillOnce(Return(supplied));
+  cached.tick();
+
+  ASSERT_EQ(output.getTailSlots()[0].size(), 1);
+  EXPECT_EQ(output.getTailSlots()[0][0], supplied);
+  EXPECT_EQ(cached.getMicroOpCacheHits(), 1);
+}
+
 }  // namespace pipeline
 }  // namespace simeng
@@ -7,8 +7,10 @@
 
 using ::testing::_;
 using ::testing::AtLeast;
+using ::testing::Invoke;
 using ::testing::Property;
 using ::testing::Return;
+using ::testing::SaveArg;
 
 namespace simeng {
 namespace pipeline {
@@ -105,7 +107,7 @@ class LoadStoreQueueTest : public ::testing::TestWithParam<bool> {
     return queue.commitStore(storeUopPtr);
   }
 
-  std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>>>
+  std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>, 1>>
       completionSlots;
 
   std::vector<MemoryAccessTarget> addresses;
@@ -225,7 +227,7 @@ TEST_P(LoadStoreQueueTest, Load) {
   loadUop->setSequenceId(1);
   auto queue = getQueue();
 
-  MemoryReadResult completedRead = {addresses[0], data[0], 1};
+  MemoryReadResult completedRead = {addresses[0], data[0], 0};
   span<MemoryReadResult> completedReads = {&completedRead, 1};
 
   EXPECT_CALL(*loadUop, getGeneratedAddresses()).Times(AtLeast(1));
@@ -234,8 +236,10 @@ TEST_P(LoadStoreQueueTest, Load) {
 
   queue.addLoad(loadUopPtr);
 
-  // Check that a read request is made to the memory interface
-  EXPECT_CALL(dataMemory, requestRead(addresses[0], _)).Times(1);
+  // Check that a read request is made to the memory interface, and complete it
+  // with the request ID given
+  EXPECT_CALL(dataMemory, requestRead(addresses[0], _))
+      .WillOnce(SaveArg<1>(&completedRead.requestId));
 
   // Expect a check against finished reads and return the result
   EXPECT_CALL(dataMemory, getCompletedReads())
@@ -243,9 +247,11 @@ TEST_P(LoadStoreQueueTest, Load) {
 
   // Check that the LSQ supplies the right data to the instruction
   // TODO: Replace with check for call over memory interface in future?
-  EXPECT_CALL(*loadUop,
-              supplyData(0, Property(&RegisterValue::get<uint8_t>, data[0])))
-      .Times(1);
+  EXPECT_CALL(*loadUop, supplyDataBlock(0, _))
+      .WillOnce(Invoke([&](size_t, span<const RegisterValue> supplied) {
+        ASSERT_EQ(supplied.size(), 1);
+        EXPECT_EQ(supplied[0].get<uint8_t>(), data[0].get<uint8_t>());
+      }));
 
   queue.startLoad(loadUopPtr);
 
@@ -253,6 +259,54 @@ TEST_P(LoadStoreQueueTest, Load) {
   queue.tick();
 }
 
+// Tests that a queue places the data of a load accessing multiple addresses by
+// access index, supplying reads to consecutive accesses as a single block
+TEST_P(LoadStoreQueueTest, LoadMultiple) {
+  loadUop->setSequenceId(1);
+  auto queue = getQueue();
+
+  std::vector<MemoryAccessTarget> loadAddresses = {{0, 1}, {1, 1}, {2, 1}};
+  ON_CALL(*loadUop, getGeneratedAddresses())
+      .WillByDefault(Return(span<const MemoryAccessTarget>(
+          loadAddresses.data(), loadAddresses.size())));
+  loadUop->setDataPending(loadAddresses.size());
+
+  // Complete the reads with the request IDs given, the last access first
+  std::vector<MemoryReadResult> completedReads(loadAddresses.size());
+  for (size_t i = 0; i < loadAddresses.size(); i++) {
+    completedReads[(i + 1) % loadAddresses.size()] = {
+        loadAddresses[i], RegisterValue(static_cast<uint8_t>(i + 1)), 0};
+    EXPECT_CALL(dataMemory, requestRead(loadAddresses[i], _))
+        .WillOnce(
+            SaveArg<1>(&completedReads[(i + 1) % loadAddresses.size()]
+                            .requestId));
+  }
+  EXPECT_CALL(dataMemory, getCompletedReads())
+      .WillRepeatedly(Return(span<MemoryReadResult>(completedReads.data(),
+                                                    completedReads.size())));
+
+  // Check that the last access is supplied alone, followed by the first two as
+  // one block
+  std::vector<uint8_t> supplied(loadAddresses.size());
+  EXPECT_CALL(*loadUop, supplyDataBlock(2, _))
+      .WillOnce(Invoke([&](size_t, span<const RegisterValue> block) {
+        ASSERT_EQ(block.size(), 1);
+        supplied[2] = block[0].get<uint8_t>();
+      }));
+  EXPECT_CALL(*loadUop, supplyDataBlock(0, _))
+      .WillOnce(Invoke([&](size_t, span<const RegisterValue> block) {
+        ASSERT_EQ(block.size(), 2);
+        supplied[0] = block[0].get<uint8_t>();
+        supplied[1] = block[1].get<uint8_t>();
+      }));
+
+  queue.addLoad(loadUopPtr);
+  queue.startLoad(loadUopPtr);
+  queue.tick();
+
+  EXPECT_EQ(supplied, std::vector<uint8_t>({1, 2, 3}));
+}
+
 // Tests that a queue can commit a load
 TEST_P(LoadStoreQueueTest, CommitLoad) {
   auto queue = getQueue();
@@ -62,5 +62,20 @@ TEST_P(PipelineBufferTest, Fill) {
 INSTANTIATE_TEST_SUITE_P(PipelineBufferTests, PipelineBufferTest,
                          ::testing::Range<size_t>(1, 9, 1));
 
+// Test that a fixed-width buffer reports its width and moves values when ticked
+TEST(FixedWidthPipelineBufferTest, Tick) {
+  auto pipelineBuffer = PipelineBuffer<int, 2>(2, 0);
+  EXPECT_EQ(pipelineBuffer.getWidth(), 2);
+
+  pipelineBuffer.getTailSlots()[0] = 1;
+  pipelineBuffer.getTailSlots()[1] = 2;
+  pipelineBuffer.tick();
+
+  EXPECT_EQ(pipelineBuffer.getHeadSlots()[0], 1);
+  EXPECT_EQ(pipelineBuffer.getHeadSlots()[1], 2);
+  EXPECT_EQ(pipelineBuffer.getTailSlots()[0], 0);
+  EXPECT_EQ(pipelineBuffer.getTailSlots()[1], 0);
+}
+
 }  // namespace pipeline
 }  // namespace simeng
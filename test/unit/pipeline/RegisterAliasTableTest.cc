@@ -93,5 +93,172 @@ TEST_F(RegisterAliasTableTest, Rewind) {
   EXPECT_EQ(rat.freeRegistersAvailable(0), initialFreeRegisters);
 }
 
+// Tests that checkpointing is disabled unless requested at construction
+TEST_F(RegisterAliasTableTest, CheckpointsDisabled) {
+  EXPECT_FALSE(rat.checkpointsEnabled());
+  EXPECT_FALSE(rat.canCheckpoint());
+}
+
+// Tests that restoring a checkpoint reinstates the mappings at the time it was
+// taken and frees all registers allocated since
+TEST_F(RegisterAliasTableTest, RestoreCheckpoint) {
+  auto checkpointRAT =
+      RegisterAliasTable({{8, architecturalCount}}, {physicalCount}, 2);
+  EXPECT_TRUE(checkpointRAT.canCheckpoint());
+
+  auto checkpointedMapping = checkpointRAT.allocate(reg);
+  auto freeRegisters = checkpointRAT.freeRegistersAvailable(0);
+  checkpointRAT.checkpoint(0);
+  EXPECT_EQ(checkpointRAT.getCheckpointCount(), 1);
+
+  checkpointRAT.allocate(reg);
+  checkpointRAT.allocate({0, 1});
+  EXPECT_EQ(checkpointRAT.freeRegistersAvailable(0), freeRegisters - 2);
+
+  EXPECT_TRUE(checkpointRAT.restoreCheckpoint(0));
+  EXPECT_EQ(checkpointRAT.getMapping(reg), checkpointedMapping);
+  EXPECT_EQ(checkpointRAT.getMapping({0, 1}), Register({0, 1}));
+  EXPECT_EQ(checkpointRAT.freeRegistersAvailable(0), freeRegisters);
+  EXPECT_EQ(checkpointRAT.getCheckpointCount(), 0);
+}
+
+// Tests that restoring a checkpoint discards any younger checkpoints, and that
+// restoring an unknown checkpoint leaves older checkpoints intact
+TEST_F(RegisterAliasTableTest, RestoreDiscardsYounger) {
+  auto checkpointRAT =
+      RegisterAliasTable({{8, architecturalCount}}, {physicalCount}, 4);
+  auto initialFreeRegisters = checkpointRAT.freeRegistersAvailable(0);
+  auto oldMapping = checkpointRAT.getMapping(reg);
+
+  checkpointRAT.checkpoint(1);
+  checkpointRAT.allocate(reg);
+  checkpointRAT.checkpoint(3);
+  checkpointRAT.allocate(reg);
+  checkpointRAT.checkpoint(5);
+
+  // No checkpoint exists for instruction 4; only the younger one is discarded
+  EXPECT_FALSE(checkpointRAT.restoreCheckpoint(4));
+  EXPECT_EQ(checkpointRAT.getCheckpointCount(), 2);
+
+  EXPECT_TRUE(checkpointRAT.restoreCheckpoint(1));
+  EXPECT_EQ(checkpointRAT.getCheckpointCount(), 0);
+  EXPECT_EQ(checkpointRAT.getMapping(reg), oldMapping);
+  EXPECT_EQ(checkpointRAT.freeRegistersAvailable(0), initialFreeRegisters);
+}
+
+// Tests that registers individually rewound before a checkpoint is restored
+// are not freed twice
+TEST_F(RegisterAliasTableTest, RestoreAfterRewind) {
+  auto checkpointRAT =
+      RegisterAliasTable({{8, architecturalCount}}, {physicalCount}, 2);
+  auto initialFreeRegisters = checkpointRAT.freeRegistersAvailable(0);
+
+  checkpointRAT.checkpoint(0);
+  checkpointRAT.allocate(reg);
+  auto mapping = checkpointRAT.allocate(reg);
+  checkpointRAT.rewind(mapping);
+
+  EXPECT_TRUE(checkpointRAT.restoreCheckpoint(0));
+  EXPECT_EQ(checkpointRAT.freeRegistersAvailable(0), initialFreeRegisters);
+}
+
+// Tests that checkpoints can no longer be taken once all are in use, and that
+// releasing committed checkpoints makes them available again
+TEST_F(RegisterAliasTableTest, ReleaseCheckpoints) {
+  auto checkpointRAT =
+      RegisterAliasTable({{8, architecturalCount}}, {physicalCount}, 2);
+  checkpointRAT.checkpoint(0);
+  checkpointRAT.checkpoint(2);
+  EXPECT_FALSE(checkpointRAT.canCheckpoint());
+
+  checkpointRAT.releaseCheckpoints(1);
+  EXPECT_TRUE(checkpointRAT.canCheckpoint());
+  EXPECT_EQ(checkpointRAT.getCheckpointCount(), 1);
+
+  checkpointRAT.checkpoint(4);
+  checkpointRAT.releaseCheckpoints(4);
+  EXPECT_EQ(checkpointRAT.getCheckpointCount(), 0);
+}
+
+// Tests that enabling elimination reserves a zero register outside of the free
+// list
+TEST_F(RegisterAliasTableTest, ZeroRegisterReserved) {
+  EXPECT_FALSE(rat.canEliminate(0));
+
+  auto eliminatingRAT =
+      RegisterAliasTable({{8, architecturalCount}}, {physicalCount}, 0, true);
+  EXPECT_TRUE(eliminatingRAT.canEliminate(0));
+  EXPECT_EQ(eliminatingRAT.freeRegistersAvailable(0),
+            physicalCount - architecturalCount - 1);
+  EXPECT_EQ(eliminatingRAT.getZeroRegister(0), Register({0, 63}));
+  EXPECT_TRUE(eliminatingRAT.isShared(eliminatingRAT.getZeroRegister(0)));
+}
+
+// Tests that a physical register shared by an eliminated move is only freed
+// once both of its architectural names have been overwritten and committed
+TEST_F(RegisterAliasTableTest, CommitEliminated) {
+  auto eliminatingRAT =
+      RegisterAliasTable({{8, architecturalCount}}, {physicalCount}, 0, true);
+  auto initialFreeRegisters = eliminatingRAT.freeRegistersAvailable(0);
+
+  // mov r1, r0
+  auto shared = eliminatingRAT.getMapping(reg);
+  eliminatingRAT.eliminate({0, 1}, shared);
+  EXPECT_EQ(eliminatingRAT.getMapping({0, 1}), shared);
+  EXPECT_TRUE(eliminatingRAT.isShared(shared));
+  eliminatingRAT.commitEliminated();
+  EXPECT_EQ(eliminatingRAT.freeRegistersAvailable(0), initialFreeRegisters + 1);
+
+  // Overwrite r0; the shared register is still referenced by r1
+  eliminatingRAT.commit(eliminatingRAT.allocate(reg));
+  EXPECT_FALSE(eliminatingRAT.isShared(shared));
+  EXPECT_EQ(eliminatingRAT.freeRegistersAvailable(0), initialFreeRegisters);
+
+  // Overwrite r1; the shared register is now free
+  eliminatingRAT.commit(eliminatingRAT.allocate({0, 1}));
+  EXPECT_EQ(eliminatingRAT.freeRegistersAvailable(0), initialFreeRegisters);
+}
+
+// Tests that rewinding an eliminated mapping reinstates the former mapping
+// without freeing the shared register
+TEST_F(RegisterAliasTableTest, RewindEliminated) {
+  auto eliminatingRAT =
+      RegisterAliasTable({{8, architecturalCount}}, {physicalCount}, 0, true);
+  auto initialFreeRegisters = eliminatingRAT.freeRegistersAvailable(0);
+  auto oldMapping = eliminatingRAT.getMapping({0, 1});
+
+  eliminatingRAT.eliminate({0, 1}, eliminatingRAT.getZeroRegister(0));
+  EXPECT_EQ(eliminatingRAT.getMapping({0, 1}),
+            eliminatingRAT.getZeroRegister(0));
+  eliminatingRAT.rewindEliminated();
+
+  EXPECT_EQ(eliminatingRAT.getMapping({0, 1}), oldMapping);
+  EXPECT_FALSE(eliminatingRAT.isShared(oldMapping));
+  EXPECT_EQ(eliminatingRAT.freeRegistersAvailable(0), initialFreeRegisters);
+}
+
+// Tests that restoring a checkpoint also undoes mappings eliminated since it
+// was taken, including those sharing registers allocated since
+TEST_F(RegisterAliasTableTest, RestoreEliminated) {
+  auto eliminatingRAT =
+      RegisterAliasTable({{8, architecturalCount}}, {physicalCount}, 2, true);
+  auto initialFreeRegisters = eliminatingRAT.freeRegistersAvailable(0);
+
+  eliminatingRAT.checkpoint(0);
+  auto allocated = eliminatingRAT.allocate(reg);
+  eliminatingRAT.eliminate({0, 1}, allocated);
+  eliminatingRAT.eliminate({0, 2}, eliminatingRAT.getMapping({0, 3}));
+
+  EXPECT_TRUE(eliminatingRAT.restoreCheckpoint(0));
+  EXPECT_EQ(eliminatingRAT.getMapping({0, 1}), Register({0, 1}));
+  EXPECT_EQ(eliminatingRAT.getMapping({0, 2}), Register({0, 2}));
+  EXPECT_FALSE(eliminatingRAT.isShared({0, 3}));
+  EXPECT_EQ(eliminatingRAT.freeRegistersAvailable(0), initialFreeRegisters);
+
+  // A reallocated register is referenced once
+  auto reallocated = eliminatingRAT.allocate(reg);
+  EXPECT_FALSE(eliminatingRAT.isShared(reallocated));
+}
+
 }  // namespace pipeline
 }  // namespace simeng
@@ -25,7 +25,7 @@ class PipelineWritebackUnitTest : public testing::Test {
         writebackUnit(input, registerFileSet, [](auto insnId) {}) {}
 
  protected:
-  std::vector<PipelineBuffer<std::shared_ptr<Instruction>>> input;
+  std::vector<PipelineBuffer<std::shared_ptr<Instruction>, 1>> input;
   RegisterFileSet registerFileSet;
 
   MockInstruction* uop;